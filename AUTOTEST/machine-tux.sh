@@ -123,6 +123,10 @@ RO="-ij -sstruct -struct -lobpcg -rt -D HYPRE_NO_SAVED -nthreads 2"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $RO
 ./renametest.sh basic $output_dir/basic--with-concurrent-hopscotch
 
+co="--enable-persistent --enable-debug"
+./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: $ro
+./renametest.sh basic $output_dir/basic--enable-persistent
+
 co="--enable-single --enable-debug"
 ./test.sh basic.sh $src_dir -co: $co -mo: $mo -ro: -single
 ./renametest.sh basic $output_dir/basic--enable-single
@@ -181,6 +185,10 @@ co="-DHYPRE_BIGINT=ON"
 ./test.sh cmake.sh $root_dir -co: $co -mo: $mo -ro: $ro
 ./renametest.sh cmake $output_dir/cmake-bigint
 
+co="-DHYPRE_ENABLE_PERSISTENT_COMM=ON"
+./test.sh cmake.sh $root_dir -co: $co -mo: $mo -ro: $ro
+./renametest.sh cmake $output_dir/cmake-persistent
+
 # cmake build doesn't currently support maxdim
 # cmake build doesn't currently support complex
 
@@ -41,6 +41,7 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixObject(ijmatrix)         = NULL;
    hypre_IJMatrixTranslator(ijmatrix)     = NULL;
    hypre_IJMatrixAssumedPart(ijmatrix)    = NULL;
+   hypre_IJMatrixFrozenPattern(ijmatrix)  = NULL;
    hypre_IJMatrixObjectType(ijmatrix)     = HYPRE_UNITIALIZED;
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
@@ -152,6 +153,7 @@ HYPRE_IJMatrixPartialClone( HYPRE_IJMatrix  matrix_in,
    hypre_IJMatrixObject(ijmatrix_out)             = NULL;
    hypre_IJMatrixTranslator(ijmatrix_out)         = NULL;
    hypre_IJMatrixAssumedPart(ijmatrix_out)        = NULL;
+   hypre_IJMatrixFrozenPattern(ijmatrix_out)      = NULL;
    hypre_IJMatrixObjectType(ijmatrix_out)         = hypre_IJMatrixObjectType(ijmatrix_in);
    hypre_IJMatrixAssembleFlag(ijmatrix_out)       = 0;
    hypre_IJMatrixPrintLevel(ijmatrix_out)         = hypre_IJMatrixPrintLevel(ijmatrix_in);
@@ -190,6 +192,10 @@ HYPRE_IJMatrixDestroy( HYPRE_IJMatrix matrix )
       {
          hypre_AssumedPartitionDestroy((hypre_IJAssumedPart*)hypre_IJMatrixAssumedPart(ijmatrix));
       }
+      if (hypre_IJMatrixFrozenPattern(ijmatrix))
+      {
+         hypre_IJMatrixFrozenPatternDestroy(ijmatrix);
+      }
       if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
       {
          hypre_IJMatrixDestroyParCSR( ijmatrix );
@@ -769,6 +775,174 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAdoptCSR( HYPRE_IJMatrix  matrix,
+                        HYPRE_Int      *row_ptr,
+                        HYPRE_BigInt   *cols,
+                        HYPRE_Complex  *values,
+                        HYPRE_Int       owns_data )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+   HYPRE_BigInt   *row_partitioning;
+   HYPRE_Int       num_rows;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!row_ptr)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   row_partitioning = hypre_IJMatrixRowPartitioning(ijmatrix);
+   num_rows = (HYPRE_Int)(row_partitioning[1] - row_partitioning[0]);
+
+   if (row_ptr[num_rows] > row_ptr[0] && !cols)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (row_ptr[num_rows] > row_ptr[0] && !values)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (hypre_IJMatrixObject(ijmatrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matrix must not be initialized before adopting CSR arrays");
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
+   {
+      hypre_IJMatrixAdoptCSRParCSR(ijmatrix, row_ptr, cols, values, owns_data);
+   }
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixFreezePattern( HYPRE_IJMatrix      matrix,
+                             HYPRE_Int           nentries,
+                             const HYPRE_BigInt *rows,
+                             const HYPRE_BigInt *cols )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nentries < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (nentries && !rows)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (nentries && !cols)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (!hypre_IJMatrixAssembleFlag(ijmatrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matrix must be assembled before freezing its pattern");
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
+   {
+      hypre_IJMatrixFreezePatternParCSR(ijmatrix, nentries, rows, cols);
+   }
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetFrozenValues( HYPRE_IJMatrix       matrix,
+                               const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
+   {
+      hypre_IJMatrixUpdateFrozenValuesParCSR(ijmatrix, values, 0);
+   }
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAddToFrozenValues( HYPRE_IJMatrix       matrix,
+                                 const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
+   {
+      hypre_IJMatrixUpdateFrozenValuesParCSR(ijmatrix, values, 1);
+   }
+   else
+   {
+      hypre_error_in_arg(1);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1269,7 +1443,7 @@ HYPRE_IJMatrixRead( const char     *filename,
                     HYPRE_Int       type,
                     HYPRE_IJMatrix *matrix_ptr )
 {
-   hypre_IJMatrixRead(filename, comm, type, matrix_ptr, 0);
+   hypre_IJMatrixRead(filename, comm, type, matrix_ptr);
 
    return hypre_error_flag;
 }
@@ -1296,7 +1470,7 @@ HYPRE_IJMatrixReadBinary( const char     *filename,
  * HYPRE_IJMatrixReadMM
  *
  * Reads matrix-market data from file in ASCII format and creates an
- * IJMatrix on host memory.
+ * IJMatrix on host memory, with the rows distributed evenly over comm.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -1305,7 +1479,37 @@ HYPRE_IJMatrixReadMM( const char     *filename,
                       HYPRE_Int       type,
                       HYPRE_IJMatrix *matrix_ptr )
 {
-   hypre_IJMatrixRead(filename, comm, type, matrix_ptr, 1);
+   hypre_IJMatrixReadMM(filename, comm, type, matrix_ptr);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixReadMPIIO
+ *
+ * Reads a single-file binary matrix written by HYPRE_IJMatrixPrintMPIIO
+ * and creates an IJMatrix with the rows evenly distributed over 'comm'.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixReadMPIIO( const char     *filename,
+                         MPI_Comm        comm,
+                         HYPRE_Int       type,
+                         HYPRE_IJMatrix *matrix_ptr )
+{
+   if (!filename)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (!matrix_ptr)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixReadMPIIO(filename, comm, type, matrix_ptr);
 
    return hypre_error_flag;
 }
@@ -1366,6 +1570,36 @@ HYPRE_IJMatrixPrintBinary( HYPRE_IJMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixPrintMPIIO
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixPrintMPIIO( HYPRE_IJMatrix  matrix,
+                          const char     *filename )
+{
+   void    *object;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( (hypre_IJMatrixObjectType(matrix) != HYPRE_PARCSR) )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   HYPRE_IJMatrixGetObject(matrix, &object);
+   hypre_ParCSRMatrixPrintMPIIO((hypre_ParCSRMatrix*) object,
+                                hypre_IJMatrixGlobalFirstRow(matrix),
+                                hypre_IJMatrixGlobalFirstCol(matrix), filename);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixSetOMPFlag
  *--------------------------------------------------------------------------*/
@@ -197,6 +197,60 @@ HYPRE_Int HYPRE_IJMatrixAddToValues2(HYPRE_IJMatrix       matrix,
  **/
 HYPRE_Int HYPRE_IJMatrixAssemble(HYPRE_IJMatrix matrix);
 
+/**
+ * Build the matrix directly from the local rows in CSR format, adopting the
+ * caller's arrays instead of copying them.  Collective.  This replaces the
+ * calls to \e HYPRE_IJMatrixInitialize, the set/add routines and
+ * \e HYPRE_IJMatrixAssemble, and leaves the matrix assembled.
+ *
+ * Row \e i of the local row range has the global column indices
+ * \e cols[row\_ptr[i]], ..., \e cols[row\_ptr[i+1]-1] and the corresponding
+ * \e values; there must be no duplicate entries.  The arrays are reordered in
+ * place and used as the storage of the local (diagonal) block; only the
+ * entries in off-processor columns are copied.  If \e owns\_data is nonzero,
+ * hypre takes ownership of the arrays and frees them with its host
+ * allocator, so they must have been allocated by hypre in host memory
+ * (\e hypre\_TAlloc with \e HYPRE\_MEMORY\_HOST), not with \e malloc, since
+ * the two differ when hypre uses Umpire or a device-aware host allocator.
+ * Otherwise they must remain valid until the matrix is destroyed.  Only host
+ * memory is supported.
+ **/
+HYPRE_Int HYPRE_IJMatrixAdoptCSR(HYPRE_IJMatrix  matrix,
+                                 HYPRE_Int      *row_ptr,
+                                 HYPRE_BigInt   *cols,
+                                 HYPRE_Complex  *values,
+                                 HYPRE_Int       owns_data);
+
+/**
+ * Freeze the (row, col) pattern of \e nentries matrix entries for repeated
+ * value-only updates.  Collective.  The matrix must be assembled, and each
+ * entry must be in its structure; rows may be owned by other processors.  The
+ * entries are mapped once to the matrix storage, so that later calls to
+ * \e HYPRE_IJMatrixSetFrozenValues and \e HYPRE_IJMatrixAddToFrozenValues
+ * need no searching or reassembly.  The pattern is kept until it is frozen
+ * again or the matrix is destroyed, and becomes invalid if the matrix
+ * structure changes.  Only host memory is supported.
+ **/
+HYPRE_Int HYPRE_IJMatrixFreezePattern(HYPRE_IJMatrix      matrix,
+                                      HYPRE_Int           nentries,
+                                      const HYPRE_BigInt *rows,
+                                      const HYPRE_BigInt *cols);
+
+/**
+ * Set the values of the frozen entries, given in the order of the pattern.
+ * Collective.  Each matrix entry in the pattern is overwritten with the sum
+ * of all values given for it, on all processors.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetFrozenValues(HYPRE_IJMatrix       matrix,
+                                        const HYPRE_Complex *values);
+
+/**
+ * Add to the values of the frozen entries, given in the order of the
+ * pattern.  Collective.
+ **/
+HYPRE_Int HYPRE_IJMatrixAddToFrozenValues(HYPRE_IJMatrix       matrix,
+                                          const HYPRE_Complex *values);
+
 /**
  * Gets number of nonzeros elements for \e nrows rows specified in \e rows
  * and returns them in \e ncols, which needs to be allocated by the
@@ -379,7 +433,10 @@ HYPRE_Int HYPRE_IJMatrixRead(const char     *filename,
                              HYPRE_IJMatrix *matrix);
 
 /**
- * Read the matrix from MM file.  This is mainly for debugging purposes.
+ * Read the matrix from a Matrix Market file.  Each process parses a
+ * contiguous part of the file, and the rows of the resulting matrix are
+ * distributed evenly over comm.  Only sparse real or integer coordinate
+ * matrices, general or symmetric, are supported.
  **/
 HYPRE_Int HYPRE_IJMatrixReadMM(const char     *filename,
                                MPI_Comm        comm,
@@ -430,6 +487,26 @@ HYPRE_Int HYPRE_IJMatrixReadBinary(const char     *filename,
                                    HYPRE_Int       type,
                                    HYPRE_IJMatrix *matrix_ptr);
 
+/**
+ * Print the matrix to a single binary file with collective MPI-IO.  The file
+ * holds the global row offsets, column indices and coefficients in CSR order,
+ * so it does not depend on the number of processes that wrote it.  Complex
+ * matrices are not supported.
+ **/
+HYPRE_Int HYPRE_IJMatrixPrintMPIIO(HYPRE_IJMatrix  matrix,
+                                   const char     *filename);
+
+/**
+ * Read a matrix written by HYPRE_IJMatrixPrintMPIIO on any number of
+ * processes.  The rows (and columns) are distributed evenly over comm,
+ * and each process reads only its own rows.  Files written with a different
+ * index or coefficient size are converted on input.
+ **/
+HYPRE_Int HYPRE_IJMatrixReadMPIIO(const char     *filename,
+                                  MPI_Comm        comm,
+                                  HYPRE_Int       type,
+                                  HYPRE_IJMatrix *matrix_ptr);
+
 /**
  * Migrate the matrix to a given memory location.
  **/
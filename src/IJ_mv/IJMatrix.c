@@ -14,6 +14,13 @@
 #include "_hypre_IJ_mv.h"
 #include "../HYPRE.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrixGetRowPartitioning
  *
@@ -104,16 +111,16 @@ hypre_IJMatrixSetObject( HYPRE_IJMatrix  matrix,
 /*--------------------------------------------------------------------------
  * hypre_IJMatrixRead
  *
- * Reads a matrix from file, HYPRE's IJ format or MM format. The resulting
- * IJMatrix is stored on host memory.
+ * Reads a matrix from file in HYPRE's IJ format. The resulting IJMatrix is
+ * stored on host memory. Matrix Market files are read with
+ * hypre_IJMatrixReadMM.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
 hypre_IJMatrixRead( const char     *filename,
                     MPI_Comm        comm,
                     HYPRE_Int       type,
-                    HYPRE_IJMatrix *matrix_ptr,
-                    HYPRE_Int       is_mm )
+                    HYPRE_IJMatrix *matrix_ptr )
 {
    HYPRE_IJMatrix  matrix;
    HYPRE_BigInt    ilower, iupper, jlower, jupper;
@@ -121,20 +128,12 @@ hypre_IJMatrixRead( const char     *filename,
    HYPRE_Int       ncols;
    HYPRE_Complex   value;
    HYPRE_Int       myid, ret;
-   HYPRE_Int       isSym = 0;
    char            new_filename[255];
    FILE           *file;
 
    hypre_MPI_Comm_rank(comm, &myid);
 
-   if (is_mm)
-   {
-      hypre_sprintf(new_filename, "%s", filename);
-   }
-   else
-   {
-      hypre_sprintf(new_filename, "%s.%05d", filename, myid);
-   }
+   hypre_sprintf(new_filename, "%s.%05d", filename, myid);
 
    if ((file = fopen(new_filename, "r")) == NULL)
    {
@@ -142,51 +141,7 @@ hypre_IJMatrixRead( const char     *filename,
       return hypre_error_flag;
    }
 
-   if (is_mm)
-   {
-      MM_typecode matcode;
-      HYPRE_Int nrow, ncol, nnz;
-
-      if (hypre_mm_read_banner(file, &matcode) != 0)
-      {
-         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not process Matrix Market banner.");
-         return hypre_error_flag;
-      }
-
-      if (!hypre_mm_is_valid(matcode))
-      {
-         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Invalid Matrix Market file.");
-         return hypre_error_flag;
-      }
-
-      if ( !( (hypre_mm_is_real(matcode) || hypre_mm_is_integer(matcode)) &&
-              hypre_mm_is_coordinate(matcode) && hypre_mm_is_sparse(matcode) ) )
-      {
-         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
-                           "Only sparse real-valued/integer coordinate matrices are supported");
-         return hypre_error_flag;
-      }
-
-      if (hypre_mm_is_symmetric(matcode))
-      {
-         isSym = 1;
-      }
-
-      if (hypre_mm_read_mtx_crd_size(file, &nrow, &ncol, &nnz) != 0)
-      {
-         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MM read size error !");
-         return hypre_error_flag;
-      }
-
-      ilower = 0;
-      iupper = ilower + nrow - 1;
-      jlower = 0;
-      jupper = jlower + ncol - 1;
-   }
-   else
-   {
-      hypre_fscanf(file, "%b %b %b %b", &ilower, &iupper, &jlower, &jupper);
-   }
+   hypre_fscanf(file, "%b %b %b %b", &ilower, &iupper, &jlower, &jupper);
 
    HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &matrix);
 
@@ -205,12 +160,6 @@ hypre_IJMatrixRead( const char     *filename,
          return hypre_error_flag;
       }
 
-      if (is_mm)
-      {
-         I --;
-         J --;
-      }
-
       if (I < ilower || I > iupper)
       {
          HYPRE_IJMatrixAddToValues(matrix, 1, &ncols, &I, &J, &value);
@@ -219,18 +168,6 @@ hypre_IJMatrixRead( const char     *filename,
       {
          HYPRE_IJMatrixSetValues(matrix, 1, &ncols, &I, &J, &value);
       }
-
-      if (isSym && I != J)
-      {
-         if (J < ilower || J > iupper)
-         {
-            HYPRE_IJMatrixAddToValues(matrix, 1, &ncols, &J, &I, &value);
-         }
-         else
-         {
-            HYPRE_IJMatrixSetValues(matrix, 1, &ncols, &J, &I, &value);
-         }
-      }
    }
 
    HYPRE_IJMatrixAssemble(matrix);
@@ -507,3 +444,823 @@ hypre_IJMatrixReadBinary( const char      *prefixname,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * Reads 'nbytes' bytes at 'offset' from a file that is either mapped into
+ * memory ('map') or opened with MPI-IO ('fh').  MPI-IO reads are split into
+ * pieces whose byte counts fit in an int.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixReadMPIIOBytes( const char        *map,
+                              hypre_MPI_File     fh,
+                              hypre_MPI_Offset   offset,
+                              size_t             nbytes,
+                              void              *buf )
+{
+   const size_t  max_count = (size_t) 1 << 30;
+   size_t        done, count;
+   HYPRE_Int     ierr = 0;
+
+   if (map)
+   {
+      memcpy(buf, map + offset, nbytes);
+      return 0;
+   }
+
+   for (done = 0; done < nbytes; done += count)
+   {
+      count = hypre_min(max_count, nbytes - done);
+      ierr += hypre_MPI_File_read_at(fh, offset + (hypre_MPI_Offset) done,
+                                     (char *) buf + done, (HYPRE_Int) count,
+                                     hypre_MPI_BYTE, hypre_MPI_STATUS_IGNORE);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixReadMPIIO
+ *
+ * Collective.  Reads a matrix from a single binary file written by
+ * hypre_ParCSRMatrixPrintMPIIO, on any number of processes.  The rows and
+ * columns are distributed evenly over the processes, and each process only
+ * reads the part of the file that holds its rows.  On POSIX systems the file
+ * is mapped into memory if it is visible to the process (e.g., on a shared
+ * file system); otherwise, it is read with independent MPI-IO calls.  Files
+ * written with a different index or coefficient size are converted.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixReadMPIIO( const char      *filename,
+                         MPI_Comm         comm,
+                         HYPRE_Int        type,
+                         HYPRE_IJMatrix  *matrix_ptr )
+{
+   HYPRE_IJMatrix     matrix;
+
+   hypre_uint64       header[hypre_PARCSR_MPIIO_NHEADER];
+   hypre_uint64      *offsets = NULL;
+   void              *buffer = NULL;
+   HYPRE_Int         *row_ptr = NULL;
+   HYPRE_BigInt      *cols = NULL;
+   HYPRE_Complex     *vals = NULL;
+
+   HYPRE_BigInt       global_num_rows, global_num_cols, size, rest;
+   HYPRE_BigInt       base_i = 0, base_j = 0;
+   HYPRE_BigInt       ilower = 0, iupper = -1, jlower = 0, jupper = -1;
+   HYPRE_Int          num_rows = 0, num_nonzeros, isize = 0, vsize = 0;
+   hypre_MPI_Offset   cols_start, vals_start, file_size;
+   HYPRE_Int          myid, num_procs, i, ierr = 0, global_ierr;
+
+   char              *map = NULL;
+   size_t             map_size = 0;
+   hypre_MPI_File     fh;
+   HYPRE_Int          fh_open = 0;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*---------------------------------------------
+    * Open the file
+    *---------------------------------------------*/
+
+#ifndef _WIN32
+   {
+      struct stat  st;
+      void        *addr;
+      int          fd = open(filename, O_RDONLY);
+
+      if (fd >= 0)
+      {
+         if (fstat(fd, &st) == 0 && st.st_size > 0)
+         {
+            addr = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (addr != MAP_FAILED)
+            {
+               map      = (char *) addr;
+               map_size = (size_t) st.st_size;
+            }
+         }
+         close(fd);
+      }
+   }
+#endif
+
+   if (!map)
+   {
+      /* on failure, fall through to the agreement below so that the other
+         processes do not wait for this one */
+      if (hypre_MPI_File_open(hypre_MPI_COMM_SELF, filename, hypre_MPI_MODE_RDONLY,
+                              hypre_MPI_INFO_NULL, &fh))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open input file");
+         ierr = 1;
+      }
+      else
+      {
+         fh_open = 1;
+      }
+   }
+
+   /*---------------------------------------------
+    * Read and check the header
+    *---------------------------------------------*/
+
+   if (!ierr)
+   {
+      if (map && map_size < sizeof(header))
+      {
+         ierr = 1;
+      }
+      else
+      {
+         ierr = hypre_IJMatrixReadMPIIOBytes(map, fh, 0, sizeof(header), header);
+      }
+      isize = (HYPRE_Int) header[2];
+      vsize = (HYPRE_Int) header[3];
+      if (ierr ||
+          header[0] != hypre_PARCSR_MPIIO_MAGIC ||
+          header[1] != hypre_PARCSR_MPIIO_VERSION ||
+          (isize != sizeof(hypre_uint32) && isize != sizeof(hypre_uint64)) ||
+          (vsize != sizeof(hypre_float)  && vsize != sizeof(hypre_double)))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Unsupported or corrupted input file");
+         ierr = 1;
+      }
+      else
+      {
+         /* the header, the global row offsets, and the column indices and
+            coefficients of all nonzeros must be present */
+         file_size = (hypre_MPI_Offset) map_size;
+         if (!map && hypre_MPI_File_get_size(fh, &file_size))
+         {
+            file_size = 0;
+         }
+         if ((hypre_uint64) file_size <
+             (hypre_PARCSR_MPIIO_NHEADER + header[4] + 1) * sizeof(hypre_uint64) +
+             header[6] * (hypre_uint64) (isize + vsize))
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Truncated input file");
+            ierr = 1;
+         }
+      }
+   }
+
+   if (!ierr)
+   {
+      global_num_rows = (HYPRE_BigInt) header[4];
+      global_num_cols = (HYPRE_BigInt) header[5];
+      base_i          = (HYPRE_BigInt) header[7];
+      base_j          = (HYPRE_BigInt) header[8];
+
+      /* even distribution of the rows and columns */
+      size   = global_num_rows / num_procs;
+      rest   = global_num_rows - size * num_procs;
+      ilower = size * myid + hypre_min(myid, rest);
+      iupper = ilower + size + ((myid < rest) ? 1 : 0) - 1;
+      size   = global_num_cols / num_procs;
+      rest   = global_num_cols - size * num_procs;
+      jlower = size * myid + hypre_min(myid, rest);
+      jupper = jlower + size + ((myid < rest) ? 1 : 0) - 1;
+      num_rows = (HYPRE_Int) (iupper - ilower + 1);
+
+      /*---------------------------------------------
+       * Read the row offsets of the local rows
+       *---------------------------------------------*/
+
+      offsets = hypre_TAlloc(hypre_uint64, num_rows + 1, HYPRE_MEMORY_HOST);
+      ierr = hypre_IJMatrixReadMPIIOBytes(map, fh,
+                                          (hypre_PARCSR_MPIIO_NHEADER + ilower) *
+                                          (hypre_MPI_Offset) sizeof(hypre_uint64),
+                                          (num_rows + 1) * sizeof(hypre_uint64), offsets);
+      if (ierr || offsets[num_rows] < offsets[0] ||
+          offsets[num_rows] - offsets[0] > HYPRE_INT_MAX)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not read the row offsets");
+         ierr = 1;
+      }
+   }
+
+   if (!ierr)
+   {
+      num_nonzeros = (HYPRE_Int) (offsets[num_rows] - offsets[0]);
+      row_ptr = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i <= num_rows; i++)
+      {
+         row_ptr[i] = (HYPRE_Int) (offsets[i] - offsets[0]);
+      }
+
+      cols_start = (hypre_PARCSR_MPIIO_NHEADER + global_num_rows + 1) *
+                   (hypre_MPI_Offset) sizeof(hypre_uint64);
+      vals_start = cols_start + (hypre_MPI_Offset) header[6] * isize +
+                   (hypre_MPI_Offset) offsets[0] * vsize;
+      cols_start += (hypre_MPI_Offset) offsets[0] * isize;
+
+      /*---------------------------------------------
+       * Read the column indices and coefficients
+       *---------------------------------------------*/
+
+      cols = hypre_TAlloc(HYPRE_BigInt,  num_nonzeros, HYPRE_MEMORY_HOST);
+      vals = hypre_TAlloc(HYPRE_Complex, num_nonzeros, HYPRE_MEMORY_HOST);
+      buffer = hypre_TAlloc(char, (size_t) num_nonzeros * hypre_max(isize, vsize),
+                            HYPRE_MEMORY_HOST);
+
+      ierr += hypre_IJMatrixReadMPIIOBytes(map, fh, cols_start,
+                                           (size_t) num_nonzeros * isize, buffer);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_nonzeros; i++)
+      {
+         cols[i] = base_j + ((isize == sizeof(hypre_uint32)) ?
+                             (HYPRE_BigInt) ((hypre_uint32 *) buffer)[i] :
+                             (HYPRE_BigInt) ((hypre_uint64 *) buffer)[i]);
+      }
+
+      ierr += hypre_IJMatrixReadMPIIOBytes(map, fh, vals_start,
+                                           (size_t) num_nonzeros * vsize, buffer);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_nonzeros; i++)
+      {
+         vals[i] = (vsize == sizeof(hypre_float)) ?
+                   (HYPRE_Complex) ((hypre_float *) buffer)[i] :
+                   (HYPRE_Complex) ((hypre_double *) buffer)[i];
+      }
+
+      if (ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not read all matrix entries");
+      }
+   }
+
+   /* Close the file */
+#ifndef _WIN32
+   if (map)
+   {
+      munmap(map, map_size);
+   }
+#endif
+   if (fh_open)
+   {
+      hypre_MPI_File_close(&fh);
+   }
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+   hypre_TFree(offsets, HYPRE_MEMORY_HOST);
+
+   /* All processes must agree before building the matrix */
+   hypre_MPI_Allreduce(&ierr, &global_ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (global_ierr)
+   {
+      hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(vals, HYPRE_MEMORY_HOST);
+      if (!hypre_error_flag)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not read input file");
+      }
+      return hypre_error_flag;
+   }
+
+   /*---------------------------------------------
+    * Build IJMatrix; on the host, the arrays are
+    * adopted without copying
+    *---------------------------------------------*/
+
+   HYPRE_IJMatrixCreate(comm, base_i + ilower, base_i + iupper,
+                        base_j + jlower, base_j + jupper, &matrix);
+   HYPRE_IJMatrixSetObjectType(matrix, type);
+   if (type == HYPRE_PARCSR &&
+       hypre_GetActualMemLocation(hypre_HandleMemoryLocation(hypre_handle())) == hypre_MEMORY_HOST)
+   {
+      HYPRE_IJMatrixAdoptCSR(matrix, row_ptr, cols, vals, 1);
+   }
+   else
+   {
+      HYPRE_Int    *ncols = hypre_TAlloc(HYPRE_Int,    num_rows, HYPRE_MEMORY_HOST);
+      HYPRE_BigInt *rows  = hypre_TAlloc(HYPRE_BigInt, num_rows, HYPRE_MEMORY_HOST);
+
+      for (i = 0; i < num_rows; i++)
+      {
+         ncols[i] = row_ptr[i + 1] - row_ptr[i];
+         rows[i]  = base_i + ilower + i;
+      }
+      HYPRE_IJMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+      HYPRE_IJMatrixSetValues(matrix, num_rows, ncols, rows, cols, vals);
+      HYPRE_IJMatrixAssemble(matrix);
+
+      hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+      hypre_TFree(rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(vals, HYPRE_MEMORY_HOST);
+   }
+
+   /* Set output pointer */
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Helpers for hypre_IJMatrixReadMM.  Both parsers skip leading blanks and
+ * advance 'ptr' past the token; they return a nonzero value on error.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_MMIsBlank(c)  ((c) == ' ' || (c) == '\t' || (c) == '\r')
+#define hypre_MMIsDigit(c)  ((c) >= '0' && (c) <= '9')
+
+static HYPRE_Int
+hypre_IJMatrixMMParseIndex( const char   **ptr,
+                            const char    *end,
+                            HYPRE_BigInt  *index )
+{
+   const char    *p = *ptr;
+   const char    *start;
+   HYPRE_BigInt   value = 0;
+
+   while (p < end && hypre_MMIsBlank(*p))
+   {
+      p++;
+   }
+   for (start = p; p < end && hypre_MMIsDigit(*p) && (p - start) < 18; p++)
+   {
+      value = 10 * value + (HYPRE_BigInt) (*p - '0');
+   }
+   if (p == start || (p < end && !hypre_MMIsBlank(*p) && *p != '\n'))
+   {
+      return 1;
+   }
+
+   *ptr   = p;
+   *index = value;
+
+   return 0;
+}
+
+/* Coefficients with at most 15 significant digits (not counting trailing
+ * zeros) and a small decimal exponent are computed exactly with a single
+ * floating point operation; all others are handed to the C library. */
+
+static HYPRE_Int
+hypre_IJMatrixMMParseReal( const char     **ptr,
+                           const char      *end,
+                           HYPRE_Complex   *value )
+{
+   static const hypre_double pow10[] =
+   {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+   };
+
+   const char    *p = *ptr;
+   const char    *start;
+   hypre_uint64   mantissa = 0;
+   hypre_double   dvalue;
+   HYPRE_Int      ndigits = 0, zeros = 0, any_digit = 0, negative = 0;
+   HYPRE_Int      in_fraction = 0, exp10 = 0, exp_value = 0, exp_negative = 0;
+   HYPRE_Int      d;
+
+   while (p < end && hypre_MMIsBlank(*p))
+   {
+      p++;
+   }
+   start = p;
+
+   if (p < end && (*p == '-' || *p == '+'))
+   {
+      negative = (*p == '-');
+      p++;
+   }
+
+   /* Digits; zeros after a nonzero digit are only absorbed into the
+    * mantissa once another nonzero digit follows */
+   for (; p < end && ndigits <= 15; p++)
+   {
+      if (*p == '.' && !in_fraction)
+      {
+         in_fraction = 1;
+         continue;
+      }
+      if (!hypre_MMIsDigit(*p))
+      {
+         break;
+      }
+      d = *p - '0';
+      any_digit = 1;
+      exp10 -= in_fraction;
+      if (d == 0)
+      {
+         zeros += (mantissa != 0);
+      }
+      else
+      {
+         ndigits += zeros + 1;
+         if (ndigits <= 15)
+         {
+            mantissa = mantissa * (hypre_uint64) pow10[zeros + 1] + (hypre_uint64) d;
+         }
+         zeros = 0;
+      }
+   }
+   exp10 += zeros;
+
+   if (ndigits <= 15 && any_digit && p < end && (*p == 'e' || *p == 'E'))
+   {
+      p++;
+      if (p < end && (*p == '-' || *p == '+'))
+      {
+         exp_negative = (*p == '-');
+         p++;
+      }
+      if (p == end || !hypre_MMIsDigit(*p))
+      {
+         any_digit = 0;
+      }
+      for (; p < end && hypre_MMIsDigit(*p) && exp_value < 1000; p++)
+      {
+         exp_value = 10 * exp_value + (*p - '0');
+      }
+      exp10 += exp_negative ? -exp_value : exp_value;
+   }
+
+   if (ndigits <= 15 && any_digit && (mantissa == 0 || (exp10 >= -22 && exp10 <= 22)) &&
+       (p == end || hypre_MMIsBlank(*p) || *p == '\n'))
+   {
+      dvalue = (hypre_double) mantissa;
+      if (mantissa != 0)
+      {
+         dvalue = (exp10 < 0) ? dvalue / pow10[-exp10] : dvalue * pow10[exp10];
+      }
+      *value = (HYPRE_Complex) (negative ? -dvalue : dvalue);
+   }
+   else
+   {
+      char        token[64];
+      HYPRE_Real  rvalue;
+      size_t      len;
+
+      for (p = start; p < end && !hypre_MMIsBlank(*p) && *p != '\n'; p++);
+      len = (size_t) (p - start);
+      if (len == 0 || len >= sizeof(token))
+      {
+         return 1;
+      }
+      memcpy(token, start, len);
+      token[len] = '\0';
+      if (hypre_sscanf(token, "%le", &rvalue) != 1)
+      {
+         return 1;
+      }
+      *value = (HYPRE_Complex) rvalue;
+   }
+
+   *ptr = p;
+
+   return 0;
+}
+
+/* Returns the offset of the first line that starts at or after 'off' */
+
+static size_t
+hypre_IJMatrixMMLineStart( const char  *buf,
+                           size_t       buf_off,
+                           size_t       buf_end,
+                           size_t       data_start,
+                           size_t       off )
+{
+   if (off <= data_start)
+   {
+      return data_start;
+   }
+   while (off < buf_end && buf[off - 1 - buf_off] != '\n')
+   {
+      off++;
+   }
+
+   return hypre_min(off, buf_end);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixReadMM
+ *
+ * Collective.  Reads a sparse real or integer coordinate matrix in Matrix
+ * Market format.  The file is split by byte range instead of by row: each
+ * process parses only the lines that start in its part of the file, and
+ * its threads parse disjoint pieces of that part.  The resulting triplets
+ * are passed to IJ assembly, which sends entries in rows of other processes
+ * to their owners in one exchange.  The rows are distributed evenly over
+ * 'comm'.  Entries that appear more than once are summed.
+ *
+ * On POSIX systems the file is mapped into memory, so that each process
+ * touches only the pages that hold its lines; otherwise, the local byte
+ * range is read with stdio.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixReadMM( const char     *filename,
+                      MPI_Comm        comm,
+                      HYPRE_Int       type,
+                      HYPRE_IJMatrix *matrix_ptr )
+{
+   HYPRE_IJMatrix   matrix;
+   MM_typecode      matcode;
+   FILE            *file;
+
+   HYPRE_Int        nrow, ncol, nnz, is_sym;
+   HYPRE_BigInt     ilower, iupper, jlower, jupper, size, rest;
+   size_t           data_start, data_end, lo, hi;
+
+   /* Local window of the file: buf[k] is the byte at offset buf_off + k */
+   char            *map = NULL;
+   char            *buf = NULL;
+   size_t           buf_off = 0, buf_end = 0;
+
+   HYPRE_Int        num_threads = hypre_NumThreads();
+   HYPRE_Int       *offsets, *counts, *ncols;
+   HYPRE_BigInt    *rows = NULL, *cols = NULL;
+   HYPRE_Complex   *vals = NULL;
+   HYPRE_Int        num_entries = 0, num_chunks = 1, ierr = 0, global_ierr;
+   HYPRE_Int        myid, num_procs, i;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*---------------------------------------------
+    * Read the banner and the sizes
+    *---------------------------------------------*/
+
+   if ((file = fopen(filename, "rb")) == NULL)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hypre_mm_read_banner(file, &matcode) != 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not process Matrix Market banner.");
+      fclose(file);
+      return hypre_error_flag;
+   }
+
+   if (!hypre_mm_is_valid(matcode))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Invalid Matrix Market file.");
+      fclose(file);
+      return hypre_error_flag;
+   }
+
+   if ( !( (hypre_mm_is_real(matcode) || hypre_mm_is_integer(matcode)) &&
+           hypre_mm_is_coordinate(matcode) && hypre_mm_is_sparse(matcode) ) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Only sparse real-valued/integer coordinate matrices are supported");
+      fclose(file);
+      return hypre_error_flag;
+   }
+   is_sym = hypre_mm_is_symmetric(matcode) ? 1 : 0;
+
+   if (hypre_mm_read_mtx_crd_size(file, &nrow, &ncol, &nnz) != 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MM read size error !");
+      fclose(file);
+      return hypre_error_flag;
+   }
+
+   data_start = (size_t) ftell(file);
+   fseek(file, 0, SEEK_END);
+   data_end = (size_t) ftell(file);
+
+   /* Byte range of this process, moved to line boundaries below */
+   lo = data_start + (size_t) (((hypre_uint64) (data_end - data_start) * myid) / num_procs);
+   hi = data_start + (size_t) (((hypre_uint64) (data_end - data_start) * (myid + 1)) / num_procs);
+
+   /*---------------------------------------------
+    * Make the local window of the file accessible
+    *---------------------------------------------*/
+
+#ifndef _WIN32
+   if (lo < hi)
+   {
+      void *addr = mmap(NULL, data_end, PROT_READ, MAP_SHARED, fileno(file), 0);
+
+      if (addr != MAP_FAILED)
+      {
+         map     = (char *) addr;
+         buf     = map;
+         buf_off = 0;
+         buf_end = data_end;
+      }
+   }
+#endif
+
+   if (!map && lo < hi)
+   {
+      /* The window starts one byte early to tell whether a line starts at
+       * 'lo', and ends with the line that holds byte hi - 1 */
+      size_t  capacity;
+
+      buf_off  = (lo > data_start) ? lo - 1 : lo;
+      buf_end  = hi;
+      capacity = hi - buf_off + 4096;
+      buf      = hypre_TAlloc(char, capacity, HYPRE_MEMORY_HOST);
+      fseek(file, (long) buf_off, SEEK_SET);
+      if (fread(buf, 1, hi - buf_off, file) != hi - buf_off)
+      {
+         ierr = 1;
+      }
+      while (!ierr && buf_end < data_end && buf[buf_end - 1 - buf_off] != '\n')
+      {
+         if (buf_end - buf_off == capacity)
+         {
+            buf = hypre_TReAlloc(buf, char, 2 * capacity, HYPRE_MEMORY_HOST);
+            capacity *= 2;
+         }
+         if (fread(buf + (buf_end - buf_off), 1, 1, file) != 1)
+         {
+            ierr = 1;
+         }
+         buf_end++;
+      }
+   }
+   fclose(file);
+
+   if (!ierr && lo < hi)
+   {
+      lo = hypre_IJMatrixMMLineStart(buf, buf_off, buf_end, data_start, lo);
+      hi = hypre_IJMatrixMMLineStart(buf, buf_off, buf_end, data_start, hi);
+   }
+   else
+   {
+      lo = hi = buf_off = buf_end = data_start;
+   }
+
+   /*---------------------------------------------
+    * Parse the local lines; each thread takes the
+    * lines that start in its piece of [lo, hi)
+    *---------------------------------------------*/
+
+   offsets = hypre_CTAlloc(HYPRE_Int, num_threads + 1, HYPRE_MEMORY_HOST);
+   counts  = hypre_CTAlloc(HYPRE_Int, num_threads, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int     my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int     nthreads      = hypre_NumActiveThreads();
+      hypre_uint64  len           = (hypre_uint64) (hi - lo);
+      const char   *end           = buf + (buf_end - buf_off);
+      const char   *p, *p_begin, *p_end;
+      HYPRE_BigInt  I, J;
+      HYPRE_Int     k, my_lines = 0, my_error = 0;
+
+      p_begin = buf + (hypre_IJMatrixMMLineStart(buf, buf_off, buf_end, data_start,
+                                                 lo + (size_t) ((len * my_thread_num) / nthreads))
+                       - buf_off);
+      p_end   = buf + (hypre_IJMatrixMMLineStart(buf, buf_off, buf_end, data_start,
+                                                 lo + (size_t) ((len * (my_thread_num + 1)) / nthreads))
+                       - buf_off);
+
+      /* Count the lines of this thread to size the triplet arrays */
+      for (p = p_begin; p < p_end; my_lines++)
+      {
+         p = (const char *) memchr(p, '\n', (size_t) (end - p));
+         p = p ? p + 1 : end;
+      }
+      offsets[my_thread_num + 1] = (is_sym + 1) * my_lines;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+      #pragma omp master
+#endif
+      {
+         num_chunks = nthreads;
+         for (i = 0; i < nthreads; i++)
+         {
+            offsets[i + 1] += offsets[i];
+         }
+         rows = hypre_TAlloc(HYPRE_BigInt,  offsets[nthreads], HYPRE_MEMORY_HOST);
+         cols = hypre_TAlloc(HYPRE_BigInt,  offsets[nthreads], HYPRE_MEMORY_HOST);
+         vals = hypre_TAlloc(HYPRE_Complex, offsets[nthreads], HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      k = offsets[my_thread_num];
+      for (p = p_begin; p < p_end; )
+      {
+         while (p < end && hypre_MMIsBlank(*p))
+         {
+            p++;
+         }
+         if (p < end && *p != '\n' && *p != '%')
+         {
+            if (hypre_IJMatrixMMParseIndex(&p, end, &I) ||
+                hypre_IJMatrixMMParseIndex(&p, end, &J) ||
+                hypre_IJMatrixMMParseReal(&p, end, &vals[k]) ||
+                I < 1 || I > nrow || J < 1 || J > ncol)
+            {
+               my_error = 1;
+               break;
+            }
+            rows[k] = I - 1;
+            cols[k] = J - 1;
+            k++;
+            if (is_sym && I != J)
+            {
+               rows[k] = J - 1;
+               cols[k] = I - 1;
+               vals[k] = vals[k - 1];
+               k++;
+            }
+         }
+         p = (const char *) memchr(p, '\n', (size_t) (end - p));
+         p = p ? p + 1 : end;
+      }
+      counts[my_thread_num] = my_error ? -1 : k - offsets[my_thread_num];
+   } /* omp parallel */
+
+   /* Close the file */
+#ifndef _WIN32
+   if (map)
+   {
+      munmap(map, data_end);
+   }
+   else
+#endif
+   {
+      hypre_TFree(buf, HYPRE_MEMORY_HOST);
+   }
+
+   /* Move the triplets of all threads next to each other */
+   for (i = 0; i < num_chunks && !ierr; i++)
+   {
+      if (counts[i] < 0)
+      {
+         ierr = 1;
+      }
+      else if (counts[i] > 0 && offsets[i] != num_entries)
+      {
+         memmove(rows + num_entries, rows + offsets[i], counts[i] * sizeof(HYPRE_BigInt));
+         memmove(cols + num_entries, cols + offsets[i], counts[i] * sizeof(HYPRE_BigInt));
+         memmove(vals + num_entries, vals + offsets[i], counts[i] * sizeof(HYPRE_Complex));
+      }
+      num_entries += hypre_max(counts[i], 0);
+   }
+   hypre_TFree(offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+
+   hypre_MPI_Allreduce(&ierr, &global_ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (global_ierr)
+   {
+      hypre_TFree(rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(vals, HYPRE_MEMORY_HOST);
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error in Matrix Market input file.");
+      return hypre_error_flag;
+   }
+
+   /*---------------------------------------------
+    * Assemble the matrix from the triplets
+    *---------------------------------------------*/
+
+   size   = nrow / num_procs;
+   rest   = nrow - size * num_procs;
+   ilower = size * myid + hypre_min(myid, rest);
+   iupper = ilower + size + ((myid < rest) ? 1 : 0) - 1;
+   size   = ncol / num_procs;
+   rest   = ncol - size * num_procs;
+   jlower = size * myid + hypre_min(myid, rest);
+   jupper = jlower + size + ((myid < rest) ? 1 : 0) - 1;
+
+   HYPRE_IJMatrixCreate(comm, ilower, iupper, jlower, jupper, &matrix);
+   HYPRE_IJMatrixSetObjectType(matrix, type);
+   HYPRE_IJMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   ncols = hypre_TAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_entries; i++)
+   {
+      ncols[i] = 1;
+   }
+   HYPRE_IJMatrixAddToValues(matrix, num_entries, ncols, rows, cols, vals);
+   HYPRE_IJMatrixAssemble(matrix);
+
+   hypre_TFree(ncols, HYPRE_MEMORY_HOST);
+   hypre_TFree(rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(vals, HYPRE_MEMORY_HOST);
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
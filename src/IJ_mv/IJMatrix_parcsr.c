@@ -1749,6 +1749,154 @@ hypre_IJMatrixAddParCSR( HYPRE_Complex    alpha,
    return hypre_error_flag;
 }
 
+/******************************************************************************
+ *
+ * hypre_IJMatrixAddMergedOffProcValsParCSR
+ *
+ * Adds n received off-proc. entries to the matrix.  The entries are sorted
+ * by (row, col) with two stable radix sorts and repeated entries are summed
+ * in the order received, so each row is added with one call and no
+ * duplicate columns.
+ *
+ *****************************************************************************/
+
+static HYPRE_Int
+hypre_IJMatrixAddMergedOffProcValsParCSR( hypre_IJMatrix *matrix,
+                                          HYPRE_Int       n,
+                                          HYPRE_BigInt   *rows,
+                                          HYPRE_BigInt   *cols,
+                                          HYPRE_Complex  *data )
+{
+   HYPRE_Int      num_threads = hypre_NumThreads();
+   HYPRE_Int     *perm, *workspace;
+   HYPRE_BigInt  *keys;
+   HYPRE_BigInt  *merged_rows, *merged_cols;
+   HYPRE_Complex *merged_data;
+   HYPRE_Int     *merged_ncols, *merged_indexes;
+   HYPRE_Int      num_merged = 0, num_merged_rows = 0;
+   HYPRE_Int      i;
+
+   if (n == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   perm = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   keys = hypre_TAlloc(HYPRE_BigInt, n, HYPRE_MEMORY_HOST);
+
+   /* sort by column, then by row */
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < n; i++)
+   {
+      perm[i] = i;
+      keys[i] = cols[i];
+   }
+   hypre_BigRadixSortbi(n, keys, perm);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < n; i++)
+   {
+      keys[i] = rows[perm[i]];
+   }
+   hypre_BigRadixSortbi(n, keys, perm);
+
+   /* merge repeated entries */
+   merged_rows    = hypre_TAlloc(HYPRE_BigInt,  n, HYPRE_MEMORY_HOST);
+   merged_cols    = hypre_TAlloc(HYPRE_BigInt,  n, HYPRE_MEMORY_HOST);
+   merged_data    = hypre_TAlloc(HYPRE_Complex, n, HYPRE_MEMORY_HOST);
+   merged_ncols   = hypre_TAlloc(HYPRE_Int,     n + 1, HYPRE_MEMORY_HOST);
+   merged_indexes = hypre_TAlloc(HYPRE_Int,     n + 1, HYPRE_MEMORY_HOST);
+   workspace      = hypre_TAlloc(HYPRE_Int,     2 * (num_threads + 1), HYPRE_MEMORY_HOST);
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel private(i)
+#endif
+   {
+      HYPRE_Int      my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int      nthreads      = hypre_NumActiveThreads();
+      HYPRE_Int      i_per_thread  = (n + nthreads - 1) / nthreads;
+      HYPRE_Int      i_begin       = hypre_min(i_per_thread * my_thread_num, n);
+      HYPRE_Int      i_end         = hypre_min(i_begin + i_per_thread, n);
+      HYPRE_Int      my_entries = 0, my_rows = 0;
+      HYPRE_Int      k;
+      HYPRE_Complex  sum;
+
+      for (i = i_begin; i < i_end; i++)
+      {
+         if (i == 0 || keys[i] != keys[i - 1])
+         {
+            my_rows++;
+            my_entries++;
+         }
+         else if (cols[perm[i]] != cols[perm[i - 1]])
+         {
+            my_entries++;
+         }
+      }
+
+      hypre_prefix_sum_pair(&my_entries, &num_merged, &my_rows, &num_merged_rows, workspace);
+
+      for (i = i_begin; i < i_end; i++)
+      {
+         if (i == 0 || keys[i] != keys[i - 1])
+         {
+            merged_rows[my_rows]      = keys[i];
+            merged_indexes[my_rows++] = my_entries;
+         }
+         else if (cols[perm[i]] == cols[perm[i - 1]])
+         {
+            continue;
+         }
+
+         /* the first of a run of repeated entries sums the run */
+         sum = data[perm[i]];
+         for (k = i + 1; k < n && keys[k] == keys[i] && cols[perm[k]] == cols[perm[i]]; k++)
+         {
+            sum += data[perm[k]];
+         }
+         merged_cols[my_entries] = cols[perm[i]];
+         merged_data[my_entries] = sum;
+         my_entries++;
+      }
+   } /* omp parallel */
+
+   merged_indexes[num_merged_rows] = num_merged;
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_merged_rows; i++)
+   {
+      merged_ncols[i] = merged_indexes[i + 1] - merged_indexes[i];
+   }
+
+   /* rows are distinct, so the threaded version can be used */
+   if (hypre_IJMatrixOMPFlag(matrix))
+   {
+      hypre_IJMatrixAddToValuesOMPParCSR(matrix, num_merged_rows, merged_ncols, merged_rows,
+                                         merged_indexes, merged_cols, merged_data);
+   }
+   else
+   {
+      hypre_IJMatrixAddToValuesParCSR(matrix, num_merged_rows, merged_ncols, merged_rows,
+                                      merged_indexes, merged_cols, merged_data);
+   }
+
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(keys, HYPRE_MEMORY_HOST);
+   hypre_TFree(merged_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(merged_cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(merged_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(merged_ncols, HYPRE_MEMORY_HOST);
+   hypre_TFree(merged_indexes, HYPRE_MEMORY_HOST);
+   hypre_TFree(workspace, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /******************************************************************************
  *
  * hypre_IJMatrixAssembleOffProcValsParCSR
@@ -1787,7 +1935,7 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int storage;
    HYPRE_Int indx;
    HYPRE_BigInt row;
-   HYPRE_Int num_ranges, row_index = 0;
+   HYPRE_Int num_ranges;
    HYPRE_Int num_recvs;
    HYPRE_BigInt upper_bound;
    HYPRE_Int counter;
@@ -1805,22 +1953,20 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    HYPRE_Int *response_buf_starts = NULL;
    HYPRE_Int *num_rows_per_proc = NULL, *num_elements_total = NULL;
    HYPRE_Int *argsort_contact_procs = NULL;
+   HYPRE_Int *row_pos = NULL, *data_pos = NULL;
+   HYPRE_Int  num_recv_rows;
+   HYPRE_Int *recv_row_pos = NULL, *recv_elmt_pos = NULL;
 
    HYPRE_Int  obj_size_bytes, complex_size;
    HYPRE_BigInt big_int_size;
    HYPRE_Int  tmp_int;
    HYPRE_BigInt  tmp_big_int;
-   HYPRE_BigInt *col_ptr;
-   HYPRE_BigInt *big_int_data = NULL;
-   HYPRE_Int big_int_data_size = 0, complex_data_size = 0;
 
    void *void_contact_buf = NULL;
    void *index_ptr;
    void *recv_data_ptr;
 
    HYPRE_Complex  tmp_complex;
-   HYPRE_Complex *col_data_ptr;
-   HYPRE_Complex *complex_data = NULL;
 
    hypre_DataExchangeResponse  response_obj1, response_obj2;
    hypre_ProcListElements      send_proc_obj;
@@ -1876,7 +2022,6 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    /* call hypre_IJMatrixAddToValuesParCSR directly inside this function
     * with one chunk of data */
    HYPRE_Int      off_proc_nelm_recv_cur = 0;
-   HYPRE_Int      off_proc_nelm_recv_max = 0;
    HYPRE_BigInt  *off_proc_i_recv = NULL;
    HYPRE_BigInt  *off_proc_j_recv = NULL;
    HYPRE_Complex *off_proc_data_recv = NULL;
@@ -1910,23 +2055,37 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    /* get the assumed processor id for each row */
    if (num_rows > 0 )
    {
+#if defined(HYPRE_USING_OPENMP)
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
       for (i = 0; i < num_rows; i++)
       {
-         row = off_proc_i[i * 2];
-         //if (row < 0) row = -row - 1;
-         row_list[i] = row;
+         row_list[i] = off_proc_i[i * 2];
          row_list_num_elements[i] = off_proc_i[i * 2 + 1];
-
-         hypre_GetAssumedPartitionProcFromRow(comm, row, global_first_row,
-                                              global_num_cols, &proc_id);
-         a_proc_id[i] = proc_id;
          orig_order[i] = i;
       }
 
       /* now we need to find the actual order of each row  - sort on row -
-         this will result in proc ids sorted also...*/
+         this will result in proc ids sorted also.  Rows that are already
+         binned by owner (in increasing order) need no sort */
+      for (i = 1; i < num_rows; i++)
+      {
+         if (row_list[i] < row_list[i - 1])
+         {
+            break;
+         }
+      }
+      if (i < num_rows)
+      {
+         hypre_BigRadixSortbi(num_rows, row_list, orig_order);
+      }
 
-      hypre_BigQsortb2i(row_list, a_proc_id, orig_order, 0, num_rows - 1);
+      for (i = 0; i < num_rows; i++)
+      {
+         hypre_GetAssumedPartitionProcFromRow(comm, row_list[i], global_first_row,
+                                              global_num_cols, &proc_id);
+         a_proc_id[i] = proc_id;
+      }
 
       /* calculate the number of contacts */
       ex_num_contacts = 1;
@@ -2118,69 +2277,79 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    }
    hypre_TFree(real_proc_id, HYPRE_MEMORY_HOST);
 
+   /* find the position of each row in the contact buffer - rows are packed
+      in their original order, after the number of rows for the processor */
+   row_pos  = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   data_pos = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
    counter = 0; /* index into data arrays */
-   prev_id = -1;
    for (i = 0; i < num_rows; i++)
    {
       proc_id = us_real_proc_id[i];
-      /* can't use row list[i] - you loose the negative signs that differentiate
-         add/set values */
-      row = off_proc_i[i * 2];
       num_elements = row_list_num_elements[i];
       /* find position of this processor */
       indx = hypre_BinarySearch(ex_contact_procs, proc_id, num_real_procs);
       in_i = ex_contact_vec_starts[indx];
 
-      index_ptr = (void *) ((char *) void_contact_buf + in_i * obj_size_bytes);
-
       /* first time for this processor - add the number of rows to the buffer */
       if (in_i < 0)
       {
          in_i = -in_i - 1;
-         /* re-calc. index_ptr since in_i was negative */
          index_ptr = (void *) ((char *) void_contact_buf + in_i * obj_size_bytes);
 
          tmp_int =  num_rows_per_proc[indx];
          hypre_TMemcpy( index_ptr,  &tmp_int, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
 
          in_i++;
       }
+      row_pos[i]  = in_i;
+      data_pos[i] = counter;
+      counter += num_elements;
+
+      /* row #, no. elements, col indices and data */
+      ex_contact_vec_starts[indx] = in_i + 2 + 2 * num_elements;
+   }
+
+   /* pack the rows */
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i, j, index_ptr, row, num_elements, tmp_big_int, tmp_complex) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      /* can't use row list[i] - it is sorted */
+      row = off_proc_i[i * 2];
+      num_elements = row_list_num_elements[i];
+      index_ptr = (void *) ((char *) void_contact_buf + row_pos[i] * obj_size_bytes);
+
       /* add row # */
       hypre_TMemcpy( index_ptr,  &row, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
       index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-      in_i++;
 
       /* add number of elements */
       hypre_TMemcpy( index_ptr,  &num_elements, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
       index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-      in_i++;
 
       /* now add col indices  */
       for (j = 0; j < num_elements; j++)
       {
-         tmp_big_int = off_proc_j[counter + j]; /* col number */
+         tmp_big_int = off_proc_j[data_pos[i] + j]; /* col number */
 
          hypre_TMemcpy( index_ptr,  &tmp_big_int, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
          index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-         in_i ++;
       }
 
       /* now add data */
       for (j = 0; j < num_elements; j++)
       {
-         tmp_complex = off_proc_data[counter++]; /* value */
+         tmp_complex = off_proc_data[data_pos[i] + j]; /* value */
 
          hypre_TMemcpy( index_ptr,  &tmp_complex, HYPRE_Complex, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
          index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
-         in_i++;
       }
-
-      /* increment the indexes to keep track of where we are - we
-       * adjust below to be actual starts*/
-      ex_contact_vec_starts[indx] = in_i;
    }
 
+   hypre_TFree(row_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(data_pos, HYPRE_MEMORY_HOST);
+
    /* some clean up */
 
    hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
@@ -2257,118 +2426,87 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_qsort2i( send_proc_obj.id, argsort_contact_procs, 0, num_recvs - 1 );
 
    /* alias */
-   recv_data_ptr = send_proc_obj.v_elements;
    recv_starts = send_proc_obj.vec_starts;
 
+   /* first find the rows in the received messages, in processor order */
+   num_recv_rows = 0;
    for (i = 0; i < num_recvs; i++)
    {
+      indx = recv_starts[argsort_contact_procs[i]];
+      recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements + indx * obj_size_bytes);
+      hypre_TMemcpy( &num_rows, recv_data_ptr, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      num_recv_rows += num_rows;
+   }
 
+   recv_row_pos  = hypre_TAlloc(HYPRE_Int, num_recv_rows + 1, HYPRE_MEMORY_HOST);
+   recv_elmt_pos = hypre_TAlloc(HYPRE_Int, num_recv_rows + 1, HYPRE_MEMORY_HOST);
+   counter = 0;
+   off_proc_nelm_recv_cur = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
       /* Find the current processor in order, and reset recv_data_ptr to that processor's message */
       original_proc_indx = argsort_contact_procs[i];
-      /*current_proc = send_proc_obj.id[i];*/
       indx = recv_starts[original_proc_indx];
       recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements + indx * obj_size_bytes);
 
       /* get the number of rows for this recv */
       hypre_TMemcpy( &num_rows, recv_data_ptr, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-      recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
       indx++;
 
-
-      for (j = 0; j < num_rows; j++) /* for each row: unpack info */
+      for (j = 0; j < num_rows; j++) /* for each row: row #, num elements, cols, data */
       {
-         /* row # */
-         hypre_TMemcpy( &row,  recv_data_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-         indx++;
-
-         /* num elements for this row */
+         recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements + (indx + 1) * obj_size_bytes);
          hypre_TMemcpy( &num_elements,  recv_data_ptr, HYPRE_Int, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-         recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-         indx++;
-
-         /* col indices */ /* Need to check this again !!!! */
-         if (big_int_size == obj_size_bytes)
-         {
-            col_ptr = (HYPRE_BigInt *) recv_data_ptr;
-            recv_data_ptr = (void *) ((char *)recv_data_ptr + num_elements * obj_size_bytes);
-         }
-         else /* copy data */
-         {
-            if (big_int_data_size < num_elements)
-            {
-               big_int_data = hypre_TReAlloc(big_int_data,  HYPRE_BigInt,  num_elements + 10, HYPRE_MEMORY_HOST);
-            }
-            for (k = 0; k < num_elements; k++)
-            {
-               hypre_TMemcpy( &big_int_data[k],  recv_data_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST,
-                              HYPRE_MEMORY_HOST);
-               recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-            }
-            col_ptr = big_int_data;
-         }
 
-         /* col data */
-         if (complex_size == obj_size_bytes)
-         {
-            col_data_ptr = (HYPRE_Complex *) recv_data_ptr;
-            recv_data_ptr = (void *) ((char *)recv_data_ptr + num_elements * obj_size_bytes);
-         }
-         else /* copy data */
-         {
-            if (complex_data_size < num_elements)
-            {
-               complex_data =
-                  hypre_TReAlloc(complex_data,  HYPRE_Complex,  num_elements + 10, HYPRE_MEMORY_HOST);
-            }
-            for (k = 0; k < num_elements; k++)
-            {
-               hypre_TMemcpy( &complex_data[k],  recv_data_ptr, HYPRE_Complex, 1, HYPRE_MEMORY_HOST,
-                              HYPRE_MEMORY_HOST);
-               recv_data_ptr = (void *) ((char *)recv_data_ptr + obj_size_bytes);
-            }
-            col_data_ptr = complex_data;
+         recv_row_pos[counter]  = indx;
+         recv_elmt_pos[counter] = off_proc_nelm_recv_cur;
+         counter++;
 
-         }
+         off_proc_nelm_recv_cur += num_elements;
+         indx += 2 + 2 * num_elements;
+      }
+   }
+   recv_elmt_pos[num_recv_rows] = off_proc_nelm_recv_cur;
 
-         if (memory_location == HYPRE_MEMORY_HOST)
-         {
-            hypre_IJMatrixAddToValuesParCSR(matrix, 1, &num_elements, &row, &row_index, col_ptr, col_data_ptr);
-         }
-         else
-         {
-            HYPRE_Int nelm_new = off_proc_nelm_recv_cur + num_elements;
+   /* unpack the received entries */
+   off_proc_i_recv    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_HOST);
+   off_proc_j_recv    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_HOST);
+   off_proc_data_recv = hypre_TAlloc(HYPRE_Complex, off_proc_nelm_recv_cur, HYPRE_MEMORY_HOST);
 
-            if (nelm_new > off_proc_nelm_recv_max)
-            {
-               off_proc_nelm_recv_max = nelm_new * 2;
-               off_proc_i_recv    = hypre_TReAlloc(off_proc_i_recv,    HYPRE_BigInt,  off_proc_nelm_recv_max,
-                                                   HYPRE_MEMORY_HOST);
-               off_proc_j_recv    = hypre_TReAlloc(off_proc_j_recv,    HYPRE_BigInt,  off_proc_nelm_recv_max,
-                                                   HYPRE_MEMORY_HOST);
-               off_proc_data_recv = hypre_TReAlloc(off_proc_data_recv, HYPRE_Complex, off_proc_nelm_recv_max,
-                                                   HYPRE_MEMORY_HOST);
-            }
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i, k, recv_data_ptr, row, num_elements) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_recv_rows; i++)
+   {
+      recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements + recv_row_pos[i] * obj_size_bytes);
+      hypre_TMemcpy( &row,  recv_data_ptr, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
 
-            HYPRE_Int i;
-            for (i = 0; i < num_elements; i++)
-            {
-               off_proc_i_recv[off_proc_nelm_recv_cur + i] = row;
-            }
-            hypre_TMemcpy(off_proc_j_recv + off_proc_nelm_recv_cur, col_ptr, HYPRE_BigInt, num_elements,
-                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
-            hypre_TMemcpy(off_proc_data_recv + off_proc_nelm_recv_cur, col_data_ptr, HYPRE_Complex,
-                          num_elements,
-                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      num_elements = recv_elmt_pos[i + 1] - recv_elmt_pos[i];
+      for (k = 0; k < num_elements; k++)
+      {
+         off_proc_i_recv[recv_elmt_pos[i] + k] = row;
 
-            off_proc_nelm_recv_cur = nelm_new;
-         }
+         recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements +
+                                   (recv_row_pos[i] + 2 + k) * obj_size_bytes);
+         hypre_TMemcpy( &off_proc_j_recv[recv_elmt_pos[i] + k], recv_data_ptr, HYPRE_BigInt, 1,
+                        HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
 
-         indx += (num_elements * 2);
+         recv_data_ptr = (void *) ((char *) send_proc_obj.v_elements +
+                                   (recv_row_pos[i] + 2 + num_elements + k) * obj_size_bytes);
+         hypre_TMemcpy( &off_proc_data_recv[recv_elmt_pos[i] + k], recv_data_ptr, HYPRE_Complex, 1,
+                        HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
       }
    }
 
-   if (memory_location == HYPRE_MEMORY_DEVICE)
+   hypre_TFree(recv_row_pos, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_elmt_pos, HYPRE_MEMORY_HOST);
+
+   if (memory_location == HYPRE_MEMORY_HOST)
+   {
+      hypre_IJMatrixAddMergedOffProcValsParCSR(matrix, off_proc_nelm_recv_cur, off_proc_i_recv,
+                                               off_proc_j_recv, off_proc_data_recv);
+   }
+   else
    {
       off_proc_i_recv_d    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_DEVICE);
       off_proc_j_recv_d    = hypre_TAlloc(HYPRE_BigInt,  off_proc_nelm_recv_cur, HYPRE_MEMORY_DEVICE);
@@ -2393,16 +2531,6 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    hypre_TFree(send_proc_obj.id, HYPRE_MEMORY_HOST);
    hypre_TFree(argsort_contact_procs, HYPRE_MEMORY_HOST);
 
-   if (big_int_data)
-   {
-      hypre_TFree(big_int_data, HYPRE_MEMORY_HOST);
-   }
-
-   if (complex_data)
-   {
-      hypre_TFree(complex_data, HYPRE_MEMORY_HOST);
-   }
-
    if (memory_location == HYPRE_MEMORY_DEVICE)
    {
       hypre_TFree(off_proc_i,    HYPRE_MEMORY_HOST);
@@ -0,0 +1,313 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR interface for adopting a caller-owned local CSR matrix
+ *
+ * The local rows are given in CSR format with global column indices.  The
+ * diag part is compacted in place in the caller's column and value arrays,
+ * only the offd part is copied out, and nothing is staged in an auxiliary
+ * matrix.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+#include "../HYPRE.h"
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixAdoptCSRParCSR
+ *
+ * Builds the ParCSR object of 'matrix' from the local CSR matrix (row_ptr,
+ * cols, values).  The arrays must live in host memory and are reordered in
+ * place.  If 'owns_data' is nonzero, they must have been allocated with
+ * hypre_TAlloc on HYPRE_MEMORY_HOST, and they are freed by hypre (either here
+ * or when the matrix is destroyed); otherwise they must outlive the matrix.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixAdoptCSRParCSR( hypre_IJMatrix *matrix,
+                              HYPRE_Int      *row_ptr,
+                              HYPRE_BigInt   *cols,
+                              HYPRE_Complex  *values,
+                              HYPRE_Int       owns_data )
+{
+   HYPRE_BigInt       *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt       *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt        base             = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int           num_rows         = (HYPRE_Int)(row_partitioning[1] - row_partitioning[0]);
+   HYPRE_BigInt        col_0            = col_partitioning[0];
+   HYPRE_BigInt        col_n            = col_partitioning[1] - 1;
+   HYPRE_Int           max_num_threads  = hypre_NumThreads();
+
+   hypre_ParCSRMatrix *par_matrix;
+   hypre_CSRMatrix    *diag;
+   hypre_CSRMatrix    *offd;
+   HYPRE_Int          *diag_i;
+   HYPRE_Int          *diag_j;
+   HYPRE_Complex      *diag_data;
+   HYPRE_Int          *offd_i;
+   HYPRE_Int          *offd_j = NULL;
+   HYPRE_Complex      *offd_data = NULL;
+   HYPRE_BigInt       *big_offd_j = NULL;
+   HYPRE_BigInt       *col_map_offd = NULL;
+   HYPRE_BigInt       *tmp_j, *work_j, *sorted_j;
+   HYPRE_Int          *row_starts;
+   HYPRE_Int          *diag_starts;
+   HYPRE_Int          *offd_starts;
+   HYPRE_Int           num_threads = 1;
+   HYPRE_Int           nnz_diag, nnz_offd, num_cols_offd = 0;
+   HYPRE_Int           i, t;
+
+   if (hypre_GetActualMemLocation(hypre_HandleMemoryLocation(hypre_handle())) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Adopting CSR arrays is only supported in host memory");
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_IJMatrixCreateParCSR(matrix);
+   par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   offd       = hypre_ParCSRMatrixOffd(par_matrix);
+
+   diag_i      = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   offd_i      = hypre_TAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   row_starts  = hypre_TAlloc(HYPRE_Int, max_num_threads + 1, HYPRE_MEMORY_HOST);
+   diag_starts = hypre_TAlloc(HYPRE_Int, max_num_threads + 1, HYPRE_MEMORY_HOST);
+   offd_starts = hypre_TAlloc(HYPRE_Int, max_num_threads + 1, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_MIXEDINT
+   /* the local column indices cannot overwrite the global ones */
+   diag_j = hypre_TAlloc(HYPRE_Int, row_ptr[num_rows], HYPRE_MEMORY_HOST);
+#else
+   diag_j = cols;
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel private(i, t)
+#endif
+   {
+      HYPRE_Int      my_thread_num = hypre_GetThreadNum();
+      HYPRE_Int      nthreads      = hypre_NumActiveThreads();
+      HYPRE_Int      ns, ne, j, jj, w, w_row, j_shift;
+      HYPRE_Int      n_diag, n_offd;
+      HYPRE_BigInt   col;
+      HYPRE_Complex  temp;
+
+      hypre_partition1D(num_rows, nthreads, my_thread_num, &ns, &ne);
+
+      /* count diag and offd entries of my rows */
+      n_diag = n_offd = 0;
+      for (i = ns; i < ne; i++)
+      {
+         for (j = row_ptr[i]; j < row_ptr[i + 1]; j++)
+         {
+            if (cols[j] < col_0 || cols[j] > col_n)
+            {
+               n_offd++;
+            }
+            else
+            {
+               n_diag++;
+            }
+         }
+      }
+      row_starts[my_thread_num]      = ns;
+      diag_starts[my_thread_num + 1] = n_diag;
+      offd_starts[my_thread_num + 1] = n_offd;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+      if (my_thread_num == 0)
+      {
+         num_threads = nthreads;
+         row_starts[nthreads] = num_rows;
+         diag_starts[0] = offd_starts[0] = 0;
+         for (t = 0; t < nthreads; t++)
+         {
+            diag_starts[t + 1] += diag_starts[t];
+            offd_starts[t + 1] += offd_starts[t];
+         }
+         diag_i[num_rows] = diag_starts[nthreads];
+         offd_i[num_rows] = offd_starts[nthreads];
+
+         big_offd_j = hypre_TAlloc(HYPRE_BigInt,  offd_i[num_rows], HYPRE_MEMORY_HOST);
+         offd_data  = hypre_TAlloc(HYPRE_Complex, offd_i[num_rows], HYPRE_MEMORY_HOST);
+      }
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp barrier
+#endif
+
+      /* Copy out the offd entries and compact the diag entries of my rows to
+       * the front of my part of the arrays, diagonal element first */
+#ifdef HYPRE_MIXEDINT
+      j_shift = diag_starts[my_thread_num] - (ns < ne ? row_ptr[ns] : 0);
+#else
+      j_shift = 0;
+#endif
+      n_offd = offd_starts[my_thread_num];
+      w = (ns < ne) ? row_ptr[ns] : 0;
+      for (i = ns; i < ne; i++)
+      {
+         diag_i[i] = diag_starts[my_thread_num] + w - row_ptr[ns];
+         offd_i[i] = n_offd;
+         w_row = w;
+         for (j = row_ptr[i]; j < row_ptr[i + 1]; j++)
+         {
+            col = cols[j];
+            if (col < col_0 || col > col_n)
+            {
+               big_offd_j[n_offd] = col;
+               offd_data[n_offd++] = values[j];
+            }
+            else
+            {
+               jj = (HYPRE_Int)(col - col_0);
+               values[w] = values[j];
+               if (jj == i && w > w_row)
+               {
+                  diag_j[w + j_shift] = diag_j[w_row + j_shift];
+                  diag_j[w_row + j_shift] = jj;
+                  temp = values[w_row];
+                  values[w_row] = values[w];
+                  values[w] = temp;
+               }
+               else
+               {
+                  diag_j[w + j_shift] = jj;
+               }
+               w++;
+            }
+         }
+      }
+   } /* end parallel region */
+
+   /* Move the compacted chunks down in thread order.  Destinations never lie
+    * past their sources, so a forward copy is safe. */
+   for (t = 0; t < num_threads; t++)
+   {
+      HYPRE_Int src = (row_starts[t] < num_rows) ? row_ptr[row_starts[t]] : 0;
+      HYPRE_Int dst = diag_starts[t];
+
+      if (src != dst)
+      {
+         for (i = 0; i < diag_starts[t + 1] - dst; i++)
+         {
+            values[dst + i] = values[src + i];
+#ifndef HYPRE_MIXEDINT
+            diag_j[dst + i] = diag_j[src + i];
+#endif
+         }
+      }
+   }
+   nnz_diag = diag_i[num_rows];
+   nnz_offd = offd_i[num_rows];
+
+   hypre_TFree(row_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(diag_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_starts, HYPRE_MEMORY_HOST);
+
+   /* generate col_map_offd with a threaded sort */
+   if (nnz_offd)
+   {
+      tmp_j  = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+      work_j = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(tmp_j, big_offd_j, HYPRE_BigInt, nnz_offd,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_big_merge_sort(tmp_j, work_j, nnz_offd, &sorted_j);
+
+      num_cols_offd = 1;
+      for (i = 1; i < nnz_offd; i++)
+      {
+         if (sorted_j[i] > sorted_j[num_cols_offd - 1])
+         {
+            sorted_j[num_cols_offd++] = sorted_j[i];
+         }
+      }
+      col_map_offd = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(col_map_offd, sorted_j, HYPRE_BigInt, num_cols_offd,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TFree(tmp_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(work_j, HYPRE_MEMORY_HOST);
+
+      offd_j = hypre_TAlloc(HYPRE_Int, nnz_offd, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < nnz_offd; i++)
+      {
+         offd_j[i] = hypre_BigBinarySearch(col_map_offd, big_offd_j[i], num_cols_offd);
+      }
+
+      if (base)
+      {
+         for (i = 0; i < num_cols_offd; i++)
+         {
+            col_map_offd[i] -= base;
+         }
+      }
+   }
+   hypre_TFree(big_offd_j, HYPRE_MEMORY_HOST);
+   if (!nnz_offd)
+   {
+      hypre_TFree(offd_data, HYPRE_MEMORY_HOST);
+   }
+
+   /* hand the arrays over to the ParCSR matrix */
+#ifdef HYPRE_MIXEDINT
+   if (owns_data)
+   {
+      hypre_TFree(cols, HYPRE_MEMORY_HOST);
+      diag_data = values;
+   }
+   else
+   {
+      /* diag owns both of its arrays, so the values must be copied */
+      diag_data = hypre_TAlloc(HYPRE_Complex, nnz_diag, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(diag_data, values, HYPRE_Complex, nnz_diag,
+                    HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+   hypre_CSRMatrixOwnsData(diag) = 1;
+#else
+   diag_data = values;
+   hypre_CSRMatrixOwnsData(diag) = owns_data ? 1 : 0;
+#endif
+   if (owns_data)
+   {
+      hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_CSRMatrixI(diag)           = diag_i;
+   hypre_CSRMatrixJ(diag)           = diag_j;
+   hypre_CSRMatrixData(diag)        = diag_data;
+   hypre_CSRMatrixNumNonzeros(diag) = nnz_diag;
+
+   hypre_CSRMatrixI(offd)           = offd_i;
+   hypre_CSRMatrixJ(offd)           = offd_j;
+   hypre_CSRMatrixData(offd)        = offd_data;
+   hypre_CSRMatrixNumNonzeros(offd) = nnz_offd;
+   hypre_CSRMatrixNumCols(offd)     = num_cols_offd;
+   hypre_ParCSRMatrixColMapOffd(par_matrix) = col_map_offd;
+
+   hypre_CSRMatrixSetRownnz(diag);
+   hypre_CSRMatrixSetRownnz(offd);
+   hypre_MatvecCommPkgCreate(par_matrix);
+
+   hypre_IJMatrixAssembleFlag(matrix) = 1;
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,627 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * IJMatrix_ParCSR frozen pattern interface
+ *
+ * After assembly, a fixed list of (row, col) entries is mapped once to offsets
+ * into the diag and offd data of the ParCSR matrix, and the entries in rows
+ * owned by other processors are bound to a persistent exchange.  Value updates
+ * for the same list then need no searching, stashing or reassembly.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+#include "../HYPRE.h"
+
+#define HYPRE_IJ_FROZEN_TAG 237
+
+/*--------------------------------------------------------------------------
+ * Returns the encoded data offset of entry (row_local, col) of the ParCSR
+ * matrix, or -1 if the entry is not in its structure.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJFrozenPatternOffset( hypre_IJMatrix *matrix,
+                             HYPRE_Int       row_local,
+                             HYPRE_BigInt    col )
+{
+   hypre_ParCSRMatrix *par_matrix    = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix    *diag          = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix    *offd          = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int          *diag_i        = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j        = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i        = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j        = hypre_CSRMatrixJ(offd);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt       *col_map_offd  = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt       *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   HYPRE_BigInt        first         = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int           j, j_offd;
+
+   if (col >= col_partitioning[0] && col < col_partitioning[1])
+   {
+      for (j = diag_i[row_local]; j < diag_i[row_local + 1]; j++)
+      {
+         if (diag_j[j] == (HYPRE_Int)(col - col_partitioning[0]))
+         {
+            return j;
+         }
+      }
+   }
+   else if (num_cols_offd)
+   {
+      j_offd = hypre_BigBinarySearch(col_map_offd, col - first, num_cols_offd);
+      if (j_offd > -1)
+      {
+         for (j = offd_i[row_local]; j < offd_i[row_local + 1]; j++)
+         {
+            if (offd_j[j] == j_offd)
+            {
+               return hypre_CSRMatrixNumNonzeros(diag) + j;
+            }
+         }
+      }
+   }
+
+   return -1;
+}
+
+/*--------------------------------------------------------------------------
+ * Finds the owners of the sorted, unique off-processor rows 'rows' through
+ * the assumed partition of the IJ matrix.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJFrozenPatternRowOwners( hypre_IJMatrix *matrix,
+                                HYPRE_Int       num_rows,
+                                HYPRE_BigInt   *rows,
+                                HYPRE_Int      *owners )
+{
+   MPI_Comm                    comm             = hypre_IJMatrixComm(matrix);
+   HYPRE_BigInt                global_first_row = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_BigInt                global_num_rows  = hypre_IJMatrixGlobalNumRows(matrix);
+   hypre_IJAssumedPart        *apart;
+
+   HYPRE_Int                   ex_num_contacts;
+   HYPRE_Int                  *ex_contact_procs;
+   HYPRE_Int                  *ex_contact_vec_starts;
+   HYPRE_BigInt               *ex_contact_buf;
+   HYPRE_BigInt               *response_buf = NULL;
+   HYPRE_Int                  *response_buf_starts = NULL;
+   hypre_DataExchangeResponse  response_obj;
+
+   HYPRE_BigInt                range_start, range_end, upper_bound;
+   HYPRE_Int                   num_ranges, proc_id;
+   HYPRE_Int                   i, j;
+
+   if (hypre_IJMatrixAssumedPart(matrix) == NULL)
+   {
+      hypre_IJMatrixCreateAssumedPartition(matrix);
+   }
+   apart = (hypre_IJAssumedPart *) hypre_IJMatrixAssumedPart(matrix);
+
+   /* contact the assumed owner of each range of rows */
+   ex_contact_procs      = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   ex_contact_vec_starts = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   ex_contact_buf        = hypre_CTAlloc(HYPRE_BigInt, 2 * num_rows, HYPRE_MEMORY_HOST);
+
+   ex_num_contacts = 0;
+   range_end = -1;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (rows[i] > range_end)
+      {
+         hypre_GetAssumedPartitionProcFromRow(comm, rows[i], global_first_row,
+                                              global_num_rows, &proc_id);
+         if (ex_num_contacts > 0)
+         {
+            ex_contact_buf[2 * ex_num_contacts - 1] = rows[i - 1];
+         }
+         ex_contact_procs[ex_num_contacts]      = proc_id;
+         ex_contact_vec_starts[ex_num_contacts] = 2 * ex_num_contacts;
+         ex_contact_buf[2 * ex_num_contacts]    = rows[i];
+         ex_num_contacts++;
+
+         hypre_GetAssumedPartitionRowRange(comm, proc_id, global_first_row,
+                                           global_num_rows, &range_start, &range_end);
+      }
+   }
+   ex_contact_vec_starts[ex_num_contacts] = 2 * ex_num_contacts;
+   if (ex_num_contacts > 0)
+   {
+      ex_contact_buf[2 * ex_num_contacts - 1] = rows[num_rows - 1];
+   }
+
+   response_obj.fill_response = hypre_RangeFillResponseIJDetermineRecvProcs;
+   response_obj.data1 = apart;
+   response_obj.data2 = NULL;
+
+   hypre_DataExchangeList(ex_num_contacts, ex_contact_procs,
+                          ex_contact_buf, ex_contact_vec_starts, sizeof(HYPRE_BigInt),
+                          sizeof(HYPRE_BigInt), &response_obj, 6, 1,
+                          comm, (void **) &response_buf, &response_buf_starts);
+
+   /* the response is a list of (proc id, range upper bound) pairs */
+   num_ranges = response_buf_starts[ex_num_contacts] / 2;
+   j = 0;
+   for (i = 0; i < num_ranges; i++)
+   {
+      upper_bound = response_buf[2 * i + 1];
+      while (j < num_rows && rows[j] <= upper_bound)
+      {
+         owners[j++] = (HYPRE_Int) response_buf[2 * i];
+      }
+   }
+
+   hypre_TFree(ex_contact_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(ex_contact_vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(ex_contact_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Sorts the (key, value) pairs by key and then by value within equal keys.
+ * On return, starts[0:num_keys] delimits the runs of equal keys and keys
+ * holds one entry per run.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJFrozenPatternGroup( HYPRE_Int   n,
+                            HYPRE_Int  *keys,
+                            HYPRE_Int  *values,
+                            HYPRE_Int  *num_keys_ptr,
+                            HYPRE_Int **starts_ptr )
+{
+   HYPRE_Int  *starts;
+   HYPRE_Int   num_keys, i, j;
+
+   hypre_qsort2i(keys, values, 0, n - 1);
+
+   starts = hypre_TAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+   num_keys = 0;
+   for (i = 0; i < n; i = j)
+   {
+      for (j = i + 1; j < n && keys[j] == keys[i]; j++);
+      hypre_qsort0(values, i, j - 1);
+      keys[num_keys]     = keys[i];
+      starts[num_keys++] = i;
+   }
+   starts[num_keys] = n;
+
+   *num_keys_ptr = num_keys;
+   *starts_ptr   = starts;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixFreezePatternParCSR
+ *
+ * Builds the frozen pattern for the 'nentries' entries (rows[k], cols[k]).
+ * Rows may be owned by other processors; repeated entries are summed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixFreezePatternParCSR( hypre_IJMatrix     *matrix,
+                                   HYPRE_Int           nentries,
+                                   const HYPRE_BigInt *rows,
+                                   const HYPRE_BigInt *cols )
+{
+   MPI_Comm                comm             = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix     *par_matrix       = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_BigInt           *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt            global_first_row = hypre_IJMatrixGlobalFirstRow(matrix);
+   HYPRE_BigInt            global_num_rows  = hypre_IJMatrixGlobalNumRows(matrix);
+   hypre_IJFrozenPattern  *pattern;
+
+   HYPRE_Int               num_loc, num_off, num_recv_pairs, num_slots, num_urows;
+   HYPRE_Int              *tgt, *src, *off_perm, *slot_starts, *owners;
+   HYPRE_BigInt           *off_rows, *off_cols, *slot_rows, *urows, *send_pairs;
+   HYPRE_Int               num_sends, *send_procs, *send_starts, *contact_starts;
+   HYPRE_Int               num_recvs, *recv_procs, *recv_starts, *orig_order;
+   HYPRE_BigInt           *response_buf = NULL;
+   HYPRE_Int              *response_buf_starts = NULL;
+   hypre_ProcListElements  send_proc_obj;
+   hypre_DataExchangeResponse response_obj;
+
+   HYPRE_BigInt            row;
+   HYPRE_Int               offset, not_found, i, j, k, m, p, sz;
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(par_matrix)) !=
+       hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Frozen patterns are only supported for host matrices");
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixFrozenPatternDestroy(matrix);
+
+   /*-----------------------------------------------------------------------
+    * Map the locally owned entries and collect the off-processor ones
+    *-----------------------------------------------------------------------*/
+
+   tgt      = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   src      = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   off_perm = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+   off_rows = hypre_TAlloc(HYPRE_BigInt, nentries, HYPRE_MEMORY_HOST);
+
+   not_found = 0;
+   num_loc = num_off = 0;
+   for (k = 0; k < nentries; k++)
+   {
+      row = rows[k];
+      if (row >= row_partitioning[0] && row < row_partitioning[1])
+      {
+         offset = hypre_IJFrozenPatternOffset(matrix, (HYPRE_Int)(row - row_partitioning[0]),
+                                              cols[k]);
+         if (offset < 0)
+         {
+            not_found++;
+            continue;
+         }
+         tgt[num_loc]   = offset;
+         src[num_loc++] = k;
+      }
+      else if (row >= global_first_row && row < global_first_row + global_num_rows)
+      {
+         off_rows[num_off]   = row;
+         off_perm[num_off++] = k;
+      }
+      else
+      {
+         not_found++;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Merge repeated off-processor entries into send slots ordered by
+    * (row, col).  Rows are owned by ascending ranks, so slots are grouped
+    * by destination.
+    *-----------------------------------------------------------------------*/
+
+   hypre_BigQsortbi(off_rows, off_perm, 0, num_off - 1);
+   off_cols = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_off; i++)
+   {
+      off_cols[i] = cols[off_perm[i]];
+   }
+   for (i = 0; i < num_off; i = j)
+   {
+      for (j = i + 1; j < num_off && off_rows[j] == off_rows[i]; j++);
+      hypre_BigQsortbi(off_cols, off_perm, i, j - 1);
+   }
+
+   slot_starts = hypre_TAlloc(HYPRE_Int, num_off + 1, HYPRE_MEMORY_HOST);
+   slot_rows   = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   urows       = hypre_TAlloc(HYPRE_BigInt, num_off, HYPRE_MEMORY_HOST);
+   send_pairs  = hypre_TAlloc(HYPRE_BigInt, 2 * num_off, HYPRE_MEMORY_HOST);
+   num_slots = num_urows = 0;
+   for (i = 0; i < num_off; i = j)
+   {
+      for (j = i + 1; j < num_off && off_rows[j] == off_rows[i] &&
+           off_cols[j] == off_cols[i]; j++);
+      hypre_qsort0(off_perm, i, j - 1);
+      if (num_urows == 0 || urows[num_urows - 1] != off_rows[i])
+      {
+         urows[num_urows++] = off_rows[i];
+      }
+      slot_rows[num_slots] = off_rows[i];
+      send_pairs[2 * num_slots]     = off_rows[i];
+      send_pairs[2 * num_slots + 1] = off_cols[i];
+      slot_starts[num_slots++] = i;
+   }
+   slot_starts[num_slots] = num_off;
+
+   hypre_TFree(off_rows, HYPRE_MEMORY_HOST);
+   hypre_TFree(off_cols, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Find the owners of the slots and send them the (row, col) pairs
+    *-----------------------------------------------------------------------*/
+
+   owners = hypre_TAlloc(HYPRE_Int, num_urows, HYPRE_MEMORY_HOST);
+   hypre_IJFrozenPatternRowOwners(matrix, num_urows, urows, owners);
+
+   send_procs  = hypre_TAlloc(HYPRE_Int, num_urows, HYPRE_MEMORY_HOST);
+   send_starts = hypre_TAlloc(HYPRE_Int, num_urows + 1, HYPRE_MEMORY_HOST);
+   num_sends = 0;
+   for (i = 0, k = 0; i < num_slots; i++)
+   {
+      while (urows[k] != slot_rows[i])
+      {
+         k++;
+      }
+      if (num_sends == 0 || send_procs[num_sends - 1] != owners[k])
+      {
+         send_procs[num_sends]    = owners[k];
+         send_starts[num_sends++] = i;
+      }
+   }
+   send_starts[num_sends] = num_slots;
+
+   hypre_TFree(owners, HYPRE_MEMORY_HOST);
+   hypre_TFree(urows, HYPRE_MEMORY_HOST);
+   hypre_TFree(slot_rows, HYPRE_MEMORY_HOST);
+
+   contact_starts = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= num_sends; i++)
+   {
+      contact_starts[i] = 2 * send_starts[i];
+   }
+
+   send_proc_obj.length = 0;
+   send_proc_obj.storage_length = num_sends + 5;
+   send_proc_obj.id = hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length, HYPRE_MEMORY_HOST);
+   send_proc_obj.vec_starts = hypre_CTAlloc(HYPRE_Int, send_proc_obj.storage_length + 1,
+                                            HYPRE_MEMORY_HOST);
+   send_proc_obj.vec_starts[0] = 0;
+   send_proc_obj.element_storage_length = 2 * num_slots + 20;
+   send_proc_obj.elements = hypre_CTAlloc(HYPRE_BigInt, send_proc_obj.element_storage_length,
+                                          HYPRE_MEMORY_HOST);
+
+   response_obj.fill_response = hypre_FillResponseIJDetermineSendProcs;
+   response_obj.data1 = NULL;
+   response_obj.data2 = &send_proc_obj;
+
+   hypre_DataExchangeList(num_sends, send_procs,
+                          send_pairs, contact_starts, sizeof(HYPRE_BigInt),
+                          sizeof(HYPRE_BigInt), &response_obj, 0, 2,
+                          comm, (void **) &response_buf, &response_buf_starts);
+
+   hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_pairs, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Map the received pairs in rank order.  Received value r is source
+    * nentries + r of the local scatter.
+    *-----------------------------------------------------------------------*/
+
+   num_recvs  = send_proc_obj.length;
+   orig_order = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      orig_order[i] = i;
+   }
+   hypre_qsort2i(send_proc_obj.id, orig_order, 0, num_recvs - 1);
+
+   num_recv_pairs = send_proc_obj.vec_starts[num_recvs] / 2;
+   recv_procs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   tgt = hypre_TReAlloc(tgt, HYPRE_Int, num_loc + num_recv_pairs, HYPRE_MEMORY_HOST);
+   src = hypre_TReAlloc(src, HYPRE_Int, num_loc + num_recv_pairs, HYPRE_MEMORY_HOST);
+
+   m = 0;
+   recv_starts[0] = 0;
+   for (p = 0; p < num_recvs; p++)
+   {
+      recv_procs[p] = send_proc_obj.id[p];
+      i  = send_proc_obj.vec_starts[orig_order[p]];
+      sz = (send_proc_obj.vec_starts[orig_order[p] + 1] - i) / 2;
+      for (j = 0; j < sz; j++, m++)
+      {
+         row    = send_proc_obj.elements[i + 2 * j];
+         offset = hypre_IJFrozenPatternOffset(matrix, (HYPRE_Int)(row - row_partitioning[0]),
+                                              send_proc_obj.elements[i + 2 * j + 1]);
+         if (offset < 0)
+         {
+            not_found++;
+            continue;
+         }
+         tgt[num_loc]   = offset;
+         src[num_loc++] = nentries + m;
+      }
+      recv_starts[p + 1] = m;
+   }
+
+   hypre_TFree(orig_order, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.id, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.vec_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_proc_obj.elements, HYPRE_MEMORY_HOST);
+
+   if (not_found)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Frozen pattern entries are not in the matrix structure");
+   }
+
+   /*-----------------------------------------------------------------------
+    * Build the pattern
+    *-----------------------------------------------------------------------*/
+
+   pattern = hypre_CTAlloc(hypre_IJFrozenPattern, 1, HYPRE_MEMORY_HOST);
+
+   pattern -> object   = par_matrix;
+   pattern -> diag_nnz = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(par_matrix));
+   pattern -> offd_nnz = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(par_matrix));
+   pattern -> nentries = nentries;
+
+   /* sort by target, so each target is written by exactly one thread */
+   hypre_IJFrozenPatternGroup(num_loc, tgt, src, &(pattern -> num_targets),
+                              &(pattern -> target_starts));
+   pattern -> targets = tgt;
+   pattern -> sources = src;
+
+   pattern -> num_slots    = num_slots;
+   pattern -> slot_starts  = slot_starts;
+   pattern -> slot_sources = off_perm;
+
+   pattern -> num_sends   = num_sends;
+   pattern -> send_procs  = send_procs;
+   pattern -> send_starts = send_starts;
+   pattern -> num_recvs   = num_recvs;
+   pattern -> recv_procs  = recv_procs;
+   pattern -> recv_starts = recv_starts;
+   pattern -> send_buf    = hypre_CTAlloc(HYPRE_Complex, num_slots, HYPRE_MEMORY_HOST);
+   pattern -> recv_buf    = hypre_CTAlloc(HYPRE_Complex, recv_starts[num_recvs],
+                                          HYPRE_MEMORY_HOST);
+   pattern -> requests    = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs,
+                                          HYPRE_MEMORY_HOST);
+
+   for (p = 0; p < num_recvs; p++)
+   {
+      hypre_MPI_Recv_init(&(pattern -> recv_buf[recv_starts[p]]),
+                          recv_starts[p + 1] - recv_starts[p], HYPRE_MPI_COMPLEX,
+                          recv_procs[p], HYPRE_IJ_FROZEN_TAG, comm,
+                          &(pattern -> requests[p]));
+   }
+   for (p = 0; p < num_sends; p++)
+   {
+      hypre_MPI_Send_init(&(pattern -> send_buf[send_starts[p]]),
+                          send_starts[p + 1] - send_starts[p], HYPRE_MPI_COMPLEX,
+                          send_procs[p], HYPRE_IJ_FROZEN_TAG, comm,
+                          &(pattern -> requests[num_recvs + p]));
+   }
+
+   hypre_IJMatrixFrozenPattern(matrix) = pattern;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixUpdateFrozenValuesParCSR
+ *
+ * Sets (action = 0) or adds (action = 1) the values of the frozen entries.
+ * With action = 0, each entry of the pattern is overwritten with the sum of
+ * all contributions to it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixUpdateFrozenValuesParCSR( hypre_IJMatrix      *matrix,
+                                        const HYPRE_Complex *values,
+                                        HYPRE_Int            action )
+{
+   hypre_IJFrozenPattern *pattern    = (hypre_IJFrozenPattern *) hypre_IJMatrixFrozenPattern(matrix);
+   hypre_ParCSRMatrix    *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix       *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix       *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Complex         *diag_data  = hypre_CSRMatrixData(diag);
+   HYPRE_Complex         *offd_data  = hypre_CSRMatrixData(offd);
+
+   HYPRE_Int              nentries, diag_nnz, num_requests;
+   HYPRE_Int             *targets, *target_starts, *sources;
+   HYPRE_Int             *slot_starts, *slot_sources;
+   HYPRE_Complex         *send_buf, *recv_buf;
+   HYPRE_Complex          sum;
+   HYPRE_Int              i, j, s, o;
+
+   if (!pattern)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix has no frozen pattern");
+      return hypre_error_flag;
+   }
+   if (pattern -> object != par_matrix ||
+       pattern -> diag_nnz != hypre_CSRMatrixNumNonzeros(diag) ||
+       pattern -> offd_nnz != hypre_CSRMatrixNumNonzeros(offd))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matrix structure changed since the pattern was frozen");
+      return hypre_error_flag;
+   }
+
+   nentries      = pattern -> nentries;
+   diag_nnz      = pattern -> diag_nnz;
+   targets       = pattern -> targets;
+   target_starts = pattern -> target_starts;
+   sources       = pattern -> sources;
+   slot_starts   = pattern -> slot_starts;
+   slot_sources  = pattern -> slot_sources;
+   send_buf      = pattern -> send_buf;
+   recv_buf      = pattern -> recv_buf;
+   num_requests  = pattern -> num_sends + pattern -> num_recvs;
+
+   /* pack the off-processor contributions */
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i, j, sum) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < pattern -> num_slots; i++)
+   {
+      sum = 0.0;
+      for (j = slot_starts[i]; j < slot_starts[i + 1]; j++)
+      {
+         sum += values[slot_sources[j]];
+      }
+      send_buf[i] = sum;
+   }
+
+   if (num_requests)
+   {
+      hypre_MPI_Startall(num_requests, pattern -> requests);
+      hypre_MPI_Waitall(num_requests, pattern -> requests, hypre_MPI_STATUSES_IGNORE);
+   }
+
+   /* scatter local and received contributions */
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i, j, s, o, sum) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < pattern -> num_targets; i++)
+   {
+      sum = 0.0;
+      for (j = target_starts[i]; j < target_starts[i + 1]; j++)
+      {
+         s = sources[j];
+         sum += (s < nentries) ? values[s] : recv_buf[s - nentries];
+      }
+
+      o = targets[i];
+      if (o < diag_nnz)
+      {
+         diag_data[o] = action ? diag_data[o] + sum : sum;
+      }
+      else
+      {
+         offd_data[o - diag_nnz] = action ? offd_data[o - diag_nnz] + sum : sum;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixFrozenPatternDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_IJMatrixFrozenPatternDestroy( hypre_IJMatrix *matrix )
+{
+   hypre_IJFrozenPattern *pattern = (hypre_IJFrozenPattern *) hypre_IJMatrixFrozenPattern(matrix);
+   HYPRE_Int              i;
+
+   if (pattern)
+   {
+      for (i = 0; i < (pattern -> num_sends + pattern -> num_recvs); i++)
+      {
+         hypre_MPI_Request_free(&(pattern -> requests[i]));
+      }
+      hypre_TFree(pattern -> requests, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> targets, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> target_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> sources, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> slot_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> slot_sources, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> send_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> send_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> recv_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> recv_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> send_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern -> recv_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(pattern, HYPRE_MEMORY_HOST);
+
+      hypre_IJMatrixFrozenPattern(matrix) = NULL;
+   }
+
+   return hypre_error_flag;
+}
@@ -14,6 +14,46 @@
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJFrozenPattern:
+ *
+ * Precomputed map from a fixed list of (row, col) entries to offsets into the
+ * diag and offd data of an assembled ParCSR matrix.  Values are gathered from
+ * the combined array [caller values, received values]; an offset o refers to
+ * diag data if o < diag_nnz and to offd data at (o - diag_nnz) otherwise.
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_IJFrozenPattern_struct
+{
+   void              *object;          /* ParCSR matrix the map was built for */
+   HYPRE_Int          diag_nnz;
+   HYPRE_Int          offd_nnz;
+   HYPRE_Int          nentries;        /* number of caller entries */
+
+   /* local scatter: sources of target i are sources[target_starts[i]:...] */
+   HYPRE_Int          num_targets;
+   HYPRE_Int         *targets;
+   HYPRE_Int         *target_starts;
+   HYPRE_Int         *sources;
+
+   /* off-process entries: send slot i sums caller values slot_sources[...] */
+   HYPRE_Int          num_slots;
+   HYPRE_Int         *slot_starts;
+   HYPRE_Int         *slot_sources;
+
+   /* persistent exchange of slot values */
+   HYPRE_Int          num_sends;
+   HYPRE_Int         *send_procs;
+   HYPRE_Int         *send_starts;
+   HYPRE_Int          num_recvs;
+   HYPRE_Int         *recv_procs;
+   HYPRE_Int         *recv_starts;
+   HYPRE_Complex     *send_buf;
+   HYPRE_Complex     *recv_buf;
+   hypre_MPI_Request *requests;
+
+} hypre_IJFrozenPattern;
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -39,6 +79,7 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
+   void         *frozen_pattern;      /* optional value-only update map */
 
 } hypre_IJMatrix;
 
@@ -63,6 +104,7 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixFrozenPattern(matrix)    ((matrix) -> frozen_pattern)
 
 static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
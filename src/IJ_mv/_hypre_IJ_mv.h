@@ -223,6 +223,46 @@ typedef struct
 #ifndef hypre_IJ_MATRIX_HEADER
 #define hypre_IJ_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * hypre_IJFrozenPattern:
+ *
+ * Precomputed map from a fixed list of (row, col) entries to offsets into the
+ * diag and offd data of an assembled ParCSR matrix.  Values are gathered from
+ * the combined array [caller values, received values]; an offset o refers to
+ * diag data if o < diag_nnz and to offd data at (o - diag_nnz) otherwise.
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_IJFrozenPattern_struct
+{
+   void              *object;          /* ParCSR matrix the map was built for */
+   HYPRE_Int          diag_nnz;
+   HYPRE_Int          offd_nnz;
+   HYPRE_Int          nentries;        /* number of caller entries */
+
+   /* local scatter: sources of target i are sources[target_starts[i]:...] */
+   HYPRE_Int          num_targets;
+   HYPRE_Int         *targets;
+   HYPRE_Int         *target_starts;
+   HYPRE_Int         *sources;
+
+   /* off-process entries: send slot i sums caller values slot_sources[...] */
+   HYPRE_Int          num_slots;
+   HYPRE_Int         *slot_starts;
+   HYPRE_Int         *slot_sources;
+
+   /* persistent exchange of slot values */
+   HYPRE_Int          num_sends;
+   HYPRE_Int         *send_procs;
+   HYPRE_Int         *send_starts;
+   HYPRE_Int          num_recvs;
+   HYPRE_Int         *recv_procs;
+   HYPRE_Int         *recv_starts;
+   HYPRE_Complex     *send_buf;
+   HYPRE_Complex     *recv_buf;
+   hypre_MPI_Request *requests;
+
+} hypre_IJFrozenPattern;
+
 /*--------------------------------------------------------------------------
  * hypre_IJMatrix:
  *--------------------------------------------------------------------------*/
@@ -248,6 +288,7 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_BigInt  global_num_cols;
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
+   void         *frozen_pattern;      /* optional value-only update map */
 
 } hypre_IJMatrix;
 
@@ -272,6 +313,7 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixFrozenPattern(matrix)    ((matrix) -> frozen_pattern)
 
 static inline HYPRE_MAYBE_UNUSED_FUNC HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
@@ -402,9 +444,13 @@ HYPRE_Int hypre_IJMatrixGetColPartitioning ( HYPRE_IJMatrix matrix,
                                              HYPRE_BigInt **col_partitioning );
 HYPRE_Int hypre_IJMatrixSetObject ( HYPRE_IJMatrix matrix, void *object );
 HYPRE_Int hypre_IJMatrixRead( const char *filename, MPI_Comm comm, HYPRE_Int type,
-                              HYPRE_IJMatrix *matrix_ptr, HYPRE_Int is_mm );
+                              HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int hypre_IJMatrixReadBinary( const char *prefixname, MPI_Comm comm,
                                     HYPRE_Int type, HYPRE_IJMatrix *matrix_ptr );
+HYPRE_Int hypre_IJMatrixReadMPIIO( const char *filename, MPI_Comm comm,
+                                   HYPRE_Int type, HYPRE_IJMatrix *matrix_ptr );
+HYPRE_Int hypre_IJMatrixReadMM( const char *filename, MPI_Comm comm,
+                                HYPRE_Int type, HYPRE_IJMatrix *matrix_ptr );
 
 /* IJMatrix_isis.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizeISIS ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
@@ -504,6 +550,18 @@ HYPRE_Int hypre_IJMatrixApplyPETSc ( hypre_IJMatrix *matrix, hypre_ParVector *x,
 HYPRE_Int hypre_IJMatrixDestroyPETSc ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetTotalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int size );
 
+/* IJMatrix_parcsr_adopt.c */
+HYPRE_Int hypre_IJMatrixAdoptCSRParCSR ( hypre_IJMatrix *matrix, HYPRE_Int *row_ptr,
+                                         HYPRE_BigInt *cols, HYPRE_Complex *values,
+                                         HYPRE_Int owns_data );
+
+/* IJMatrix_parcsr_frozen.c */
+HYPRE_Int hypre_IJMatrixFreezePatternParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nentries,
+                                              const HYPRE_BigInt *rows, const HYPRE_BigInt *cols );
+HYPRE_Int hypre_IJMatrixUpdateFrozenValuesParCSR ( hypre_IJMatrix *matrix,
+                                                   const HYPRE_Complex *values, HYPRE_Int action );
+HYPRE_Int hypre_IJMatrixFrozenPatternDestroy ( hypre_IJMatrix *matrix );
+
 /* IJVector.c */
 HYPRE_Int hypre_IJVectorDistribute ( HYPRE_IJVector vector, const HYPRE_Int *vec_starts );
 HYPRE_Int hypre_IJVectorZeroValues ( HYPRE_IJVector vector );
@@ -554,6 +612,12 @@ HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixAdoptCSR ( HYPRE_IJMatrix matrix, HYPRE_Int *row_ptr, HYPRE_BigInt *cols,
+                                   HYPRE_Complex *values, HYPRE_Int owns_data );
+HYPRE_Int HYPRE_IJMatrixFreezePattern ( HYPRE_IJMatrix matrix, HYPRE_Int nentries,
+                                        const HYPRE_BigInt *rows, const HYPRE_BigInt *cols );
+HYPRE_Int HYPRE_IJMatrixSetFrozenValues ( HYPRE_IJMatrix matrix, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixAddToFrozenValues ( HYPRE_IJMatrix matrix, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
 HYPRE_Int HYPRE_IJMatrixGetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
@@ -573,8 +637,11 @@ HYPRE_Int HYPRE_IJMatrixReadBinary ( const char *filename, MPI_Comm comm, HYPRE_
                                      HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int type,
                                 HYPRE_IJMatrix *matrix_ptr );
+HYPRE_Int HYPRE_IJMatrixReadMPIIO ( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                    HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixPrintBinary ( HYPRE_IJMatrix matrix, const char *filename );
+HYPRE_Int HYPRE_IJMatrixPrintMPIIO ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
@@ -32,9 +32,13 @@ HYPRE_Int hypre_IJMatrixGetColPartitioning ( HYPRE_IJMatrix matrix,
                                              HYPRE_BigInt **col_partitioning );
 HYPRE_Int hypre_IJMatrixSetObject ( HYPRE_IJMatrix matrix, void *object );
 HYPRE_Int hypre_IJMatrixRead( const char *filename, MPI_Comm comm, HYPRE_Int type,
-                              HYPRE_IJMatrix *matrix_ptr, HYPRE_Int is_mm );
+                              HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int hypre_IJMatrixReadBinary( const char *prefixname, MPI_Comm comm,
                                     HYPRE_Int type, HYPRE_IJMatrix *matrix_ptr );
+HYPRE_Int hypre_IJMatrixReadMPIIO( const char *filename, MPI_Comm comm,
+                                   HYPRE_Int type, HYPRE_IJMatrix *matrix_ptr );
+HYPRE_Int hypre_IJMatrixReadMM( const char *filename, MPI_Comm comm,
+                                HYPRE_Int type, HYPRE_IJMatrix *matrix_ptr );
 
 /* IJMatrix_isis.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizeISIS ( hypre_IJMatrix *matrix, HYPRE_Int local_m,
@@ -134,6 +138,18 @@ HYPRE_Int hypre_IJMatrixApplyPETSc ( hypre_IJMatrix *matrix, hypre_ParVector *x,
 HYPRE_Int hypre_IJMatrixDestroyPETSc ( hypre_IJMatrix *matrix );
 HYPRE_Int hypre_IJMatrixSetTotalSizePETSc ( hypre_IJMatrix *matrix, HYPRE_Int size );
 
+/* IJMatrix_parcsr_adopt.c */
+HYPRE_Int hypre_IJMatrixAdoptCSRParCSR ( hypre_IJMatrix *matrix, HYPRE_Int *row_ptr,
+                                         HYPRE_BigInt *cols, HYPRE_Complex *values,
+                                         HYPRE_Int owns_data );
+
+/* IJMatrix_parcsr_frozen.c */
+HYPRE_Int hypre_IJMatrixFreezePatternParCSR ( hypre_IJMatrix *matrix, HYPRE_Int nentries,
+                                              const HYPRE_BigInt *rows, const HYPRE_BigInt *cols );
+HYPRE_Int hypre_IJMatrixUpdateFrozenValuesParCSR ( hypre_IJMatrix *matrix,
+                                                   const HYPRE_Complex *values, HYPRE_Int action );
+HYPRE_Int hypre_IJMatrixFrozenPatternDestroy ( hypre_IJMatrix *matrix );
+
 /* IJVector.c */
 HYPRE_Int hypre_IJVectorDistribute ( HYPRE_IJVector vector, const HYPRE_Int *vec_starts );
 HYPRE_Int hypre_IJVectorZeroValues ( HYPRE_IJVector vector );
@@ -184,6 +200,12 @@ HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix, HYPRE_Complex
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
                                       const HYPRE_BigInt *rows, const HYPRE_BigInt *cols, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixAdoptCSR ( HYPRE_IJMatrix matrix, HYPRE_Int *row_ptr, HYPRE_BigInt *cols,
+                                   HYPRE_Complex *values, HYPRE_Int owns_data );
+HYPRE_Int HYPRE_IJMatrixFreezePattern ( HYPRE_IJMatrix matrix, HYPRE_Int nentries,
+                                        const HYPRE_BigInt *rows, const HYPRE_BigInt *cols );
+HYPRE_Int HYPRE_IJMatrixSetFrozenValues ( HYPRE_IJMatrix matrix, const HYPRE_Complex *values );
+HYPRE_Int HYPRE_IJMatrixAddToFrozenValues ( HYPRE_IJMatrix matrix, const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_BigInt *rows,
                                        HYPRE_Int *ncols );
 HYPRE_Int HYPRE_IJMatrixGetValues ( HYPRE_IJMatrix matrix, HYPRE_Int nrows, HYPRE_Int *ncols,
@@ -203,8 +225,11 @@ HYPRE_Int HYPRE_IJMatrixReadBinary ( const char *filename, MPI_Comm comm, HYPRE_
                                      HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixReadMM( const char *filename, MPI_Comm comm, HYPRE_Int type,
                                 HYPRE_IJMatrix *matrix_ptr );
+HYPRE_Int HYPRE_IJMatrixReadMPIIO ( const char *filename, MPI_Comm comm, HYPRE_Int type,
+                                    HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixPrintBinary ( HYPRE_IJMatrix matrix, const char *filename );
+HYPRE_Int HYPRE_IJMatrixPrintMPIIO ( HYPRE_IJMatrix matrix, const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix, HYPRE_Int omp_flag );
 HYPRE_Int HYPRE_IJMatrixTranspose ( HYPRE_IJMatrix  matrix_A, HYPRE_IJMatrix *matrix_AT );
 HYPRE_Int HYPRE_IJMatrixNorm ( HYPRE_IJMatrix matrix, HYPRE_Real *norm );
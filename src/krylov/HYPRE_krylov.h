@@ -204,6 +204,15 @@ HYPRE_Int HYPRE_PCGGetNumIterations(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_PCGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
                                                 HYPRE_Real   *norm);
 
+/**
+ * Return the residual norm of each iteration, starting with the initial
+ * residual, i.e., \e num_iterations + 1 values.  The history is only kept
+ * when the logging or print level is positive, otherwise NULL is returned.
+ * The array belongs to the solver.
+ **/
+HYPRE_Int HYPRE_PCGGetResidualNorms(HYPRE_Solver   solver,
+                                    HYPRE_Real   **norms);
+
 /**
  * Return the residual.
  **/
@@ -384,6 +384,14 @@ hypre_LOBPCGMultiOperatorA( void *data, void * x, void*  y )
 {
    hypre_LOBPCGData *pcg_data = (hypre_LOBPCGData*)data;
    mv_InterfaceInterpreter* ii = pcg_data->interpreter;
+   HYPRE_MatvecFunctions * mv = pcg_data->matvecFunctions;
+
+   /* apply A to the whole block at once if the interface supports it */
+   if ( mv->MatMultiVec != NULL )
+   {
+      (*(mv->MatMultiVec))(pcg_data->matvecData, 1.0, pcg_data->A, x, 0.0, y);
+      return;
+   }
 
    ii->Eval( hypre_LOBPCGOperatorA, data, x, y );
 }
@@ -393,6 +401,13 @@ hypre_LOBPCGMultiOperatorB( void *data, void * x, void*  y )
 {
    hypre_LOBPCGData *pcg_data = (hypre_LOBPCGData*)data;
    mv_InterfaceInterpreter* ii = pcg_data->interpreter;
+   HYPRE_MatvecFunctions * mv = pcg_data->matvecFunctions;
+
+   if ( mv->MatMultiVec != NULL && pcg_data->B != NULL )
+   {
+      (*(mv->MatMultiVec))(pcg_data->matvecDataB, 1.0, pcg_data->B, x, 0.0, y);
+      return;
+   }
 
    ii->Eval( hypre_LOBPCGOperatorB, data, x, y );
 }
@@ -393,6 +393,17 @@ HYPRE_PCGGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
    return ( hypre_PCGGetFinalRelativeResidualNorm( (void *) solver, norm ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_PCGGetResidualNorms
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_PCGGetResidualNorms( HYPRE_Solver   solver,
+                           HYPRE_Real   **norms )
+{
+   return ( hypre_PCGGetResidualNorms( (void *) solver, norms ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_PCGGetResidual
  *--------------------------------------------------------------------------*/
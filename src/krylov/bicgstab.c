@@ -58,6 +58,28 @@ hypre_BiCGSTABFunctionsCreate(
    return bicgstab_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BiCGSTABFunctionsSetFusedOps
+ *
+ * Registers optional fused vector kernels.  Any of them may be NULL, in which
+ * case the solver falls back to the basic Axpy/ScaleVector/InnerProd calls.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BiCGSTABFunctionsSetFusedOps(
+   hypre_BiCGSTABFunctions *bicgstab_functions,
+   HYPRE_Int  (*Axpby)             ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Real (*AxpyInnerProd)     ( HYPRE_Complex alpha, void *x, void *y, void *z ),
+   HYPRE_Real (*DualAxpyInnerProd) ( HYPRE_Complex alpha, void *x1, void *y1,
+                                     HYPRE_Complex beta, void *x2, void *y2 ) )
+{
+   bicgstab_functions->Axpby             = Axpby;
+   bicgstab_functions->AxpyInnerProd     = AxpyInnerProd;
+   bicgstab_functions->DualAxpyInnerProd = DualAxpyInnerProd;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_BiCGSTABCreate
  *--------------------------------------------------------------------------*/
@@ -480,10 +502,18 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
       {
          gamma = gamma_numer / gamma_denom;
       }
-      (*(bicgstab_functions->Axpy))(gamma, v, x);
-      (*(bicgstab_functions->Axpy))(-gamma, s, r);
       /* residual is now updated, must immediately check for convergence */
-      r_norm = hypre_sqrt((*(bicgstab_functions->InnerProd))(r, r));
+      if (bicgstab_functions->DualAxpyInnerProd)
+      {
+         r_norm = hypre_sqrt((*(bicgstab_functions->DualAxpyInnerProd))(gamma, v, x,
+                                                                        -gamma, s, r));
+      }
+      else
+      {
+         (*(bicgstab_functions->Axpy))(gamma, v, x);
+         (*(bicgstab_functions->Axpy))(-gamma, s, r);
+         r_norm = hypre_sqrt((*(bicgstab_functions->InnerProd))(r, r));
+      }
       if (logging > 0 || print_level > 0)
       {
          norms[iter] = r_norm;
@@ -548,7 +578,15 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
       (*(bicgstab_functions->Axpy))(-gamma, q, p);
       if (hypre_abs(gamma) >= epsmac)
       {
-         (*(bicgstab_functions->ScaleVector))((beta * alpha / gamma), p);
+         if (bicgstab_functions->Axpby)
+         {
+            (*(bicgstab_functions->Axpby))(1.0, r, (beta * alpha / gamma), p);
+         }
+         else
+         {
+            (*(bicgstab_functions->ScaleVector))((beta * alpha / gamma), p);
+            (*(bicgstab_functions->Axpy))(1.0, r, p);
+         }
       }
       else
       {
@@ -557,7 +595,6 @@ hypre_BiCGSTABSolve(void  *bicgstab_vdata,
 
          return hypre_error_flag;
       }
-      (*(bicgstab_functions->Axpy))(1.0, r, p);
    } /* end while loop */
 
    (bicgstab_data -> num_iterations) = iter;
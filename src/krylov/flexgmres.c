@@ -68,6 +68,28 @@ hypre_FlexGMRESFunctionsCreate(
    return fgmres_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_FlexGMRESFunctionsSetFusedOps
+ *
+ * Registers optional fused vector kernels.  Any of them may be NULL, in which
+ * case the solver falls back to the basic Axpy/ScaleVector/InnerProd calls.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FlexGMRESFunctionsSetFusedOps(
+   hypre_FlexGMRESFunctions *fgmres_functions,
+   HYPRE_Int  (*Axpby)             ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Real (*AxpyInnerProd)     ( HYPRE_Complex alpha, void *x, void *y, void *z ),
+   HYPRE_Real (*DualAxpyInnerProd) ( HYPRE_Complex alpha, void *x1, void *y1,
+                                     HYPRE_Complex beta, void *x2, void *y2 ) )
+{
+   fgmres_functions->Axpby             = Axpby;
+   fgmres_functions->AxpyInnerProd     = AxpyInnerProd;
+   fgmres_functions->DualAxpyInnerProd = DualAxpyInnerProd;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_FlexGMRESCreate
  *--------------------------------------------------------------------------*/
@@ -559,12 +581,31 @@ hypre_FlexGMRESSolve(void  *fgmres_vdata,
 
 
          /* modified Gram_Schmidt */
-         for (j = 0; j < i; j++)
+         if (fgmres_functions->AxpyInnerProd)
+         {
+            /* each update of p[i] also computes the next coefficient,
+               and the last one computes <p[i],p[i]> */
+            hh[0][i - 1] = (*(fgmres_functions->InnerProd))(p[0], p[i]);
+            for (j = 0; j < i; j++)
+            {
+               t = (*(fgmres_functions->AxpyInnerProd))(-hh[j][i - 1], p[j], p[i],
+                                                        p[j + 1]);
+               if (j < i - 1)
+               {
+                  hh[j + 1][i - 1] = t;
+               }
+            }
+            t = hypre_sqrt(t);
+         }
+         else
          {
-            hh[j][i - 1] = (*(fgmres_functions->InnerProd))(p[j], p[i]);
-            (*(fgmres_functions->Axpy))(-hh[j][i - 1], p[j], p[i]);
+            for (j = 0; j < i; j++)
+            {
+               hh[j][i - 1] = (*(fgmres_functions->InnerProd))(p[j], p[i]);
+               (*(fgmres_functions->Axpy))(-hh[j][i - 1], p[j], p[i]);
+            }
+            t = hypre_sqrt((*(fgmres_functions->InnerProd))(p[i], p[i]));
          }
-         t = hypre_sqrt((*(fgmres_functions->InnerProd))(p[i], p[i]));
          hh[i][i - 1] = t;
          if (t != 0.0)
          {
@@ -61,6 +61,11 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional fused kernels, NULL if not provided (see hypre_FlexGMRESFunctionsSetFusedOps) */
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z );
+   HYPRE_Real   (*DualAxpyInnerProd) ( HYPRE_Complex alpha, void *x1, void *y1,
+                                       HYPRE_Complex beta, void *x2, void *y2 );
 
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x );
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x );
@@ -101,6 +101,11 @@ typedef struct
    HYPRE_Int  (*ClearVector)   ( void *x );
    HYPRE_Int  (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int  (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional fused kernels, NULL if not provided (see hypre_BiCGSTABFunctionsSetFusedOps) */
+   HYPRE_Int  (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Real (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z );
+   HYPRE_Real (*DualAxpyInnerProd) ( HYPRE_Complex alpha, void *x1, void *y1,
+                                     HYPRE_Complex beta, void *x2, void *y2 );
    HYPRE_Int  (*CommInfo)      ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
    HYPRE_Int  (*precond_setup) (void *vdata, void *A, void *b, void *x);
    HYPRE_Int  (*precond)       (void *vdata, void *A, void *b, void *x);
@@ -907,6 +912,11 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional fused kernels, NULL if not provided (see hypre_FlexGMRESFunctionsSetFusedOps) */
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z );
+   HYPRE_Real   (*DualAxpyInnerProd) ( HYPRE_Complex alpha, void *x1, void *y1,
+                                       HYPRE_Complex beta, void *x2, void *y2 );
 
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x );
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x );
@@ -1066,6 +1076,11 @@ typedef struct
    HYPRE_Int    (*ClearVector)   ( void *x );
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
+   /* optional fused kernels, NULL if not provided (see hypre_PCGFunctionsSetFusedOps) */
+   HYPRE_Int    (*Axpby)         ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+   HYPRE_Real   (*AxpyInnerProd) ( HYPRE_Complex alpha, void *x, void *y, void *z );
+   HYPRE_Real   (*DualAxpyInnerProd) ( HYPRE_Complex alpha, void *x1, void *y1,
+                                       HYPRE_Complex beta, void *x2, void *y2 );
 
    HYPRE_Int    (*precond)(void *vdata, void *A, void *b, void *x);
    HYPRE_Int    (*precond_setup)(void *vdata, void *A, void *b, void *x);
@@ -1207,6 +1222,10 @@ extern "C" {
 #endif
 
 /* bicgstab.c */
+HYPRE_Int hypre_BiCGSTABFunctionsSetFusedOps ( hypre_BiCGSTABFunctions *bicgstab_functions,
+   HYPRE_Int  (*Axpby)             ( HYPRE_Complex, void*, HYPRE_Complex, void* ),
+   HYPRE_Real (*AxpyInnerProd)     ( HYPRE_Complex, void*, void*, void* ),
+   HYPRE_Real (*DualAxpyInnerProd) ( HYPRE_Complex, void*, void*, HYPRE_Complex, void*, void* ) );
 void *hypre_BiCGSTABCreate ( hypre_BiCGSTABFunctions *bicgstab_functions );
 HYPRE_Int hypre_BiCGSTABDestroy ( void *bicgstab_vdata );
 HYPRE_Int hypre_BiCGSTABSetup ( void *bicgstab_vdata, void *A, void *b, void *x );
@@ -1330,6 +1349,10 @@ HYPRE_Int hypre_COGMRESSetModifyPC ( void *fgmres_vdata, HYPRE_Int (*modify_pc )
 
 
 /* flexgmres.c */
+HYPRE_Int hypre_FlexGMRESFunctionsSetFusedOps ( hypre_FlexGMRESFunctions *fgmres_functions,
+   HYPRE_Int  (*Axpby)             ( HYPRE_Complex, void*, HYPRE_Complex, void* ),
+   HYPRE_Real (*AxpyInnerProd)     ( HYPRE_Complex, void*, void*, void* ),
+   HYPRE_Real (*DualAxpyInnerProd) ( HYPRE_Complex, void*, void*, HYPRE_Complex, void*, void* ) );
 void *hypre_FlexGMRESCreate ( hypre_FlexGMRESFunctions *fgmres_functions );
 HYPRE_Int hypre_FlexGMRESDestroy ( void *fgmres_vdata );
 HYPRE_Int hypre_FlexGMRESGetResidual ( void *fgmres_vdata, void **residual );
@@ -1607,9 +1630,14 @@ HYPRE_Int HYPRE_PCGGetPrintLevel ( HYPRE_Solver solver, HYPRE_Int *level );
 HYPRE_Int HYPRE_PCGGetNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
 HYPRE_Int HYPRE_PCGGetConverged ( HYPRE_Solver solver, HYPRE_Int *converged );
 HYPRE_Int HYPRE_PCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
+HYPRE_Int HYPRE_PCGGetResidualNorms ( HYPRE_Solver solver, HYPRE_Real **norms );
 HYPRE_Int HYPRE_PCGGetResidual ( HYPRE_Solver solver, void *residual );
 
 /* pcg.c */
+HYPRE_Int hypre_PCGFunctionsSetFusedOps ( hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int  (*Axpby)             ( HYPRE_Complex, void*, HYPRE_Complex, void* ),
+   HYPRE_Real (*AxpyInnerProd)     ( HYPRE_Complex, void*, void*, void* ),
+   HYPRE_Real (*DualAxpyInnerProd) ( HYPRE_Complex, void*, void*, HYPRE_Complex, void*, void* ) );
 void *hypre_PCGCreate ( hypre_PCGFunctions *pcg_functions );
 HYPRE_Int hypre_PCGDestroy ( void *pcg_vdata );
 HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata, void **residual );
@@ -1657,6 +1685,7 @@ HYPRE_Int hypre_PCGGetConverged ( void *pcg_vdata, HYPRE_Int *converged );
 HYPRE_Int hypre_PCGPrintLogging ( void *pcg_vdata, HYPRE_Int myid );
 HYPRE_Int hypre_PCGGetFinalRelativeResidualNorm ( void *pcg_vdata,
                                                   HYPRE_Real *relative_residual_norm );
+HYPRE_Int hypre_PCGGetResidualNorms ( void *pcg_vdata, HYPRE_Real **norms );
 
 #ifdef __cplusplus
 }
@@ -72,6 +72,28 @@ hypre_PCGFunctionsCreate(
    return pcg_functions;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGFunctionsSetFusedOps
+ *
+ * Registers optional fused vector kernels.  Any of them may be NULL, in which
+ * case the solver falls back to the basic Axpy/ScaleVector/InnerProd calls.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGFunctionsSetFusedOps(
+   hypre_PCGFunctions *pcg_functions,
+   HYPRE_Int  (*Axpby)             ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y ),
+   HYPRE_Real (*AxpyInnerProd)     ( HYPRE_Complex alpha, void *x, void *y, void *z ),
+   HYPRE_Real (*DualAxpyInnerProd) ( HYPRE_Complex alpha, void *x1, void *y1,
+                                     HYPRE_Complex beta, void *x2, void *y2 ) )
+{
+   pcg_functions->Axpby             = Axpby;
+   pcg_functions->AxpyInnerProd     = AxpyInnerProd;
+   pcg_functions->DualAxpyInnerProd = DualAxpyInnerProd;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGCreate
  *--------------------------------------------------------------------------*/
@@ -375,6 +397,7 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Real      guard_zero_residual, sdotp;
    HYPRE_Int       tentatively_converged = 0;
    HYPRE_Int       recompute_true_residual = 0;
+   HYPRE_Int       fuse_residual_update;
 
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
@@ -573,6 +596,11 @@ hypre_PCGSolve( void *pcg_vdata,
          essentially a "restarted CG"). */
       recompute_true_residual = recompute_residual_p && !(i % recompute_residual_p);
 
+      /* Update x and r and compute <r,r> in one sweep when the vector
+         interface provides a fused kernel */
+      fuse_residual_update = two_norm && !flex && !recompute_true_residual &&
+                             (pcg_functions->DualAxpyInnerProd != NULL);
+
       /* s = A*p */
       (*(pcg_functions->Matvec))(matvec_data, 1.0, A, p, 0.0, s);
 
@@ -630,18 +658,29 @@ hypre_PCGSolve( void *pcg_vdata,
 
       gamma_old = gamma;
 
-      /* x = x + alpha*p */
-      (*(pcg_functions->Axpy))(alpha, p, x);
+      if (fuse_residual_update)
+      {
+         /* x = x + alpha*p, r = r - alpha*s, i_prod = <r,r> */
+         i_prod = (*(pcg_functions->DualAxpyInnerProd))(alpha, p, x, -alpha, s, r);
+      }
+      else
+      {
+         /* x = x + alpha*p */
+         (*(pcg_functions->Axpy))(alpha, p, x);
+      }
 
       if (flex)
       {
          (*(pcg_functions->CopyVector))(r, r_old); /*save old residual */
       }
 
-      /* r = r - alpha*s */
+      /* r = r - alpha*s (already done above if fuse_residual_update) */
       if ( !recompute_true_residual )
       {
-         (*(pcg_functions->Axpy))(-alpha, s, r);
+         if (!fuse_residual_update)
+         {
+            (*(pcg_functions->Axpy))(-alpha, s, r);
+         }
       }
       else
       {
@@ -744,7 +783,10 @@ hypre_PCGSolve( void *pcg_vdata,
       /* set i_prod for convergence test */
       if (two_norm)
       {
-         i_prod = (*(pcg_functions->InnerProd))(r, r);
+         if (!fuse_residual_update)
+         {
+            i_prod = (*(pcg_functions->InnerProd))(r, r);
+         }
       }
       else
       {
@@ -967,8 +1009,15 @@ hypre_PCGSolve( void *pcg_vdata,
       /* p = s + beta p */
       if ( !recompute_true_residual )
       {
-         (*(pcg_functions->ScaleVector))(beta, p);
-         (*(pcg_functions->Axpy))(1.0, s, p);
+         if (pcg_functions->Axpby)
+         {
+            (*(pcg_functions->Axpby))(1.0, s, beta, p);
+         }
+         else
+         {
+            (*(pcg_functions->ScaleVector))(beta, p);
+            (*(pcg_functions->Axpy))(1.0, s, p);
+         }
       }
       else
       {
@@ -1557,3 +1606,18 @@ hypre_PCGGetFinalRelativeResidualNorm( void   *pcg_vdata,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGGetResidualNorms
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGGetResidualNorms( void        *pcg_vdata,
+                           HYPRE_Real **norms )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *norms = (pcg_data -> norms);
+
+   return hypre_error_flag;
+}
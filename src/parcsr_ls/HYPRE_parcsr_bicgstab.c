@@ -38,6 +38,9 @@ HYPRE_ParCSRBiCGSTABCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovCommInfo,
          hypre_ParKrylovIdentitySetup,
          hypre_ParKrylovIdentity );
+   hypre_BiCGSTABFunctionsSetFusedOps(bicgstab_functions, hypre_ParKrylovAxpby,
+                                      hypre_ParKrylovAxpyInnerProd,
+                                      hypre_ParKrylovDualAxpyInnerProd);
    *solver = ( (HYPRE_Solver) hypre_BiCGSTABCreate( bicgstab_functions) );
 
    return hypre_error_flag;
@@ -41,6 +41,9 @@ HYPRE_ParCSRFlexGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup,
          hypre_ParKrylovIdentity );
+   hypre_FlexGMRESFunctionsSetFusedOps(fgmres_functions, hypre_ParKrylovAxpby,
+                                       hypre_ParKrylovAxpyInnerProd,
+                                       hypre_ParKrylovDualAxpyInnerProd);
    *solver = ( (HYPRE_Solver) hypre_FlexGMRESCreate( fgmres_functions ) );
 
    return hypre_error_flag;
@@ -130,6 +130,17 @@ HYPRE_ParCSRHybridSetSetupType( HYPRE_Solver solver,
    return ( hypre_AMGHybridSetSetupType( (void *) solver, setup_type ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRHybridSetCostModel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRHybridSetCostModel( HYPRE_Solver solver,
+                                HYPRE_Int    cost_model )
+{
+   return ( hypre_AMGHybridSetCostModel( (void *) solver, cost_model ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRHybridSetSolverType
  *--------------------------------------------------------------------------*/
@@ -220,3 +220,58 @@ HYPRE_ParCSRSetupMatvec(HYPRE_MatvecFunctions * mv)
 
    return 0;
 }
+
+/* Interpreter for multivectors stored as one contiguous ParVector
+   (cf. par_contig_multivector.c).  The vector part is the same as above. */
+
+HYPRE_Int
+HYPRE_ParCSRSetupContigInterpreter( mv_InterfaceInterpreter *i )
+{
+   /* Vector part */
+
+   i->CreateVector = hypre_ParKrylovCreateVector;
+   i->DestroyVector = hypre_ParKrylovDestroyVector;
+   i->InnerProd = hypre_ParKrylovInnerProd;
+   i->CopyVector = hypre_ParKrylovCopyVector;
+   i->ClearVector = hypre_ParKrylovClearVector;
+   i->SetRandomValues = hypre_ParSetRandomValues;
+   i->ScaleVector = hypre_ParKrylovScaleVector;
+   i->Axpy = hypre_ParKrylovAxpy;
+   i->VectorSize = hypre_ParVectorSize;
+
+   /* Multivector part */
+
+   i->CreateMultiVector = hypre_ParContigMultiVectorCreateFromSampleVector;
+   i->CopyCreateMultiVector = hypre_ParContigMultiVectorCreateCopy;
+   i->DestroyMultiVector = hypre_ParContigMultiVectorDestroy;
+
+   i->Width = hypre_ParContigMultiVectorWidth;
+   i->Height = hypre_ParContigMultiVectorHeight;
+   i->SetMask = hypre_ParContigMultiVectorSetMask;
+   i->CopyMultiVector = hypre_ParContigMultiVectorCopy;
+   i->ClearMultiVector = hypre_ParContigMultiVectorClear;
+   i->SetRandomVectors = hypre_ParContigMultiVectorSetRandom;
+   i->MultiInnerProd = hypre_ParContigMultiVectorByMultiVector;
+   i->MultiInnerProdDiag = hypre_ParContigMultiVectorByMultiVectorDiag;
+   i->MultiVecMat = hypre_ParContigMultiVectorByMatrix;
+   i->MultiVecMatDiag = hypre_ParContigMultiVectorByDiagonal;
+   i->MultiAxpy = hypre_ParContigMultiVectorAxpy;
+   i->MultiXapy = hypre_ParContigMultiVectorXapy;
+   i->Eval = hypre_ParContigMultiVectorEval;
+
+   return 0;
+}
+
+HYPRE_Int
+HYPRE_ParCSRSetupContigMatvec(HYPRE_MatvecFunctions * mv)
+{
+   mv->MatvecCreate = hypre_ParKrylovMatvecCreate;
+   mv->Matvec = hypre_ParKrylovMatvec;
+   mv->MatvecDestroy = hypre_ParKrylovMatvecDestroy;
+
+   mv->MatMultiVecCreate = NULL;
+   mv->MatMultiVec = hypre_ParContigMultiVectorMatvec;
+   mv->MatMultiVecDestroy = NULL;
+
+   return 0;
+}
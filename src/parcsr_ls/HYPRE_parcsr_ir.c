@@ -0,0 +1,160 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRCreate
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRCreate( HYPRE_Solver *solver )
+{
+   if (!solver)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *solver = (HYPRE_Solver) hypre_ParIRCreate( );
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRDestroy( HYPRE_Solver solver )
+{
+   return ( hypre_ParIRDestroy( (void *) solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRSetup( HYPRE_Solver       solver,
+                     HYPRE_ParCSRMatrix A,
+                     HYPRE_ParVector    b,
+                     HYPRE_ParVector    x )
+{
+   return ( hypre_ParIRSetup( (void *) solver,
+                              (hypre_ParCSRMatrix *) A,
+                              (hypre_ParVector *) b,
+                              (hypre_ParVector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRSolve( HYPRE_Solver       solver,
+                     HYPRE_ParCSRMatrix A,
+                     HYPRE_ParVector    b,
+                     HYPRE_ParVector    x )
+{
+   return ( hypre_ParIRSolve( (void *) solver,
+                              (hypre_ParCSRMatrix *) A,
+                              (hypre_ParVector *) b,
+                              (hypre_ParVector *) x ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRSetTol( HYPRE_Solver solver,
+                      HYPRE_Real   tol )
+{
+   return ( hypre_ParIRSetTol( (void *) solver, tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRSetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRSetAbsoluteTol( HYPRE_Solver solver,
+                              HYPRE_Real   a_tol )
+{
+   return ( hypre_ParIRSetAbsoluteTol( (void *) solver, a_tol ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRSetMaxIter( HYPRE_Solver solver,
+                          HYPRE_Int    max_iter )
+{
+   return ( hypre_ParIRSetMaxIter( (void *) solver, max_iter ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRSetInnerSolver
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRSetInnerSolver( HYPRE_Solver            solver,
+                              HYPRE_PtrToParSolverFcn inner_solve,
+                              HYPRE_PtrToParSolverFcn inner_setup,
+                              HYPRE_Solver            inner_solver )
+{
+   return ( hypre_ParIRSetInnerSolver( (void *) solver,
+                                       (HYPRE_Int(*)(void*, void*, void*, void*)) inner_solve,
+                                       (HYPRE_Int(*)(void*, void*, void*, void*)) inner_setup,
+                                       (void *) inner_solver ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRSetInnerPrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRSetInnerPrecision( HYPRE_Solver solver,
+                                 HYPRE_Int    inner_precision )
+{
+   return ( hypre_ParIRSetInnerPrecision( (void *) solver, inner_precision ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRSetPrintLevel( HYPRE_Solver solver,
+                             HYPRE_Int    print_level )
+{
+   return ( hypre_ParIRSetPrintLevel( (void *) solver, print_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRGetNumIterations( HYPRE_Solver  solver,
+                                HYPRE_Int    *num_iterations )
+{
+   return ( hypre_ParIRGetNumIterations( (void *) solver, num_iterations ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRIRGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRIRGetFinalRelativeResidualNorm( HYPRE_Solver  solver,
+                                            HYPRE_Real   *norm )
+{
+   return ( hypre_ParIRGetFinalRelativeResidualNorm( (void *) solver, norm ) );
+}
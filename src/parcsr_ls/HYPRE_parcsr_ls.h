@@ -3326,6 +3326,22 @@ HYPRE_Int HYPRE_ParCSRHybridSetPCGMaxIter(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRHybridSetSetupType(HYPRE_Solver solver,
                                          HYPRE_Int    setup_type);
 
+/**
+ * (Optional) Use a cost model for the switch to AMG.  When the diagonally
+ * scaled solver stalls (see \e HYPRE\_ParCSRHybridSetConvergenceTol), the
+ * time to finish with it is predicted from its convergence rate and measured
+ * iteration time, and compared with the predicted time for AMG setup plus
+ * AMG-preconditioned iterations.  The solver switches only if AMG is
+ * predicted to be cheaper.  AMG costs are estimated from the matrix size
+ * until an AMG solve has been timed, after which the measured ratios are
+ * used.  In addition, the path taken is remembered: if the matrix has not
+ * changed since the previous solve, an existing AMG setup is reused and
+ * the diagonally scaled phase is skipped when AMG was needed, or run to
+ * completion when it was not.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_ParCSRHybridSetCostModel(HYPRE_Solver solver,
+                                         HYPRE_Int    cost_model);
+
 /**
  *  Set the desired solver type. There are the following options:
  *     -  1 : PCG (default)
@@ -3807,6 +3823,112 @@ HYPRE_ParCSRHybridGetSetupSolveTime( HYPRE_Solver solver,
                                      HYPRE_Real  *time    );
 /**@}*/
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+/**
+ * @name ParCSR Iterative Refinement Solver
+ *
+ * Iterative refinement driver. The outer residual r = b - A*x and the solution
+ * update x = x + e are computed in the working precision, while the
+ * correction equation A*e = r is solved approximately by an inner solver,
+ * e.g., BoomerAMG-PCG or BoomerAMG-GMRES with a loose tolerance, optionally
+ * on single-precision data (see \e HYPRE_ParCSRIRSetInnerPrecision).
+ *
+ * @{
+ **/
+
+/**
+ * Create a solver object.
+ **/
+HYPRE_Int HYPRE_ParCSRIRCreate(HYPRE_Solver *solver);
+
+/**
+ * Destroy a solver object. The inner solver is not destroyed.
+ **/
+HYPRE_Int HYPRE_ParCSRIRDestroy(HYPRE_Solver solver);
+
+/**
+ * Set up the solver. This calls the setup routine of the inner solver.
+ **/
+HYPRE_Int HYPRE_ParCSRIRSetup(HYPRE_Solver       solver,
+                              HYPRE_ParCSRMatrix A,
+                              HYPRE_ParVector    b,
+                              HYPRE_ParVector    x);
+
+/**
+ * Solve the system.
+ **/
+HYPRE_Int HYPRE_ParCSRIRSolve(HYPRE_Solver       solver,
+                              HYPRE_ParCSRMatrix A,
+                              HYPRE_ParVector    b,
+                              HYPRE_ParVector    x);
+
+/**
+ * (Optional) Set the relative convergence tolerance of the outer iteration.
+ * The default is 1e-8.
+ **/
+HYPRE_Int HYPRE_ParCSRIRSetTol(HYPRE_Solver solver,
+                               HYPRE_Real   tol);
+
+/**
+ * (Optional) Set the absolute convergence tolerance of the outer iteration.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_ParCSRIRSetAbsoluteTol(HYPRE_Solver solver,
+                                       HYPRE_Real   a_tol);
+
+/**
+ * (Optional) Set the maximum number of outer iterations. The default is 20.
+ **/
+HYPRE_Int HYPRE_ParCSRIRSetMaxIter(HYPRE_Solver solver,
+                                   HYPRE_Int    max_iter);
+
+/**
+ * Set the inner solver used for the correction equation. Its tolerance
+ * determines the residual reduction per outer iteration and should be set
+ * loosely (e.g., 1e-2 to 1e-4) by the caller.
+ **/
+HYPRE_Int HYPRE_ParCSRIRSetInnerSolver(HYPRE_Solver            solver,
+                                       HYPRE_PtrToParSolverFcn inner_solve,
+                                       HYPRE_PtrToParSolverFcn inner_setup,
+                                       HYPRE_Solver            inner_solver);
+
+/**
+ * (Optional) Set the precision of the data that the inner solver set by
+ * \e HYPRE_ParCSRIRSetInnerSolver works on:
+ *
+ *    - 0 : the matrix and residual in the working precision (default)
+ *    - 1 : a copy of the matrix and the residual with their values rounded
+ *          to single precision, for matrices in host memory. The inner
+ *          solver is set up on the copy, so setup must be called again when
+ *          the values of the matrix change. The rounded values are stored in
+ *          the working precision, so this does not reduce memory traffic.
+ **/
+HYPRE_Int HYPRE_ParCSRIRSetInnerPrecision(HYPRE_Solver solver,
+                                          HYPRE_Int    inner_precision);
+
+/**
+ * (Optional) Set the print level. Residual norms of the outer iteration are
+ * printed for values > 0.
+ **/
+HYPRE_Int HYPRE_ParCSRIRSetPrintLevel(HYPRE_Solver solver,
+                                      HYPRE_Int    print_level);
+
+/**
+ * Return the number of outer iterations taken.
+ **/
+HYPRE_Int HYPRE_ParCSRIRGetNumIterations(HYPRE_Solver  solver,
+                                         HYPRE_Int    *num_iterations);
+
+/**
+ * Return the norm of the final relative residual.
+ **/
+HYPRE_Int HYPRE_ParCSRIRGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
+                                                     HYPRE_Real   *norm);
+
+/**@}*/
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -5015,6 +5137,24 @@ HYPRE_ParCSRSetupInterpreter(mv_InterfaceInterpreter *i);
 HYPRE_Int
 HYPRE_ParCSRSetupMatvec(HYPRE_MatvecFunctions *mv);
 
+/**
+ * Load interface interpreter with a multivector stored as a single
+ * contiguous (column-major) ParVector.  Gram matrices, block updates and
+ * matrix-multivector products are then done with BLAS-3 and multivector
+ * matvec calls instead of loops over single vectors.  Must be used together
+ * with \Ref{HYPRE_ParCSRSetupContigMatvec}.  Multivectors read with
+ * \Ref{HYPRE_ParCSRMultiVectorRead} are not compatible with this interpreter.
+ **/
+HYPRE_Int
+HYPRE_ParCSRSetupContigInterpreter(mv_InterfaceInterpreter *i);
+
+/**
+ * Load Matvec interpreter for use with
+ * \Ref{HYPRE_ParCSRSetupContigInterpreter}.
+ **/
+HYPRE_Int
+HYPRE_ParCSRSetupContigMatvec(HYPRE_MatvecFunctions *mv);
+
 /*
  * Print multivector to file.
  **/
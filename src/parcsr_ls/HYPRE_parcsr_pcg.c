@@ -33,6 +33,9 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   hypre_PCGFunctionsSetFusedOps(pcg_functions, hypre_ParKrylovAxpby,
+                                 hypre_ParKrylovAxpyInnerProd,
+                                 hypre_ParKrylovDualAxpyInnerProd);
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
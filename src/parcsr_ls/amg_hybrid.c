@@ -85,8 +85,30 @@ typedef struct
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
    HYPRE_Real         *nongalerkin_tol;
+
+   /* cost model for the switch to AMG (see hypre_AMGHybridSetCostModel) */
+   HYPRE_Int             cost_model;
+   HYPRE_Int             last_path;        /* 0: unknown, 1: diag. scaled, 2: AMG */
+   hypre_ParCSRMatrix   *last_A;
+   HYPRE_Real            last_A_stats[2];  /* global rows, nonzeros */
+   hypre_ulonglongint    last_A_hash;      /* hash of the local coefficients */
+   HYPRE_Real            amg_setup_ratio;  /* AMG setup time / DS iteration time */
+   HYPRE_Real            amg_iter_ratio;   /* AMG iteration time / DS iteration time */
+   HYPRE_Real            amg_conv_factor;
 } hypre_AMGHybridData;
 
+/*--------------------------------------------------------------------------
+ * Cost model defaults, used until an AMG solve has been timed.  Costs are
+ * in units of one matrix-vector product with A; the operator complexity
+ * of the AMG hierarchy is guessed.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_HYBRID_OPERATOR_COMPLEXITY   1.6
+#define hypre_HYBRID_AMG_CONV_FACTOR       0.1
+
+#define hypre_HYBRID_PATH_DS               1
+#define hypre_HYBRID_PATH_AMG              2
+
 /*--------------------------------------------------------------------------
  * hypre_AMGHybridCreate
  *--------------------------------------------------------------------------*/
@@ -157,6 +179,15 @@ hypre_AMGHybridCreate( void )
    (AMGhybrid_data -> nongalerk_num_tol)  = 0;
    (AMGhybrid_data -> nongalerkin_tol)  = NULL;
 
+   /* cost model */
+   (AMGhybrid_data -> cost_model)       = 0;
+   (AMGhybrid_data -> last_path)        = 0;
+   (AMGhybrid_data -> last_A)           = NULL;
+   (AMGhybrid_data -> last_A_hash)      = 0;
+   (AMGhybrid_data -> amg_setup_ratio)  = 0.0;
+   (AMGhybrid_data -> amg_iter_ratio)   = 0.0;
+   (AMGhybrid_data -> amg_conv_factor)  = 0.0;
+
    return (void *) AMGhybrid_data;
 }
 
@@ -392,6 +423,26 @@ hypre_AMGHybridSetSetupType( void   *AMGhybrid_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMGHybridSetCostModel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_AMGHybridSetCostModel( void      *AMGhybrid_vdata,
+                             HYPRE_Int  cost_model )
+{
+   hypre_AMGHybridData *AMGhybrid_data = (hypre_AMGHybridData *) AMGhybrid_vdata;
+   if (!AMGhybrid_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   (AMGhybrid_data -> cost_model) = cost_model;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMGHybridSetSolverType
  *--------------------------------------------------------------------------*/
@@ -1663,6 +1714,249 @@ hypre_AMGHybridGetFinalRelativeResidualNorm( void   *AMGhybrid_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMGHybridHashValues
+ *
+ * Fold the bit patterns of n coefficients into the 64-bit FNV-1a hash h.
+ * Device data is copied to the host first.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ulonglongint
+hypre_AMGHybridHashValues( HYPRE_Complex        *data,
+                           HYPRE_Int             n,
+                           HYPRE_MemoryLocation  memory_location,
+                           hypre_ulonglongint    h )
+{
+   HYPRE_Complex  *h_data = data;
+   unsigned char  *bytes;
+   size_t          num_words, k;
+   hypre_uint      word;
+
+   if (n <= 0)
+   {
+      return h;
+   }
+
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      h_data = hypre_TAlloc(HYPRE_Complex, n, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(h_data, data, HYPRE_Complex, n, HYPRE_MEMORY_HOST, memory_location);
+   }
+
+   /* sizeof(HYPRE_Complex) is a multiple of the word size */
+   bytes     = (unsigned char *) h_data;
+   num_words = ((size_t) n * sizeof(HYPRE_Complex)) / sizeof(hypre_uint);
+   for (k = 0; k < num_words; k++)
+   {
+      memcpy(&word, bytes + k * sizeof(hypre_uint), sizeof(hypre_uint));
+      h ^= (hypre_ulonglongint) word;
+      h *= 1099511628211ULL;
+   }
+
+   if (h_data != data)
+   {
+      hypre_TFree(h_data, HYPRE_MEMORY_HOST);
+   }
+
+   return h;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGHybridMatrixChanged
+ *
+ * Returns 1 if A differs from the matrix of the previous solve.  The
+ * comparison uses the matrix pointer, the global sizes and, on each rank,
+ * a hash of the bit patterns of the local coefficients, so any change of a
+ * value (including its sign) is detected wherever the matrix lives.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_AMGHybridMatrixChanged( hypre_AMGHybridData *AMGhybrid_data,
+                              hypre_ParCSRMatrix  *A )
+{
+   hypre_CSRMatrix      *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix      *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int             nnz_diag        = hypre_CSRMatrixNumNonzeros(A_diag);
+   HYPRE_Int             nnz_offd        = hypre_CSRMatrixNumNonzeros(A_offd);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(A);
+   HYPRE_Real           *last_stats      = (AMGhybrid_data -> last_A_stats);
+
+   HYPRE_Real            local_stats[2], stats[2];
+   hypre_ulonglongint    hash;
+   HYPRE_Int             changed;
+
+   /* FNV-1a offset basis, seeded with the local sizes */
+   hash = 14695981039346656037ULL;
+   hash = (hash ^ (hypre_ulonglongint) nnz_diag) * 1099511628211ULL;
+   hash = (hash ^ (hypre_ulonglongint) nnz_offd) * 1099511628211ULL;
+   hash = hypre_AMGHybridHashValues(hypre_CSRMatrixData(A_diag), nnz_diag,
+                                    memory_location, hash);
+   hash = hypre_AMGHybridHashValues(hypre_CSRMatrixData(A_offd), nnz_offd,
+                                    memory_location, hash);
+
+   /* nonzeros and the number of ranks whose coefficients changed */
+   local_stats[0] = (HYPRE_Real) (nnz_diag + nnz_offd);
+   local_stats[1] = (hash != (AMGhybrid_data -> last_A_hash)) ? 1.0 : 0.0;
+   hypre_MPI_Allreduce(local_stats, stats, 2, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_ParCSRMatrixComm(A));
+
+   changed = ((AMGhybrid_data -> last_A) != A) ||
+             (last_stats[0] != (HYPRE_Real) hypre_ParCSRMatrixGlobalNumRows(A)) ||
+             (last_stats[1] != stats[0]) ||
+             (stats[1] > 0.0);
+
+   (AMGhybrid_data -> last_A)      = A;
+   (AMGhybrid_data -> last_A_hash) = hash;
+   last_stats[0] = (HYPRE_Real) hypre_ParCSRMatrixGlobalNumRows(A);
+   last_stats[1] = stats[0];
+
+   return changed;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGHybridPredictDSCheaper
+ *
+ * Called when the diagonally scaled solver stalls.  Compares the predicted
+ * time for finishing with it against the time for AMG setup (unless an
+ * existing setup can be reused) plus AMG-preconditioned iterations.
+ * Iteration counts are extrapolated from the convergence factors; times
+ * use the measured time per DS iteration, scaled by ratios measured in
+ * earlier AMG solves or, before any, by work estimates from the matrix
+ * size and number of nonzeros.  Returns the same answer on all ranks.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_AMGHybridPredictDSCheaper( hypre_AMGHybridData *AMGhybrid_data,
+                                 hypre_ParCSRMatrix  *A,
+                                 HYPRE_Int            dscg_num_its,
+                                 HYPRE_Int            dscg_max_its,
+                                 HYPRE_Real           res_norm,
+                                 HYPRE_Real           ds_time,
+                                 HYPRE_Int            reuse_precond )
+{
+   HYPRE_Real  tol         = (AMGhybrid_data -> tol);
+   HYPRE_Int   print_level = (AMGhybrid_data -> print_level);
+   HYPRE_Real  num_rows    = (AMGhybrid_data -> last_A_stats)[0];
+   HYPRE_Real  num_nnz     = (AMGhybrid_data -> last_A_stats)[1];
+   HYPRE_Real  cop         = hypre_HYBRID_OPERATOR_COMPLEXITY;
+
+   HYPRE_Real  t_ds_it, ds_work, reduction;
+   HYPRE_Real  ds_conv, ds_its, ds_cost;
+   HYPRE_Real  amg_conv, amg_its, amg_cost;
+   HYPRE_Real  setup_ratio, iter_ratio;
+   HYPRE_Int   my_id;
+
+   if (dscg_num_its < 1 || dscg_num_its >= dscg_max_its || !(res_norm > 0.0))
+   {
+      return 0;
+   }
+
+   hypre_MPI_Allreduce(&ds_time, &t_ds_it, 1, HYPRE_MPI_REAL, hypre_MPI_MAX,
+                       hypre_ParCSRMatrixComm(A));
+   t_ds_it /= (HYPRE_Real) dscg_num_its;
+
+   /* Remaining reduction of the relative residual */
+   reduction = hypre_min(tol / res_norm, 1.0);
+
+   ds_conv = hypre_pow(res_norm, 1.0 / (HYPRE_Real) dscg_num_its);
+   if (ds_conv >= 1.0)
+   {
+      return 0;
+   }
+   ds_its = hypre_ceil(hypre_log(reduction) / hypre_log(ds_conv));
+   if (ds_its > (HYPRE_Real) (dscg_max_its - dscg_num_its))
+   {
+      return 0;
+   }
+
+   /* One DS iteration: a matvec and about ten vector updates */
+   ds_work     = num_nnz + 10.0 * num_rows;
+   setup_ratio = (AMGhybrid_data -> amg_setup_ratio);
+   iter_ratio  = (AMGhybrid_data -> amg_iter_ratio);
+   if (iter_ratio <= 0.0)
+   {
+      /* V(1,1)-cycle: two relaxations, a residual and the transfers on
+         each level, plus the Krylov work */
+      iter_ratio = ((1.0 + 3.5 * cop) * num_nnz + 10.0 * num_rows) / ds_work;
+   }
+   if (setup_ratio <= 0.0)
+   {
+      /* Dominated by the Galerkin products */
+      setup_ratio = 4.0 * cop * num_nnz * (1.0 + num_nnz / hypre_max(num_rows, 1.0)) /
+                    ds_work;
+   }
+   amg_conv = (AMGhybrid_data -> amg_conv_factor);
+   if (amg_conv <= 0.0 || amg_conv >= 1.0)
+   {
+      amg_conv = hypre_HYBRID_AMG_CONV_FACTOR;
+   }
+   amg_its = hypre_ceil(hypre_log(reduction) / hypre_log(amg_conv));
+
+   ds_cost  = ds_its * t_ds_it;
+   amg_cost = (amg_its * iter_ratio + (reuse_precond ? 0.0 : setup_ratio)) * t_ds_it;
+
+   if (print_level > 0)
+   {
+      hypre_MPI_Comm_rank(hypre_ParCSRMatrixComm(A), &my_id);
+      if (my_id == 0)
+      {
+         hypre_printf("AMGHybrid cost model: DS %d more its (%e s), AMG %d its (%e s)\n",
+                      (HYPRE_Int) ds_its, ds_cost, (HYPRE_Int) amg_its, amg_cost);
+      }
+   }
+
+   return (ds_cost < amg_cost);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_AMGHybridKrylovSolve
+ *
+ * Continues with the current Krylov solver and preconditioner for at most
+ * max_its iterations, without the convergence factor test.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_AMGHybridKrylovSolve( HYPRE_Int           solver_type,
+                            void               *pcg_solver,
+                            HYPRE_Int           max_its,
+                            hypre_ParCSRMatrix *A,
+                            hypre_ParVector    *b,
+                            hypre_ParVector    *x,
+                            HYPRE_Int          *num_its,
+                            HYPRE_Real         *res_norm,
+                            HYPRE_Int          *converged )
+{
+   if (solver_type == 1)
+   {
+      hypre_PCGSetMaxIter(pcg_solver, max_its);
+      hypre_PCGSetConvergenceFactorTol(pcg_solver, 0.0);
+      hypre_PCGSolve(pcg_solver, (void*) A, (void*) b, (void*) x);
+      hypre_PCGGetNumIterations(pcg_solver, num_its);
+      hypre_PCGGetFinalRelativeResidualNorm(pcg_solver, res_norm);
+      hypre_PCGGetConverged(pcg_solver, converged);
+   }
+   else if (solver_type == 2)
+   {
+      hypre_GMRESSetMaxIter(pcg_solver, max_its);
+      hypre_GMRESSetConvergenceFactorTol(pcg_solver, 0.0);
+      hypre_GMRESSolve(pcg_solver, (void*) A, (void*) b, (void*) x);
+      hypre_GMRESGetNumIterations(pcg_solver, num_its);
+      hypre_GMRESGetFinalRelativeResidualNorm(pcg_solver, res_norm);
+      hypre_GMRESGetConverged(pcg_solver, converged);
+   }
+   else if (solver_type == 3)
+   {
+      hypre_BiCGSTABSetMaxIter(pcg_solver, max_its);
+      hypre_BiCGSTABSetConvergenceFactorTol(pcg_solver, 0.0);
+      hypre_BiCGSTABSolve(pcg_solver, (void*) A, (void*) b, (void*) x);
+      hypre_BiCGSTABGetNumIterations(pcg_solver, num_its);
+      hypre_BiCGSTABGetFinalRelativeResidualNorm(pcg_solver, res_norm);
+      hypre_BiCGSTABGetConverged(pcg_solver, converged);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMGHybridSetup
  *--------------------------------------------------------------------------*/
@@ -1779,6 +2073,14 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
 
    HYPRE_Real         tt1, tt2;
 
+   /* cost model */
+   HYPRE_Int          cost_model;
+   HYPRE_Int          reuse_precond = 0;
+   HYPRE_Int          skip_ds = 0;
+   HYPRE_Int          run_ds;
+   HYPRE_Int          more_its;
+   HYPRE_Real         ds_res_norm = 1.0;
+
    if (!AMGhybrid_data)
    {
       hypre_error_in_arg(1);
@@ -1837,6 +2139,7 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
    pcg_default    = (AMGhybrid_data -> pcg_default);
    nongalerk_num_tol    = (AMGhybrid_data -> nongalerk_num_tol);
    nongalerkin_tol    = (AMGhybrid_data -> nongalerkin_tol);
+   cost_model     = (AMGhybrid_data -> cost_model);
    if (!b)
    {
       hypre_error_in_arg(3);
@@ -1863,9 +2166,36 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
    (AMGhybrid_data -> dscg_num_its) = 0;
    (AMGhybrid_data -> pcg_num_its) = 0;
 
-   if (setup_type || pcg_precond == NULL)
+   /*-----------------------------------------------------------------------
+    * With the cost model, remember which path won for this matrix.  If it
+    * was AMG and its setup is still available, go there directly; if it
+    * was the diagonally scaled solver, do not stop it early.
+    *-----------------------------------------------------------------------*/
+   if (cost_model)
+   {
+      if (hypre_AMGHybridMatrixChanged(AMGhybrid_data, A))
+      {
+         (AMGhybrid_data -> last_path) = 0;
+      }
+      else if (pcg_precond && pcg_default)
+      {
+         reuse_precond = 1;
+      }
+
+      if (reuse_precond && (AMGhybrid_data -> last_path) == hypre_HYBRID_PATH_AMG)
+      {
+         skip_ds = 1;
+      }
+      else if ((AMGhybrid_data -> last_path) == hypre_HYBRID_PATH_DS)
+      {
+         cf_tol = 0.0;
+      }
+   }
+
+   run_ds = (setup_type || pcg_precond == NULL) && !skip_ds;
+   if (run_ds)
    {
-      if (pcg_precond)
+      if (pcg_precond && !reuse_precond)
       {
          hypre_BoomerAMGDestroy(pcg_precond);
          pcg_precond = NULL;
@@ -1889,6 +2219,9 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            hypre_PCGFunctionsSetFusedOps(pcg_functions, hypre_ParKrylovAxpby,
+                                          hypre_ParKrylovAxpyInnerProd,
+                                          hypre_ParKrylovDualAxpyInnerProd);
             pcg_solver = hypre_PCGCreate( pcg_functions );
 
             hypre_PCGSetTol(pcg_solver, tol);
@@ -2019,6 +2352,9 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovCommInfo,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+            hypre_BiCGSTABFunctionsSetFusedOps(bicgstab_functions, hypre_ParKrylovAxpby,
+                                               hypre_ParKrylovAxpyInnerProd,
+                                               hypre_ParKrylovDualAxpyInnerProd);
             pcg_solver = hypre_BiCGSTABCreate( bicgstab_functions );
 
             hypre_BiCGSTABSetTol(pcg_solver, tol);
@@ -2065,6 +2401,29 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
       }
    }
 
+   /*---------------------------------------------------------------------
+    * With the cost model, keep going with the diagonally scaled solver if
+    * that is predicted to be cheaper than switching to AMG.
+    *---------------------------------------------------------------------*/
+   if (cost_model && run_ds && !converged)
+   {
+      if (hypre_AMGHybridPredictDSCheaper(AMGhybrid_data, A, dscg_num_its, dscg_max_its,
+                                          res_norm, AMGhybrid_data->solve_time1,
+                                          reuse_precond))
+      {
+         tt1 = hypre_MPI_Wtime();
+
+         hypre_AMGHybridKrylovSolve(solver_type, pcg_solver, dscg_max_its - dscg_num_its,
+                                    A, b, x, &more_its, &res_norm, &converged);
+         dscg_num_its += more_its;
+         (AMGhybrid_data -> dscg_num_its) = dscg_num_its;
+
+         tt2 = hypre_MPI_Wtime();
+         AMGhybrid_data->solve_time1 += tt2 - tt1;
+      }
+      ds_res_norm = res_norm;
+   }
+
    /*---------------------------------------------------------------------
     * If converged, done...
     *---------------------------------------------------------------------*/
@@ -2074,6 +2433,10 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
       {
          (AMGhybrid_data -> final_rel_res_norm) = res_norm;
       }
+      if (cost_model)
+      {
+         (AMGhybrid_data -> last_path) = hypre_HYBRID_PATH_DS;
+      }
    }
    /*-----------------------------------------------------------------------
     * ... otherwise, use AMG+solver
@@ -2105,7 +2468,7 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
       }
 
       /* Setup preconditioner */
-      if (setup_type && pcg_default)
+      if (setup_type && pcg_default && !reuse_precond)
       {
          pcg_precond = hypre_BoomerAMGCreate();
          hypre_BoomerAMGSetMaxIter(pcg_precond, 1);
@@ -2216,7 +2579,8 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
          pcg_precond       = (AMGhybrid_data -> pcg_precond);
          pcg_precond_solve = (AMGhybrid_data -> pcg_precond_solve);
          pcg_precond_setup = (AMGhybrid_data -> pcg_precond_setup);
-         hypre_BoomerAMGSetSetupType(pcg_precond, setup_type);
+         /* An AMG setup kept by the cost model is for this same matrix */
+         hypre_BoomerAMGSetSetupType(pcg_precond, reuse_precond ? 0 : setup_type);
       }
 
       /* Complete setup of solver+AMG */
@@ -2307,6 +2671,52 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
          tt2 = hypre_MPI_Wtime();
          AMGhybrid_data->solve_time2 = tt2 - tt1;
       }
+
+      /*-----------------------------------------------------------------
+       * Record the measured AMG costs for later predictions
+       *-----------------------------------------------------------------*/
+      if (cost_model)
+      {
+         HYPRE_Real t_local[3], t[3];
+
+         (AMGhybrid_data -> last_path) = hypre_HYBRID_PATH_AMG;
+
+         t_local[0] = AMGhybrid_data->solve_time1;
+         t_local[1] = AMGhybrid_data->setup_time2;
+         t_local[2] = AMGhybrid_data->solve_time2;
+         hypre_MPI_Allreduce(t_local, t, 3, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+         if (dscg_num_its > 0 && pcg_num_its > 0 && t[0] > 0.0)
+         {
+            t[0] /= (HYPRE_Real) dscg_num_its;
+            if (!reuse_precond)
+            {
+               (AMGhybrid_data -> amg_setup_ratio) = t[1] / t[0];
+            }
+            (AMGhybrid_data -> amg_iter_ratio) = t[2] / ((HYPRE_Real) pcg_num_its * t[0]);
+         }
+
+         if (pcg_num_its > 0)
+         {
+            if (solver_type == 1)
+            {
+               hypre_PCGGetFinalRelativeResidualNorm(pcg_solver, &res_norm);
+            }
+            else if (solver_type == 2)
+            {
+               hypre_GMRESGetFinalRelativeResidualNorm(pcg_solver, &res_norm);
+            }
+            else if (solver_type == 3)
+            {
+               hypre_BiCGSTABGetFinalRelativeResidualNorm(pcg_solver, &res_norm);
+            }
+            if (res_norm > 0.0 && res_norm < ds_res_norm)
+            {
+               (AMGhybrid_data -> amg_conv_factor) =
+                  hypre_pow(res_norm / ds_res_norm, 1.0 / (HYPRE_Real) pcg_num_its);
+            }
+         }
+      }
    }
 
    return hypre_error_flag;
@@ -0,0 +1,766 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * ParCSR multivector stored as one contiguous column-major hypre_ParVector
+ * (num_vectors = block width).  Gram matrices and block updates are done
+ * with a single local dgemm (plus one reduction), and matrix-multivector
+ * products with a single multivector ParCSR matvec.
+ *
+ * The object starts with a mv_TempMultiVector whose columns are views into
+ * the contiguous block, so it can be used anywhere a mv_TempMultiVector is
+ * expected (e.g. HYPRE_ParCSRMultiVectorPrint), and operations without a
+ * blocked kernel (or with data in device memory) fall back to the
+ * column-by-column mv_TempMultiVector implementation.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "_hypre_blas.h"
+#include "interpreter.h"
+#include "HYPRE_MatvecFunctions.h"
+#include "temp_multivector.h"
+
+typedef struct
+{
+   mv_TempMultiVector   columns;  /* column views into block; must be first */
+   hypre_ParVector     *block;    /* contiguous column-major storage */
+
+} hypre_ParContigMultiVector;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorUseBLAS
+ *
+ * Returns 1 if the blocked host kernels can be used on x.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParContigMultiVectorUseBLAS( hypre_ParContigMultiVector *x )
+{
+#if defined(HYPRE_COMPLEX)
+   HYPRE_UNUSED_VAR(x);
+
+   return 0;
+#else
+   HYPRE_MemoryLocation memory_location = hypre_ParVectorMemoryLocation(x->block);
+
+   return (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST);
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorMaskIsFull
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParContigMultiVectorMaskIsFull( hypre_ParContigMultiVector *x )
+{
+   HYPRE_Int n = (x->columns).numVectors;
+
+   return (aux_maskCount(n, (x->columns).mask) == n);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorGather
+ *
+ * Returns a pointer to the active (masked) columns of x stored contiguously
+ * with leading dimension *ld_ptr.  If the mask selects all columns this is
+ * the block data itself; otherwise the columns are packed into a new buffer
+ * (*owns_ptr = 1) which the caller frees.  If copy_values is zero, a packed
+ * buffer is only allocated.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Complex *
+hypre_ParContigMultiVectorGather( hypre_ParContigMultiVector *x,
+                                  HYPRE_Int                   copy_values,
+                                  HYPRE_Int                  *ld_ptr,
+                                  HYPRE_Int                  *owns_ptr )
+{
+   hypre_Vector   *block_local = hypre_ParVectorLocalVector(x->block);
+   HYPRE_Complex  *data        = hypre_VectorData(block_local);
+   HYPRE_Int       size        = hypre_VectorSize(block_local);
+   HYPRE_Int       vecstride   = hypre_VectorVectorStride(block_local);
+   HYPRE_Int       n           = (x->columns).numVectors;
+   HYPRE_Int      *mask        = (x->columns).mask;
+   HYPRE_Complex  *buffer;
+   HYPRE_Int       i, j;
+
+   if (hypre_ParContigMultiVectorMaskIsFull(x))
+   {
+      *ld_ptr   = hypre_max(vecstride, 1);
+      *owns_ptr = 0;
+
+      return data;
+   }
+
+   buffer = hypre_TAlloc(HYPRE_Complex, size * aux_maskCount(n, mask) + 1, HYPRE_MEMORY_HOST);
+   if (copy_values)
+   {
+      for (i = 0, j = 0; i < n; i++)
+      {
+         if (mask[i])
+         {
+            hypre_TMemcpy(buffer + j * size, data + i * vecstride, HYPRE_Complex, size,
+                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            j++;
+         }
+      }
+   }
+
+   *ld_ptr   = hypre_max(size, 1);
+   *owns_ptr = 1;
+
+   return buffer;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorScatter
+ *
+ * Copies a buffer returned by hypre_ParContigMultiVectorGather back into the
+ * active columns of x and frees it.  Does nothing if the buffer is the block
+ * data itself.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParContigMultiVectorScatter( hypre_ParContigMultiVector *x,
+                                   HYPRE_Complex              *buffer,
+                                   HYPRE_Int                   owns_buffer )
+{
+   hypre_Vector   *block_local = hypre_ParVectorLocalVector(x->block);
+   HYPRE_Complex  *data        = hypre_VectorData(block_local);
+   HYPRE_Int       size        = hypre_VectorSize(block_local);
+   HYPRE_Int       vecstride   = hypre_VectorVectorStride(block_local);
+   HYPRE_Int       n           = (x->columns).numVectors;
+   HYPRE_Int      *mask        = (x->columns).mask;
+   HYPRE_Int       i, j;
+
+   if (!owns_buffer)
+   {
+      return;
+   }
+
+   for (i = 0, j = 0; i < n; i++)
+   {
+      if (mask[i])
+      {
+         hypre_TMemcpy(data + i * vecstride, buffer + j * size, HYPRE_Complex, size,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         j++;
+      }
+   }
+
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorCreateFromSampleVector
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ParContigMultiVectorCreateFromSampleVector( void      *ii_,
+                                                  HYPRE_Int  n,
+                                                  void      *sample_ )
+{
+   mv_InterfaceInterpreter    *ii     = (mv_InterfaceInterpreter *) ii_;
+   hypre_ParVector            *sample = (hypre_ParVector *) sample_;
+   MPI_Comm                    comm   = hypre_ParVectorComm(sample);
+   HYPRE_BigInt                global_size = hypre_ParVectorGlobalSize(sample);
+   HYPRE_BigInt               *partitioning = hypre_ParVectorPartitioning(sample);
+   HYPRE_MemoryLocation        memory_location = hypre_ParVectorMemoryLocation(sample);
+   hypre_ParContigMultiVector *x;
+   hypre_ParVector            *column;
+   HYPRE_Complex              *data;
+   HYPRE_Int                   vecstride;
+   HYPRE_Int                   i;
+
+   x = hypre_CTAlloc(hypre_ParContigMultiVector, 1, HYPRE_MEMORY_HOST);
+
+   x->block = hypre_ParMultiVectorCreate(comm, global_size, partitioning, n);
+   hypre_ParVectorInitialize_v2(x->block, memory_location);
+
+   data      = hypre_VectorData(hypre_ParVectorLocalVector(x->block));
+   vecstride = hypre_VectorVectorStride(hypre_ParVectorLocalVector(x->block));
+
+   (x->columns).interpreter = ii;
+   (x->columns).numVectors  = n;
+   (x->columns).vector      = hypre_CTAlloc(void *, n, HYPRE_MEMORY_HOST);
+   (x->columns).ownsVectors = 1;
+   (x->columns).mask        = NULL;
+   (x->columns).ownsMask    = 0;
+
+   for (i = 0; i < n; i++)
+   {
+      column = hypre_ParVectorCreate(comm, global_size, partitioning);
+      hypre_ParVectorSetData(column, data + i * vecstride);
+      hypre_ParVectorInitialize_v2(column, memory_location);
+
+      (x->columns).vector[i] = (void *) column;
+   }
+
+   return x;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorCreateCopy
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ParContigMultiVectorCreateCopy( void      *src_,
+                                      HYPRE_Int  copyValues )
+{
+   hypre_ParContigMultiVector *src = (hypre_ParContigMultiVector *) src_;
+   hypre_ParContigMultiVector *dest;
+
+   hypre_assert( src != NULL );
+
+   dest = (hypre_ParContigMultiVector *)
+          hypre_ParContigMultiVectorCreateFromSampleVector((src->columns).interpreter,
+                                                           (src->columns).numVectors,
+                                                           (src->columns).vector[0]);
+   if (copyValues)
+   {
+      hypre_ParVectorCopy(src->block, dest->block);
+   }
+
+   return dest;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorDestroy
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParContigMultiVectorDestroy( void *x_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+   HYPRE_Int                   i;
+
+   if (x == NULL)
+   {
+      return;
+   }
+
+   for (i = 0; i < (x->columns).numVectors; i++)
+   {
+      hypre_ParVectorDestroy((hypre_ParVector *) (x->columns).vector[i]);
+   }
+   hypre_TFree((x->columns).vector, HYPRE_MEMORY_HOST);
+   if ((x->columns).mask && (x->columns).ownsMask)
+   {
+      hypre_TFree((x->columns).mask, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParVectorDestroy(x->block);
+   hypre_TFree(x, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorClear
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParContigMultiVectorClear( void *x_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+
+   hypre_assert( x != NULL );
+
+   if (hypre_ParContigMultiVectorMaskIsFull(x))
+   {
+      hypre_ParVectorSetZeros(x->block);
+   }
+   else
+   {
+      mv_TempMultiVectorClear(&(x->columns));
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorCopy
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParContigMultiVectorCopy( void *src_,
+                                void *dest_ )
+{
+   hypre_ParContigMultiVector *src  = (hypre_ParContigMultiVector *) src_;
+   hypre_ParContigMultiVector *dest = (hypre_ParContigMultiVector *) dest_;
+
+   hypre_assert( src != NULL && dest != NULL );
+
+   if (hypre_ParContigMultiVectorMaskIsFull(src) &&
+       hypre_ParContigMultiVectorMaskIsFull(dest))
+   {
+      hypre_ParVectorCopy(src->block, dest->block);
+   }
+   else
+   {
+      mv_TempMultiVectorCopy(&(src->columns), &(dest->columns));
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorAxpy
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParContigMultiVectorAxpy( HYPRE_Complex  a,
+                                void          *x_,
+                                void          *y_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+   hypre_ParContigMultiVector *y = (hypre_ParContigMultiVector *) y_;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (hypre_ParContigMultiVectorMaskIsFull(x) &&
+       hypre_ParContigMultiVectorMaskIsFull(y))
+   {
+      hypre_ParVectorAxpy(a, x->block, y->block);
+   }
+   else
+   {
+      mv_TempMultiVectorAxpy(a, &(x->columns), &(y->columns));
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorByMultiVector
+ *
+ * xy = x'*y, computed as one local dgemm and one reduction.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParContigMultiVectorByMultiVector( void          *x_,
+                                         void          *y_,
+                                         HYPRE_BigInt   xyGHeight,
+                                         HYPRE_Int      xyHeight,
+                                         HYPRE_Int      xyWidth,
+                                         HYPRE_Complex *xyVal )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+   hypre_ParContigMultiVector *y = (hypre_ParContigMultiVector *) y_;
+   HYPRE_Int                   size;
+   HYPRE_Complex              *xp, *yp;
+   HYPRE_Int                   ldx, ldy, owns_x, owns_y;
+   HYPRE_Real                 *local_xy, *xy;
+   HYPRE_Real                  one = 1.0, zero = 0.0;
+   HYPRE_Int                   i, j;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (!hypre_ParContigMultiVectorUseBLAS(x) || !hypre_ParContigMultiVectorUseBLAS(y))
+   {
+      mv_TempMultiVectorByMultiVector(&(x->columns), &(y->columns),
+                                      xyGHeight, xyHeight, xyWidth, xyVal);
+      return;
+   }
+
+   hypre_assert( aux_maskCount((x->columns).numVectors, (x->columns).mask) == xyHeight );
+   hypre_assert( aux_maskCount((y->columns).numVectors, (y->columns).mask) == xyWidth );
+
+   if (xyHeight < 1 || xyWidth < 1)
+   {
+      return;
+   }
+
+   size     = hypre_ParVectorLocalSize(x->block);
+   local_xy = hypre_CTAlloc(HYPRE_Real, 2 * xyHeight * xyWidth, HYPRE_MEMORY_HOST);
+   xy       = local_xy + xyHeight * xyWidth;
+
+   if (size > 0)
+   {
+      xp = hypre_ParContigMultiVectorGather(x, 1, &ldx, &owns_x);
+      yp = hypre_ParContigMultiVectorGather(y, 1, &ldy, &owns_y);
+
+      hypre_dgemm("T", "N", &xyHeight, &xyWidth, &size, &one,
+                  (HYPRE_Real *) xp, &ldx, (HYPRE_Real *) yp, &ldy,
+                  &zero, local_xy, &xyHeight);
+
+      if (owns_x) { hypre_TFree(xp, HYPRE_MEMORY_HOST); }
+      if (owns_y) { hypre_TFree(yp, HYPRE_MEMORY_HOST); }
+   }
+
+   hypre_MPI_Allreduce(local_xy, xy, xyHeight * xyWidth, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_ParVectorComm(x->block));
+
+   for (j = 0; j < xyWidth; j++)
+   {
+      for (i = 0; i < xyHeight; i++)
+      {
+         xyVal[i + j * xyGHeight] = xy[i + j * xyHeight];
+      }
+   }
+
+   hypre_TFree(local_xy, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorByMultiVectorDiag
+ *
+ * diag = diag(x'*y), with a single reduction for all columns.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParContigMultiVectorByMultiVectorDiag( void          *x_,
+                                             void          *y_,
+                                             HYPRE_Int     *mask,
+                                             HYPRE_Int      n,
+                                             HYPRE_Complex *diag )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+   hypre_ParContigMultiVector *y = (hypre_ParContigMultiVector *) y_;
+   hypre_Vector               *x_local, *y_local;
+   HYPRE_Complex              *xp, *yp;
+   HYPRE_Int                   size, x_stride, y_stride;
+   HYPRE_Int                  *x_index, *y_index, *index;
+   HYPRE_Real                 *local_d, *d;
+   HYPRE_Int                   i, k, m;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (!hypre_ParContigMultiVectorUseBLAS(x) || !hypre_ParContigMultiVectorUseBLAS(y))
+   {
+      mv_TempMultiVectorByMultiVectorDiag(&(x->columns), &(y->columns), mask, n, diag);
+      return;
+   }
+
+   m = aux_maskCount(n, mask);
+   hypre_assert( aux_maskCount((x->columns).numVectors, (x->columns).mask) == m );
+   hypre_assert( aux_maskCount((y->columns).numVectors, (y->columns).mask) == m );
+
+   if (m < 1)
+   {
+      return;
+   }
+
+   x_local  = hypre_ParVectorLocalVector(x->block);
+   y_local  = hypre_ParVectorLocalVector(y->block);
+   size     = hypre_VectorSize(x_local);
+   x_stride = hypre_VectorVectorStride(x_local);
+   y_stride = hypre_VectorVectorStride(y_local);
+
+   x_index  = hypre_CTAlloc(HYPRE_Int, 3 * m, HYPRE_MEMORY_HOST);
+   y_index  = x_index + m;
+   index    = y_index + m;
+   aux_indexFromMask((x->columns).numVectors, (x->columns).mask, x_index);
+   aux_indexFromMask((y->columns).numVectors, (y->columns).mask, y_index);
+   aux_indexFromMask(n, mask, index);
+
+   local_d = hypre_CTAlloc(HYPRE_Real, 2 * m, HYPRE_MEMORY_HOST);
+   d       = local_d + m;
+
+   for (i = 0; i < m; i++)
+   {
+      xp = hypre_VectorData(x_local) + (x_index[i] - 1) * x_stride;
+      yp = hypre_VectorData(y_local) + (y_index[i] - 1) * y_stride;
+      for (k = 0; k < size; k++)
+      {
+         local_d[i] += xp[k] * yp[k];
+      }
+   }
+
+   hypre_MPI_Allreduce(local_d, d, m, HYPRE_MPI_REAL, hypre_MPI_SUM,
+                       hypre_ParVectorComm(x->block));
+
+   for (i = 0; i < m; i++)
+   {
+      diag[index[i] - 1] = d[i];
+   }
+
+   hypre_TFree(local_d, HYPRE_MEMORY_HOST);
+   hypre_TFree(x_index, HYPRE_MEMORY_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorGemm
+ *
+ * y = x*r + beta*y on the active columns, as one local dgemm.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParContigMultiVectorGemm( hypre_ParContigMultiVector *x,
+                                HYPRE_BigInt                rGHeight,
+                                HYPRE_Int                   rHeight,
+                                HYPRE_Int                   rWidth,
+                                HYPRE_Complex              *rVal,
+                                HYPRE_Real                  beta,
+                                hypre_ParContigMultiVector *y )
+{
+   HYPRE_Int      size = hypre_ParVectorLocalSize(y->block);
+   HYPRE_Int      ldr  = (HYPRE_Int) rGHeight;
+   HYPRE_Complex *xp, *yp;
+   HYPRE_Int      ldx, ldy, owns_x, owns_y;
+   HYPRE_Real     one = 1.0;
+
+   hypre_assert( aux_maskCount((x->columns).numVectors, (x->columns).mask) == rHeight );
+   hypre_assert( aux_maskCount((y->columns).numVectors, (y->columns).mask) == rWidth );
+
+   if (size < 1 || rWidth < 1)
+   {
+      return;
+   }
+
+   if (rHeight < 1)
+   {
+      /* nothing to add; only y = beta*y is left */
+      if (beta == 0.0)
+      {
+         hypre_ParContigMultiVectorClear(y);
+      }
+      return;
+   }
+
+   xp = hypre_ParContigMultiVectorGather(x, 1, &ldx, &owns_x);
+   yp = hypre_ParContigMultiVectorGather(y, (beta != 0.0), &ldy, &owns_y);
+
+   hypre_dgemm("N", "N", &size, &rWidth, &rHeight, &one,
+               (HYPRE_Real *) xp, &ldx, (HYPRE_Real *) rVal, &ldr,
+               &beta, (HYPRE_Real *) yp, &ldy);
+
+   if (owns_x) { hypre_TFree(xp, HYPRE_MEMORY_HOST); }
+   hypre_ParContigMultiVectorScatter(y, yp, owns_y);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorByMatrix
+ *
+ * y = x*r
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParContigMultiVectorByMatrix( void          *x_,
+                                    HYPRE_BigInt   rGHeight,
+                                    HYPRE_Int      rHeight,
+                                    HYPRE_Int      rWidth,
+                                    HYPRE_Complex *rVal,
+                                    void          *y_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+   hypre_ParContigMultiVector *y = (hypre_ParContigMultiVector *) y_;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (!hypre_ParContigMultiVectorUseBLAS(x) || !hypre_ParContigMultiVectorUseBLAS(y))
+   {
+      mv_TempMultiVectorByMatrix(&(x->columns), rGHeight, rHeight, rWidth, rVal,
+                                 &(y->columns));
+      return;
+   }
+
+   hypre_ParContigMultiVectorGemm(x, rGHeight, rHeight, rWidth, rVal, 0.0, y);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorXapy
+ *
+ * y = y + x*r
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_ParContigMultiVectorXapy( void          *x_,
+                                HYPRE_BigInt   rGHeight,
+                                HYPRE_Int      rHeight,
+                                HYPRE_Int      rWidth,
+                                HYPRE_Complex *rVal,
+                                void          *y_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+   hypre_ParContigMultiVector *y = (hypre_ParContigMultiVector *) y_;
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (!hypre_ParContigMultiVectorUseBLAS(x) || !hypre_ParContigMultiVectorUseBLAS(y))
+   {
+      mv_TempMultiVectorXapy(&(x->columns), rGHeight, rHeight, rWidth, rVal,
+                             &(y->columns));
+      return;
+   }
+
+   hypre_ParContigMultiVectorGemm(x, rGHeight, rHeight, rWidth, rVal, 1.0, y);
+}
+
+/*--------------------------------------------------------------------------
+ * Operations that work column by column on the views
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParContigMultiVectorWidth( void *x_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+
+   return mv_TempMultiVectorWidth(x ? &(x->columns) : NULL);
+}
+
+HYPRE_Int
+hypre_ParContigMultiVectorHeight( void *x_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+
+   return mv_TempMultiVectorHeight(x ? &(x->columns) : NULL);
+}
+
+void
+hypre_ParContigMultiVectorSetMask( void      *x_,
+                                   HYPRE_Int *mask )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+
+   hypre_assert( x != NULL );
+   mv_TempMultiVectorSetMask(&(x->columns), mask);
+}
+
+void
+hypre_ParContigMultiVectorSetRandom( void      *x_,
+                                     HYPRE_Int  seed )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+
+   hypre_assert( x != NULL );
+   mv_TempMultiVectorSetRandom(&(x->columns), seed);
+}
+
+void
+hypre_ParContigMultiVectorByDiagonal( void          *x_,
+                                      HYPRE_Int     *mask,
+                                      HYPRE_Int      n,
+                                      HYPRE_Complex *diag,
+                                      void          *y_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+   hypre_ParContigMultiVector *y = (hypre_ParContigMultiVector *) y_;
+
+   hypre_assert( x != NULL && y != NULL );
+   mv_TempMultiVectorByDiagonal(&(x->columns), mask, n, diag, &(y->columns));
+}
+
+void
+hypre_ParContigMultiVectorEval( void (*f)( void*, void*, void* ),
+                                void  *par,
+                                void  *x_,
+                                void  *y_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+   hypre_ParContigMultiVector *y = (hypre_ParContigMultiVector *) y_;
+
+   hypre_assert( x != NULL && y != NULL );
+   mv_TempMultiVectorEval(f, par, &(x->columns), &(y->columns));
+}
+
+/*--------------------------------------------------------------------------
+ * Multivector matvec on the blocks.  The communication package of A is
+ * shared with every other solver using A, so it is returned to its
+ * single-vector layout afterwards.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParContigMultiVectorBlockMatvec( HYPRE_Complex       alpha,
+                                       hypre_ParCSRMatrix *A,
+                                       hypre_ParVector    *x,
+                                       HYPRE_Complex       beta,
+                                       hypre_ParVector    *y )
+{
+   hypre_ParCSRCommPkg *comm_pkg;
+
+   hypre_ParCSRMatrixMatvec(alpha, A, x, beta, y);
+
+   comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   if (comm_pkg)
+   {
+      hypre_ParCSRCommPkgUpdateVecStarts(comm_pkg, 1, 0, 1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParContigMultiVectorMatvec
+ *
+ * y = alpha*A*x + beta*y on the active columns, as one multivector matvec.
+ * Active columns are packed into temporary multivectors if the masks do
+ * not select all columns.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParContigMultiVectorMatvec( void          *matvec_data,
+                                  HYPRE_Complex  alpha,
+                                  void          *A,
+                                  void          *x_,
+                                  HYPRE_Complex  beta,
+                                  void          *y_ )
+{
+   hypre_ParContigMultiVector *x = (hypre_ParContigMultiVector *) x_;
+   hypre_ParContigMultiVector *y = (hypre_ParContigMultiVector *) y_;
+   hypre_ParVector            *xb, *yb;
+   hypre_Vector               *local;
+   HYPRE_MemoryLocation        memory_location;
+   HYPRE_Int                   size, m, i, j, k;
+
+   HYPRE_UNUSED_VAR(matvec_data);
+
+   hypre_assert( x != NULL && y != NULL );
+
+   if (hypre_ParContigMultiVectorMaskIsFull(x) &&
+       hypre_ParContigMultiVectorMaskIsFull(y))
+   {
+      return hypre_ParContigMultiVectorBlockMatvec(alpha, (hypre_ParCSRMatrix *) A,
+                                                   x->block, beta, y->block);
+   }
+
+   m = aux_maskCount((x->columns).numVectors, (x->columns).mask);
+   hypre_assert( aux_maskCount((y->columns).numVectors, (y->columns).mask) == m );
+   if (m < 1)
+   {
+      return hypre_error_flag;
+   }
+
+   memory_location = hypre_ParVectorMemoryLocation(x->block);
+   size            = hypre_ParVectorLocalSize(x->block);
+
+   xb = hypre_ParMultiVectorCreate(hypre_ParVectorComm(x->block),
+                                   hypre_ParVectorGlobalSize(x->block),
+                                   hypre_ParVectorPartitioning(x->block), m);
+   hypre_ParVectorInitialize_v2(xb, memory_location);
+   yb = hypre_ParMultiVectorCreate(hypre_ParVectorComm(y->block),
+                                   hypre_ParVectorGlobalSize(y->block),
+                                   hypre_ParVectorPartitioning(y->block), m);
+   hypre_ParVectorInitialize_v2(yb, memory_location);
+
+   /* Pack active columns */
+   for (k = 0, i = 0, j = 0; k < m; k++, i++, j++)
+   {
+      while ((x->columns).mask && !(x->columns).mask[i]) { i++; }
+      while ((y->columns).mask && !(y->columns).mask[j]) { j++; }
+
+      local = hypre_ParVectorLocalVector((hypre_ParVector *) (x->columns).vector[i]);
+      hypre_TMemcpy(hypre_ParVectorLocalData(xb) + k * size, hypre_VectorData(local),
+                    HYPRE_Complex, size, memory_location, memory_location);
+      if (beta != 0.0)
+      {
+         local = hypre_ParVectorLocalVector((hypre_ParVector *) (y->columns).vector[j]);
+         hypre_TMemcpy(hypre_ParVectorLocalData(yb) + k * size, hypre_VectorData(local),
+                       HYPRE_Complex, size, memory_location, memory_location);
+      }
+   }
+
+   hypre_ParContigMultiVectorBlockMatvec(alpha, (hypre_ParCSRMatrix *) A, xb, beta, yb);
+
+   /* Unpack result */
+   for (k = 0, j = 0; k < m; k++, j++)
+   {
+      while ((y->columns).mask && !(y->columns).mask[j]) { j++; }
+
+      local = hypre_ParVectorLocalVector((hypre_ParVector *) (y->columns).vector[j]);
+      hypre_TMemcpy(hypre_VectorData(local), hypre_ParVectorLocalData(yb) + k * size,
+                    HYPRE_Complex, size, memory_location, memory_location);
+   }
+
+   hypre_ParVectorDestroy(xb);
+   hypre_ParVectorDestroy(yb);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,567 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Iterative refinement driver
+ *
+ * The outer loop keeps the residual r = b - A*x and the solution update
+ * x = x + e in the working precision of the library, while the correction
+ * equation A*e = r is solved approximately by a user-supplied inner solver
+ * (typically BoomerAMG-preconditioned PCG or GMRES with a loose tolerance).
+ * The inner solver only needs to reduce the residual by a modest factor per
+ * outer step, so it can be run with a cheaper configuration, or with a
+ * reduced-precision copy of the problem, without limiting the accuracy of
+ * the final solution.
+ *
+ * With inner_precision = 1, the inner solver is set up on a copy of A whose
+ * values are rounded to single precision, and the residual is rounded the
+ * same way before each inner solve, so that the correction is computed from
+ * single-precision data only. The values are still stored in HYPRE_Real,
+ * since the library is built for one precision (host memory only).
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRData:
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Real            tol;
+   HYPRE_Real            a_tol;
+   HYPRE_Int             max_iter;
+
+   HYPRE_Int           (*inner_solve)(void*, void*, void*, void*);
+   HYPRE_Int           (*inner_setup)(void*, void*, void*, void*);
+   void                 *inner_solver;
+
+   hypre_ParVector      *r;           /* outer residual */
+   hypre_ParVector      *e;           /* correction from the inner solver */
+
+   /* single-precision inner solve (inner_precision = 1) */
+   HYPRE_Int             inner_precision;
+   hypre_ParCSRMatrix   *A_s;         /* A rounded to single precision */
+
+   /* log info (always logged) */
+   HYPRE_Int             num_iterations;
+   HYPRE_Real            final_rel_res_norm;
+
+   HYPRE_Int             print_level;
+} hypre_ParIRData;
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRCreate
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ParIRCreate( void )
+{
+   hypre_ParIRData *ir_data;
+
+   ir_data = hypre_CTAlloc(hypre_ParIRData, 1, HYPRE_MEMORY_HOST);
+
+   /* set defaults */
+   (ir_data -> tol)                  = 1.0e-08;
+   (ir_data -> a_tol)                = 0.0;
+   (ir_data -> max_iter)             = 20;
+   (ir_data -> inner_solve)          = NULL;
+   (ir_data -> inner_setup)          = NULL;
+   (ir_data -> inner_solver)         = NULL;
+   (ir_data -> r)                    = NULL;
+   (ir_data -> e)                    = NULL;
+   (ir_data -> inner_precision)      = 0;
+   (ir_data -> A_s)                  = NULL;
+
+   /* initialize */
+   (ir_data -> num_iterations)       = 0;
+   (ir_data -> final_rel_res_norm)   = 0.0;
+   (ir_data -> print_level)          = 0;
+
+   return (void *) ir_data;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRDestroy
+ *
+ * The inner solver is owned by the caller and is not destroyed here.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRDestroy( void *ir_vdata )
+{
+   hypre_ParIRData *ir_data = (hypre_ParIRData *) ir_vdata;
+
+   if (ir_data)
+   {
+      hypre_ParVectorDestroy(ir_data -> r);
+      hypre_ParVectorDestroy(ir_data -> e);
+      hypre_ParCSRMatrixDestroy(ir_data -> A_s);
+      hypre_TFree(ir_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRSetTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRSetTol( void       *ir_vdata,
+                   HYPRE_Real  tol )
+{
+   hypre_ParIRData *ir_data = (hypre_ParIRData *) ir_vdata;
+
+   if (!ir_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (tol < 0 || tol > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (ir_data -> tol) = tol;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRSetAbsoluteTol
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRSetAbsoluteTol( void       *ir_vdata,
+                           HYPRE_Real  a_tol )
+{
+   hypre_ParIRData *ir_data = (hypre_ParIRData *) ir_vdata;
+
+   if (!ir_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (a_tol < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (ir_data -> a_tol) = a_tol;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRSetMaxIter
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRSetMaxIter( void      *ir_vdata,
+                       HYPRE_Int  max_iter )
+{
+   hypre_ParIRData *ir_data = (hypre_ParIRData *) ir_vdata;
+
+   if (!ir_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (max_iter < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (ir_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRSetInnerSolver
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRSetInnerSolver( void  *ir_vdata,
+                           HYPRE_Int  (*inner_solve)(void*, void*, void*, void*),
+                           HYPRE_Int  (*inner_setup)(void*, void*, void*, void*),
+                           void  *inner_solver )
+{
+   hypre_ParIRData *ir_data = (hypre_ParIRData *) ir_vdata;
+
+   if (!ir_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   (ir_data -> inner_solve)  = inner_solve;
+   (ir_data -> inner_setup)  = inner_setup;
+   (ir_data -> inner_solver) = inner_solver;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRSetInnerPrecision
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRSetInnerPrecision( void      *ir_vdata,
+                              HYPRE_Int  inner_precision )
+{
+   hypre_ParIRData *ir_data = (hypre_ParIRData *) ir_vdata;
+
+   if (!ir_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (inner_precision < 0 || inner_precision > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (ir_data -> inner_precision) = inner_precision;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRSetPrintLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRSetPrintLevel( void      *ir_vdata,
+                          HYPRE_Int  print_level )
+{
+   hypre_ParIRData *ir_data = (hypre_ParIRData *) ir_vdata;
+
+   if (!ir_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   (ir_data -> print_level) = print_level;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRGetNumIterations
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRGetNumIterations( void      *ir_vdata,
+                             HYPRE_Int *num_iterations )
+{
+   hypre_ParIRData *ir_data = (hypre_ParIRData *) ir_vdata;
+
+   if (!ir_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *num_iterations = (ir_data -> num_iterations);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRGetFinalRelativeResidualNorm
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRGetFinalRelativeResidualNorm( void       *ir_vdata,
+                                         HYPRE_Real *final_rel_res_norm )
+{
+   hypre_ParIRData *ir_data = (hypre_ParIRData *) ir_vdata;
+
+   if (!ir_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   *final_rel_res_norm = (ir_data -> final_rel_res_norm);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRRoundToSingle
+ *
+ * Round n values to single precision in place.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParIRRoundToSingle( HYPRE_Complex *data,
+                          HYPRE_Int      n )
+{
+#if defined(HYPRE_COMPLEX)
+   HYPRE_UNUSED_VAR(data);
+   HYPRE_UNUSED_VAR(n);
+#else
+   HYPRE_Int i;
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < n; i++)
+   {
+      data[i] = (HYPRE_Complex) ((hypre_float) data[i]);
+   }
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRSingleSetup
+ *
+ * Make the copy of A with its values rounded to single precision that the
+ * inner solver is set up on and applied to. On failure, A_s is left NULL.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParIRSingleSetup( hypre_ParIRData    *ir_data,
+                        hypre_ParCSRMatrix *A )
+{
+   hypre_ParCSRMatrix *A_s;
+   hypre_CSRMatrix    *A_s_diag, *A_s_offd;
+
+   hypre_ParCSRMatrixDestroy(ir_data -> A_s);
+   (ir_data -> A_s) = NULL;
+
+#if defined(HYPRE_COMPLEX)
+   HYPRE_UNUSED_VAR(A);
+   HYPRE_UNUSED_VAR(A_s);
+   HYPRE_UNUSED_VAR(A_s_diag);
+   HYPRE_UNUSED_VAR(A_s_offd);
+
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                     "Single-precision inner solve is not available for complex matrices");
+   return hypre_error_flag;
+#else
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Single-precision inner solve requires a matrix in host memory");
+      return hypre_error_flag;
+   }
+
+   A_s      = hypre_ParCSRMatrixClone(A, 1);
+   A_s_diag = hypre_ParCSRMatrixDiag(A_s);
+   A_s_offd = hypre_ParCSRMatrixOffd(A_s);
+   hypre_ParIRRoundToSingle(hypre_CSRMatrixData(A_s_diag),
+                            hypre_CSRMatrixNumNonzeros(A_s_diag));
+   hypre_ParIRRoundToSingle(hypre_CSRMatrixData(A_s_offd),
+                            hypre_CSRMatrixNumNonzeros(A_s_offd));
+
+   (ir_data -> A_s) = A_s;
+
+   return hypre_error_flag;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRSetup( void               *ir_vdata,
+                  hypre_ParCSRMatrix *A,
+                  hypre_ParVector    *b,
+                  hypre_ParVector    *x )
+{
+   hypre_ParIRData    *ir_data = (hypre_ParIRData *) ir_vdata;
+   hypre_ParCSRMatrix *A_inner;
+   HYPRE_Int           ierr;
+
+   HYPRE_UNUSED_VAR(b);
+   HYPRE_UNUSED_VAR(x);
+
+   if (!ir_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!(ir_data -> inner_solve))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Iterative refinement requires an inner solver");
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_ParVectorDestroy(ir_data -> r);
+   hypre_ParVectorDestroy(ir_data -> e);
+
+   (ir_data -> r) = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                          hypre_ParCSRMatrixGlobalNumRows(A),
+                                          hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(ir_data -> r);
+
+   (ir_data -> e) = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                          hypre_ParCSRMatrixGlobalNumRows(A),
+                                          hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(ir_data -> e);
+
+   /* The inner solver is set up on the correction equation A*e = r */
+   A_inner = A;
+   if (ir_data -> inner_precision)
+   {
+      hypre_ParIRSingleSetup(ir_data, A);
+      if (!(ir_data -> A_s))
+      {
+         HYPRE_ANNOTATE_FUNC_END;
+         return hypre_error_flag;
+      }
+      A_inner = (ir_data -> A_s);
+   }
+   if (ir_data -> inner_setup)
+   {
+      hypre_error_code_save();
+      ierr = (ir_data -> inner_setup)(ir_data -> inner_solver, A_inner,
+                                      ir_data -> r, ir_data -> e);
+      hypre_error_code_restore();
+      if (ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Setup of the inner solver failed");
+      }
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParIRSolve
+ *
+ * Iterative refinement:
+ *
+ *    r = b - A*x
+ *    while ||r|| > max(tol*||b||, a_tol):
+ *       solve A*e = r approximately with the inner solver (e0 = 0)
+ *       x = x + e
+ *       r = b - A*x
+ *
+ * The residual is recomputed from the original b at each step, so rounding
+ * errors made by the inner solver do not accumulate in x. The inner solver
+ * runs with the error code of the caller saved, and only its return code is
+ * checked: it is not expected to converge, so a convergence error from it is
+ * ignored, while any other error stops the iteration.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParIRSolve( void               *ir_vdata,
+                  hypre_ParCSRMatrix *A,
+                  hypre_ParVector    *b,
+                  hypre_ParVector    *x )
+{
+   hypre_ParIRData    *ir_data      = (hypre_ParIRData *) ir_vdata;
+   MPI_Comm            comm         = hypre_ParCSRMatrixComm(A);
+
+   HYPRE_Real          tol          = (ir_data -> tol);
+   HYPRE_Real          a_tol        = (ir_data -> a_tol);
+   HYPRE_Int           max_iter     = (ir_data -> max_iter);
+   HYPRE_Int           print_level  = (ir_data -> print_level);
+   void               *inner_solver = (ir_data -> inner_solver);
+   hypre_ParVector    *r            = (ir_data -> r);
+   hypre_ParVector    *e            = (ir_data -> e);
+   hypre_ParCSRMatrix *A_inner      = (ir_data -> inner_precision) ? (ir_data -> A_s) : A;
+
+   HYPRE_Int           iter, my_id, ierr;
+   HYPRE_Real          b_norm, r_norm, r_norm_old, stop_norm;
+
+   if (!r || !e || !A_inner)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "hypre_ParIRSetup must be called before solve");
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   (ir_data -> num_iterations) = 0;
+
+   b_norm = hypre_sqrt(hypre_ParVectorInnerProd(b, b));
+   if (b_norm == 0.0)
+   {
+      hypre_ParVectorSetConstantValues(x, 0.0);
+      (ir_data -> final_rel_res_norm) = 0.0;
+
+      HYPRE_ANNOTATE_FUNC_END;
+      return hypre_error_flag;
+   }
+
+   /* r = b - A*x */
+   hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, x, 1.0, b, r);
+   r_norm    = hypre_sqrt(hypre_ParVectorInnerProd(r, r));
+   stop_norm = hypre_max(tol * b_norm, a_tol);
+
+   if (my_id == 0 && print_level > 0)
+   {
+      hypre_printf("\n IR: ||b|| = %e\n", b_norm);
+      hypre_printf("   iter     res norm      rel res norm   conv rate\n");
+      hypre_printf("   -----    ----------    ------------   ---------\n");
+      hypre_printf("   %5d    %e    %e\n", 0, r_norm, r_norm / b_norm);
+   }
+
+   for (iter = 0; iter < max_iter && r_norm > stop_norm; iter++)
+   {
+      /* Solve the correction equation from a zero initial guess */
+      if (ir_data -> inner_precision)
+      {
+         hypre_ParIRRoundToSingle(hypre_VectorData(hypre_ParVectorLocalVector(r)),
+                                  hypre_VectorSize(hypre_ParVectorLocalVector(r)));
+      }
+      hypre_ParVectorSetConstantValues(e, 0.0);
+
+      hypre_error_code_save();
+      ierr = (ir_data -> inner_solve)(inner_solver, A_inner, r, e);
+      hypre_error_code_restore();
+      if (ierr & ~HYPRE_ERROR_CONV)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Inner solver failed");
+         break;
+      }
+
+      /* x = x + e; r = b - A*x */
+      hypre_ParVectorAxpy(1.0, e, x);
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, x, 1.0, b, r);
+
+      r_norm_old = r_norm;
+      r_norm     = hypre_sqrt(hypre_ParVectorInnerProd(r, r));
+
+      if (my_id == 0 && print_level > 0)
+      {
+         hypre_printf("   %5d    %e    %e    %f\n", iter + 1,
+                      r_norm, r_norm / b_norm, r_norm / r_norm_old);
+      }
+
+      /* Stop if the inner solver no longer reduces the residual */
+      if (r_norm >= r_norm_old)
+      {
+         iter++;
+         break;
+      }
+   }
+
+   (ir_data -> num_iterations)     = iter;
+   (ir_data -> final_rel_res_norm) = r_norm / b_norm;
+
+   if (r_norm > stop_norm)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
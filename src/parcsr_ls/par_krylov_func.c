@@ -274,6 +274,60 @@ hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha,
                                      (hypre_ParVector *) y, k, unroll));
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovAxpby
+ *
+ * y = alpha*x + beta*y
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovAxpby( HYPRE_Complex alpha,
+                      void         *x,
+                      HYPRE_Complex beta,
+                      void         *y )
+{
+   return ( hypre_ParVectorAxpyz( alpha, (hypre_ParVector *) x,
+                                  beta, (hypre_ParVector *) y,
+                                  (hypre_ParVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovAxpyInnerProd
+ *
+ * y = y + alpha*x, returns <y, z>
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParKrylovAxpyInnerProd( HYPRE_Complex alpha,
+                              void         *x,
+                              void         *y,
+                              void         *z )
+{
+   return ( hypre_ParVectorAxpyInnerProd( alpha, (hypre_ParVector *) x,
+                                          (hypre_ParVector *) y,
+                                          (hypre_ParVector *) z ) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovDualAxpyInnerProd
+ *
+ * y1 = y1 + alpha*x1, y2 = y2 + beta*x2, returns <y2, y2>
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParKrylovDualAxpyInnerProd( HYPRE_Complex alpha,
+                                  void         *x1,
+                                  void         *y1,
+                                  HYPRE_Complex beta,
+                                  void         *x2,
+                                  void         *y2 )
+{
+   return ( hypre_ParVectorDualAxpyInnerProd( alpha, (hypre_ParVector *) x1,
+                                              (hypre_ParVector *) y1, beta,
+                                              (hypre_ParVector *) x2,
+                                              (hypre_ParVector *) y2 ) );
+}
+
 
 
 /*--------------------------------------------------------------------------
@@ -79,6 +79,7 @@ HYPRE_Int hypre_AMGHybridSetNonGalerkinTol ( void *AMGhybrid_vdata, HYPRE_Int no
 HYPRE_Int hypre_AMGHybridSetDSCGMaxIter ( void *AMGhybrid_vdata, HYPRE_Int dscg_max_its );
 HYPRE_Int hypre_AMGHybridSetPCGMaxIter ( void *AMGhybrid_vdata, HYPRE_Int pcg_max_its );
 HYPRE_Int hypre_AMGHybridSetSetupType ( void *AMGhybrid_vdata, HYPRE_Int setup_type );
+HYPRE_Int hypre_AMGHybridSetCostModel ( void *AMGhybrid_vdata, HYPRE_Int cost_model );
 HYPRE_Int hypre_AMGHybridSetSolverType ( void *AMGhybrid_vdata, HYPRE_Int solver_type );
 HYPRE_Int hypre_AMGHybridSetRecomputeResidual ( void *AMGhybrid_vdata,
                                                 HYPRE_Int recompute_residual );
@@ -786,6 +787,7 @@ HYPRE_Int HYPRE_ParCSRHybridSetConvergenceTol ( HYPRE_Solver solver, HYPRE_Real
 HYPRE_Int HYPRE_ParCSRHybridSetDSCGMaxIter ( HYPRE_Solver solver, HYPRE_Int dscg_max_its );
 HYPRE_Int HYPRE_ParCSRHybridSetPCGMaxIter ( HYPRE_Solver solver, HYPRE_Int pcg_max_its );
 HYPRE_Int HYPRE_ParCSRHybridSetSetupType ( HYPRE_Solver solver, HYPRE_Int setup_type );
+HYPRE_Int HYPRE_ParCSRHybridSetCostModel ( HYPRE_Solver solver, HYPRE_Int cost_model );
 HYPRE_Int HYPRE_ParCSRHybridSetSolverType ( HYPRE_Solver solver, HYPRE_Int solver_type );
 HYPRE_Int HYPRE_ParCSRHybridSetKDim ( HYPRE_Solver solver, HYPRE_Int k_dim );
 HYPRE_Int HYPRE_ParCSRHybridSetTwoNorm ( HYPRE_Solver solver, HYPRE_Int two_norm );
@@ -840,6 +842,23 @@ HYPRE_Int HYPRE_ParCSRHybridGetPCGNumIterations ( HYPRE_Solver solver, HYPRE_Int
 HYPRE_Int HYPRE_ParCSRHybridGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
 HYPRE_Int HYPRE_ParCSRHybridGetSetupSolveTime( HYPRE_Solver solver, HYPRE_Real *time );
 
+/* HYPRE_parcsr_ir.c */
+HYPRE_Int HYPRE_ParCSRIRCreate ( HYPRE_Solver *solver );
+HYPRE_Int HYPRE_ParCSRIRDestroy ( HYPRE_Solver solver );
+HYPRE_Int HYPRE_ParCSRIRSetup ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
+                                HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRIRSolve ( HYPRE_Solver solver, HYPRE_ParCSRMatrix A, HYPRE_ParVector b,
+                                HYPRE_ParVector x );
+HYPRE_Int HYPRE_ParCSRIRSetTol ( HYPRE_Solver solver, HYPRE_Real tol );
+HYPRE_Int HYPRE_ParCSRIRSetAbsoluteTol ( HYPRE_Solver solver, HYPRE_Real a_tol );
+HYPRE_Int HYPRE_ParCSRIRSetMaxIter ( HYPRE_Solver solver, HYPRE_Int max_iter );
+HYPRE_Int HYPRE_ParCSRIRSetInnerSolver ( HYPRE_Solver solver, HYPRE_PtrToParSolverFcn inner_solve,
+                                         HYPRE_PtrToParSolverFcn inner_setup, HYPRE_Solver inner_solver );
+HYPRE_Int HYPRE_ParCSRIRSetInnerPrecision ( HYPRE_Solver solver, HYPRE_Int inner_precision );
+HYPRE_Int HYPRE_ParCSRIRSetPrintLevel ( HYPRE_Solver solver, HYPRE_Int print_level );
+HYPRE_Int HYPRE_ParCSRIRGetNumIterations ( HYPRE_Solver solver, HYPRE_Int *num_iterations );
+HYPRE_Int HYPRE_ParCSRIRGetFinalRelativeResidualNorm ( HYPRE_Solver solver, HYPRE_Real *norm );
+
 /* HYPRE_parcsr_int.c */
 HYPRE_Int hypre_ParSetRandomValues ( void *v, HYPRE_Int seed );
 HYPRE_Int hypre_ParPrintVector ( void *v, const char *file );
@@ -852,6 +871,8 @@ void aux_indexFromMask ( HYPRE_Int n, HYPRE_Int *mask, HYPRE_Int *index );
 HYPRE_Int HYPRE_TempParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupInterpreter ( mv_InterfaceInterpreter *i );
 HYPRE_Int HYPRE_ParCSRSetupMatvec ( HYPRE_MatvecFunctions *mv );
+HYPRE_Int HYPRE_ParCSRSetupContigInterpreter ( mv_InterfaceInterpreter *i );
+HYPRE_Int HYPRE_ParCSRSetupContigMatvec ( HYPRE_MatvecFunctions *mv );
 
 /* HYPRE_parcsr_lgmres.c */
 HYPRE_Int HYPRE_ParCSRLGMRESCreate ( MPI_Comm comm, HYPRE_Solver *solver );
@@ -1326,6 +1347,33 @@ HYPRE_Int hypre_BoomerAMGCoarseParmsDevice ( MPI_Comm comm, HYPRE_Int local_num_
 HYPRE_Int hypre_BoomerAMGInitDofFuncDevice( HYPRE_Int *dof_func, HYPRE_Int local_size,
                                             HYPRE_Int offset, HYPRE_Int num_functions );
 
+/* par_contig_multivector.c */
+void *hypre_ParContigMultiVectorCreateFromSampleVector ( void *ii_, HYPRE_Int n, void *sample_ );
+void *hypre_ParContigMultiVectorCreateCopy ( void *src_, HYPRE_Int copyValues );
+void hypre_ParContigMultiVectorDestroy ( void *x_ );
+void hypre_ParContigMultiVectorClear ( void *x_ );
+void hypre_ParContigMultiVectorCopy ( void *src_, void *dest_ );
+void hypre_ParContigMultiVectorAxpy ( HYPRE_Complex a, void *x_, void *y_ );
+void hypre_ParContigMultiVectorByMultiVector ( void *x_, void *y_, HYPRE_BigInt xyGHeight,
+                                               HYPRE_Int xyHeight, HYPRE_Int xyWidth,
+                                               HYPRE_Complex *xyVal );
+void hypre_ParContigMultiVectorByMultiVectorDiag ( void *x_, void *y_, HYPRE_Int *mask,
+                                                   HYPRE_Int n, HYPRE_Complex *diag );
+void hypre_ParContigMultiVectorByMatrix ( void *x_, HYPRE_BigInt rGHeight, HYPRE_Int rHeight,
+                                          HYPRE_Int rWidth, HYPRE_Complex *rVal, void *y_ );
+void hypre_ParContigMultiVectorXapy ( void *x_, HYPRE_BigInt rGHeight, HYPRE_Int rHeight,
+                                      HYPRE_Int rWidth, HYPRE_Complex *rVal, void *y_ );
+HYPRE_Int hypre_ParContigMultiVectorWidth ( void *x_ );
+HYPRE_Int hypre_ParContigMultiVectorHeight ( void *x_ );
+void hypre_ParContigMultiVectorSetMask ( void *x_, HYPRE_Int *mask );
+void hypre_ParContigMultiVectorSetRandom ( void *x_, HYPRE_Int seed );
+void hypre_ParContigMultiVectorByDiagonal ( void *x_, HYPRE_Int *mask, HYPRE_Int n,
+                                            HYPRE_Complex *diag, void *y_ );
+void hypre_ParContigMultiVectorEval ( void (*f )(void*, void*, void*), void *par, void *x_,
+                                      void *y_ );
+HYPRE_Int hypre_ParContigMultiVectorMatvec ( void *matvec_data, HYPRE_Complex alpha, void *A,
+                                             void *x_, HYPRE_Complex beta, void *y_ );
+
 /* par_coordinates.c */
 float *hypre_GenerateCoordinates ( MPI_Comm comm, HYPRE_BigInt nx, HYPRE_BigInt ny,
                                    HYPRE_BigInt nz, HYPRE_Int P, HYPRE_Int Q, HYPRE_Int R,
@@ -1449,6 +1497,24 @@ HYPRE_Int hypre_BoomerAMGBuildInterpOnePnt( hypre_ParCSRMatrix  *A, HYPRE_Int *C
                                             hypre_ParCSRMatrix *S, HYPRE_BigInt *num_cpts_global, HYPRE_Int num_functions, HYPRE_Int *dof_func,
                                             HYPRE_Int debug_flag, hypre_ParCSRMatrix **P_ptr);
 
+/* par_ir.c */
+void *hypre_ParIRCreate ( void );
+HYPRE_Int hypre_ParIRDestroy ( void *ir_vdata );
+HYPRE_Int hypre_ParIRSetTol ( void *ir_vdata, HYPRE_Real tol );
+HYPRE_Int hypre_ParIRSetAbsoluteTol ( void *ir_vdata, HYPRE_Real a_tol );
+HYPRE_Int hypre_ParIRSetMaxIter ( void *ir_vdata, HYPRE_Int max_iter );
+HYPRE_Int hypre_ParIRSetInnerSolver ( void *ir_vdata, HYPRE_Int (*inner_solve)(void*, void*, void*,
+                                                                              void*), HYPRE_Int (*inner_setup)(void*, void*, void*, void*), void *inner_solver );
+HYPRE_Int hypre_ParIRSetInnerPrecision ( void *ir_vdata, HYPRE_Int inner_precision );
+HYPRE_Int hypre_ParIRSetPrintLevel ( void *ir_vdata, HYPRE_Int print_level );
+HYPRE_Int hypre_ParIRGetNumIterations ( void *ir_vdata, HYPRE_Int *num_iterations );
+HYPRE_Int hypre_ParIRGetFinalRelativeResidualNorm ( void *ir_vdata,
+                                                    HYPRE_Real *final_rel_res_norm );
+HYPRE_Int hypre_ParIRSetup ( void *ir_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *b,
+                             hypre_ParVector *x );
+HYPRE_Int hypre_ParIRSolve ( void *ir_vdata, hypre_ParCSRMatrix *A, hypre_ParVector *b,
+                             hypre_ParVector *x );
+
 /* par_jacobi_interp.c */
 void hypre_BoomerAMGJacobiInterp ( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix **P,
                                    hypre_ParCSRMatrix *S, HYPRE_Int num_functions, HYPRE_Int *dof_func, HYPRE_Int *CF_marker,
@@ -2005,6 +2071,10 @@ HYPRE_Int hypre_ParKrylovCopyVector ( void *x, void *y );
 HYPRE_Int hypre_ParKrylovClearVector ( void *x );
 HYPRE_Int hypre_ParKrylovScaleVector ( HYPRE_Complex alpha, void *x );
 HYPRE_Int hypre_ParKrylovAxpy ( HYPRE_Complex alpha, void *x, void *y );
+HYPRE_Int hypre_ParKrylovAxpby ( HYPRE_Complex alpha, void *x, HYPRE_Complex beta, void *y );
+HYPRE_Real hypre_ParKrylovAxpyInnerProd ( HYPRE_Complex alpha, void *x, void *y, void *z );
+HYPRE_Real hypre_ParKrylovDualAxpyInnerProd ( HYPRE_Complex alpha, void *x1, void *y1,
+                                              HYPRE_Complex beta, void *x2, void *y2 );
 HYPRE_Int hypre_ParKrylovCommInfo ( void *A, HYPRE_Int *my_id, HYPRE_Int *num_procs );
 HYPRE_Int hypre_ParKrylovIdentitySetup ( void *vdata, void *A, void *b, void *x );
 HYPRE_Int hypre_ParKrylovIdentity ( void *vdata, void *A, void *b, void *x );
@@ -1064,6 +1064,7 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
    HYPRE_Int    *send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
 
    HYPRE_Int    *send_map_elmts_new;
+   HYPRE_Int     num_elmts;
 
    HYPRE_Int     i, j;
 
@@ -1071,12 +1072,15 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
 
    if (num_components_in != num_components)
    {
+      /* Number of send elements per component */
+      num_elmts = send_map_starts[num_sends] / num_components;
+
       /* Update number of components in the communication package */
       hypre_ParCSRCommPkgNumComponents(comm_pkg) = num_components_in;
 
       /* Allocate send_maps_elmts */
       send_map_elmts_new = hypre_CTAlloc(HYPRE_Int,
-                                         send_map_starts[num_sends] * num_components_in,
+                                         num_elmts * num_components_in,
                                          HYPRE_MEMORY_HOST);
 
       /* Update send_maps_elmts */
@@ -1084,7 +1088,7 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
       {
          if (num_components == 1)
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            for (i = 0; i < num_elmts; i++)
             {
                for (j = 0; j < num_components_in; j++)
                {
@@ -1095,7 +1099,7 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
          }
          else
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            for (i = 0; i < num_elmts; i++)
             {
                for (j = 0; j < num_components_in; j++)
                {
@@ -1110,14 +1114,14 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
          /* num_components_in < num_components */
          if (num_components_in == 1)
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            for (i = 0; i < num_elmts; i++)
             {
                send_map_elmts_new[i] = send_map_elmts[i * num_components];
             }
          }
          else
          {
-            for (i = 0; i < send_map_starts[num_sends]; i++)
+            for (i = 0; i < num_elmts; i++)
             {
                for (j = 0; j < num_components_in; j++)
                {
@@ -1140,13 +1144,13 @@ hypre_ParCSRCommPkgUpdateVecStarts( hypre_ParCSRCommPkg *comm_pkg,
       /* Update send_map_starts */
       for (i = 0; i < num_sends + 1; i++)
       {
-         send_map_starts[i] *= num_components_in / num_components;
+         send_map_starts[i] = (send_map_starts[i] / num_components) * num_components_in;
       }
 
       /* Update recv_vec_starts */
       for (i = 0; i < num_recvs + 1; i++)
       {
-         recv_vec_starts[i] *= num_components_in / num_components;
+         recv_vec_starts[i] = (recv_vec_starts[i] / num_components) * num_components_in;
       }
    }
 
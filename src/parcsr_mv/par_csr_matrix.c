@@ -1360,6 +1360,201 @@ hypre_ParCSRMatrixPrintBinaryIJ( hypre_ParCSRMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintMPIIO
+ *
+ * Collective.  Prints a ParCSRMatrix to a single binary file with MPI-IO.
+ * Unlike hypre_ParCSRMatrixPrintBinaryIJ, the file does not depend on the
+ * number of processes, and it can be read back on any number of processes
+ * with hypre_IJMatrixReadMPIIO.  The file consists of four sections:
+ *
+ *    1) A header of hypre_PARCSR_MPIIO_NHEADER 8-byte entries:
+ *          0) Magic number
+ *          1) Format version
+ *          2) Number of bytes for storing a column index
+ *          3) Number of bytes for storing a coefficient
+ *          4) Number of rows in the matrix
+ *          5) Number of columns in the matrix
+ *          6) Number of nonzero coefficients in the matrix
+ *          7) Global index of the first row (base_i)
+ *          8) Global index of the first column (base_j)
+ *    2) The row offsets: (number of rows + 1) 8-byte entries, entry i being
+ *       the number of nonzero coefficients in rows 0 through i-1
+ *    3) The zero-based column indices of all rows, in row order
+ *    4) The coefficients of all rows, in row order
+ *
+ * Each section is written with collective calls, so that the MPI-IO layer
+ * can aggregate the writes (collective buffering).  Complex coefficients are
+ * not supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintMPIIO( hypre_ParCSRMatrix *matrix,
+                              HYPRE_BigInt        base_i,
+                              HYPRE_BigInt        base_j,
+                              const char         *filename )
+{
+   MPI_Comm              comm = hypre_ParCSRMatrixComm(matrix);
+   HYPRE_MemoryLocation  memory_location = hypre_ParCSRMatrixMemoryLocation(matrix);
+   hypre_ParCSRMatrix   *h_matrix;
+
+   HYPRE_BigInt          global_num_rows, first_row_index, first_col_diag;
+   hypre_CSRMatrix      *diag, *offd;
+   HYPRE_Int            *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex        *diag_data, *offd_data;
+   HYPRE_BigInt         *col_map_offd;
+   HYPRE_Int             num_rows, num_offsets, local_nnz;
+   HYPRE_BigInt          nnz_local, nnz_end, nnz_start, nnz_global;
+
+   hypre_uint64          header[hypre_PARCSR_MPIIO_NHEADER];
+   hypre_uint64         *offsets;
+   HYPRE_BigInt         *cols;
+   HYPRE_Complex        *vals;
+   hypre_MPI_File        fh;
+   hypre_MPI_Offset      offsets_start, cols_start, vals_start;
+   HYPRE_Int             max_num_offsets, done;
+   HYPRE_Int             chunk = (HYPRE_Int) ((1 << 30) / sizeof(hypre_uint64));
+   HYPRE_Int             myid, num_procs, count, ierr;
+   HYPRE_Int             i;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+#ifdef HYPRE_COMPLEX
+   /* the file format and hypre_IJMatrixReadMPIIO only support real coefficients */
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "MPI-IO output is not supported for complex matrices");
+   return hypre_error_flag;
+#endif
+
+   /* Create temporary matrix on host memory if needed */
+   h_matrix = (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_DEVICE) ?
+              hypre_ParCSRMatrixClone_v2(matrix, 1, HYPRE_MEMORY_HOST) : matrix;
+
+   global_num_rows = hypre_ParCSRMatrixGlobalNumRows(h_matrix);
+   first_row_index = hypre_ParCSRMatrixFirstRowIndex(h_matrix);
+   first_col_diag  = hypre_ParCSRMatrixFirstColDiag(h_matrix);
+   num_rows        = hypre_ParCSRMatrixNumRows(h_matrix);
+   col_map_offd    = hypre_ParCSRMatrixColMapOffd(h_matrix);
+   diag            = hypre_ParCSRMatrixDiag(h_matrix);
+   offd            = hypre_ParCSRMatrixOffd(h_matrix);
+   diag_i          = hypre_CSRMatrixI(diag);
+   diag_j          = hypre_CSRMatrixJ(diag);
+   diag_data       = hypre_CSRMatrixData(diag);
+   offd_i          = hypre_CSRMatrixI(offd);
+   offd_j          = hypre_CSRMatrixJ(offd);
+   offd_data       = hypre_CSRMatrixData(offd);
+
+   /* Position of the local nonzeros in the global row order */
+   local_nnz = diag_i[num_rows] + offd_i[num_rows];
+   nnz_local = (HYPRE_BigInt) local_nnz;
+   hypre_MPI_Scan(&nnz_local, &nnz_end, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+   nnz_start = nnz_end - nnz_local;
+   hypre_MPI_Allreduce(&nnz_local, &nnz_global, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+
+   /*---------------------------------------------
+    * Pack the local sections; the last process
+    * also writes the final row offset
+    *---------------------------------------------*/
+
+   num_offsets = num_rows + ((myid == num_procs - 1) ? 1 : 0);
+   hypre_MPI_Allreduce(&num_offsets, &max_num_offsets, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   offsets = hypre_TAlloc(hypre_uint64,  num_offsets, HYPRE_MEMORY_HOST);
+   cols    = hypre_TAlloc(HYPRE_BigInt,  local_nnz,   HYPRE_MEMORY_HOST);
+   vals    = hypre_TAlloc(HYPRE_Complex, local_nnz,   HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int  j, k = diag_i[i] + offd_i[i];
+
+      offsets[i] = (hypre_uint64) (nnz_start + k);
+      for (j = diag_i[i]; j < diag_i[i + 1]; j++, k++)
+      {
+         cols[k] = first_col_diag + (HYPRE_BigInt) diag_j[j];
+         vals[k] = diag_data ? diag_data[j] : 1.0;
+      }
+      for (j = offd_i[i]; j < offd_i[i + 1]; j++, k++)
+      {
+         cols[k] = col_map_offd[offd_j[j]];
+         vals[k] = offd_data ? offd_data[j] : 1.0;
+      }
+   }
+   if (num_offsets > num_rows)
+   {
+      offsets[num_rows] = (hypre_uint64) nnz_global;
+   }
+
+   /*---------------------------------------------
+    * Write the file
+    *---------------------------------------------*/
+
+   offsets_start = hypre_PARCSR_MPIIO_NHEADER * (hypre_MPI_Offset) sizeof(hypre_uint64) +
+                   first_row_index * (hypre_MPI_Offset) sizeof(hypre_uint64);
+   cols_start    = (hypre_PARCSR_MPIIO_NHEADER + global_num_rows + 1) *
+                   (hypre_MPI_Offset) sizeof(hypre_uint64);
+   vals_start    = cols_start + nnz_global * (hypre_MPI_Offset) sizeof(HYPRE_BigInt);
+   cols_start   += nnz_start * (hypre_MPI_Offset) sizeof(HYPRE_BigInt);
+   vals_start   += nnz_start * (hypre_MPI_Offset) sizeof(HYPRE_Complex);
+
+   header[0] = (hypre_uint64) hypre_PARCSR_MPIIO_MAGIC;
+   header[1] = (hypre_uint64) hypre_PARCSR_MPIIO_VERSION;
+   header[2] = (hypre_uint64) sizeof(HYPRE_BigInt);
+   header[3] = (hypre_uint64) sizeof(HYPRE_Complex);
+   header[4] = (hypre_uint64) global_num_rows;
+   header[5] = (hypre_uint64) hypre_ParCSRMatrixGlobalNumCols(h_matrix);
+   header[6] = (hypre_uint64) nnz_global;
+   header[7] = (hypre_uint64) base_i;
+   header[8] = (hypre_uint64) base_j;
+
+   ierr = hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_WRONLY | hypre_MPI_MODE_CREATE,
+                              hypre_MPI_INFO_NULL, &fh);
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not open output file!");
+   }
+   else
+   {
+      hypre_MPI_File_set_size(fh, 0);
+
+      count = (myid == 0) ? (HYPRE_Int) sizeof(header) : 0;
+      ierr  = hypre_MPI_File_write_at_all(fh, 0, header, count, hypre_MPI_BYTE,
+                                          hypre_MPI_STATUS_IGNORE);
+      /* the byte count of the offsets may not fit in an int, so they are
+         written in pieces; all processes make the same number of calls */
+      for (done = 0; done < max_num_offsets; done += chunk)
+      {
+         count = (done < num_offsets) ? hypre_min(chunk, num_offsets - done) : 0;
+         ierr += hypre_MPI_File_write_at_all(fh, offsets_start +
+                                             done * (hypre_MPI_Offset) sizeof(hypre_uint64),
+                                             offsets + done,
+                                             count * (HYPRE_Int) sizeof(hypre_uint64),
+                                             hypre_MPI_BYTE, hypre_MPI_STATUS_IGNORE);
+      }
+      ierr += hypre_MPI_File_write_at_all(fh, cols_start, cols, local_nnz,
+                                          HYPRE_MPI_BIG_INT, hypre_MPI_STATUS_IGNORE);
+      ierr += hypre_MPI_File_write_at_all(fh, vals_start, vals, local_nnz,
+                                          HYPRE_MPI_COMPLEX, hypre_MPI_STATUS_IGNORE);
+      if (ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Could not write the output file!");
+      }
+
+      hypre_MPI_File_close(&fh);
+   }
+
+   if (h_matrix != matrix)
+   {
+      hypre_ParCSRMatrixDestroy(h_matrix);
+   }
+   hypre_TFree(offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(cols, HYPRE_MEMORY_HOST);
+   hypre_TFree(vals, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixReadIJ
  *--------------------------------------------------------------------------*/
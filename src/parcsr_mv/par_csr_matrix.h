@@ -158,6 +158,14 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return HYPRE_MEMORY_UNDEFINED;
 }
 
+/*--------------------------------------------------------------------------
+ * Single-file binary format (see hypre_ParCSRMatrixPrintMPIIO)
+ *--------------------------------------------------------------------------*/
+
+#define hypre_PARCSR_MPIIO_MAGIC    0x6879706d
+#define hypre_PARCSR_MPIIO_VERSION  1
+#define hypre_PARCSR_MPIIO_NHEADER  9
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -537,6 +537,73 @@ hypre_ParVectorAxpyz( HYPRE_Complex    alpha,
    return hypre_SeqVectorAxpyz(alpha, x_local, beta, y_local, z_local);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorUseReproInnerProd
+ *
+ * Returns 1 if inner products of x and y are to be computed with the
+ * reproducible summation of hypre_ParVectorInnerProdRepro.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParVectorUseReproInnerProd( hypre_ParVector *x,
+                                  hypre_ParVector *y )
+{
+   if (!hypre_GetReproducibleReductions())
+   {
+      return 0;
+   }
+
+   return (hypre_GetExecPolicy2(hypre_ParVectorMemoryLocation(x),
+                                hypre_ParVectorMemoryLocation(y)) == HYPRE_EXEC_HOST);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInnerProdRepro
+ *
+ * Inner product whose value does not depend on the number of threads or
+ * MPI ranks (see hypre_SeqVectorInnerProdFoldsHost).  The global scale is
+ * agreed upon first, after which the folds are summed exactly.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParVectorInnerProdRepro( hypre_ParVector *x,
+                               hypre_ParVector *y )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(x);
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+   HYPRE_BigInt  num_terms;
+
+   HYPRE_Real    local_max, global_max;
+   HYPRE_Real    local_folds[hypre_REPRO_NUM_FOLDS];
+   HYPRE_Real    folds[hypre_REPRO_NUM_FOLDS];
+
+   num_terms = hypre_ParVectorGlobalSize(x) * hypre_VectorNumVectors(x_local);
+   local_max = hypre_SeqVectorInnerProdMaxAbsHost(x_local, y_local);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(&local_max, &global_max, 1, HYPRE_MPI_REAL,
+                       hypre_MPI_MAX, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_SeqVectorInnerProdFoldsHost(x_local, y_local, global_max, num_terms, local_folds);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_folds, folds, hypre_REPRO_NUM_FOLDS, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_SeqVectorInnerProdFoldsSum(folds);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorInnerProd
  *--------------------------------------------------------------------------*/
@@ -550,7 +617,101 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
 
    HYPRE_Real result = 0.0;
-   HYPRE_Real local_result = hypre_SeqVectorInnerProd(x_local, y_local);
+   HYPRE_Real local_result;
+
+   if (hypre_ParVectorUseReproInnerProd(x, y))
+   {
+      return hypre_ParVectorInnerProdRepro(x, y);
+   }
+
+   local_result = hypre_SeqVectorInnerProd(x_local, y_local);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(&local_result, &result, 1, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorAxpyInnerProd
+ *
+ * y = y + alpha*x, returns <y, z>
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParVectorAxpyInnerProd( HYPRE_Complex    alpha,
+                              hypre_ParVector *x,
+                              hypre_ParVector *y,
+                              hypre_ParVector *z )
+{
+   MPI_Comm      comm    = hypre_ParVectorComm(x);
+   hypre_Vector *x_local = hypre_ParVectorLocalVector(x);
+   hypre_Vector *y_local = hypre_ParVectorLocalVector(y);
+   hypre_Vector *z_local = hypre_ParVectorLocalVector(z);
+
+   HYPRE_Real result = 0.0;
+   HYPRE_Real local_result;
+
+   if (hypre_ParVectorUseReproInnerProd(y, z))
+   {
+      hypre_SeqVectorAxpy(alpha, x_local, y_local);
+
+      return hypre_ParVectorInnerProdRepro(y, z);
+   }
+
+   local_result = hypre_SeqVectorAxpyInnerProd(alpha, x_local, y_local, z_local);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(&local_result, &result, 1, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorDualAxpyInnerProd
+ *
+ * y1 = y1 + alpha*x1, y2 = y2 + beta*x2, returns <y2, y2>
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_ParVectorDualAxpyInnerProd( HYPRE_Complex    alpha,
+                                  hypre_ParVector *x1,
+                                  hypre_ParVector *y1,
+                                  HYPRE_Complex    beta,
+                                  hypre_ParVector *x2,
+                                  hypre_ParVector *y2 )
+{
+   MPI_Comm      comm     = hypre_ParVectorComm(x1);
+   hypre_Vector *x1_local = hypre_ParVectorLocalVector(x1);
+   hypre_Vector *y1_local = hypre_ParVectorLocalVector(y1);
+   hypre_Vector *x2_local = hypre_ParVectorLocalVector(x2);
+   hypre_Vector *y2_local = hypre_ParVectorLocalVector(y2);
+
+   HYPRE_Real result = 0.0;
+   HYPRE_Real local_result;
+
+   if (hypre_ParVectorUseReproInnerProd(y2, y2))
+   {
+      hypre_SeqVectorAxpy(alpha, x1_local, y1_local);
+      hypre_SeqVectorAxpy(beta, x2_local, y2_local);
+
+      return hypre_ParVectorInnerProdRepro(y2, y2);
+   }
+
+   local_result = hypre_SeqVectorDualAxpyInnerProd(alpha, x1_local, y1_local,
+                                                   beta, x2_local, y2_local);
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
@@ -57,6 +57,18 @@ hypre_ParVectorMassInnerProd( hypre_ParVector  *x,
    HYPRE_Real *local_result;
    HYPRE_Int i;
    hypre_Vector **y_local;
+
+   /* Reproducible reductions are done one inner product at a time */
+   if (hypre_GetReproducibleReductions())
+   {
+      for (i = 0; i < k; i++)
+      {
+         result[i] = hypre_ParVectorInnerProd(x, y[i]);
+      }
+
+      return hypre_error_flag;
+   }
+
    y_local = hypre_TAlloc(hypre_Vector *, k, HYPRE_MEMORY_HOST);
 
    for (i = 0; i < k; i++)
@@ -102,6 +114,19 @@ hypre_ParVectorMassDotpTwo ( hypre_ParVector  *x,
    HYPRE_Real *local_result, *result;
    HYPRE_Int i;
    hypre_Vector **z_local;
+
+   /* Reproducible reductions are done one inner product at a time */
+   if (hypre_GetReproducibleReductions())
+   {
+      for (i = 0; i < k; i++)
+      {
+         result_x[i] = hypre_ParVectorInnerProd(x, z[i]);
+         result_y[i] = hypre_ParVectorInnerProd(y, z[i]);
+      }
+
+      return hypre_error_flag;
+   }
+
    z_local = hypre_TAlloc(hypre_Vector*, k, HYPRE_MEMORY_HOST);
 
    for (i = 0; i < k; i++)
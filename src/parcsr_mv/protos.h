@@ -489,6 +489,8 @@ HYPRE_Int hypre_ParCSRMatrixPrintIJ ( const hypre_ParCSRMatrix *matrix, const HY
                                       const HYPRE_Int base_j, const char *filename );
 HYPRE_Int hypre_ParCSRMatrixPrintBinaryIJ ( hypre_ParCSRMatrix *matrix, HYPRE_Int base_i,
                                             HYPRE_Int base_j, const char *filename );
+HYPRE_Int hypre_ParCSRMatrixPrintMPIIO ( hypre_ParCSRMatrix *matrix, HYPRE_BigInt base_i,
+                                         HYPRE_BigInt base_j, const char *filename );
 HYPRE_Int hypre_ParCSRMatrixReadIJ ( MPI_Comm comm, const char *filename, HYPRE_Int *base_i_ptr,
                                      HYPRE_Int *base_j_ptr, hypre_ParCSRMatrix **matrix_ptr );
 HYPRE_Int hypre_ParCSRMatrixGetLocalRange ( hypre_ParCSRMatrix *matrix, HYPRE_BigInt *row_start,
@@ -624,6 +626,12 @@ HYPRE_Int hypre_ParVectorAxpyz ( HYPRE_Complex alpha, hypre_ParVector *x,
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y,
                                     HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Real hypre_ParVectorInnerProdRepro ( hypre_ParVector *x, hypre_ParVector *y );
+HYPRE_Real hypre_ParVectorAxpyInnerProd ( HYPRE_Complex alpha, hypre_ParVector *x,
+                                         hypre_ParVector *y, hypre_ParVector *z );
+HYPRE_Real hypre_ParVectorDualAxpyInnerProd ( HYPRE_Complex alpha, hypre_ParVector *x1,
+                                             hypre_ParVector *y1, HYPRE_Complex beta,
+                                             hypre_ParVector *x2, hypre_ParVector *y2 );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x, hypre_ParVector **y, HYPRE_Int k,
                                          HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x, hypre_ParVector *y, hypre_ParVector **z,
@@ -289,6 +289,22 @@ HYPRE_Int hypre_SeqVectorAxpyz ( HYPRE_Complex alpha, hypre_Vector *x,
                                  hypre_Vector *z );
 HYPRE_Real hypre_SeqVectorInnerProd ( hypre_Vector *x, hypre_Vector *y );
 HYPRE_Real hypre_SeqVectorInnerProdHost ( hypre_Vector *x, hypre_Vector *y );
+HYPRE_Real hypre_SeqVectorInnerProdMaxAbsHost ( hypre_Vector *x, hypre_Vector *y );
+HYPRE_Int hypre_SeqVectorInnerProdFoldsHost ( hypre_Vector *x, hypre_Vector *y,
+                                              HYPRE_Real max_abs, HYPRE_BigInt num_terms,
+                                              HYPRE_Real *folds );
+HYPRE_Real hypre_SeqVectorInnerProdFoldsSum ( HYPRE_Real *folds );
+HYPRE_Real hypre_SeqVectorInnerProdReproHost ( hypre_Vector *x, hypre_Vector *y );
+HYPRE_Real hypre_SeqVectorAxpyInnerProd ( HYPRE_Complex alpha, hypre_Vector *x, hypre_Vector *y,
+                                         hypre_Vector *z );
+HYPRE_Real hypre_SeqVectorAxpyInnerProdHost ( HYPRE_Complex alpha, hypre_Vector *x,
+                                             hypre_Vector *y, hypre_Vector *z );
+HYPRE_Real hypre_SeqVectorDualAxpyInnerProd ( HYPRE_Complex alpha, hypre_Vector *x1,
+                                             hypre_Vector *y1, HYPRE_Complex beta,
+                                             hypre_Vector *x2, hypre_Vector *y2 );
+HYPRE_Real hypre_SeqVectorDualAxpyInnerProdHost ( HYPRE_Complex alpha, hypre_Vector *x1,
+                                                 hypre_Vector *y1, HYPRE_Complex beta,
+                                                 hypre_Vector *x2, hypre_Vector *y2 );
 HYPRE_Int hypre_SeqVectorMassInnerProd(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,
                                        HYPRE_Int unroll, HYPRE_Real *result);
 HYPRE_Int hypre_SeqVectorMassInnerProd4(hypre_Vector *x, hypre_Vector **y, HYPRE_Int k,
@@ -1126,6 +1126,11 @@ hypre_SeqVectorInnerProd( hypre_Vector *x,
    }
    else
 #endif
+   if (hypre_GetReproducibleReductions())
+   {
+      result = hypre_SeqVectorInnerProdReproHost(x, y);
+   }
+   else
    {
       result = hypre_SeqVectorInnerProdHost(x, y);
    }
@@ -1137,6 +1142,346 @@ hypre_SeqVectorInnerProd( hypre_Vector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorInnerProdMaxAbsHost
+ *
+ * Returns max_i |y_i^* x_i|, the scale used by the reproducible inner product.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SeqVectorInnerProdMaxAbsHost( hypre_Vector *x,
+                                    hypre_Vector *y )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      total_size  = size * num_vectors;
+
+   HYPRE_Real     result      = 0.0;
+   HYPRE_Int      i;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) reduction(max:result) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < total_size; i++)
+   {
+      HYPRE_Real p = hypre_abs(hypre_creal(hypre_conj(y_data[i]) * x_data[i]));
+
+      result = hypre_max(result, p);
+   }
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorInnerProdFoldsHost
+ *
+ * Order-independent partial sums for <x, y>.  Each term p_i is split as
+ * p_i = q_i^0 + q_i^1 + q_i^2 + (dropped), where q_i^k is p_i rounded to a
+ * fixed grid obtained by adding and subtracting the power of two sigma_k.
+ * The grids depend only on max_abs and num_terms, which must be the global
+ * max_i |p_i| and the global number of terms.  sigma_k is large enough that
+ * every partial sum of the q_i^k is exact, so folds[k] has the same value
+ * for any split of the terms over threads and ranks, and folds can be
+ * combined across ranks with a plain MPI sum.
+ *
+ * If the terms are not finite or there are too many of them for the working
+ * precision, the plain sum is returned in folds[0] instead.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SeqVectorInnerProdFoldsHost( hypre_Vector *x,
+                                   hypre_Vector *y,
+                                   HYPRE_Real    max_abs,
+                                   HYPRE_BigInt  num_terms,
+                                   HYPRE_Real   *folds )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      total_size  = size * num_vectors;
+
+   HYPRE_Real     sigma[hypre_REPRO_NUM_FOLDS];
+   HYPRE_Real     s0, s1, s2;
+   HYPRE_Real     f0 = 0.0, f1 = 0.0, f2 = 0.0;
+   HYPRE_BigInt   n;
+   HYPRE_Int      mant_dig, log2n, e, s, s_min;
+   HYPRE_Int      i, k;
+
+   for (k = 0; k < hypre_REPRO_NUM_FOLDS; k++)
+   {
+      folds[k] = 0.0;
+   }
+
+   if (max_abs == 0.0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* HYPRE_REAL_EPSILON = 2^(1 - mant_dig) */
+   (void) hypre_frexp(HYPRE_REAL_EPSILON, &e);
+   mant_dig = 2 - e;
+   for (log2n = 0, n = 1; n < num_terms; n *= 2)
+   {
+      log2n++;
+   }
+
+   if (!(max_abs <= HYPRE_REAL_MAX) || (mant_dig - 1 - log2n) < 2)
+   {
+      folds[0] = hypre_SeqVectorInnerProdHost(x, y);
+
+      return hypre_error_flag;
+   }
+
+   /* max_abs < 2^e.  Sums of num_terms grid values stay below 2^s, and the
+      residual of each extraction is below 2^(s - mant_dig).  Grids are not
+      allowed to fall below the smallest normalized number. */
+   (void) hypre_frexp(max_abs, &e);
+   s     = e + log2n + 1;
+   s_min = HYPRE_REAL_MIN_EXP - 1 + mant_dig;
+   for (k = 0; k < hypre_REPRO_NUM_FOLDS; k++)
+   {
+      sigma[k] = hypre_ldexp((HYPRE_Real) 1.0, hypre_max(s, s_min));
+      s -= mant_dig - 1 - log2n;
+   }
+
+   if (!(sigma[0] <= HYPRE_REAL_MAX))
+   {
+      folds[0] = hypre_SeqVectorInnerProdHost(x, y);
+
+      return hypre_error_flag;
+   }
+
+   s0 = sigma[0];
+   s1 = sigma[1];
+   s2 = sigma[2];
+
+   /* Branch-free so that the loop can be vectorized */
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) reduction(+:f0,f1,f2) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < total_size; i++)
+   {
+      HYPRE_Real p = hypre_creal(hypre_conj(y_data[i]) * x_data[i]);
+      HYPRE_Real q;
+
+      q = (s0 + p) - s0; f0 += q; p -= q;
+      q = (s1 + p) - s1; f1 += q; p -= q;
+      q = (s2 + p) - s2; f2 += q;
+   }
+
+   folds[0] = f0;
+   folds[1] = f1;
+   folds[2] = f2;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorInnerProdFoldsSum
+ *
+ * Combines the folds of a reproducible inner product, smallest first.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SeqVectorInnerProdFoldsSum( HYPRE_Real *folds )
+{
+   HYPRE_Real result = 0.0;
+   HYPRE_Int  k;
+
+   for (k = hypre_REPRO_NUM_FOLDS - 1; k >= 0; k--)
+   {
+      result += folds[k];
+   }
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorInnerProdReproHost
+ *
+ * Inner product whose value does not depend on the number of threads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SeqVectorInnerProdReproHost( hypre_Vector *x,
+                                   hypre_Vector *y )
+{
+   HYPRE_Real   folds[hypre_REPRO_NUM_FOLDS];
+   HYPRE_BigInt num_terms = (HYPRE_BigInt) hypre_VectorSize(x) * hypre_VectorNumVectors(x);
+
+   hypre_SeqVectorInnerProdFoldsHost(x, y, hypre_SeqVectorInnerProdMaxAbsHost(x, y),
+                                     num_terms, folds);
+
+   return hypre_SeqVectorInnerProdFoldsSum(folds);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorAxpyInnerProdHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SeqVectorAxpyInnerProdHost( HYPRE_Complex alpha,
+                                  hypre_Vector *x,
+                                  hypre_Vector *y,
+                                  hypre_Vector *z )
+{
+   HYPRE_Complex *x_data      = hypre_VectorData(x);
+   HYPRE_Complex *y_data      = hypre_VectorData(y);
+   HYPRE_Complex *z_data      = hypre_VectorData(z);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int      size        = hypre_VectorSize(x);
+   HYPRE_Int      total_size  = size * num_vectors;
+
+   HYPRE_Real     result      = 0.0;
+   HYPRE_Int      i;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) reduction(+:result) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < total_size; i++)
+   {
+      y_data[i] += alpha * x_data[i];
+      result    += hypre_conj(z_data[i]) * y_data[i];
+   }
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorAxpyInnerProd
+ *
+ * Computes y = y + alpha*x and returns <y, z> in a single pass over the data.
+ * z may be the same vector as y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SeqVectorAxpyInnerProd( HYPRE_Complex alpha,
+                              hypre_Vector *x,
+                              hypre_Vector *y,
+                              hypre_Vector *z )
+{
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   HYPRE_Real result;
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_VectorMemoryLocation(x),
+                                                      hypre_VectorMemoryLocation(y) );
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      hypre_SeqVectorAxpyDevice(alpha, x, y);
+      result = hypre_SeqVectorInnerProdDevice(y, z);
+   }
+   else
+#endif
+   if (hypre_GetReproducibleReductions())
+   {
+      hypre_SeqVectorAxpyHost(alpha, x, y);
+      result = hypre_SeqVectorInnerProdReproHost(y, z);
+   }
+   else
+   {
+      result = hypre_SeqVectorAxpyInnerProdHost(alpha, x, y, z);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorDualAxpyInnerProdHost
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SeqVectorDualAxpyInnerProdHost( HYPRE_Complex alpha,
+                                      hypre_Vector *x1,
+                                      hypre_Vector *y1,
+                                      HYPRE_Complex beta,
+                                      hypre_Vector *x2,
+                                      hypre_Vector *y2 )
+{
+   HYPRE_Complex *x1_data     = hypre_VectorData(x1);
+   HYPRE_Complex *y1_data     = hypre_VectorData(y1);
+   HYPRE_Complex *x2_data     = hypre_VectorData(x2);
+   HYPRE_Complex *y2_data     = hypre_VectorData(y2);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x1);
+   HYPRE_Int      size        = hypre_VectorSize(x1);
+   HYPRE_Int      total_size  = size * num_vectors;
+
+   HYPRE_Real     result      = 0.0;
+   HYPRE_Int      i;
+
+#if defined(HYPRE_USING_OPENMP)
+   #pragma omp parallel for private(i) reduction(+:result) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < total_size; i++)
+   {
+      y1_data[i] += alpha * x1_data[i];
+      y2_data[i] += beta  * x2_data[i];
+      result     += hypre_conj(y2_data[i]) * y2_data[i];
+   }
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SeqVectorDualAxpyInnerProd
+ *
+ * Computes y1 = y1 + alpha*x1, y2 = y2 + beta*x2 and returns <y2, y2> in a
+ * single pass over the data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SeqVectorDualAxpyInnerProd( HYPRE_Complex alpha,
+                                  hypre_Vector *x1,
+                                  hypre_Vector *y1,
+                                  HYPRE_Complex beta,
+                                  hypre_Vector *x2,
+                                  hypre_Vector *y2 )
+{
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] -= hypre_MPI_Wtime();
+#endif
+
+   HYPRE_Real result;
+
+#if defined(HYPRE_USING_GPU)
+   HYPRE_ExecutionPolicy exec = hypre_GetExecPolicy2( hypre_VectorMemoryLocation(x1),
+                                                      hypre_VectorMemoryLocation(y2) );
+   if (exec == HYPRE_EXEC_DEVICE)
+   {
+      hypre_SeqVectorAxpyDevice(alpha, x1, y1);
+      hypre_SeqVectorAxpyDevice(beta, x2, y2);
+      result = hypre_SeqVectorInnerProdDevice(y2, y2);
+   }
+   else
+#endif
+   if (hypre_GetReproducibleReductions())
+   {
+      hypre_SeqVectorAxpyHost(alpha, x1, y1);
+      hypre_SeqVectorAxpyHost(beta, x2, y2);
+      result = hypre_SeqVectorInnerProdReproHost(y2, y2);
+   }
+   else
+   {
+      result = hypre_SeqVectorDualAxpyInnerProdHost(alpha, x1, y1, beta, x2, y2);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_BLAS1] += hypre_MPI_Wtime();
+#endif
+
+   return result;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SeqVectorSumEltsHost
  *--------------------------------------------------------------------------*/
@@ -55,4 +55,11 @@ typedef struct
 #define hypre_VectorEntryIJ(vector, i, j) \
    ((vector) -> data[((vector) -> vecstride) * j + ((vector) -> idxstride) * i])
 
+/*--------------------------------------------------------------------------
+ * Number of folds kept by the reproducible inner product
+ * (see hypre_SeqVectorInnerProdFoldsHost)
+ *--------------------------------------------------------------------------*/
+
+#define hypre_REPRO_NUM_FOLDS 3
+
 #endif
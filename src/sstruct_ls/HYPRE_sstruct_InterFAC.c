@@ -43,7 +43,7 @@ HYPRE_SStructFACAMR_RAP( HYPRE_SStructMatrix  A,
                          HYPRE_Int          (*rfactors)[HYPRE_MAXDIM],
                          HYPRE_SStructMatrix *fac_A )
 {
-   return ( hypre_AMR_RAP(A, rfactors, fac_A) );
+   return ( hypre_AMR_RAP(A, rfactors, NULL, fac_A) );
 }
 
 /*--------------------------------------------------------------------------
@@ -98,6 +98,62 @@ typedef struct
 
 } hypre_SStructSendInfoData;
 
+#endif
+
+/*--------------------------------------------------------------------------
+ * hypre_FACCFCache data structure
+ * Coarse-fine interface boxes of the FAC setup that are kept between setups.
+ * For each fine part and variable, every cbox of the underlying coarse part
+ * on this processor is recorded with the extents of the fboxes in or abutting
+ * it. On a later setup, a cbox whose extents and fbox neighbourhood are
+ * unchanged reuses its entries; only the (cbox, fbox) pairs of changed
+ * patches are recomputed. The send/recv info of the inter-level communication
+ * of hypre_AMR_RAP is kept as well, and reused as long as the local fboxes and
+ * cboxes and the entries of both box managers are unchanged.
+ *--------------------------------------------------------------------------*/
+#ifndef hypre_FACCFCACHE_HEADER
+#define hypre_FACCFCACHE_HEADER
+
+typedef struct
+{
+   hypre_BoxArray        *cboxes;      /* cboxes of this processor */
+   hypre_BoxArray       **fboxes;      /* fboxes in or abutting each cbox */
+   hypre_BoxArrayArray  **cf_extents;  /* c/f interface extents, per fbox */
+   hypre_BoxArray       **composite;   /* cbox minus the coarsened fboxes */
+
+   hypre_Index            rfactor;
+   HYPRE_Int              stencil_size;
+   hypre_Index           *stencil_shape;
+
+   hypre_BoxArray             *fgrid_boxes;    /* fboxes of this processor */
+   HYPRE_Int                  *fboxman_key;    /* fine box manager entries */
+   HYPRE_Int                   fboxman_key_size;
+   HYPRE_Int                  *cboxman_key;    /* coarse box manager entries */
+   HYPRE_Int                   cboxman_key_size;
+   hypre_SStructSendInfoData  *sendinfo;
+   hypre_SStructRecvInfoData  *recvinfo;
+} hypre_FACCFCacheVarData;
+
+typedef struct
+{
+   HYPRE_Int                  nparts;
+   HYPRE_Int                 *nvars;
+   hypre_FACCFCacheVarData ***var_data;  /* var_data[part][var] */
+} hypre_FACCFCache;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_FACCFCache
+ *--------------------------------------------------------------------------*/
+
+#define hypre_FACCFCacheCFExtents(cache, part, var) \
+((cache) -> var_data[part][var] -> cf_extents)
+#define hypre_FACCFCacheComposite(cache, part, var) \
+((cache) -> var_data[part][var] -> composite)
+#define hypre_FACCFCacheSendInfo(cache, part, var) \
+((cache) -> var_data[part][var] -> sendinfo)
+#define hypre_FACCFCacheRecvInfo(cache, part, var) \
+((cache) -> var_data[part][var] -> recvinfo)
+
 #endif
 typedef struct
 {
@@ -236,7 +292,7 @@ HYPRE_Int hypre_AMR_FCoarsen ( hypre_SStructMatrix *A, hypre_SStructMatrix *fac_
 
 /* fac_amr_rap.c */
 HYPRE_Int hypre_AMR_RAP ( hypre_SStructMatrix *A, hypre_Index *rfactors,
-                          hypre_SStructMatrix **fac_A_ptr );
+                          hypre_FACCFCache *cf_cache, hypre_SStructMatrix **fac_A_ptr );
 
 /* fac_amr_zero_data.c */
 HYPRE_Int hypre_ZeroAMRVectorData ( hypre_SStructVector *b, HYPRE_Int *plevels,
@@ -247,6 +303,7 @@ HYPRE_Int hypre_ZeroAMRMatrixData ( hypre_SStructMatrix *A, HYPRE_Int part_crse,
 /* fac.c */
 void *hypre_FACCreate ( MPI_Comm comm );
 HYPRE_Int hypre_FACDestroy2 ( void *fac_vdata );
+HYPRE_Int hypre_FACSetupDestroy ( void *fac_vdata );
 HYPRE_Int hypre_FACSetTol ( void *fac_vdata, HYPRE_Real tol );
 HYPRE_Int hypre_FACSetPLevels ( void *fac_vdata, HYPRE_Int nparts, HYPRE_Int *plevels );
 HYPRE_Int hypre_FACSetPRefinements ( void *fac_vdata, HYPRE_Int nparts, hypre_Index *prefinements);
@@ -267,7 +324,13 @@ HYPRE_Int hypre_FACGetFinalRelativeResidualNorm ( void *fac_vdata,
 
 /* fac_cf_coarsen.c */
 HYPRE_Int hypre_AMR_CFCoarsen ( hypre_SStructMatrix *A, hypre_SStructMatrix *fac_A,
-                                hypre_Index refine_factors, HYPRE_Int level );
+                                hypre_Index refine_factors, HYPRE_Int level, hypre_FACCFCache *cf_cache );
+
+/* fac_cf_cache.c */
+hypre_FACCFCache *hypre_FACCFCacheCreate ( HYPRE_Int nparts );
+HYPRE_Int hypre_FACCFCacheDestroy ( hypre_FACCFCache *cache );
+HYPRE_Int hypre_FACCFCacheUpdate ( hypre_FACCFCache *cache, hypre_SStructMatrix *fac_A,
+                                   HYPRE_Int part, hypre_Index rfactor );
 
 /* fac_CFInterfaceExtents.c */
 hypre_BoxArray *hypre_CFInterfaceExtents ( hypre_Box *fgrid_box, hypre_Box *cgrid_box,
@@ -695,7 +758,8 @@ HYPRE_Int hypre_SStructIndexScaleF_C ( hypre_Index findex, hypre_Index index, hy
 HYPRE_Int hypre_SStructIndexScaleC_F ( hypre_Index cindex, hypre_Index index, hypre_Index stride,
                                        hypre_Index findex );
 hypre_SStructOwnInfoData *hypre_SStructOwnInfo ( hypre_StructGrid *fgrid, hypre_StructGrid *cgrid,
-                                                 hypre_BoxManager *cboxman, hypre_BoxManager *fboxman, hypre_Index rfactor );
+                                                 hypre_BoxManager *cboxman, hypre_BoxManager *fboxman, hypre_Index rfactor,
+                                                 hypre_BoxArray **composite_cboxes );
 HYPRE_Int hypre_SStructOwnInfoDataDestroy ( hypre_SStructOwnInfoData *owninfo_data );
 
 /* sstruct_recvinfo.c */
@@ -38,88 +38,108 @@ hypre_FACCreate( MPI_Comm  comm )
 }
 
 /*--------------------------------------------------------------------------
- * hypre_FACDestroy
+ * hypre_FACSetupDestroy: Frees the data created by hypre_FacSetup2, except
+ * for the c/f interface cache, so that the solver can be set up again.
  *--------------------------------------------------------------------------*/
 HYPRE_Int
-hypre_FACDestroy2(void *fac_vdata)
+hypre_FACSetupDestroy(void *fac_vdata)
 {
    hypre_FACData *fac_data = (hypre_FACData *)fac_vdata;
 
    HYPRE_Int level;
-   HYPRE_Int ierr = 0;
 
-   if (fac_data)
+   if ((fac_data -> A_rap) == NULL)
    {
-      hypre_TFree((fac_data ->plevels), HYPRE_MEMORY_HOST);
-      hypre_TFree((fac_data ->prefinements), HYPRE_MEMORY_HOST);
-
-      HYPRE_SStructGraphDestroy(hypre_SStructMatrixGraph((fac_data -> A_rap)));
-      HYPRE_SStructMatrixDestroy((fac_data -> A_rap));
-      for (level = 0; level <= (fac_data -> max_levels); level++)
-      {
-         HYPRE_SStructMatrixDestroy( (fac_data -> A_level[level]) );
-         HYPRE_SStructVectorDestroy( (fac_data -> x_level[level]) );
-         HYPRE_SStructVectorDestroy( (fac_data -> b_level[level]) );
-         HYPRE_SStructVectorDestroy( (fac_data -> r_level[level]) );
-         HYPRE_SStructVectorDestroy( (fac_data -> e_level[level]) );
-         hypre_SStructPVectorDestroy( (fac_data -> tx_level[level]) );
+      return hypre_error_flag;
+   }
 
-         HYPRE_SStructGraphDestroy( (fac_data -> graph_level[level]) );
-         HYPRE_SStructGridDestroy(  (fac_data -> grid_level[level]) );
+   HYPRE_SStructGraphDestroy(hypre_SStructMatrixGraph((fac_data -> A_rap)));
+   HYPRE_SStructMatrixDestroy((fac_data -> A_rap));
+   for (level = 0; level <= (fac_data -> max_levels); level++)
+   {
+      HYPRE_SStructMatrixDestroy( (fac_data -> A_level[level]) );
+      HYPRE_SStructVectorDestroy( (fac_data -> x_level[level]) );
+      HYPRE_SStructVectorDestroy( (fac_data -> b_level[level]) );
+      HYPRE_SStructVectorDestroy( (fac_data -> r_level[level]) );
+      HYPRE_SStructVectorDestroy( (fac_data -> e_level[level]) );
+      hypre_SStructPVectorDestroy( (fac_data -> tx_level[level]) );
 
-         hypre_SStructMatvecDestroy( (fac_data   -> matvec_data_level[level]) );
-         hypre_SStructPMatvecDestroy((fac_data  -> pmatvec_data_level[level]) );
+      HYPRE_SStructGraphDestroy( (fac_data -> graph_level[level]) );
+      HYPRE_SStructGridDestroy(  (fac_data -> grid_level[level]) );
 
-         hypre_SysPFMGRelaxDestroy( (fac_data -> relax_data_level[level]) );
+      hypre_SStructMatvecDestroy( (fac_data   -> matvec_data_level[level]) );
+      hypre_SStructPMatvecDestroy((fac_data  -> pmatvec_data_level[level]) );
 
-         if (level > 0)
-         {
-            hypre_FacSemiRestrictDestroy2( (fac_data -> restrict_data_level[level]) );
-         }
+      hypre_SysPFMGRelaxDestroy( (fac_data -> relax_data_level[level]) );
 
-         if (level < (fac_data -> max_levels))
-         {
-            hypre_FacSemiInterpDestroy2( (fac_data -> interp_data_level[level]) );
-         }
-      }
-      hypre_SStructMatvecDestroy( (fac_data -> matvec_data) );
-
-      hypre_TFree(fac_data -> A_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> x_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> b_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> r_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> e_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> tx_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> relax_data_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> restrict_data_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> matvec_data_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> pmatvec_data_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> interp_data_level, HYPRE_MEMORY_HOST);
-
-      hypre_TFree(fac_data -> grid_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> graph_level, HYPRE_MEMORY_HOST);
-
-      HYPRE_SStructVectorDestroy(fac_data -> tx);
-
-      hypre_TFree(fac_data -> level_to_part, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> part_to_level, HYPRE_MEMORY_HOST);
-      hypre_TFree(fac_data -> refine_factors, HYPRE_MEMORY_HOST);
-
-      if ( (fac_data -> csolver_type) == 1)
-      {
-         HYPRE_SStructPCGDestroy(fac_data -> csolver);
-         HYPRE_SStructSysPFMGDestroy(fac_data -> cprecond);
-      }
-      else if ((fac_data -> csolver_type) == 2)
+      if (level > 0)
       {
-         HYPRE_SStructSysPFMGDestroy(fac_data -> csolver);
+         hypre_FacSemiRestrictDestroy2( (fac_data -> restrict_data_level[level]) );
       }
 
-      if ((fac_data -> logging) > 0)
+      if (level < (fac_data -> max_levels))
       {
-         hypre_TFree(fac_data -> norms, HYPRE_MEMORY_HOST);
-         hypre_TFree(fac_data -> rel_norms, HYPRE_MEMORY_HOST);
+         hypre_FacSemiInterpDestroy2( (fac_data -> interp_data_level[level]) );
       }
+   }
+   hypre_SStructMatvecDestroy( (fac_data -> matvec_data) );
+
+   hypre_TFree(fac_data -> A_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> x_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> b_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> r_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> e_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> tx_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> relax_data_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> restrict_data_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> matvec_data_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> pmatvec_data_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> interp_data_level, HYPRE_MEMORY_HOST);
+
+   hypre_TFree(fac_data -> grid_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> graph_level, HYPRE_MEMORY_HOST);
+
+   HYPRE_SStructVectorDestroy(fac_data -> tx);
+
+   hypre_TFree(fac_data -> level_to_part, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> part_to_level, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> refine_factors, HYPRE_MEMORY_HOST);
+
+   if ( (fac_data -> csolver_type) == 1)
+   {
+      HYPRE_SStructPCGDestroy(fac_data -> csolver);
+      HYPRE_SStructSysPFMGDestroy(fac_data -> cprecond);
+   }
+   else if ((fac_data -> csolver_type) == 2)
+   {
+      HYPRE_SStructSysPFMGDestroy(fac_data -> csolver);
+   }
+
+   hypre_TFree(fac_data -> norms, HYPRE_MEMORY_HOST);
+   hypre_TFree(fac_data -> rel_norms, HYPRE_MEMORY_HOST);
+
+   (fac_data -> A_rap) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FACDestroy
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+hypre_FACDestroy2(void *fac_vdata)
+{
+   hypre_FACData *fac_data = (hypre_FACData *)fac_vdata;
+
+   HYPRE_Int ierr = 0;
+
+   if (fac_data)
+   {
+      hypre_TFree((fac_data ->plevels), HYPRE_MEMORY_HOST);
+      hypre_TFree((fac_data ->prefinements), HYPRE_MEMORY_HOST);
+
+      hypre_FACSetupDestroy(fac_data);
+      hypre_FACCFCacheDestroy(fac_data -> cf_cache);
 
       hypre_FinalizeTiming(fac_data -> time_index);
 
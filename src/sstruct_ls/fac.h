@@ -49,6 +49,8 @@ typedef struct
    void                 **restrict_data_level;
    void                 **interp_data_level;
 
+   hypre_FACCFCache      *cf_cache;       /* c/f interface boxes kept between setups */
+
    HYPRE_Int              csolver_type;
    HYPRE_SStructSolver    csolver;
    HYPRE_SStructSolver    cprecond;
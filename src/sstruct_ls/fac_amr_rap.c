@@ -19,10 +19,15 @@
  * same so that the row ranks are the same. However, the generated
  * coarse-grid operators are re-distributed so that each processor has its
  * operator on its grid.
+ *
+ * If cf_cache is non-NULL, the coarse-fine interface boxes and the send/recv
+ * info are taken from it after bringing it up to date with the grid of A, so
+ * that repeated setups recompute them only where the grid changed.
  *--------------------------------------------------------------------------*/
 HYPRE_Int
 hypre_AMR_RAP( hypre_SStructMatrix  *A,
                hypre_Index          *rfactors,
+               hypre_FACCFCache     *cf_cache,
                hypre_SStructMatrix **fac_A_ptr )
 {
 
@@ -153,6 +158,11 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
       nvars  = hypre_SStructPGridNVars(f_pgrid);
       owninfo[part] = hypre_CTAlloc(hypre_SStructOwnInfoData   *,  nvars, HYPRE_MEMORY_HOST);
 
+      if (cf_cache)
+      {
+         hypre_FACCFCacheUpdate(cf_cache, fac_A, part, rfactors[part]);
+      }
+
       for (var1 = 0; var1 < nvars; var1++)
       {
          fboxman = hypre_SStructGridBoxManager(fac_grid, part, var1);
@@ -162,7 +172,10 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
          cgrid = hypre_SStructPGridSGrid(c_pgrid, var1);
 
          owninfo[part][var1] = hypre_SStructOwnInfo(fgrid, cgrid, cboxman, fboxman,
-                                                    rfactors[part]);
+                                                    rfactors[part],
+                                                    cf_cache ?
+                                                    hypre_FACCFCacheComposite(cf_cache, part, var1) :
+                                                    NULL);
       }
    }
 
@@ -302,7 +315,7 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
     *--------------------------------------------------------------------------*/
    for (part = (nparts - 1); part >= 1; part--)
    {
-      hypre_AMR_CFCoarsen(A, fac_A, rfactors[part], part);
+      hypre_AMR_CFCoarsen(A, fac_A, rfactors[part], part, cf_cache);
 
       /*-----------------------------------------------------------------------
        *  Create the temp SStruct_PMatrix for coarsening away the level= part
@@ -435,8 +448,16 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
          fgrid = hypre_SStructPGridSGrid(f_pgrid, var1);
          cgrid = hypre_SStructPGridSGrid(c_pgrid, var1);
 
-         sendinfo = hypre_SStructSendInfo(fgrid, cboxman, rfactors[part]);
-         recvinfo = hypre_SStructRecvInfo(cgrid, fboxman, rfactors[part]);
+         if (cf_cache)
+         {
+            sendinfo = hypre_FACCFCacheSendInfo(cf_cache, part, var1);
+            recvinfo = hypre_FACCFCacheRecvInfo(cf_cache, part, var1);
+         }
+         else
+         {
+            sendinfo = hypre_SStructSendInfo(fgrid, cboxman, rfactors[part]);
+            recvinfo = hypre_SStructRecvInfo(cgrid, fboxman, rfactors[part]);
+         }
 
          /*-------------------------------------------------------------------
           * need to check this for more than one variable- are the comm. info
@@ -464,8 +485,11 @@ hypre_AMR_RAP( hypre_SStructMatrix  *A,
             hypre_CommPkgDestroy(amrA_comm_pkg);
          }
 
-         hypre_SStructSendInfoDataDestroy(sendinfo);
-         hypre_SStructRecvInfoDataDestroy(recvinfo);
+         if (!cf_cache)
+         {
+            hypre_SStructSendInfoDataDestroy(sendinfo);
+            hypre_SStructRecvInfoDataDestroy(recvinfo);
+         }
 
       }  /* for (var1= 0; var1< nvars; var1++) */
 
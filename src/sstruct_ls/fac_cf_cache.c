@@ -0,0 +1,507 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_sstruct_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_FACCFCacheCreate
+ *--------------------------------------------------------------------------*/
+
+hypre_FACCFCache *
+hypre_FACCFCacheCreate( HYPRE_Int nparts )
+{
+   hypre_FACCFCache *cache;
+
+   cache = hypre_CTAlloc(hypre_FACCFCache, 1, HYPRE_MEMORY_HOST);
+
+   (cache -> nparts)   = nparts;
+   (cache -> nvars)    = hypre_CTAlloc(HYPRE_Int, nparts, HYPRE_MEMORY_HOST);
+   (cache -> var_data) = hypre_CTAlloc(hypre_FACCFCacheVarData **, nparts, HYPRE_MEMORY_HOST);
+
+   return cache;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FACCFCacheVarDataDestroy
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_FACCFCacheVarDataDestroy( hypre_FACCFCacheVarData *var_data )
+{
+   HYPRE_Int ci;
+
+   if (var_data)
+   {
+      hypre_ForBoxI(ci, (var_data -> cboxes))
+      {
+         hypre_BoxArrayDestroy(var_data -> fboxes[ci]);
+         hypre_BoxArrayArrayDestroy(var_data -> cf_extents[ci]);
+         hypre_BoxArrayDestroy(var_data -> composite[ci]);
+      }
+      hypre_BoxArrayDestroy(var_data -> cboxes);
+      hypre_TFree(var_data -> fboxes, HYPRE_MEMORY_HOST);
+      hypre_TFree(var_data -> cf_extents, HYPRE_MEMORY_HOST);
+      hypre_TFree(var_data -> composite, HYPRE_MEMORY_HOST);
+      hypre_TFree(var_data -> stencil_shape, HYPRE_MEMORY_HOST);
+      hypre_BoxArrayDestroy(var_data -> fgrid_boxes);
+      hypre_TFree(var_data -> fboxman_key, HYPRE_MEMORY_HOST);
+      hypre_TFree(var_data -> cboxman_key, HYPRE_MEMORY_HOST);
+      if (var_data -> sendinfo)
+      {
+         hypre_SStructSendInfoDataDestroy(var_data -> sendinfo);
+      }
+      if (var_data -> recvinfo)
+      {
+         hypre_SStructRecvInfoDataDestroy(var_data -> recvinfo);
+      }
+      hypre_TFree(var_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FACCFCacheDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FACCFCacheDestroy( hypre_FACCFCache *cache )
+{
+   HYPRE_Int part, var;
+
+   if (cache)
+   {
+      for (part = 0; part < (cache -> nparts); part++)
+      {
+         for (var = 0; var < (cache -> nvars[part]); var++)
+         {
+            hypre_FACCFCacheVarDataDestroy(cache -> var_data[part][var]);
+         }
+         hypre_TFree(cache -> var_data[part], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(cache -> var_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(cache -> nvars, HYPRE_MEMORY_HOST);
+      hypre_TFree(cache, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if box1 and box2 have the same extents.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_FACCFCacheSameBox( hypre_Box *box1,
+                         hypre_Box *box2,
+                         HYPRE_Int  ndim )
+{
+   return ( hypre_IndexesEqual(hypre_BoxIMin(box1), hypre_BoxIMin(box2), ndim) &&
+            hypre_IndexesEqual(hypre_BoxIMax(box1), hypre_BoxIMax(box2), ndim) );
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if the box arrays have the same boxes in the same order.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_FACCFCacheSameBoxArray( hypre_BoxArray *boxes1,
+                              hypre_BoxArray *boxes2,
+                              HYPRE_Int       ndim )
+{
+   HYPRE_Int i;
+
+   if (hypre_BoxArraySize(boxes1) != hypre_BoxArraySize(boxes2))
+   {
+      return 0;
+   }
+   hypre_ForBoxI(i, boxes1)
+   {
+      if (!hypre_FACCFCacheSameBox(hypre_BoxArrayBox(boxes1, i),
+                                   hypre_BoxArrayBox(boxes2, i), ndim))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * Packs the extents, process, and box number of every entry of an SStruct
+ * box manager into an array, which identifies the boxes that the send/recv
+ * info computed from the box manager depends on.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int *
+hypre_FACCFCacheBoxManKey( hypre_BoxManager *boxman,
+                           HYPRE_Int         ndim,
+                           HYPRE_Int        *key_size_ptr )
+{
+   hypre_BoxManEntry  *entries;
+   HYPRE_Int          *key;
+   hypre_Index         imin, imax;
+   HYPRE_Int           nentries, i, d, k;
+
+   hypre_BoxManGetAllEntries(boxman, &nentries, &entries);
+
+   key = hypre_TAlloc(HYPRE_Int, nentries * (2 * ndim + 2), HYPRE_MEMORY_HOST);
+   k = 0;
+   for (i = 0; i < nentries; i++)
+   {
+      hypre_BoxManEntryGetExtents(&entries[i], imin, imax);
+      for (d = 0; d < ndim; d++)
+      {
+         key[k++] = imin[d];
+         key[k++] = imax[d];
+      }
+      hypre_SStructBoxManEntryGetProcess(&entries[i], &key[k++]);
+      hypre_SStructBoxManEntryGetBoxnum(&entries[i], &key[k++]);
+   }
+
+   *key_size_ptr = k;
+
+   return key;
+}
+
+/*--------------------------------------------------------------------------
+ * Computes the composite cboxes of cgrid_box, i.e., cgrid_box minus the
+ * coarsened fboxes underlying it. This is the own_composite_cboxes
+ * computation of hypre_SStructOwnInfo, with the fboxes taken from the
+ * (stretched) fbox neighbourhood of the cache.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_FACCFCacheComputeComposite( hypre_Box      *cgrid_box,
+                                  hypre_BoxArray *fboxes,
+                                  hypre_Index     rfactor,
+                                  hypre_BoxArray *composite )
+{
+   HYPRE_Int        ndim = hypre_BoxArrayNDim(fboxes);
+   hypre_BoxArray  *intersect_boxes;
+   hypre_BoxArray  *tmp_boxarray;
+   hypre_Box        scaled_box, intersect_box;
+   hypre_Index      index;
+   HYPRE_Int        fi, k, mod;
+
+   hypre_BoxInit(&scaled_box, ndim);
+   hypre_BoxInit(&intersect_box, ndim);
+
+   hypre_ClearIndex(index);
+   hypre_SStructIndexScaleC_F(hypre_BoxIMin(cgrid_box), index,
+                              rfactor, hypre_BoxIMin(&scaled_box));
+   hypre_SetIndex3(index, rfactor[0] - 1, rfactor[1] - 1, rfactor[2] - 1);
+   hypre_SStructIndexScaleC_F(hypre_BoxIMax(cgrid_box), index,
+                              rfactor, hypre_BoxIMax(&scaled_box));
+
+   hypre_ClearIndex(index);
+   intersect_boxes = hypre_BoxArrayCreate(0, ndim);
+   hypre_ForBoxI(fi, fboxes)
+   {
+      hypre_IntersectBoxes(hypre_BoxArrayBox(fboxes, fi), &scaled_box, &intersect_box);
+      if (!hypre_BoxVolume(&intersect_box))
+      {
+         /* an abutting fbox */
+         continue;
+      }
+
+      /* contract the intersection box so that only the cnodes in the
+         intersection box are included. */
+      for (k = 0; k < ndim; k++)
+      {
+         mod = hypre_BoxIMin(&intersect_box)[k] % rfactor[k];
+         if (mod)
+         {
+            hypre_BoxIMin(&intersect_box)[k] += rfactor[k] - mod;
+         }
+      }
+
+      hypre_SStructIndexScaleF_C(hypre_BoxIMin(&intersect_box), index,
+                                 rfactor, hypre_BoxIMin(&intersect_box));
+      hypre_SStructIndexScaleF_C(hypre_BoxIMax(&intersect_box), index,
+                                 rfactor, hypre_BoxIMax(&intersect_box));
+      hypre_AppendBox(&intersect_box, intersect_boxes);
+   }
+
+   hypre_AppendBox(cgrid_box, composite);
+   tmp_boxarray = hypre_BoxArrayCreate(0, ndim);
+   hypre_SubtractBoxArrays(composite, intersect_boxes, tmp_boxarray);
+   hypre_MinUnionBoxes(composite);
+
+   hypre_BoxArrayDestroy(tmp_boxarray);
+   hypre_BoxArrayDestroy(intersect_boxes);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FACCFCacheUpdate: Brings the cache entries of fine part 'part' up to
+ * date with the grid of fac_A. For each variable and each cbox of part-1 on
+ * this processor, the fboxes in or abutting the refined cbox are gathered
+ * from the fine box manager and compared with the entry of the previous
+ * setup:
+ *
+ *   - the c/f interface extents of a (cbox, fbox) pair are reused when the
+ *     same pair was cached, and computed otherwise;
+ *   - the composite cboxes are reused when the cbox and its whole fbox
+ *     neighbourhood are unchanged, and computed otherwise.
+ *
+ * Entries of cboxes that no longer exist are dropped. A change of the
+ * refinement factor or of the var-var stencil clears the variable's cache.
+ *
+ * The send/recv info of hypre_AMR_RAP is reused if the fboxes and cboxes of
+ * this processor and the entries of the fine and coarse box managers are all
+ * unchanged, and computed otherwise. Both only depend on these boxes, so the
+ * decision is local.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_FACCFCacheUpdate( hypre_FACCFCache    *cache,
+                        hypre_SStructMatrix *fac_A,
+                        HYPRE_Int            part,
+                        hypre_Index          rfactor )
+{
+   HYPRE_Int                 ndim     = hypre_SStructMatrixNDim(fac_A);
+   hypre_SStructGrid        *grid     = hypre_SStructGraphGrid(hypre_SStructMatrixGraph(fac_A));
+   hypre_SStructPMatrix     *A_pmatrix = hypre_SStructMatrixPMatrix(fac_A, part - 1);
+   HYPRE_Int                 nvars    = hypre_SStructPMatrixNVars(A_pmatrix);
+
+   hypre_FACCFCacheVarData  *old_data, *new_data;
+   hypre_StructStencil      *stencils;
+   hypre_StructGrid         *cgrid, *fgrid;
+   hypre_BoxArray           *cgrid_boxes, *fgrid_boxes;
+   hypre_Box                *cgrid_box;
+   hypre_BoxArray           *fboxes, *old_fboxes;
+   hypre_BoxManager         *fboxman, *cboxman;
+   hypre_BoxManEntry       **boxman_entries;
+   HYPRE_Int                 nboxman_entries;
+   hypre_Box                 refined_box;
+   hypre_Index               zero_index, index1;
+
+   HYPRE_Int                 stencil_size;
+   HYPRE_Int                 var, ci, oci, oi, nold, fi, ofi, i, same;
+
+   hypre_BoxInit(&refined_box, ndim);
+   hypre_ClearIndex(zero_index);
+   hypre_SetIndex3(index1, rfactor[0] - 1, rfactor[1] - 1, rfactor[2] - 1);
+
+   if ((cache -> nvars[part]) != nvars)
+   {
+      for (var = 0; var < (cache -> nvars[part]); var++)
+      {
+         hypre_FACCFCacheVarDataDestroy(cache -> var_data[part][var]);
+      }
+      hypre_TFree(cache -> var_data[part], HYPRE_MEMORY_HOST);
+      (cache -> var_data[part]) = hypre_CTAlloc(hypre_FACCFCacheVarData *, nvars,
+                                                HYPRE_MEMORY_HOST);
+      (cache -> nvars[part]) = nvars;
+   }
+
+   for (var = 0; var < nvars; var++)
+   {
+      fboxman  = hypre_SStructGridBoxManager(grid, part, var);
+      stencils = hypre_SStructPMatrixSStencil(A_pmatrix, var, var);
+      stencil_size = (stencils != NULL) ? hypre_StructStencilSize(stencils) : 0;
+
+      cgrid = hypre_SStructPGridSGrid(hypre_SStructPMatrixPGrid(A_pmatrix), var);
+      cgrid_boxes = hypre_StructGridBoxes(cgrid);
+      cboxman = hypre_SStructGridBoxManager(grid, part - 1, var);
+      fgrid = hypre_SStructPGridSGrid(hypre_SStructGridPGrid(grid, part), var);
+      fgrid_boxes = hypre_StructGridBoxes(fgrid);
+
+      /*-----------------------------------------------------------------------
+       * The c/f interface extents depend on the refinement factor and on the
+       * var-var stencil. If either changed, nothing can be reused.
+       *-----------------------------------------------------------------------*/
+      old_data = (cache -> var_data[part][var]);
+      if (old_data)
+      {
+         same = ( hypre_IndexesEqual((old_data -> rfactor), rfactor, ndim) &&
+                  (old_data -> stencil_size) == stencil_size );
+         for (i = 0; same && (i < stencil_size); i++)
+         {
+            same = hypre_IndexesEqual((old_data -> stencil_shape[i]),
+                                      hypre_StructStencilElement(stencils, i), ndim);
+         }
+         if (!same)
+         {
+            hypre_FACCFCacheVarDataDestroy(old_data);
+            old_data = NULL;
+         }
+      }
+
+      new_data = hypre_CTAlloc(hypre_FACCFCacheVarData, 1, HYPRE_MEMORY_HOST);
+      (new_data -> cboxes)     = hypre_BoxArrayDuplicate(cgrid_boxes);
+      (new_data -> fboxes)     = hypre_TAlloc(hypre_BoxArray *,
+                                              hypre_BoxArraySize(cgrid_boxes), HYPRE_MEMORY_HOST);
+      (new_data -> cf_extents) = hypre_TAlloc(hypre_BoxArrayArray *,
+                                              hypre_BoxArraySize(cgrid_boxes), HYPRE_MEMORY_HOST);
+      (new_data -> composite)  = hypre_TAlloc(hypre_BoxArray *,
+                                              hypre_BoxArraySize(cgrid_boxes), HYPRE_MEMORY_HOST);
+      hypre_CopyIndex(rfactor, (new_data -> rfactor));
+      (new_data -> stencil_size)  = stencil_size;
+      (new_data -> stencil_shape) = hypre_TAlloc(hypre_Index, stencil_size, HYPRE_MEMORY_HOST);
+      for (i = 0; i < stencil_size; i++)
+      {
+         hypre_CopyIndex(hypre_StructStencilElement(stencils, i), (new_data -> stencil_shape[i]));
+      }
+
+      /*-----------------------------------------------------------------------
+       * Send/recv info: reuse it if none of the boxes it depends on changed.
+       *-----------------------------------------------------------------------*/
+      (new_data -> fgrid_boxes) = hypre_BoxArrayDuplicate(fgrid_boxes);
+      (new_data -> fboxman_key) = hypre_FACCFCacheBoxManKey(fboxman, ndim,
+                                                            &(new_data -> fboxman_key_size));
+      (new_data -> cboxman_key) = hypre_FACCFCacheBoxManKey(cboxman, ndim,
+                                                            &(new_data -> cboxman_key_size));
+      same = (old_data != NULL) &&
+             hypre_FACCFCacheSameBoxArray((old_data -> fgrid_boxes), fgrid_boxes, ndim) &&
+             hypre_FACCFCacheSameBoxArray((old_data -> cboxes), cgrid_boxes, ndim) &&
+             (old_data -> fboxman_key_size) == (new_data -> fboxman_key_size) &&
+             (old_data -> cboxman_key_size) == (new_data -> cboxman_key_size);
+      for (i = 0; same && (i < (new_data -> fboxman_key_size)); i++)
+      {
+         same = ((old_data -> fboxman_key[i]) == (new_data -> fboxman_key[i]));
+      }
+      for (i = 0; same && (i < (new_data -> cboxman_key_size)); i++)
+      {
+         same = ((old_data -> cboxman_key[i]) == (new_data -> cboxman_key[i]));
+      }
+      if (same)
+      {
+         (new_data -> sendinfo) = (old_data -> sendinfo);
+         (new_data -> recvinfo) = (old_data -> recvinfo);
+         (old_data -> sendinfo) = NULL;
+         (old_data -> recvinfo) = NULL;
+      }
+      else
+      {
+         (new_data -> sendinfo) = hypre_SStructSendInfo(fgrid, cboxman, rfactor);
+         (new_data -> recvinfo) = hypre_SStructRecvInfo(cgrid, fboxman, rfactor);
+      }
+
+      hypre_ForBoxI(ci, cgrid_boxes)
+      {
+         cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+         /*--------------------------------------------------------------------
+          * Find the cached entry of this cbox. Boxes usually keep their local
+          * numbering, so try the same number first.
+          *--------------------------------------------------------------------*/
+         oci = -1;
+         if (old_data)
+         {
+            nold = hypre_BoxArraySize(old_data -> cboxes);
+            for (i = 0; i < nold; i++)
+            {
+               oi = (ci + i) % nold;
+               if ( (old_data -> composite[oi]) != NULL &&
+                    hypre_FACCFCacheSameBox(hypre_BoxArrayBox(old_data -> cboxes, oi),
+                                            cgrid_box, ndim) )
+               {
+                  oci = oi;
+                  break;
+               }
+            }
+         }
+
+         /*--------------------------------------------------------------------
+          * Gather the fboxes in or abutting the refined cbox, as in
+          * hypre_AMR_CFCoarsen.
+          *--------------------------------------------------------------------*/
+         hypre_StructMapCoarseToFine(hypre_BoxIMin(cgrid_box), zero_index,
+                                     rfactor, hypre_BoxIMin(&refined_box));
+         hypre_StructMapCoarseToFine(hypre_BoxIMax(cgrid_box), index1,
+                                     rfactor, hypre_BoxIMax(&refined_box));
+         for (i = 0; i < ndim; i++)
+         {
+            hypre_BoxIMin(&refined_box)[i] -= 1;
+            hypre_BoxIMax(&refined_box)[i] += 1;
+         }
+
+         hypre_BoxManIntersect(fboxman, hypre_BoxIMin(&refined_box),
+                               hypre_BoxIMax(&refined_box), &boxman_entries,
+                               &nboxman_entries);
+
+         fboxes = hypre_BoxArrayCreate(nboxman_entries, ndim);
+         for (fi = 0; fi < nboxman_entries; fi++)
+         {
+            hypre_BoxManEntryGetExtents(boxman_entries[fi],
+                                        hypre_BoxIMin(hypre_BoxArrayBox(fboxes, fi)),
+                                        hypre_BoxIMax(hypre_BoxArrayBox(fboxes, fi)));
+         }
+         hypre_TFree(boxman_entries, HYPRE_MEMORY_HOST);
+
+         /*--------------------------------------------------------------------
+          * c/f interface extents: reuse the cached (cbox, fbox) pairs.
+          *--------------------------------------------------------------------*/
+         old_fboxes = (oci > -1) ? (old_data -> fboxes[oci]) : NULL;
+         same = (old_fboxes != NULL) &&
+                (hypre_BoxArraySize(old_fboxes) == nboxman_entries);
+
+         (new_data -> cf_extents[ci]) = hypre_BoxArrayArrayCreate(nboxman_entries, ndim);
+         hypre_ForBoxI(fi, fboxes)
+         {
+            ofi = -1;
+            if (old_fboxes)
+            {
+               hypre_ForBoxI(i, old_fboxes)
+               {
+                  if (hypre_FACCFCacheSameBox(hypre_BoxArrayBox(old_fboxes, i),
+                                              hypre_BoxArrayBox(fboxes, fi), ndim))
+                  {
+                     ofi = i;
+                     break;
+                  }
+               }
+            }
+            if (ofi != fi)
+            {
+               same = 0;
+            }
+
+            if (stencils == NULL)
+            {
+               continue;
+            }
+            if (ofi > -1)
+            {
+               hypre_AppendBoxArray(
+                  hypre_BoxArrayArrayBoxArray(old_data -> cf_extents[oci], ofi),
+                  hypre_BoxArrayArrayBoxArray(new_data -> cf_extents[ci], fi));
+            }
+            else
+            {
+               hypre_CFInterfaceExtents2(hypre_BoxArrayBox(fboxes, fi), cgrid_box,
+                                         stencils, rfactor,
+                                         hypre_BoxArrayArrayBoxArray(new_data -> cf_extents[ci], fi));
+            }
+         }
+
+         /*--------------------------------------------------------------------
+          * Composite cboxes: reuse only if the fbox neighbourhood is unchanged.
+          *--------------------------------------------------------------------*/
+         if (same)
+         {
+            (new_data -> composite[ci]) = (old_data -> composite[oci]);
+            (old_data -> composite[oci]) = NULL;
+         }
+         else
+         {
+            (new_data -> composite[ci]) = hypre_BoxArrayCreate(0, ndim);
+            hypre_FACCFCacheComputeComposite(cgrid_box, fboxes, rfactor,
+                                             (new_data -> composite[ci]));
+         }
+         (new_data -> fboxes[ci]) = fboxes;
+      }
+
+      hypre_FACCFCacheVarDataDestroy(old_data);
+      (cache -> var_data[part][var]) = new_data;
+   }
+
+   return hypre_error_flag;
+}
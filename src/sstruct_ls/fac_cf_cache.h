@@ -0,0 +1,62 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/*--------------------------------------------------------------------------
+ * hypre_FACCFCache data structure
+ * Coarse-fine interface boxes of the FAC setup that are kept between setups.
+ * For each fine part and variable, every cbox of the underlying coarse part
+ * on this processor is recorded with the extents of the fboxes in or abutting
+ * it. On a later setup, a cbox whose extents and fbox neighbourhood are
+ * unchanged reuses its entries; only the (cbox, fbox) pairs of changed
+ * patches are recomputed. The send/recv info of the inter-level communication
+ * of hypre_AMR_RAP is kept as well, and reused as long as the local fboxes and
+ * cboxes and the entries of both box managers are unchanged.
+ *--------------------------------------------------------------------------*/
+#ifndef hypre_FACCFCACHE_HEADER
+#define hypre_FACCFCACHE_HEADER
+
+typedef struct
+{
+   hypre_BoxArray        *cboxes;      /* cboxes of this processor */
+   hypre_BoxArray       **fboxes;      /* fboxes in or abutting each cbox */
+   hypre_BoxArrayArray  **cf_extents;  /* c/f interface extents, per fbox */
+   hypre_BoxArray       **composite;   /* cbox minus the coarsened fboxes */
+
+   hypre_Index            rfactor;
+   HYPRE_Int              stencil_size;
+   hypre_Index           *stencil_shape;
+
+   hypre_BoxArray             *fgrid_boxes;    /* fboxes of this processor */
+   HYPRE_Int                  *fboxman_key;    /* fine box manager entries */
+   HYPRE_Int                   fboxman_key_size;
+   HYPRE_Int                  *cboxman_key;    /* coarse box manager entries */
+   HYPRE_Int                   cboxman_key_size;
+   hypre_SStructSendInfoData  *sendinfo;
+   hypre_SStructRecvInfoData  *recvinfo;
+} hypre_FACCFCacheVarData;
+
+typedef struct
+{
+   HYPRE_Int                  nparts;
+   HYPRE_Int                 *nvars;
+   hypre_FACCFCacheVarData ***var_data;  /* var_data[part][var] */
+} hypre_FACCFCache;
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_FACCFCache
+ *--------------------------------------------------------------------------*/
+
+#define hypre_FACCFCacheCFExtents(cache, part, var) \
+((cache) -> var_data[part][var] -> cf_extents)
+#define hypre_FACCFCacheComposite(cache, part, var) \
+((cache) -> var_data[part][var] -> composite)
+#define hypre_FACCFCacheSendInfo(cache, part, var) \
+((cache) -> var_data[part][var] -> sendinfo)
+#define hypre_FACCFCacheRecvInfo(cache, part, var) \
+((cache) -> var_data[part][var] -> recvinfo)
+
+#endif
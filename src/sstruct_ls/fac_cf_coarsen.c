@@ -66,13 +66,17 @@
  * same grid & graph. Therefore, we will use A's grid & graph.
  *
  * ASSUMING ONLY LIKE-VARIABLES COUPLE THROUGH CF CONNECTIONS.
+ *
+ * If cf_cache is non-NULL, it must be up to date with the grid of fac_A and
+ * the c/f interface extents are taken from it.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
 hypre_AMR_CFCoarsen( hypre_SStructMatrix  *   A,
                      hypre_SStructMatrix  *   fac_A,
                      hypre_Index              refine_factors,
-                     HYPRE_Int                level )
+                     HYPRE_Int                level,
+                     hypre_FACCFCache     *   cf_cache )
 
 {
    MPI_Comm                comm       = hypre_SStructMatrixComm(A);
@@ -205,6 +209,12 @@ hypre_AMR_CFCoarsen( hypre_SStructMatrix  *   A,
    fgrid_cinterface_extents = hypre_TAlloc(hypre_BoxArrayArray **,  nvars, HYPRE_MEMORY_HOST);
    for (var1 = 0; var1 < nvars; var1++)
    {
+      if (cf_cache)
+      {
+         fgrid_cinterface_extents[var1] = hypre_FACCFCacheCFExtents(cf_cache, part_fine, var1);
+         continue;
+      }
+
       fboxman = hypre_SStructGridBoxManager(grid, part_fine, var1);
       stencils = hypre_SStructPMatrixSStencil(A_pmatrix, var1, var1);
 
@@ -487,7 +497,7 @@ hypre_AMR_CFCoarsen( hypre_SStructMatrix  *   A,
    }      /* end var1 */
 
 
-   for (var1 = 0; var1 < nvars; var1++)
+   for (var1 = 0; var1 < nvars && !cf_cache; var1++)
    {
       cgrid = hypre_SStructPGridSGrid(hypre_SStructPMatrixPGrid(A_pmatrix), var1);
       cgrid_boxes = hypre_StructGridBoxes(cgrid);
@@ -13,6 +13,10 @@
  * hypre_FacSetup2: Constructs the level composite structures.
  * Each consists only of two levels, the refinement patches and the
  * coarse parent base grids.
+ *
+ * The solver may be set up again, e.g., after a regrid. The structures of
+ * the previous setup are freed, but the coarse-fine interface boxes are kept
+ * in the c/f cache and are recomputed only where patches changed.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -127,8 +131,22 @@ hypre_FacSetup2( void                 *fac_vdata,
      nested_A= hypre_TAlloc(hypre_SStructMatrix ,  1, HYPRE_MEMORY_HOST);
      nested_A= hypre_CoarsenAMROp(fac_vdata, A);*/
 
+   /* release the previous setup, if any */
+   hypre_FACSetupDestroy(fac_vdata);
+
+   npart = hypre_SStructMatrixNParts(A_in);
+   if ((fac_data -> cf_cache) && (fac_data -> cf_cache -> nparts) != npart)
+   {
+      hypre_FACCFCacheDestroy(fac_data -> cf_cache);
+      (fac_data -> cf_cache) = NULL;
+   }
+   if ((fac_data -> cf_cache) == NULL)
+   {
+      (fac_data -> cf_cache) = hypre_FACCFCacheCreate(npart);
+   }
+
    /* generate the composite operator with the computed coarse-grid operators */
-   hypre_AMR_RAP(A_in, rfactors, &A_rap);
+   hypre_AMR_RAP(A_in, rfactors, (fac_data -> cf_cache), &A_rap);
    (fac_data -> A_rap) = A_rap;
 
    comm = hypre_SStructMatrixComm(A_rap);
@@ -12,7 +12,7 @@
 #include "gselim.h"
 
 /* TODO consider adding it to semistruct header files */
-#define HYPRE_MAXVARS 4
+#define HYPRE_MAXVARS 8
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -61,6 +61,17 @@ typedef struct
    HYPRE_Real            **xp;
    HYPRE_Real            **tp;
 
+   /* host only: inverses of the intra-nodal blocks, stored interleaved as one
+    * row-major nvars x nvars block per point of the matrix data space, and
+    * the off-diagonal (inter-nodal) terms of each variable */
+   HYPRE_Real             *Dinv;
+   HYPRE_Int              *Dinv_offsets;
+   HYPRE_Int              *term_starts;
+   HYPRE_Int              *term_vars;
+   HYPRE_Int              *term_entries;
+   HYPRE_Real            **term_Ap;
+   HYPRE_Real            **term_xp;
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
@@ -105,6 +116,13 @@ hypre_NodeRelaxCreate( MPI_Comm  comm )
    (relax_data -> bp)               = NULL;
    (relax_data -> xp)               = NULL;
    (relax_data -> tp)               = NULL;
+   (relax_data -> Dinv)             = NULL;
+   (relax_data -> Dinv_offsets)     = NULL;
+   (relax_data -> term_starts)      = NULL;
+   (relax_data -> term_vars)        = NULL;
+   (relax_data -> term_entries)     = NULL;
+   (relax_data -> term_Ap)          = NULL;
+   (relax_data -> term_xp)          = NULL;
    (relax_data -> comm_handle)      = NULL;
    (relax_data -> svec_compute_pkgs) = NULL;
    (relax_data -> compute_pkgs)     = NULL;
@@ -162,6 +180,13 @@ hypre_NodeRelaxDestroy( void *relax_vdata )
       hypre_TFree(relax_data -> xp, memory_location);
       hypre_TFree(relax_data -> tp, memory_location);
       hypre_TFree(relax_data -> Ap, memory_location);
+      hypre_TFree(relax_data -> Dinv, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> Dinv_offsets, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> term_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> term_vars, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> term_entries, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> term_Ap, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> term_xp, HYPRE_MEMORY_HOST);
       for (vi = 0; vi < nvars; vi++)
       {
          hypre_TFree((relax_data -> diag_rank)[vi], HYPRE_MEMORY_HOST);
@@ -175,6 +200,212 @@ hypre_NodeRelaxDestroy( void *relax_vdata )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_NodeRelaxSetupBlocks
+ *
+ * Host setup for the point-block relaxation: inverts the intra-nodal block
+ * at every point once and lists the inter-nodal stencil terms of each
+ * variable.  A sweep then updates all variables of a point together with a
+ * small dense matvec.  Each block is LU factored without pivoting, as in
+ * hypre_gselim, and the inverse is formed by solving for the unit vectors, so
+ * it gives the same linear map as solving with the block in every sweep.
+ * Points with a singular block are reported and left unchanged by the sweeps.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_NodeRelaxSetupBlocks( hypre_NodeRelaxData  *relax_data,
+                            hypre_SStructPMatrix *A,
+                            HYPRE_Int           **diag_rank )
+{
+   HYPRE_Int            ndim    = hypre_SStructPMatrixNDim(A);
+   HYPRE_Int            nvars   = hypre_SStructPMatrixNVars(A);
+   HYPRE_Int            nblock  = nvars * nvars;
+   hypre_StructMatrix  *sA00    = hypre_SStructPMatrixSMatrix(A, 0, 0);
+   hypre_BoxArray      *boxes   = hypre_StructGridBoxes(hypre_StructMatrixGrid(sA00));
+   hypre_BoxArray      *A_space = hypre_StructMatrixDataSpace(sA00);
+   hypre_StructMatrix  *sA;
+   hypre_Box           *box, *A_data_box;
+   hypre_IndexRef       start;
+   hypre_Index          stride, loop_size;
+   HYPRE_Real          *Ap[HYPRE_MAXVARS * HYPRE_MAXVARS];
+   HYPRE_Real          *Dinv, *Dp;
+   HYPRE_Int           *Dinv_offsets;
+   HYPRE_Int           *term_starts, *term_vars, *term_entries;
+   HYPRE_Int            nterms, size, vi, vj, si, i;
+   HYPRE_Int            num_singular = 0;
+
+   hypre_TFree(relax_data -> Dinv, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> Dinv_offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> term_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> term_vars, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> term_entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> term_Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(relax_data -> term_xp, HYPRE_MEMORY_HOST);
+
+   /* inter-nodal terms */
+   nterms = 0;
+   for (vi = 0; vi < nvars; vi++)
+   {
+      for (vj = 0; vj < nvars; vj++)
+      {
+         sA = hypre_SStructPMatrixSMatrix(A, vi, vj);
+         if (sA != NULL)
+         {
+            nterms += hypre_StructStencilSize(hypre_StructMatrixStencil(sA));
+         }
+      }
+   }
+   term_starts  = hypre_TAlloc(HYPRE_Int, nvars + 1, HYPRE_MEMORY_HOST);
+   term_vars    = hypre_TAlloc(HYPRE_Int, nterms, HYPRE_MEMORY_HOST);
+   term_entries = hypre_TAlloc(HYPRE_Int, nterms, HYPRE_MEMORY_HOST);
+   nterms = 0;
+   for (vi = 0; vi < nvars; vi++)
+   {
+      term_starts[vi] = nterms;
+      for (vj = 0; vj < nvars; vj++)
+      {
+         sA = hypre_SStructPMatrixSMatrix(A, vi, vj);
+         if (sA != NULL)
+         {
+            for (si = 0; si < hypre_StructStencilSize(hypre_StructMatrixStencil(sA)); si++)
+            {
+               if (si != diag_rank[vi][vj])
+               {
+                  term_vars[nterms]    = vj;
+                  term_entries[nterms] = si;
+                  nterms++;
+               }
+            }
+         }
+      }
+   }
+   term_starts[nvars] = nterms;
+
+   /* inverses of the intra-nodal blocks */
+   Dinv_offsets = hypre_TAlloc(HYPRE_Int, hypre_BoxArraySize(A_space), HYPRE_MEMORY_HOST);
+   size = 0;
+   hypre_ForBoxI(i, A_space)
+   {
+      Dinv_offsets[i] = size;
+      size += nblock * hypre_BoxVolume(hypre_BoxArrayBox(A_space, i));
+   }
+   Dinv = hypre_CTAlloc(HYPRE_Real, size, HYPRE_MEMORY_HOST);
+
+   hypre_SetIndex(stride, 1);
+   hypre_ForBoxI(i, boxes)
+   {
+      box        = hypre_BoxArrayBox(boxes, i);
+      A_data_box = hypre_BoxArrayBox(A_space, i);
+      Dp         = Dinv + Dinv_offsets[i];
+
+      for (vi = 0; vi < nvars; vi++)
+      {
+         for (vj = 0; vj < nvars; vj++)
+         {
+            sA = hypre_SStructPMatrixSMatrix(A, vi, vj);
+            Ap[vi * nvars + vj] = (sA != NULL) ?
+                                  hypre_StructMatrixBoxData(sA, i, diag_rank[vi][vj]) : NULL;
+         }
+      }
+
+      start = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION reduction(+:num_singular)
+      zypre_BoxLoop1ReductionBegin(ndim, loop_size, A_data_box, start, stride, Ai,
+                                   num_singular);
+      {
+         HYPRE_Real  LU[HYPRE_MAXVARS * HYPRE_MAXVARS];
+         HYPRE_Real  e_loc[HYPRE_MAXVARS];
+         HYPRE_Real *D_loc = Dp + Ai * nblock;
+         HYPRE_Real  factor;
+         HYPRE_Int   ii, jj, k, col, singular;
+
+         for (ii = 0; ii < nvars; ii++)
+         {
+            for (jj = 0; jj < nvars; jj++)
+            {
+               LU[ii * nvars + jj] = Ap[ii * nvars + jj] ? Ap[ii * nvars + jj][Ai] : 0.0;
+            }
+         }
+
+         /* factor: U in the upper triangle, the multipliers of L below it */
+         singular = 0;
+         for (k = 0; k < nvars && !singular; k++)
+         {
+            if (LU[k * nvars + k] == 0.0)
+            {
+               singular = 1;
+               continue;
+            }
+            factor = 1.0 / LU[k * nvars + k];
+            for (ii = k + 1; ii < nvars; ii++)
+            {
+               LU[ii * nvars + k] *= factor;
+               for (jj = k + 1; jj < nvars; jj++)
+               {
+                  LU[ii * nvars + jj] -= LU[ii * nvars + k] * LU[k * nvars + jj];
+               }
+            }
+         }
+
+         if (singular)
+         {
+            num_singular++;
+         }
+         else
+         {
+            /* invert column by column */
+            for (col = 0; col < nvars; col++)
+            {
+               for (ii = 0; ii < nvars; ii++)
+               {
+                  e_loc[ii] = (ii == col) ? 1.0 : 0.0;
+               }
+               for (k = 0; k < nvars - 1; k++)
+               {
+                  for (ii = k + 1; ii < nvars; ii++)
+                  {
+                     e_loc[ii] -= LU[ii * nvars + k] * e_loc[k];
+                  }
+               }
+               for (k = nvars - 1; k >= 0; k--)
+               {
+                  e_loc[k] /= LU[k * nvars + k];
+                  for (ii = 0; ii < k; ii++)
+                  {
+                     e_loc[ii] -= e_loc[k] * LU[ii * nvars + k];
+                  }
+               }
+               for (ii = 0; ii < nvars; ii++)
+               {
+                  D_loc[ii * nvars + col] = e_loc[ii];
+               }
+            }
+         }
+      }
+      zypre_BoxLoop1ReductionEnd(Ai, num_singular);
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+   }
+
+   if (num_singular)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Singular intra-nodal block in nodal relaxation; those points are not relaxed");
+   }
+
+   (relax_data -> Dinv)         = Dinv;
+   (relax_data -> Dinv_offsets) = Dinv_offsets;
+   (relax_data -> term_starts)  = term_starts;
+   (relax_data -> term_vars)    = term_vars;
+   (relax_data -> term_entries) = term_entries;
+   (relax_data -> term_Ap)      = hypre_TAlloc(HYPRE_Real *, nterms, HYPRE_MEMORY_HOST);
+   (relax_data -> term_xp)      = hypre_TAlloc(HYPRE_Real *, nterms, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -296,6 +527,11 @@ hypre_NodeRelaxSetup(  void                 *relax_vdata,
    A_loc = hypre_TAlloc(HYPRE_Real  , i*nvars*nvars, memory_location);
    */
 
+   if (hypre_GetExecPolicy1(memory_location) == HYPRE_EXEC_HOST)
+   {
+      hypre_NodeRelaxSetupBlocks(relax_data, A, diag_rank);
+   }
+
    /* Allocate pointers for vector and matrix */
    bp = hypre_TAlloc(HYPRE_Real *, nvars, memory_location);
    xp = hypre_TAlloc(HYPRE_Real *, nvars, memory_location);
@@ -582,6 +818,15 @@ hypre_NodeRelax(  void                 *relax_vdata,
    HYPRE_Real          **bp = (relax_data -> bp);
    HYPRE_Real          **xp = (relax_data -> xp);
    HYPRE_Real          **tp = (relax_data -> tp);
+   HYPRE_Real           *Dinv         = (relax_data -> Dinv);
+   HYPRE_Int            *Dinv_offsets = (relax_data -> Dinv_offsets);
+   HYPRE_Int            *term_starts  = (relax_data -> term_starts);
+   HYPRE_Int            *term_vars    = (relax_data -> term_vars);
+   HYPRE_Int            *term_entries = (relax_data -> term_entries);
+   HYPRE_Real          **term_Ap      = (relax_data -> term_Ap);
+   HYPRE_Real          **term_xp      = (relax_data -> term_xp);
+   HYPRE_Real           *Dp;
+   HYPRE_Int             k;
    HYPRE_Real           *_h_Ap[HYPRE_MAXVARS * HYPRE_MAXVARS];
    HYPRE_Real           *_h_bp[HYPRE_MAXVARS];
    HYPRE_Real           *_h_xp[HYPRE_MAXVARS];
@@ -734,6 +979,38 @@ hypre_NodeRelax(  void                 *relax_vdata,
                start = hypre_BoxIMin(compute_box);
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
+               /* x = inv(D) b with the precomputed block inverses */
+               if (Dinv)
+               {
+                  Dp = Dinv + Dinv_offsets[i];
+                  zypre_BoxLoop3Begin(ndim, loop_size,
+                                      A_data_box, start, stride, Ai,
+                                      b_data_box, start, stride, bi,
+                                      x_data_box, start, stride, xi);
+                  {
+                     HYPRE_Real *D_loc = Dp + Ai * nvars * nvars;
+                     HYPRE_Real  b_loc[HYPRE_MAXVARS];
+                     HYPRE_Real  sum;
+                     HYPRE_Int   ii, jj;
+
+                     for (ii = 0; ii < nvars; ii++)
+                     {
+                        b_loc[ii] = h_bp[ii][bi];
+                     }
+                     for (ii = 0; ii < nvars; ii++)
+                     {
+                        sum = 0.0;
+                        for (jj = 0; jj < nvars; jj++)
+                        {
+                           sum += D_loc[ii * nvars + jj] * b_loc[jj];
+                        }
+                        h_xp[ii][xi] = sum;
+                     }
+                  }
+                  zypre_BoxLoop3End(Ai, bi, xi);
+                  continue;
+               }
+
 #define DEVICE_VAR is_device_ptr(bp,Ap,xp)
                hypre_BoxLoop3Begin(ndim, loop_size,
                                    A_data_box, start, stride, Ai,
@@ -864,6 +1141,58 @@ hypre_NodeRelax(  void                 *relax_vdata,
                start  = hypre_BoxIMin(compute_box);
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
+               /* t = inv(D) (b - L x - U x) in one sweep, all variables of
+                * a point together, with the precomputed block inverses */
+               if (Dinv)
+               {
+                  for (vi = 0; vi < nvars; vi++)
+                  {
+                     for (k = term_starts[vi]; k < term_starts[vi + 1]; k++)
+                     {
+                        vj = term_vars[k];
+                        A_block = hypre_SStructPMatrixSMatrix(A, vi, vj);
+                        stencil_shape = hypre_StructStencilShape(hypre_StructMatrixStencil(A_block));
+                        term_Ap[k] = hypre_StructMatrixBoxData(A_block, i, term_entries[k]);
+                        term_xp[k] = hypre_StructVectorBoxData(hypre_SStructPVectorSVector(x, vj), i) +
+                                     hypre_BoxOffsetDistance(x_data_box, stencil_shape[term_entries[k]]);
+                     }
+                  }
+
+                  Dp = Dinv + Dinv_offsets[i];
+                  zypre_BoxLoop4Begin(ndim, loop_size,
+                                      A_data_box, start, stride, Ai,
+                                      b_data_box, start, stride, bi,
+                                      x_data_box, start, stride, xi,
+                                      t_data_box, start, stride, ti);
+                  {
+                     HYPRE_Real *D_loc = Dp + Ai * nvars * nvars;
+                     HYPRE_Real  r_loc[HYPRE_MAXVARS];
+                     HYPRE_Real  sum;
+                     HYPRE_Int   ii, jj, tt;
+
+                     for (ii = 0; ii < nvars; ii++)
+                     {
+                        sum = h_bp[ii][bi];
+                        for (tt = term_starts[ii]; tt < term_starts[ii + 1]; tt++)
+                        {
+                           sum -= term_Ap[tt][Ai] * term_xp[tt][xi];
+                        }
+                        r_loc[ii] = sum;
+                     }
+                     for (ii = 0; ii < nvars; ii++)
+                     {
+                        sum = 0.0;
+                        for (jj = 0; jj < nvars; jj++)
+                        {
+                           sum += D_loc[ii * nvars + jj] * r_loc[jj];
+                        }
+                        h_tp[ii][ti] = sum;
+                     }
+                  }
+                  zypre_BoxLoop4End(Ai, bi, xi, ti);
+                  continue;
+               }
+
 #define DEVICE_VAR is_device_ptr(tp,bp)
                hypre_BoxLoop2Begin(ndim, loop_size,
                                    b_data_box, start, stride, bi,
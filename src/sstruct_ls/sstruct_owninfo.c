@@ -42,6 +42,10 @@ hypre_SStructIndexScaleC_F( hypre_Index cindex,
 /*--------------------------------------------------------------------------
  * hypre_SStructOwnInfo: Given a fgrid, coarsen each fbox and find the
  * coarsened boxes that belong on my current processor. These are my own_boxes.
+ *
+ * If composite_cboxes is non-NULL, it holds the own_composite_cboxes of each
+ * cbox of cgrid (e.g., from the FAC c/f cache) and these are copied instead of
+ * being computed.
  *--------------------------------------------------------------------------*/
 
 hypre_SStructOwnInfoData *
@@ -49,7 +53,8 @@ hypre_SStructOwnInfo( hypre_StructGrid  *fgrid,
                       hypre_StructGrid  *cgrid,
                       hypre_BoxManager  *cboxman,
                       hypre_BoxManager  *fboxman,
-                      hypre_Index        rfactor )
+                      hypre_Index        rfactor,
+                      hypre_BoxArray   **composite_cboxes )
 {
    hypre_SStructOwnInfoData *owninfo_data;
 
@@ -163,6 +168,18 @@ hypre_SStructOwnInfo( hypre_StructGrid  *fgrid,
    own_composite_cboxes = hypre_BoxArrayArrayCreate(hypre_BoxArraySize(grid_boxes), ndim);
    (owninfo_data -> own_composite_size) = hypre_BoxArraySize(grid_boxes);
 
+   if (composite_cboxes)
+   {
+      hypre_ForBoxI(i, grid_boxes)
+      {
+         hypre_AppendBoxArray(composite_cboxes[i],
+                              hypre_BoxArrayArrayBoxArray(own_composite_cboxes, i));
+      }
+      (owninfo_data -> own_composite_cboxes) = own_composite_cboxes;
+
+      return owninfo_data;
+   }
+
    tmp_boxarray = hypre_BoxArrayCreate(0, ndim);
    hypre_ForBoxI(i, grid_boxes)
    {
@@ -347,6 +347,11 @@ HYPRE_SStructGraphAssemble( HYPRE_SStructGraph graph )
    HYPRE_Int                 to_proc;
    HYPRE_BigInt              Uverank, rank;
    hypre_BoxManEntry        *boxman_entry;
+   HYPRE_BigInt             *Uveranks;
+   HYPRE_Int                *lookup_parts, *lookup_vars;
+   hypre_IndexRef           *lookup_indexes;
+   hypre_BoxManEntry       **from_entries, **to_entries;
+   HYPRE_Int                 nlookups;
 
    HYPRE_Int                 nprocs, myproc;
    HYPRE_Int                 part, var;
@@ -358,6 +363,7 @@ HYPRE_SStructGraphAssemble( HYPRE_SStructGraph graph )
    hypre_BoxManager        ***new_managers = NULL;
    hypre_BoxManager          *orig_boxman;
    hypre_BoxManager          *new_boxman;
+   hypre_StructAssumedPart   *ap;
 
    HYPRE_Int                  global_n_add_entries;
    HYPRE_Int                  is_gather, k;
@@ -504,6 +510,13 @@ HYPRE_SStructGraphAssemble( HYPRE_SStructGraph graph )
 
                orig_boxman = managers[part][var];
 
+               /* the new boxman gets the same local entries, so the assumed
+                  partition of the orig boxman is still valid - move it over
+                  instead of creating a new one in the assemble */
+               hypre_BoxManGetAssumedPartition(orig_boxman, &ap);
+               hypre_BoxManSetAssumedPartition(new_boxman, ap);
+               hypre_BoxManSetAssumedPartition(orig_boxman, NULL);
+
                hypre_BoxManGetAllEntries(orig_boxman, &num_entries, &all_entries);
 
                for (j = 0; j < num_entries; j++)
@@ -602,6 +615,52 @@ HYPRE_SStructGraphAssemble( HYPRE_SStructGraph graph )
    hypre_SStructGraphIUVEntries(graph) = iUventries;
    hypre_SStructGraphUVEntries(graph)  = Uventries;
 
+   /* compute the location (rank) of each Uventry, then look up the box
+      manager entries for all of them with batched intersections */
+   Uveranks       = hypre_TAlloc(HYPRE_BigInt, n_add_entries, HYPRE_MEMORY_HOST);
+   lookup_parts   = hypre_TAlloc(HYPRE_Int, n_add_entries, HYPRE_MEMORY_HOST);
+   lookup_vars    = hypre_TAlloc(HYPRE_Int, n_add_entries, HYPRE_MEMORY_HOST);
+   lookup_indexes = hypre_TAlloc(hypre_IndexRef, n_add_entries, HYPRE_MEMORY_HOST);
+   from_entries   = hypre_TAlloc(hypre_BoxManEntry *, n_add_entries, HYPRE_MEMORY_HOST);
+   to_entries     = hypre_TAlloc(hypre_BoxManEntry *, n_add_entries, HYPRE_MEMORY_HOST);
+
+   nlookups = 0;
+   for (j = 0; j < n_add_entries; j++)
+   {
+      new_entry = add_entries[j];
+
+      part = hypre_SStructGraphEntryPart(new_entry);
+      var = hypre_SStructGraphEntryVar(new_entry);
+      index = hypre_SStructGraphEntryIndex(new_entry);
+      hypre_SStructGraphGetUVEntryRank(graph, part, var, index, &Uveranks[j]);
+
+      if (Uveranks[j] > -1)
+      {
+         lookup_parts[nlookups]   = part;
+         lookup_vars[nlookups]    = var;
+         lookup_indexes[nlookups] = index;
+         nlookups++;
+      }
+   }
+   hypre_SStructGridFindBoxManEntries(grid, nlookups, lookup_parts, lookup_vars,
+                                      lookup_indexes, from_entries);
+
+   nlookups = 0;
+   for (j = 0; j < n_add_entries; j++)
+   {
+      if (Uveranks[j] > -1)
+      {
+         new_entry = add_entries[j];
+
+         lookup_parts[nlookups]   = hypre_SStructGraphEntryToPart(new_entry);
+         lookup_vars[nlookups]    = hypre_SStructGraphEntryToVar(new_entry);
+         lookup_indexes[nlookups] = hypre_SStructGraphEntryToIndex(new_entry);
+         nlookups++;
+      }
+   }
+   hypre_SStructGridFindBoxManEntries(dom_grid, nlookups, lookup_parts, lookup_vars,
+                                      lookup_indexes, to_entries);
+
    nUventries = 0;
 
    /* go through each entry that was added */
@@ -616,8 +675,7 @@ HYPRE_SStructGraphAssemble( HYPRE_SStructGraph graph )
       to_var =  hypre_SStructGraphEntryToVar(new_entry);
       to_index = hypre_SStructGraphEntryToIndex(new_entry);
 
-      /* compute location (rank) for Uventry */
-      hypre_SStructGraphGetUVEntryRank(graph, part, var, index, &Uverank);
+      Uverank = Uveranks[j];
 
       if (Uverank > -1)
       {
@@ -629,7 +687,7 @@ HYPRE_SStructGraphAssemble( HYPRE_SStructGraph graph )
             hypre_SStructUVEntryPart(Uventry) = part;
             hypre_CopyIndex(index, hypre_SStructUVEntryIndex(Uventry));
             hypre_SStructUVEntryVar(Uventry) = var;
-            hypre_SStructGridFindBoxManEntry(grid, part, index, var, &boxman_entry);
+            boxman_entry = from_entries[nUventries];
             hypre_SStructBoxManEntryGetGlobalRank(boxman_entry, index, &rank, type);
             hypre_SStructUVEntryRank(Uventry) = rank;
             nUentries = 1;
@@ -652,8 +710,7 @@ HYPRE_SStructGraphAssemble( HYPRE_SStructGraph graph )
          hypre_CopyIndex(to_index, hypre_SStructUVEntryToIndex(Uventry, i));
          hypre_SStructUVEntryToVar(Uventry, i) = to_var;
 
-         hypre_SStructGridFindBoxManEntry(
-            dom_grid, to_part, to_index, to_var, &boxman_entry);
+         boxman_entry = to_entries[nUventries];
          hypre_SStructBoxManEntryGetBoxnum(boxman_entry, &to_boxnum);
          hypre_SStructUVEntryToBoxnum(Uventry, i) = to_boxnum;
          hypre_SStructBoxManEntryGetProcess(boxman_entry, &to_proc);
@@ -671,6 +728,13 @@ HYPRE_SStructGraphAssemble( HYPRE_SStructGraph graph )
       }
    } /* end of loop through add entries */
 
+   hypre_TFree(Uveranks, HYPRE_MEMORY_HOST);
+   hypre_TFree(lookup_parts, HYPRE_MEMORY_HOST);
+   hypre_TFree(lookup_vars, HYPRE_MEMORY_HOST);
+   hypre_TFree(lookup_indexes, HYPRE_MEMORY_HOST);
+   hypre_TFree(from_entries, HYPRE_MEMORY_HOST);
+   hypre_TFree(to_entries, HYPRE_MEMORY_HOST);
+
    /*---------------------------------------------------------
     * Set up the FEM stencil information
     *---------------------------------------------------------*/
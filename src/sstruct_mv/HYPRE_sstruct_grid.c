@@ -80,6 +80,8 @@ HYPRE_SStructGridCreate( MPI_Comm           comm,
    /* GEC0902 ghost addition to the grid    */
    hypre_SStructGridGhlocalSize(grid)   = 0;
 
+   hypre_SStructGridPrevGrid(grid)      = NULL;
+
    /* Initialize num ghost */
    for (i = 0; i < 2 * ndim; i++)
    {
@@ -173,6 +175,7 @@ HYPRE_SStructGridDestroy( HYPRE_SStructGrid grid )
          hypre_TFree(vnbor_comm_info, HYPRE_MEMORY_HOST);
          hypre_TFree(managers, HYPRE_MEMORY_HOST);
          hypre_TFree(nbor_managers, HYPRE_MEMORY_HOST);
+         HYPRE_SStructGridDestroy(hypre_SStructGridPrevGrid(grid));
          hypre_TFree(grid, HYPRE_MEMORY_HOST);
       }
    }
@@ -202,6 +205,49 @@ HYPRE_SStructGridSetExtents( HYPRE_SStructGrid  grid,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructGridRemoveExtents( HYPRE_SStructGrid  grid,
+                                HYPRE_Int          part,
+                                HYPRE_Int         *ilower,
+                                HYPRE_Int         *iupper )
+{
+   HYPRE_Int            ndim  = hypre_SStructGridNDim(grid);
+   hypre_SStructPGrid  *pgrid = hypre_SStructGridPGrid(grid, part);
+   hypre_StructGrid    *sgrid = hypre_SStructPGridCellSGrid(pgrid);
+   hypre_BoxArray      *boxes = hypre_StructGridBoxes(sgrid);
+   hypre_Box           *box;
+   hypre_Index          cilower;
+   hypre_Index          ciupper;
+   HYPRE_Int            i;
+
+   if (hypre_StructGridBoxMan(sgrid) != NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Grid is already assembled!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_CopyToCleanIndex(ilower, ndim, cilower);
+   hypre_CopyToCleanIndex(iupper, ndim, ciupper);
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if ( hypre_IndexesEqual(hypre_BoxIMin(box), cilower, ndim) &&
+           hypre_IndexesEqual(hypre_BoxIMax(box), ciupper, ndim) )
+      {
+         hypre_DeleteBox(boxes, i);
+         return hypre_error_flag;
+      }
+   }
+
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Box to remove is not in the grid!\n");
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -850,6 +896,99 @@ HYPRE_SStructGridAssemble( HYPRE_SStructGrid grid )
 
    hypre_SStructGridCreateCommInfo(grid);
 
+   /* the assumed partitions of a previous grid are no longer needed */
+   HYPRE_SStructGridDestroy(hypre_SStructGridPrevGrid(grid));
+   hypre_SStructGridPrevGrid(grid) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * The box managers of the new grid are assembled with assumed partitions
+ * updated from those of the old grid (see hypre_SStructGridAssembleBoxManagers),
+ * so the old grid is referenced until the new one is assembled.  Box manager
+ * entries and ranks are rebuilt, and graphs must be re-created on the new grid.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructGridRegrid( HYPRE_SStructGrid  grid,
+                         HYPRE_SStructGrid *new_grid_ptr )
+{
+   MPI_Comm                 comm     = hypre_SStructGridComm(grid);
+   HYPRE_Int                ndim     = hypre_SStructGridNDim(grid);
+   HYPRE_Int                nparts   = hypre_SStructGridNParts(grid);
+   HYPRE_Int                memchunk = 10;
+   hypre_SStructGrid       *new_grid;
+   hypre_SStructPGrid      *pgrid, *new_pgrid;
+   hypre_BoxArray          *boxes;
+   hypre_Box               *box;
+   HYPRE_Int                part, nneighbors, fem_nvars, alloc, i;
+
+   if (hypre_SStructGridBoxManagers(grid) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Grid is not assembled!\n");
+      return hypre_error_flag;
+   }
+
+   HYPRE_SStructGridCreate(comm, ndim, nparts, &new_grid);
+   hypre_SStructGridSetNumGhost(new_grid, hypre_SStructGridNumGhost(grid));
+
+   for (part = 0; part < nparts; part++)
+   {
+      pgrid     = hypre_SStructGridPGrid(grid, part);
+      new_pgrid = hypre_SStructGridPGrid(new_grid, part);
+
+      hypre_SStructPGridSetVariables(new_pgrid, hypre_SStructPGridNVars(pgrid),
+                                     hypre_SStructPGridVarTypes(pgrid));
+      hypre_CopyIndex(hypre_SStructPGridPeriodic(pgrid),
+                      hypre_SStructPGridPeriodic(new_pgrid));
+
+      boxes = hypre_StructGridBoxes(hypre_SStructPGridCellSGrid(pgrid));
+      hypre_ForBoxI(i, boxes)
+      {
+         box = hypre_BoxArrayBox(boxes, i);
+         hypre_SStructPGridSetExtents(new_pgrid, hypre_BoxIMin(box), hypre_BoxIMax(box));
+      }
+
+      /* keep the allocation in multiples of memchunk, as in SetNeighborPart */
+      nneighbors = hypre_SStructGridNNeighbors(grid)[part];
+      if (nneighbors > 0)
+      {
+         alloc = ((nneighbors + memchunk - 1) / memchunk) * memchunk;
+         hypre_SStructGridNeighbors(new_grid)[part] =
+            hypre_TAlloc(hypre_SStructNeighbor, alloc, HYPRE_MEMORY_HOST);
+         hypre_SStructGridNborOffsets(new_grid)[part] =
+            hypre_TAlloc(hypre_Index, alloc, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(hypre_SStructGridNeighbors(new_grid)[part],
+                       hypre_SStructGridNeighbors(grid)[part], hypre_SStructNeighbor,
+                       nneighbors, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(hypre_SStructGridNborOffsets(new_grid)[part],
+                       hypre_SStructGridNborOffsets(grid)[part], hypre_Index,
+                       nneighbors, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_SStructGridNNeighbors(new_grid)[part] = nneighbors;
+      }
+
+      fem_nvars = hypre_SStructGridFEMPNVars(grid, part);
+      if (fem_nvars > 0)
+      {
+         hypre_SStructGridFEMPVars(new_grid, part) =
+            hypre_TAlloc(HYPRE_Int, fem_nvars, HYPRE_MEMORY_HOST);
+         hypre_SStructGridFEMPOffsets(new_grid, part) =
+            hypre_TAlloc(hypre_Index, fem_nvars, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(hypre_SStructGridFEMPVars(new_grid, part),
+                       hypre_SStructGridFEMPVars(grid, part), HYPRE_Int,
+                       fem_nvars, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(hypre_SStructGridFEMPOffsets(new_grid, part),
+                       hypre_SStructGridFEMPOffsets(grid, part), hypre_Index,
+                       fem_nvars, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_SStructGridFEMPNVars(new_grid, part) = fem_nvars;
+      }
+   }
+
+   hypre_SStructGridRef(grid, &hypre_SStructGridPrevGrid(new_grid));
+
+   *new_grid_ptr = new_grid;
+
    return hypre_error_flag;
 }
 
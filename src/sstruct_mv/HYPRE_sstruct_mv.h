@@ -326,6 +326,48 @@ HYPRE_Int
 HYPRE_SStructGridSetNumGhost(HYPRE_SStructGrid  grid,
                              HYPRE_Int         *num_ghost);
 
+/**
+ * Create a new grid from an assembled grid \e grid, e.g., after a regrid of an
+ * adaptive mesh refinement hierarchy.  The new grid starts out unassembled
+ * with the parts, variables, neighbor parts, periodicity, ghost layers, FEM
+ * ordering and local boxes of \e grid.  Boxes may then be added with
+ * \ref HYPRE_SStructGridSetExtents and removed with
+ * \ref HYPRE_SStructGridRemoveExtents before calling
+ * \ref HYPRE_SStructGridAssemble.
+ *
+ * On assembly, the assumed partitions of the box managers of \e grid are
+ * updated with the local box changes instead of being recomputed, which saves
+ * the global reductions and region refinement of a full assembly.  Only
+ * processes whose boxes changed communicate, and only with the owners of the
+ * affected assumed regions.  When some new box lies outside of the old assumed
+ * regions, new assumed partitions are created as usual.
+ *
+ * Only the assumed partitions are updated incrementally.  The box manager
+ * entries, global ranks and communication information of the new grid are
+ * rebuilt as in a full assembly, and existing box manager entries are never
+ * updated in place.  Graphs, matrices and vectors are not carried over to the
+ * new grid: they must be created on it and assembled from scratch, since
+ * inserting or removing graph entries for changed boxes is not supported.
+ *
+ * Both grids may be used (and must be destroyed) independently.  Neighbor
+ * parts that were dropped when \e grid was assembled, because this process had
+ * no boxes on the part, are not carried over and must be set again.
+ **/
+HYPRE_Int
+HYPRE_SStructGridRegrid(HYPRE_SStructGrid  grid,
+                        HYPRE_SStructGrid *new_grid);
+
+/**
+ * Remove a box that was set with \ref HYPRE_SStructGridSetExtents (or carried
+ * over by \ref HYPRE_SStructGridRegrid) from a structured part of an
+ * unassembled grid.  The extents must match those of the box exactly.
+ **/
+HYPRE_Int
+HYPRE_SStructGridRemoveExtents(HYPRE_SStructGrid  grid,
+                               HYPRE_Int          part,
+                               HYPRE_Int         *ilower,
+                               HYPRE_Int         *iupper);
+
 /**@}*/
 
 /*--------------------------------------------------------------------------
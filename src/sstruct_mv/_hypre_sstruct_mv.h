@@ -181,6 +181,10 @@ typedef struct hypre_SStructGrid_struct
    HYPRE_BigInt            ghstart_rank;  /* GEC0902 start rank including ghosts  */
    HYPRE_Int               num_ghost[2 * HYPRE_MAXDIM]; /* ghost layer size */
 
+   /* assembled grid this one was created from (see HYPRE_SStructGridRegrid);
+      only kept until this grid is assembled */
+   struct hypre_SStructGrid_struct *prev_grid;
+
 } hypre_SStructGrid;
 
 /*--------------------------------------------------------------------------
@@ -223,6 +227,7 @@ typedef struct hypre_SStructGrid_struct
 #define hypre_SStructGridGhlocalSize(grid)    ((grid) -> ghlocal_size)
 #define hypre_SStructGridGhstartRank(grid)    ((grid) -> ghstart_rank)
 #define hypre_SStructGridNumGhost(grid)       ((grid) -> num_ghost)
+#define hypre_SStructGridPrevGrid(grid)       ((grid) -> prev_grid)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructPGrid
@@ -810,6 +815,8 @@ HYPRE_Int HYPRE_SStructGridCreate ( MPI_Comm comm, HYPRE_Int ndim, HYPRE_Int npa
 HYPRE_Int HYPRE_SStructGridDestroy ( HYPRE_SStructGrid grid );
 HYPRE_Int HYPRE_SStructGridSetExtents ( HYPRE_SStructGrid grid, HYPRE_Int part, HYPRE_Int *ilower,
                                         HYPRE_Int *iupper );
+HYPRE_Int HYPRE_SStructGridRemoveExtents ( HYPRE_SStructGrid grid, HYPRE_Int part,
+                                           HYPRE_Int *ilower, HYPRE_Int *iupper );
 HYPRE_Int HYPRE_SStructGridSetVariables ( HYPRE_SStructGrid grid, HYPRE_Int part, HYPRE_Int nvars,
                                           HYPRE_SStructVariable *vartypes );
 HYPRE_Int HYPRE_SStructGridAddVariables ( HYPRE_SStructGrid grid, HYPRE_Int part, HYPRE_Int *index,
@@ -829,6 +836,7 @@ HYPRE_Int HYPRE_SStructGridAssemble ( HYPRE_SStructGrid grid );
 HYPRE_Int HYPRE_SStructGridSetPeriodic ( HYPRE_SStructGrid grid, HYPRE_Int part,
                                          HYPRE_Int *periodic );
 HYPRE_Int HYPRE_SStructGridSetNumGhost ( HYPRE_SStructGrid grid, HYPRE_Int *num_ghost );
+HYPRE_Int HYPRE_SStructGridRegrid ( HYPRE_SStructGrid grid, HYPRE_SStructGrid *new_grid_ptr );
 
 /* HYPRE_sstruct_matrix.c */
 HYPRE_Int HYPRE_SStructMatrixCreate ( MPI_Comm comm, HYPRE_SStructGraph graph,
@@ -957,6 +965,9 @@ HYPRE_Int hypre_SStructGridFindBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int
                                              hypre_Index index, HYPRE_Int var, hypre_BoxManEntry **entry_ptr );
 HYPRE_Int hypre_SStructGridFindNborBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int part,
                                                  hypre_Index index, HYPRE_Int var, hypre_BoxManEntry **entry_ptr );
+HYPRE_Int hypre_SStructGridFindBoxManEntries ( hypre_SStructGrid *grid, HYPRE_Int nindexes,
+                                               HYPRE_Int *parts, HYPRE_Int *vars, hypre_IndexRef *indexes,
+                                               hypre_BoxManEntry **entries );
 HYPRE_Int hypre_SStructGridBoxProcFindBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int part,
                                                     HYPRE_Int var, HYPRE_Int box, HYPRE_Int proc, hypre_BoxManEntry **entry_ptr );
 HYPRE_Int hypre_SStructBoxManEntryGetCSRstrides ( hypre_BoxManEntry *entry, hypre_Index strides );
@@ -1021,6 +1032,7 @@ HYPRE_Int hypre_SStructPMatrixSetSymmetric ( hypre_SStructPMatrix *pmatrix, HYPR
 HYPRE_Int hypre_SStructPMatrixPrint ( const char *filename, hypre_SStructPMatrix *pmatrix,
                                       HYPRE_Int all );
 HYPRE_Int hypre_SStructUMatrixInitialize ( hypre_SStructMatrix *matrix );
+HYPRE_Int hypre_SStructUMatrixBuildParCSR ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructUMatrixSetValues ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                           hypre_Index index, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Complex *values,
                                           HYPRE_Int action );
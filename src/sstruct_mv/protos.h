@@ -30,6 +30,8 @@ HYPRE_Int HYPRE_SStructGridCreate ( MPI_Comm comm, HYPRE_Int ndim, HYPRE_Int npa
 HYPRE_Int HYPRE_SStructGridDestroy ( HYPRE_SStructGrid grid );
 HYPRE_Int HYPRE_SStructGridSetExtents ( HYPRE_SStructGrid grid, HYPRE_Int part, HYPRE_Int *ilower,
                                         HYPRE_Int *iupper );
+HYPRE_Int HYPRE_SStructGridRemoveExtents ( HYPRE_SStructGrid grid, HYPRE_Int part,
+                                           HYPRE_Int *ilower, HYPRE_Int *iupper );
 HYPRE_Int HYPRE_SStructGridSetVariables ( HYPRE_SStructGrid grid, HYPRE_Int part, HYPRE_Int nvars,
                                           HYPRE_SStructVariable *vartypes );
 HYPRE_Int HYPRE_SStructGridAddVariables ( HYPRE_SStructGrid grid, HYPRE_Int part, HYPRE_Int *index,
@@ -49,6 +51,7 @@ HYPRE_Int HYPRE_SStructGridAssemble ( HYPRE_SStructGrid grid );
 HYPRE_Int HYPRE_SStructGridSetPeriodic ( HYPRE_SStructGrid grid, HYPRE_Int part,
                                          HYPRE_Int *periodic );
 HYPRE_Int HYPRE_SStructGridSetNumGhost ( HYPRE_SStructGrid grid, HYPRE_Int *num_ghost );
+HYPRE_Int HYPRE_SStructGridRegrid ( HYPRE_SStructGrid grid, HYPRE_SStructGrid *new_grid_ptr );
 
 /* HYPRE_sstruct_matrix.c */
 HYPRE_Int HYPRE_SStructMatrixCreate ( MPI_Comm comm, HYPRE_SStructGraph graph,
@@ -177,6 +180,9 @@ HYPRE_Int hypre_SStructGridFindBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int
                                              hypre_Index index, HYPRE_Int var, hypre_BoxManEntry **entry_ptr );
 HYPRE_Int hypre_SStructGridFindNborBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int part,
                                                  hypre_Index index, HYPRE_Int var, hypre_BoxManEntry **entry_ptr );
+HYPRE_Int hypre_SStructGridFindBoxManEntries ( hypre_SStructGrid *grid, HYPRE_Int nindexes,
+                                               HYPRE_Int *parts, HYPRE_Int *vars, hypre_IndexRef *indexes,
+                                               hypre_BoxManEntry **entries );
 HYPRE_Int hypre_SStructGridBoxProcFindBoxManEntry ( hypre_SStructGrid *grid, HYPRE_Int part,
                                                     HYPRE_Int var, HYPRE_Int box, HYPRE_Int proc, hypre_BoxManEntry **entry_ptr );
 HYPRE_Int hypre_SStructBoxManEntryGetCSRstrides ( hypre_BoxManEntry *entry, hypre_Index strides );
@@ -241,6 +247,7 @@ HYPRE_Int hypre_SStructPMatrixSetSymmetric ( hypre_SStructPMatrix *pmatrix, HYPR
 HYPRE_Int hypre_SStructPMatrixPrint ( const char *filename, hypre_SStructPMatrix *pmatrix,
                                       HYPRE_Int all );
 HYPRE_Int hypre_SStructUMatrixInitialize ( hypre_SStructMatrix *matrix );
+HYPRE_Int hypre_SStructUMatrixBuildParCSR ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructUMatrixSetValues ( hypre_SStructMatrix *matrix, HYPRE_Int part,
                                           hypre_Index index, HYPRE_Int var, HYPRE_Int nentries, HYPRE_Int *entries, HYPRE_Complex *values,
                                           HYPRE_Int action );
@@ -474,6 +474,8 @@ hypre_SStructGridAssembleBoxManagers( hypre_SStructGrid *grid )
    HYPRE_Int                  info_size;
    HYPRE_BigInt               box_offset, ghbox_offset;
 
+   hypre_SStructGrid         *prev_grid;
+
    /*------------------------------------------------------
     * Build box manager info for grid boxes
     *------------------------------------------------------*/
@@ -699,6 +701,78 @@ hypre_SStructGridAssembleBoxManagers( hypre_SStructGrid *grid )
       hypre_BoxArrayDestroy(local_boxes);
    }
 
+   /* if this grid was created from an assembled one, update the assumed
+      partitions of the old box managers with the changes to the local boxes
+      instead of letting the assembles create new ones (only the assumed
+      partitions are reused; the entries, global ranks and comm info are
+      still computed from scratch below and in the assembles) */
+   prev_grid = hypre_SStructGridPrevGrid(grid);
+   if (prev_grid != NULL)
+   {
+      hypre_StructAssumedPart  *ap, *new_ap;
+      hypre_BoxArray           *old_boxes, *new_boxes;
+      HYPRE_Int                *boxnums;
+      HYPRE_Int                 i;
+
+      old_boxes = hypre_BoxArrayCreate(0, ndim);
+      new_boxes = hypre_BoxArrayCreate(0, ndim);
+
+      for (part = 0; part < nparts; part++)
+      {
+         pgrid = hypre_SStructGridPGrid(grid, part);
+         nvars = hypre_SStructPGridNVars(pgrid);
+
+         for (var = 0; var < nvars; var++)
+         {
+            hypre_BoxManGetAssumedPartition(
+               hypre_SStructGridBoxManager(prev_grid, part, var), &ap);
+            if (ap == NULL)
+            {
+               continue;
+            }
+
+            /* local entries are numbered consecutively in both grids */
+            hypre_BoxManGetLocalEntriesBoxes(
+               hypre_SStructGridBoxManager(prev_grid, part, var), old_boxes);
+
+            sgrid = hypre_SStructPGridSGrid(pgrid, var);
+            hypre_BoxManGetAllEntries(hypre_StructGridBoxMan(sgrid),
+                                      &num_entries, &all_entries);
+            hypre_BoxArraySetSize(new_boxes, 0);
+            for (b = 0; b < num_entries; b++)
+            {
+               entry = &all_entries[b];
+               if (hypre_BoxManEntryProc(entry) == myproc)
+               {
+                  hypre_BoxSetExtents(box, hypre_BoxManEntryIMin(entry),
+                                      hypre_BoxManEntryIMax(entry));
+                  hypre_AppendBox(box, new_boxes);
+               }
+            }
+
+            b = hypre_max(hypre_BoxArraySize(old_boxes),
+                          hypre_BoxArraySize(new_boxes));
+            boxnums = hypre_TAlloc(HYPRE_Int, b, HYPRE_MEMORY_HOST);
+            for (i = 0; i < b; i++)
+            {
+               boxnums[i] = i;
+            }
+
+            hypre_StructAssumedPartitionUpdate(ap, old_boxes, boxnums,
+                                               new_boxes, boxnums, comm, &new_ap);
+            if (new_ap != NULL)
+            {
+               hypre_BoxManSetAssumedPartition(managers[part][var], new_ap);
+            }
+
+            hypre_TFree(boxnums, HYPRE_MEMORY_HOST);
+         }
+      }
+
+      hypre_BoxArrayDestroy(old_boxes);
+      hypre_BoxArrayDestroy(new_boxes);
+   }
+
    /* now call the assembles */
    for (part = 0; part < nparts; part++)
    {
@@ -1518,6 +1592,125 @@ hypre_SStructGridFindNborBoxManEntry( hypre_SStructGrid  *grid,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Batched version of hypre_SStructGridFindBoxManEntry.  On return, entries[i]
+ * is the box manager entry containing index indexes[i] of variable vars[i] on
+ * part parts[i] (NULL if no entry is found).  The indexes are bucketed by
+ * part and variable so that each box manager is searched in one traversal.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructGridFindBoxManEntries( hypre_SStructGrid  *grid,
+                                    HYPRE_Int           nindexes,
+                                    HYPRE_Int          *parts,
+                                    HYPRE_Int          *vars,
+                                    hypre_IndexRef     *indexes,
+                                    hypre_BoxManEntry **entries )
+{
+   HYPRE_Int            ndim   = hypre_SStructGridNDim(grid);
+   HYPRE_Int            nparts = hypre_SStructGridNParts(grid);
+   HYPRE_Int           *var_offsets;
+   HYPRE_Int           *bucket_offsets;
+   HYPRE_Int           *bucket_counts;
+   HYPRE_Int           *bucket;
+   HYPRE_Int            nbuckets;
+   hypre_BoxArray      *boxes;
+   HYPRE_Int           *offsets;
+   hypre_BoxManEntry  **found;
+   HYPRE_Int            part, var, nvars;
+   HYPRE_Int            i, j, k, n, nfound;
+
+   if (nindexes == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* bucket the indexes by (part, var) */
+   var_offsets = hypre_TAlloc(HYPRE_Int, nparts + 1, HYPRE_MEMORY_HOST);
+   var_offsets[0] = 0;
+   for (part = 0; part < nparts; part++)
+   {
+      nvars = hypre_SStructPGridNVars(hypre_SStructGridPGrid(grid, part));
+      var_offsets[part + 1] = var_offsets[part] + nvars;
+   }
+   nbuckets = var_offsets[nparts];
+
+   bucket_offsets = hypre_CTAlloc(HYPRE_Int, nbuckets + 1, HYPRE_MEMORY_HOST);
+   bucket_counts  = hypre_CTAlloc(HYPRE_Int, nbuckets, HYPRE_MEMORY_HOST);
+   bucket         = hypre_TAlloc(HYPRE_Int, nindexes, HYPRE_MEMORY_HOST);
+   for (i = 0; i < nindexes; i++)
+   {
+      bucket_offsets[var_offsets[parts[i]] + vars[i] + 1]++;
+   }
+   for (k = 0; k < nbuckets; k++)
+   {
+      bucket_offsets[k + 1] += bucket_offsets[k];
+   }
+   for (i = 0; i < nindexes; i++)
+   {
+      k = var_offsets[parts[i]] + vars[i];
+      bucket[bucket_offsets[k] + bucket_counts[k]] = i;
+      bucket_counts[k]++;
+   }
+
+   /* intersect each bucket of (degenerate) boxes with its box manager */
+   boxes = hypre_BoxArrayCreate(0, ndim);
+   for (part = 0; part < nparts; part++)
+   {
+      for (var = 0; var < var_offsets[part + 1] - var_offsets[part]; var++)
+      {
+         k = var_offsets[part] + var;
+         n = bucket_offsets[k + 1] - bucket_offsets[k];
+         if (n == 0)
+         {
+            continue;
+         }
+
+         hypre_BoxArraySetSize(boxes, n);
+         for (j = 0; j < n; j++)
+         {
+            i = bucket[bucket_offsets[k] + j];
+            hypre_BoxSetExtents(hypre_BoxArrayBox(boxes, j), indexes[i], indexes[i]);
+         }
+
+         hypre_BoxManIntersectBoxes(hypre_SStructGridBoxManager(grid, part, var),
+                                    boxes, &offsets, &found);
+
+         for (j = 0; j < n; j++)
+         {
+            i = bucket[bucket_offsets[k] + j];
+            nfound = offsets[j + 1] - offsets[j];
+
+            /* we should only get a single entry returned */
+            if (nfound > 1)
+            {
+               hypre_error(HYPRE_ERROR_GENERIC);
+               entries[i] = NULL;
+            }
+            else if (nfound == 0)
+            {
+               entries[i] = NULL;
+            }
+            else
+            {
+               entries[i] = found[offsets[j]];
+            }
+         }
+
+         hypre_TFree(offsets, HYPRE_MEMORY_HOST);
+         hypre_TFree(found, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_BoxArrayDestroy(boxes);
+   hypre_TFree(var_offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(bucket_offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(bucket_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(bucket, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -161,6 +161,10 @@ typedef struct hypre_SStructGrid_struct
    HYPRE_BigInt            ghstart_rank;  /* GEC0902 start rank including ghosts  */
    HYPRE_Int               num_ghost[2 * HYPRE_MAXDIM]; /* ghost layer size */
 
+   /* assembled grid this one was created from (see HYPRE_SStructGridRegrid);
+      only kept until this grid is assembled */
+   struct hypre_SStructGrid_struct *prev_grid;
+
 } hypre_SStructGrid;
 
 /*--------------------------------------------------------------------------
@@ -203,6 +207,7 @@ typedef struct hypre_SStructGrid_struct
 #define hypre_SStructGridGhlocalSize(grid)    ((grid) -> ghlocal_size)
 #define hypre_SStructGridGhstartRank(grid)    ((grid) -> ghstart_rank)
 #define hypre_SStructGridNumGhost(grid)       ((grid) -> num_ghost)
+#define hypre_SStructGridPrevGrid(grid)       ((grid) -> prev_grid)
 
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_SStructPGrid
@@ -663,6 +663,7 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
    HYPRE_Int               part, var, entry, b, m, mi;
    HYPRE_Int              *row_sizes;
    HYPRE_Int               max_row_size;
+   HYPRE_Int               build_parcsr;
 
    hypre_BoxArray         *boxes;
    hypre_Box              *box;
@@ -763,8 +764,16 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
       }
    }
 
+   /* Build the PARCSR pattern directly on the host; otherwise stage through IJ */
+   build_parcsr = (matrix_type == HYPRE_PARCSR) &&
+                  (hypre_GetActualMemLocation(hypre_IJMatrixMemoryLocation(ijmatrix)) ==
+                   hypre_MEMORY_HOST);
+
    /* ZTODO: Update row_sizes based on neighbor off-part couplings */
-   HYPRE_IJMatrixSetRowSizes (ijmatrix, (const HYPRE_Int *) row_sizes);
+   if (!build_parcsr)
+   {
+      HYPRE_IJMatrixSetRowSizes (ijmatrix, (const HYPRE_Int *) row_sizes);
+   }
 
    hypre_TFree(row_sizes, HYPRE_MEMORY_HOST);
 
@@ -776,13 +785,251 @@ hypre_SStructUMatrixInitialize( hypre_SStructMatrix *matrix )
    hypre_SStructMatrixTmpCoeffs(matrix)    = hypre_CTAlloc(HYPRE_Complex, max_row_size,
                                                            HYPRE_MEMORY_HOST);
 
-   HYPRE_IJMatrixInitialize(ijmatrix);
+   if (build_parcsr)
+   {
+      hypre_SStructUMatrixBuildParCSR(matrix);
+   }
+   else
+   {
+      HYPRE_IJMatrixInitialize(ijmatrix);
+   }
    HYPRE_IJMatrixGetObject(ijmatrix,
                            (void **) &hypre_SStructMatrixParCSRMatrix(matrix));
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Builds the nonzero pattern of a HYPRE_PARCSR matrix directly from the
+ * stencils and the graph, without staging the entries through IJ.  Row i
+ * holds, in stencil order, the column of every stencil entry whose target
+ * lies in the domain grid, followed by the non-stencil (graph) entries of
+ * row i; a column is stored only once.  The local rows are first counted and
+ * then filled with box loops over the grid boxes, using the box manager's
+ * global ranks, and the result is adopted by the IJ matrix, which is then
+ * assembled with zero coefficients.  Values set later are written into this
+ * pattern in place (see hypre_SStructUMatrixSetBoxValues).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructUMatrixBuildParCSR( hypre_SStructMatrix *matrix )
+{
+   HYPRE_Int               ndim        = hypre_SStructMatrixNDim(matrix);
+   HYPRE_IJMatrix          ijmatrix    = hypre_SStructMatrixIJMatrix(matrix);
+   HYPRE_Int               matrix_type = hypre_SStructMatrixObjectType(matrix);
+   hypre_SStructGraph     *graph       = hypre_SStructMatrixGraph(matrix);
+   hypre_SStructGrid      *grid        = hypre_SStructGraphGrid(graph);
+   hypre_SStructGrid      *dom_grid    = hypre_SStructGraphDomainGrid(graph);
+   HYPRE_Int               nparts      = hypre_SStructGraphNParts(graph);
+   hypre_SStructPGrid    **pgrids      = hypre_SStructGraphPGrids(graph);
+   hypre_SStructStencil ***stencils    = hypre_SStructGraphStencils(graph);
+   HYPRE_Int               nUventries  = hypre_SStructGraphNUVEntries(graph);
+   HYPRE_Int              *iUventries  = hypre_SStructGraphIUVEntries(graph);
+   hypre_SStructUVEntry  **Uventries   = hypre_SStructGraphUVEntries(graph);
+   HYPRE_BigInt            rowstart    = hypre_SStructGridStartRank(grid);
+   HYPRE_Int               nrows       = hypre_SStructGridLocalSize(grid);
+   hypre_SStructStencil   *stencil;
+   hypre_SStructUVEntry   *Uventry;
+   hypre_Index            *shape;
+   HYPRE_Int              *vars, *split;
+   hypre_BoxArray         *boxes;
+   hypre_Box              *box, *to_box, *map_box, *int_box;
+   hypre_BoxManEntry      *boxman_entry;
+   hypre_BoxManEntry     **boxman_to_entries;
+   HYPRE_Int               nboxman_to_entries;
+   hypre_IndexRef          offset, start;
+   hypre_Index             index, stride, loop_size, cs;
+   HYPRE_BigInt            row_base, col_base, row;
+   HYPRE_Int              *row_ptr, *row_pos;
+   HYPRE_BigInt           *cols = NULL;
+   HYPRE_Complex          *values;
+   HYPRE_Int               pass, part, nvars, var, entry, b, jj, m, i, j, k, nnz;
+
+   to_box  = hypre_BoxCreate(ndim);
+   map_box = hypre_BoxCreate(ndim);
+   int_box = hypre_BoxCreate(ndim);
+   hypre_SetIndex(stride, 1);
+
+   row_ptr = hypre_CTAlloc(HYPRE_Int, nrows + 1, HYPRE_MEMORY_HOST);
+   row_pos = hypre_CTAlloc(HYPRE_Int, nrows, HYPRE_MEMORY_HOST);
+
+   /* pass 0 counts the entries of each row, pass 1 fills in the columns */
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         nvars = hypre_SStructPGridNVars(pgrids[part]);
+         for (var = 0; var < nvars; var++)
+         {
+            stencil = stencils[part][var];
+            shape   = hypre_SStructStencilShape(stencil);
+            vars    = hypre_SStructStencilVars(stencil);
+            split   = hypre_SStructMatrixSplit(matrix, part, var);
+
+            boxes = hypre_StructGridBoxes(hypre_SStructPGridSGrid(pgrids[part], var));
+            hypre_ForBoxI(b, boxes)
+            {
+               box = hypre_BoxArrayBox(boxes, b);
+               if (hypre_BoxVolume(box) == 0)
+               {
+                  continue;
+               }
+
+               /* the rows of 'box' are numbered consecutively from row_base */
+               hypre_SStructGridFindBoxManEntry(grid, part, hypre_BoxIMin(box), var,
+                                                &boxman_entry);
+               hypre_SStructBoxManEntryGetGlobalRank(boxman_entry, hypre_BoxIMin(box),
+                                                     &row_base, matrix_type);
+               m = (HYPRE_Int) (row_base - rowstart);
+
+               for (entry = 0; entry < hypre_SStructStencilSize(stencil); entry++)
+               {
+                  if (split[entry] != -1)
+                  {
+                     continue;
+                  }
+
+                  offset = shape[entry];
+                  hypre_CopyBox(box, to_box);
+                  hypre_BoxShiftPos(to_box, offset);
+
+                  hypre_SStructGridIntersect(dom_grid, part, vars[entry], to_box, -1,
+                                             &boxman_to_entries, &nboxman_to_entries);
+
+                  for (jj = 0; jj < nboxman_to_entries; jj++)
+                  {
+                     hypre_SStructBoxManEntryGetStrides(boxman_to_entries[jj], cs, matrix_type);
+
+                     hypre_BoxManEntryGetExtents(boxman_to_entries[jj],
+                                                 hypre_BoxIMin(map_box), hypre_BoxIMax(map_box));
+                     hypre_IntersectBoxes(to_box, map_box, int_box);
+                     if (hypre_BoxVolume(int_box) == 0)
+                     {
+                        continue;
+                     }
+
+                     hypre_CopyIndex(hypre_BoxIMin(int_box), index);
+                     hypre_SStructBoxManEntryGetGlobalRank(boxman_to_entries[jj],
+                                                           index, &col_base, matrix_type);
+
+                     hypre_BoxShiftNeg(int_box, offset);
+                     start = hypre_BoxIMin(int_box);
+                     hypre_BoxGetSize(int_box, loop_size);
+
+                     if (pass == 0)
+                     {
+                        zypre_BoxLoop1Begin(ndim, loop_size, box, start, stride, mi);
+                        {
+                           row_ptr[m + mi + 1]++;
+                        }
+                        zypre_BoxLoop1End(mi);
+                     }
+                     else
+                     {
+                        zypre_BoxLoop1Begin(ndim, loop_size, box, start, stride, mi);
+                        {
+                           hypre_Index  lindex;
+                           HYPRE_BigInt col = col_base;
+                           HYPRE_Int    d;
+
+                           zypre_BoxLoopGetIndex(lindex);
+                           for (d = 0; d < ndim; d++)
+                           {
+                              col += lindex[d] * cs[d];
+                           }
+                           cols[row_pos[m + mi]++] = col;
+                        }
+                        zypre_BoxLoop1End(mi);
+                     }
+                  }
+
+                  hypre_TFree(boxman_to_entries, HYPRE_MEMORY_HOST);
+               }
+            }
+         }
+      }
+
+      /* non-stencil entries */
+      for (entry = 0; entry < nUventries; entry++)
+      {
+         Uventry = Uventries[iUventries[entry]];
+         row = hypre_SStructUVEntryRank(Uventry) - rowstart;
+         if ((row > -1) && (row < nrows))
+         {
+            i = (HYPRE_Int) row;
+            if (pass == 0)
+            {
+               row_ptr[i + 1] += hypre_SStructUVEntryNUEntries(Uventry);
+            }
+            else
+            {
+               for (k = 0; k < hypre_SStructUVEntryNUEntries(Uventry); k++)
+               {
+                  cols[row_pos[i]++] = hypre_SStructUVEntryToRank(Uventry, k);
+               }
+            }
+         }
+      }
+
+      if (pass == 0)
+      {
+         for (i = 0; i < nrows; i++)
+         {
+            row_ptr[i + 1] += row_ptr[i];
+            row_pos[i] = row_ptr[i];
+         }
+         cols = hypre_TAlloc(HYPRE_BigInt, row_ptr[nrows], HYPRE_MEMORY_HOST);
+      }
+   }
+
+   /* Keep the first occurrence of each column; row_pos becomes the row length */
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(i, j, k, nnz) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < nrows; i++)
+   {
+      nnz = row_ptr[i];
+      for (j = row_ptr[i]; j < row_ptr[i + 1]; j++)
+      {
+         for (k = row_ptr[i]; k < nnz; k++)
+         {
+            if (cols[k] == cols[j])
+            {
+               break;
+            }
+         }
+         if (k == nnz)
+         {
+            cols[nnz++] = cols[j];
+         }
+      }
+      row_pos[i] = nnz - row_ptr[i];
+   }
+
+   nnz = 0;
+   for (i = 0; i < nrows; i++)
+   {
+      j = row_ptr[i];
+      row_ptr[i] = nnz;
+      for (k = 0; k < row_pos[i]; k++)
+      {
+         cols[nnz++] = cols[j + k];
+      }
+   }
+   row_ptr[nrows] = nnz;
+
+   values = hypre_CTAlloc(HYPRE_Complex, nnz, HYPRE_MEMORY_HOST);
+
+   HYPRE_IJMatrixAdoptCSR(ijmatrix, row_ptr, cols, values, 1);
+
+   hypre_TFree(row_pos, HYPRE_MEMORY_HOST);
+   hypre_BoxDestroy(to_box);
+   hypre_BoxDestroy(map_box);
+   hypre_BoxDestroy(int_box);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * (action > 0): add-to values
  * (action = 0): set values
@@ -986,6 +1233,59 @@ hypre_SStructUMatrixSetValues( hypre_SStructMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Returns a pointer to the coefficient of (row_local, col) in an assembled
+ * ParCSR matrix, or NULL if the entry is not in the nonzero pattern.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Complex *
+hypre_SStructUMatrixEntryData( hypre_ParCSRMatrix *par_matrix,
+                               HYPRE_Int           row_local,
+                               HYPRE_BigInt        col,
+                               HYPRE_BigInt        col_0,
+                               HYPRE_BigInt        col_n,
+                               HYPRE_BigInt        first )
+{
+   hypre_CSRMatrix *diag = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int       *A_i, *A_j;
+   HYPRE_Int        jcol, j;
+
+   if (col < col_0 || col > col_n)
+   {
+      jcol = hypre_BigBinarySearch(hypre_ParCSRMatrixColMapOffd(par_matrix), col - first,
+                                   hypre_CSRMatrixNumCols(offd));
+      if (jcol == -1)
+      {
+         return NULL;
+      }
+      A_i = hypre_CSRMatrixI(offd);
+      A_j = hypre_CSRMatrixJ(offd);
+      for (j = A_i[row_local]; j < A_i[row_local + 1]; j++)
+      {
+         if (A_j[j] == jcol)
+         {
+            return &hypre_CSRMatrixData(offd)[j];
+         }
+      }
+   }
+   else
+   {
+      jcol = (HYPRE_Int) (col - col_0);
+      A_i = hypre_CSRMatrixI(diag);
+      A_j = hypre_CSRMatrixJ(diag);
+      for (j = A_i[row_local]; j < A_i[row_local + 1]; j++)
+      {
+         if (A_j[j] == jcol)
+         {
+            return &hypre_CSRMatrixData(diag)[j];
+         }
+      }
+   }
+
+   return NULL;
+}
+
 /*--------------------------------------------------------------------------
  * Note: Entries must all be of type stencil or non-stencil, but not both.
  *
@@ -1049,6 +1349,10 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
    HYPRE_Int             ei, entry, ii, jj;
    HYPRE_Int             matrix_type = hypre_SStructMatrixObjectType(matrix);
    HYPRE_MemoryLocation  memory_location = hypre_IJMatrixMemoryLocation(ijmatrix);
+   hypre_ParCSRMatrix   *par_matrix = NULL;
+   HYPRE_BigInt          row_0 = 0, col_0 = 0, col_n = 0, first = 0;
+   HYPRE_Int             direct, direct_ii, num_missing = 0;
+   HYPRE_Int             myid;
 
    /*------------------------------------------
     * all stencil entries
@@ -1060,12 +1364,24 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
       map_box = hypre_BoxCreate(ndim);
       int_box = hypre_BoxCreate(ndim);
 
-      nrows       = hypre_BoxVolume(set_box);
-      ncols       = hypre_CTAlloc(HYPRE_Int,     nrows,            memory_location);
-      rows        = hypre_CTAlloc(HYPRE_BigInt,  nrows,            memory_location);
-      row_indexes = hypre_CTAlloc(HYPRE_Int,     nrows,            memory_location);
-      cols        = hypre_CTAlloc(HYPRE_BigInt,  nrows * nentries, memory_location);
-      ijvalues    = hypre_CTAlloc(HYPRE_Complex, nrows * nentries, memory_location);
+      /* The IJ staging arrays are allocated on first use */
+      ncols       = NULL;
+      rows        = NULL;
+      row_indexes = NULL;
+      cols        = NULL;
+      ijvalues    = NULL;
+
+      direct = (action > -1) && hypre_IJMatrixAssembleFlag(ijmatrix) &&
+               (hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST);
+      if (direct)
+      {
+         hypre_MPI_Comm_rank(hypre_SStructMatrixComm(matrix), &myid);
+         par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix);
+         row_0 = hypre_IJMatrixRowPartitioning(ijmatrix)[0];
+         col_0 = hypre_IJMatrixColPartitioning(ijmatrix)[0];
+         col_n = hypre_IJMatrixColPartitioning(ijmatrix)[1] - 1;
+         first = hypre_IJMatrixGlobalFirstCol(ijmatrix);
+      }
 
       hypre_SetIndex(stride, 1);
 
@@ -1074,6 +1390,17 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
 
       for (ii = 0; ii < nboxman_entries; ii++)
       {
+         direct_ii = direct && (hypre_BoxManEntryProc(boxman_entries[ii]) == myid);
+         if (!direct_ii && ncols == NULL)
+         {
+            nrows       = hypre_BoxVolume(set_box);
+            ncols       = hypre_CTAlloc(HYPRE_Int,     nrows,            memory_location);
+            rows        = hypre_CTAlloc(HYPRE_BigInt,  nrows,            memory_location);
+            row_indexes = hypre_CTAlloc(HYPRE_Int,     nrows,            memory_location);
+            cols        = hypre_CTAlloc(HYPRE_BigInt,  nrows * nentries, memory_location);
+            ijvalues    = hypre_CTAlloc(HYPRE_Complex, nrows * nentries, memory_location);
+         }
+
          hypre_SStructBoxManEntryGetStrides(boxman_entries[ii], rs, matrix_type);
 
          hypre_CopyBox(set_box, box);
@@ -1088,16 +1415,19 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
 
          nrows = hypre_BoxVolume(box);
 
+         if (!direct_ii)
+         {
 #undef DEVICE_VAR
 #define DEVICE_VAR is_device_ptr(ncols,row_indexes)
-         hypre_LoopBegin(nrows, i)
-         {
-            ncols[i] = 0;
-            row_indexes[i] = i * nentries;
-         }
-         hypre_LoopEnd()
+            hypre_LoopBegin(nrows, i)
+            {
+               ncols[i] = 0;
+               row_indexes[i] = i * nentries;
+            }
+            hypre_LoopEnd()
 #undef DEVICE_VAR
 #define DEVICE_VAR
+         }
 
          for (ei = 0; ei < nentries; ei++)
          {
@@ -1132,6 +1462,46 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
                start = hypre_BoxIMin(int_box);
                hypre_BoxGetSize(int_box, loop_size);
 
+               if (direct_ii)
+               {
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION reduction(+:num_missing)
+                  zypre_BoxLoop1ReductionBegin(ndim, loop_size, value_box, start, stride, vi,
+                                               num_missing);
+                  {
+                     hypre_Index    lindex;
+                     HYPRE_BigInt   row = row_base - row_0;
+                     HYPRE_BigInt   col = col_base;
+                     HYPRE_Complex *data;
+                     HYPRE_Int      d;
+
+                     zypre_BoxLoopGetIndex(lindex);
+                     for (d = 0; d < ndim; d++)
+                     {
+                        row += lindex[d] * rs[d];
+                        col += lindex[d] * cs[d];
+                     }
+
+                     data = hypre_SStructUMatrixEntryData(par_matrix, (HYPRE_Int) row, col,
+                                                          col_0, col_n, first);
+                     if (data == NULL)
+                     {
+                        num_missing++;
+                     }
+                     else if (action > 0)
+                     {
+                        *data += values[ei + vi * nentries];
+                     }
+                     else
+                     {
+                        *data = values[ei + vi * nentries];
+                     }
+                  }
+                  zypre_BoxLoop1ReductionEnd(vi, num_missing);
+#undef HYPRE_BOX_REDUCTION
+#define HYPRE_BOX_REDUCTION
+               }
+               else
 #if defined(HYPRE_USING_GPU)
                {
                   hypre_assert(ndim <= 3);
@@ -1231,6 +1601,11 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
 
          } /* end of ei nentries loop */
 
+         if (direct_ii)
+         {
+            continue;
+         }
+
          if (action > 0)
          {
             HYPRE_IJMatrixAddToValues2(ijmatrix, nrows, ncols,
@@ -1256,6 +1631,11 @@ hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix,
 
       hypre_TFree(boxman_entries, HYPRE_MEMORY_HOST);
 
+      if (num_missing)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix entry is not in the nonzero pattern!\n");
+      }
+
       hypre_TFree(ncols, memory_location);
       hypre_TFree(rows, memory_location);
       hypre_TFree(row_indexes, memory_location);
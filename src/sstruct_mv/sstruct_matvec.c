@@ -19,12 +19,28 @@
 
 /*--------------------------------------------------------------------------
  * hypre_SStructPMatvecData data structure
+ *
+ * When all variables live on the same grid with the same data layout (e.g.,
+ * several cell-centered unknowns per cell), the (vi,vj) blocks are applied
+ * by one fused kernel instead of nvars^2 struct matvecs.  The kernel reads x
+ * from a copy in blocked layout, where the data of all variables is stored
+ * box by box (as the values of a multi-valued struct object), so that one
+ * ghost exchange with nvars values per point serves all variables.  Each box
+ * is then swept once, computing all outputs from all couplings.
  *--------------------------------------------------------------------------*/
 
 typedef struct
 {
    HYPRE_Int     nvars;
-   void ***smatvec_data;
+   void       ***smatvec_data;
+
+   HYPRE_Int          fused;
+   hypre_ComputePkg  *compute_pkg;   /* ghost exchange of x for all variables */
+   HYPRE_Complex     *xdata;         /* x in blocked layout */
+   HYPRE_Int         *xdata_offsets; /* start of each box in xdata */
+   HYPRE_Int         *term_starts;   /* terms of output variable vi */
+   HYPRE_Int         *term_vars;     /* input variable vj of each term */
+   HYPRE_Int         *term_entries;  /* stencil entry of each term */
 
 } hypre_SStructPMatvecData;
 
@@ -44,22 +60,137 @@ hypre_SStructPMatvecCreate( void **pmatvec_vdata_ptr )
 }
 
 /*--------------------------------------------------------------------------
- * hypre_SStructPMatvecSetup
+ * Returns 1 if the box arrays a and b describe the same boxes
  *--------------------------------------------------------------------------*/
 
-HYPRE_Int
-hypre_SStructPMatvecSetup( void                 *pmatvec_vdata,
-                           hypre_SStructPMatrix *pA,
-                           hypre_SStructPVector *px )
+static HYPRE_Int
+hypre_SStructPMatvecSameSpace( hypre_BoxArray *a,
+                               hypre_BoxArray *b )
 {
-   hypre_SStructPMatvecData   *pmatvec_data = (hypre_SStructPMatvecData   *)pmatvec_vdata;
-   HYPRE_Int                   nvars;
+   HYPRE_Int  ndim = hypre_BoxArrayNDim(a);
+   hypre_Box *abox, *bbox;
+   HYPRE_Int  i;
+
+   if (a == b)
+   {
+      return 1;
+   }
+   if (hypre_BoxArraySize(a) != hypre_BoxArraySize(b))
+   {
+      return 0;
+   }
+   hypre_ForBoxI(i, a)
+   {
+      abox = hypre_BoxArrayBox(a, i);
+      bbox = hypre_BoxArrayBox(b, i);
+      if (!hypre_IndexesEqual(hypre_BoxIMin(abox), hypre_BoxIMin(bbox), ndim) ||
+          !hypre_IndexesEqual(hypre_BoxIMax(abox), hypre_BoxIMax(bbox), ndim))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if the data of all variables of pvector share one layout
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructPMatvecSameLayout( hypre_SStructPVector *pvector )
+{
+   HYPRE_Int           nvars = hypre_SStructPVectorNVars(pvector);
+   hypre_StructVector *sv0   = hypre_SStructPVectorSVector(pvector, 0);
+   hypre_StructVector *sv;
+   HYPRE_Int           var;
+
+   for (var = 1; var < nvars; var++)
+   {
+      sv = hypre_SStructPVectorSVector(pvector, var);
+      if ((hypre_StructVectorGrid(sv) != hypre_StructVectorGrid(sv0)) ||
+          !hypre_SStructPMatvecSameSpace(hypre_StructVectorDataSpace(sv),
+                                         hypre_StructVectorDataSpace(sv0)))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if the fused kernel applies to pA and px: there are several
+ * variables, all on the same grid and data layout, and all blocks store
+ * variable coefficients in host memory.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructPMatvecCanFuse( hypre_SStructPMatrix *pA,
+                             hypre_SStructPVector *px )
+{
+   HYPRE_Int           nvars = hypre_SStructPMatrixNVars(pA);
+   hypre_StructVector *sx0;
+   hypre_StructMatrix *sA, *sA0 = NULL;
+   HYPRE_Int           vi, vj;
+
+   if (nvars < 2)
+   {
+      return 0;
+   }
+
+   sx0 = hypre_SStructPVectorSVector(px, 0);
+   if ((hypre_GetExecPolicy1(hypre_StructVectorMemoryLocation(sx0)) != HYPRE_EXEC_HOST) ||
+       !hypre_SStructPMatvecSameLayout(px))
+   {
+      return 0;
+   }
+
+   for (vi = 0; vi < nvars; vi++)
+   {
+      for (vj = 0; vj < nvars; vj++)
+      {
+         sA = hypre_SStructPMatrixSMatrix(pA, vi, vj);
+         if (sA == NULL)
+         {
+            continue;
+         }
+         if ((hypre_StructMatrixConstantCoefficient(sA) != 0) ||
+             hypre_StructMatrixSymmetric(sA) || hypre_StructMatrixMatrixFree(sA) ||
+             (hypre_StructMatrixGrid(sA) != hypre_StructVectorGrid(sx0)))
+         {
+            return 0;
+         }
+         if (sA0 == NULL)
+         {
+            sA0 = sA;
+         }
+         else if (!hypre_SStructPMatvecSameSpace(hypre_StructMatrixDataSpace(sA),
+                                                 hypre_StructMatrixDataSpace(sA0)))
+         {
+            return 0;
+         }
+      }
+   }
+
+   return (sA0 != NULL);
+}
+
+/*--------------------------------------------------------------------------
+ * Sets up one struct matvec per (vi,vj) block
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructPMatvecSetupBlocks( hypre_SStructPMatvecData *pmatvec_data,
+                                 hypre_SStructPMatrix     *pA,
+                                 hypre_SStructPVector     *px )
+{
+   HYPRE_Int                   nvars = (pmatvec_data -> nvars);
    void                     ***smatvec_data;
    hypre_StructMatrix         *sA;
    hypre_StructVector         *sx;
    HYPRE_Int                   vi, vj;
 
-   nvars = hypre_SStructPMatrixNVars(pA);
    smatvec_data = hypre_TAlloc(void **,  nvars, HYPRE_MEMORY_HOST);
    for (vi = 0; vi < nvars; vi++)
    {
@@ -76,12 +207,293 @@ hypre_SStructPMatvecSetup( void                 *pmatvec_vdata,
          }
       }
    }
-   (pmatvec_data -> nvars)        = nvars;
    (pmatvec_data -> smatvec_data) = smatvec_data;
 
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Sets up the fused kernel: the term lists, the blocked copy of x, and a
+ * compute package for the union of the block stencils with nvars values
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructPMatvecSetupFused( hypre_SStructPMatvecData *pmatvec_data,
+                                hypre_SStructPMatrix     *pA,
+                                hypre_SStructPVector     *px )
+{
+   HYPRE_Int            nvars   = (pmatvec_data -> nvars);
+   HYPRE_Int            ndim    = hypre_SStructPMatrixNDim(pA);
+   hypre_StructVector  *sx0     = hypre_SStructPVectorSVector(px, 0);
+   hypre_StructGrid    *grid    = hypre_StructVectorGrid(sx0);
+   hypre_BoxArray      *x_space = hypre_StructVectorDataSpace(sx0);
+   hypre_StructMatrix  *sA;
+   hypre_StructStencil *sstencil;
+   hypre_Index         *sshape, *shape;
+   hypre_StructStencil *stencil;
+   hypre_ComputeInfo   *compute_info;
+   hypre_ComputePkg    *compute_pkg;
+   HYPRE_Int           *term_starts, *term_vars, *term_entries;
+   HYPRE_Int           *xdata_offsets;
+   HYPRE_Int            nterms, size, xdata_size;
+   HYPRE_Int            vi, vj, s, k, i;
+
+   /* count the terms and collect the union of the stencil shapes */
+   nterms = 0;
+   for (vi = 0; vi < nvars; vi++)
+   {
+      for (vj = 0; vj < nvars; vj++)
+      {
+         sA = hypre_SStructPMatrixSMatrix(pA, vi, vj);
+         if (sA != NULL)
+         {
+            nterms += hypre_StructStencilSize(hypre_StructMatrixStencil(sA));
+         }
+      }
+   }
+
+   term_starts  = hypre_TAlloc(HYPRE_Int, nvars + 1, HYPRE_MEMORY_HOST);
+   term_vars    = hypre_TAlloc(HYPRE_Int, nterms, HYPRE_MEMORY_HOST);
+   term_entries = hypre_TAlloc(HYPRE_Int, nterms, HYPRE_MEMORY_HOST);
+   shape        = hypre_TAlloc(hypre_Index, nterms, HYPRE_MEMORY_HOST);
+
+   nterms = 0;
+   size   = 0;
+   for (vi = 0; vi < nvars; vi++)
+   {
+      term_starts[vi] = nterms;
+      for (vj = 0; vj < nvars; vj++)
+      {
+         sA = hypre_SStructPMatrixSMatrix(pA, vi, vj);
+         if (sA == NULL)
+         {
+            continue;
+         }
+         sstencil = hypre_StructMatrixStencil(sA);
+         sshape   = hypre_StructStencilShape(sstencil);
+         for (s = 0; s < hypre_StructStencilSize(sstencil); s++)
+         {
+            term_vars[nterms]    = vj;
+            term_entries[nterms] = s;
+            nterms++;
+
+            for (k = 0; k < size; k++)
+            {
+               if (hypre_IndexesEqual(shape[k], sshape[s], ndim))
+               {
+                  break;
+               }
+            }
+            if (k == size)
+            {
+               hypre_CopyIndex(sshape[s], shape[size]);
+               size++;
+            }
+         }
+      }
+   }
+   term_starts[nvars] = nterms;
+
+   /* the stencil takes ownership of shape */
+   stencil = hypre_StructStencilCreate(ndim, size, shape);
+   hypre_CreateComputeInfo(grid, stencil, &compute_info);
+   hypre_ComputePkgCreate(compute_info, x_space, nvars, grid, &compute_pkg);
+   hypre_StructStencilDestroy(stencil);
+
+   xdata_offsets = hypre_TAlloc(HYPRE_Int, hypre_BoxArraySize(x_space), HYPRE_MEMORY_HOST);
+   xdata_size = 0;
+   hypre_ForBoxI(i, x_space)
+   {
+      xdata_offsets[i] = xdata_size;
+      xdata_size += nvars * hypre_BoxVolume(hypre_BoxArrayBox(x_space, i));
+   }
+
+   (pmatvec_data -> fused)         = 1;
+   (pmatvec_data -> compute_pkg)   = compute_pkg;
+   (pmatvec_data -> xdata)         = hypre_CTAlloc(HYPRE_Complex, xdata_size, HYPRE_MEMORY_HOST);
+   (pmatvec_data -> xdata_offsets) = xdata_offsets;
+   (pmatvec_data -> term_starts)   = term_starts;
+   (pmatvec_data -> term_vars)     = term_vars;
+   (pmatvec_data -> term_entries)  = term_entries;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructPMatvecSetup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPMatvecSetup( void                 *pmatvec_vdata,
+                           hypre_SStructPMatrix *pA,
+                           hypre_SStructPVector *px )
+{
+   hypre_SStructPMatvecData   *pmatvec_data = (hypre_SStructPMatvecData   *)pmatvec_vdata;
+
+   (pmatvec_data -> nvars) = hypre_SStructPMatrixNVars(pA);
+
+   if (hypre_SStructPMatvecCanFuse(pA, px))
+   {
+      hypre_SStructPMatvecSetupFused(pmatvec_data, pA, px);
+   }
+   else
+   {
+      hypre_SStructPMatvecSetupBlocks(pmatvec_data, pA, px);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * y = alpha*A*x + beta*y with the fused kernel (see hypre_SStructPMatvecData)
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_SStructPMatvecComputeFused( hypre_SStructPMatvecData *pmatvec_data,
+                                  HYPRE_Complex             alpha,
+                                  hypre_SStructPMatrix     *pA,
+                                  hypre_SStructPVector     *px,
+                                  HYPRE_Complex             beta,
+                                  hypre_SStructPVector     *py )
+{
+   HYPRE_Int            nvars         = (pmatvec_data -> nvars);
+   hypre_ComputePkg    *compute_pkg   = (pmatvec_data -> compute_pkg);
+   HYPRE_Complex       *xdata         = (pmatvec_data -> xdata);
+   HYPRE_Int           *xdata_offsets = (pmatvec_data -> xdata_offsets);
+   HYPRE_Int           *term_starts   = (pmatvec_data -> term_starts);
+   HYPRE_Int           *term_vars     = (pmatvec_data -> term_vars);
+   HYPRE_Int           *term_entries  = (pmatvec_data -> term_entries);
+   HYPRE_Int            nterms        = term_starts[nvars];
+   HYPRE_Int            ndim          = hypre_SStructPMatrixNDim(pA);
+   hypre_IndexRef       stride        = hypre_ComputePkgStride(compute_pkg);
+   hypre_BoxArray      *x_space       = hypre_StructVectorDataSpace(
+                                           hypre_SStructPVectorSVector(px, 0));
+   hypre_BoxArray      *y_space       = hypre_StructVectorDataSpace(
+                                           hypre_SStructPVectorSVector(py, 0));
+   hypre_BoxArray      *A_space       = NULL;
+
+   hypre_CommHandle    *comm_handle;
+   hypre_BoxArrayArray *compute_box_aa;
+   hypre_BoxArray      *compute_box_a;
+   hypre_Box           *compute_box;
+   hypre_Box           *A_data_box, *x_data_box, *y_data_box;
+   hypre_StructMatrix  *sA;
+   hypre_Index         *shape;
+   hypre_Index          loop_size;
+   hypre_IndexRef       start;
+   HYPRE_Complex      **Ap, **yp, *xp;
+   HYPRE_Int           *xoff;
+   HYPRE_Int            xvol, compute_i, vi, vj, t, i, j;
+
+   for (vi = 0; (vi < nvars) && (A_space == NULL); vi++)
+   {
+      for (vj = 0; vj < nvars; vj++)
+      {
+         sA = hypre_SStructPMatrixSMatrix(pA, vi, vj);
+         if (sA != NULL)
+         {
+            A_space = hypre_StructMatrixDataSpace(sA);
+            break;
+         }
+      }
+   }
+
+   /* copy x into the blocked layout, ghost layers included */
+   hypre_ForBoxI(i, x_space)
+   {
+      xvol = hypre_BoxVolume(hypre_BoxArrayBox(x_space, i));
+      for (vj = 0; vj < nvars; vj++)
+      {
+         hypre_TMemcpy(xdata + xdata_offsets[i] + vj * xvol,
+                       hypre_StructVectorBoxData(hypre_SStructPVectorSVector(px, vj), i),
+                       HYPRE_Complex, xvol, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   Ap   = hypre_TAlloc(HYPRE_Complex *, nterms, HYPRE_MEMORY_HOST);
+   xoff = hypre_TAlloc(HYPRE_Int, nterms, HYPRE_MEMORY_HOST);
+   yp   = hypre_TAlloc(HYPRE_Complex *, nvars, HYPRE_MEMORY_HOST);
+
+   for (compute_i = 0; compute_i < 2; compute_i++)
+   {
+      if (compute_i == 0)
+      {
+         hypre_InitializeIndtComputations(compute_pkg, xdata, &comm_handle);
+         compute_box_aa = hypre_ComputePkgIndtBoxes(compute_pkg);
+      }
+      else
+      {
+         hypre_FinalizeIndtComputations(comm_handle);
+         compute_box_aa = hypre_ComputePkgDeptBoxes(compute_pkg);
+      }
+
+      hypre_ForBoxArrayI(i, compute_box_aa)
+      {
+         compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+         A_data_box = hypre_BoxArrayBox(A_space, i);
+         x_data_box = hypre_BoxArrayBox(x_space, i);
+         y_data_box = hypre_BoxArrayBox(y_space, i);
+
+         xvol = hypre_BoxVolume(x_data_box);
+         xp   = xdata + xdata_offsets[i];
+         for (vi = 0; vi < nvars; vi++)
+         {
+            yp[vi] = hypre_StructVectorBoxData(hypre_SStructPVectorSVector(py, vi), i);
+            for (t = term_starts[vi]; t < term_starts[vi + 1]; t++)
+            {
+               vj    = term_vars[t];
+               sA    = hypre_SStructPMatrixSMatrix(pA, vi, vj);
+               shape = hypre_StructStencilShape(hypre_StructMatrixStencil(sA));
+               Ap[t] = hypre_StructMatrixBoxData(sA, i, term_entries[t]);
+               xoff[t] = vj * xvol +
+                         hypre_BoxOffsetDistance(x_data_box, shape[term_entries[t]]);
+            }
+         }
+
+         hypre_ForBoxI(j, compute_box_a)
+         {
+            compute_box = hypre_BoxArrayBox(compute_box_a, j);
+            start = hypre_BoxIMin(compute_box);
+            hypre_BoxGetSize(compute_box, loop_size);
+
+            zypre_BoxLoop3Begin(ndim, loop_size,
+                                A_data_box, start, stride, Ai,
+                                x_data_box, start, stride, xi,
+                                y_data_box, start, stride, yi);
+            {
+               HYPRE_Complex sum;
+               HYPRE_Int     ov, tt;
+
+               for (ov = 0; ov < nvars; ov++)
+               {
+                  sum = 0.0;
+                  for (tt = term_starts[ov]; tt < term_starts[ov + 1]; tt++)
+                  {
+                     sum += Ap[tt][Ai] * xp[xi + xoff[tt]];
+                  }
+                  if (beta == 0.0)
+                  {
+                     yp[ov][yi] = alpha * sum;
+                  }
+                  else
+                  {
+                     yp[ov][yi] = beta * yp[ov][yi] + alpha * sum;
+                  }
+               }
+            }
+            zypre_BoxLoop3End(Ai, xi, yi);
+         }
+      }
+   }
+
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoff, HYPRE_MEMORY_HOST);
+   hypre_TFree(yp, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SStructPMatvecCompute
  *--------------------------------------------------------------------------*/
@@ -96,7 +508,7 @@ hypre_SStructPMatvecCompute( void                 *pmatvec_vdata,
 {
    hypre_SStructPMatvecData   *pmatvec_data = (hypre_SStructPMatvecData   *)pmatvec_vdata;
    HYPRE_Int                   nvars        = (pmatvec_data -> nvars);
-   void                     ***smatvec_data = (pmatvec_data -> smatvec_data);
+   void                     ***smatvec_data;
 
    void                       *sdata;
    hypre_StructMatrix         *sA;
@@ -105,6 +517,34 @@ hypre_SStructPMatvecCompute( void                 *pmatvec_vdata,
 
    HYPRE_Int                  vi, vj;
 
+   if (pmatvec_data -> fused)
+   {
+      if (alpha == 0.0)
+      {
+         for (vi = 0; vi < nvars; vi++)
+         {
+            hypre_StructScale(beta, hypre_SStructPVectorSVector(py, vi));
+         }
+         return hypre_error_flag;
+      }
+
+      /* y must share the layout of x; otherwise use the block matvecs */
+      if (hypre_SStructPMatvecSameLayout(py) &&
+          hypre_SStructPMatvecSameSpace(
+             hypre_StructVectorDataSpace(hypre_SStructPVectorSVector(py, 0)),
+             hypre_StructVectorDataSpace(hypre_SStructPVectorSVector(px, 0))))
+      {
+         return hypre_SStructPMatvecComputeFused(pmatvec_data, alpha, pA, px, beta, py);
+      }
+
+      if ((pmatvec_data -> smatvec_data) == NULL)
+      {
+         hypre_SStructPMatvecSetupBlocks(pmatvec_data, pA, px);
+      }
+   }
+
+   smatvec_data = (pmatvec_data -> smatvec_data);
+
    for (vi = 0; vi < nvars; vi++)
    {
       sy = hypre_SStructPVectorSVector(py, vi);
@@ -154,18 +594,30 @@ hypre_SStructPMatvecDestroy( void *pmatvec_vdata )
    {
       nvars        = (pmatvec_data -> nvars);
       smatvec_data = (pmatvec_data -> smatvec_data);
-      for (vi = 0; vi < nvars; vi++)
+      if (smatvec_data)
       {
-         for (vj = 0; vj < nvars; vj++)
+         for (vi = 0; vi < nvars; vi++)
          {
-            if (smatvec_data[vi][vj] != NULL)
+            for (vj = 0; vj < nvars; vj++)
             {
-               hypre_StructMatvecDestroy(smatvec_data[vi][vj]);
+               if (smatvec_data[vi][vj] != NULL)
+               {
+                  hypre_StructMatvecDestroy(smatvec_data[vi][vj]);
+               }
             }
+            hypre_TFree(smatvec_data[vi], HYPRE_MEMORY_HOST);
          }
-         hypre_TFree(smatvec_data[vi], HYPRE_MEMORY_HOST);
+         hypre_TFree(smatvec_data, HYPRE_MEMORY_HOST);
+      }
+      if (pmatvec_data -> fused)
+      {
+         hypre_ComputePkgDestroy(pmatvec_data -> compute_pkg);
+         hypre_TFree(pmatvec_data -> xdata, HYPRE_MEMORY_HOST);
+         hypre_TFree(pmatvec_data -> xdata_offsets, HYPRE_MEMORY_HOST);
+         hypre_TFree(pmatvec_data -> term_starts, HYPRE_MEMORY_HOST);
+         hypre_TFree(pmatvec_data -> term_vars, HYPRE_MEMORY_HOST);
+         hypre_TFree(pmatvec_data -> term_entries, HYPRE_MEMORY_HOST);
       }
-      hypre_TFree(smatvec_data, HYPRE_MEMORY_HOST);
       hypre_TFree(pmatvec_data, HYPRE_MEMORY_HOST);
    }
 
@@ -277,6 +277,62 @@ hypre_F90_IFACE(hypre_structpfmgsetjacobiweigh, HYPRE_STRUCTPFMGSETJACOBIWEIGH)
                hypre_F90_PassReal (weight) ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPFMGSetRelaxTiling, HYPRE_StructPFMGGetRelaxTiling
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_structpfmgsetrelaxtiling, HYPRE_STRUCTPFMGSETRELAXTILING)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *relax_tiling,
+  hypre_F90_Int *ierr         )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructPFMGSetRelaxTiling(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassInt (relax_tiling) ) );
+}
+
+void
+hypre_F90_IFACE(hypre_structpfmggetrelaxtiling, HYPRE_STRUCTPFMGGETRELAXTILING)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *relax_tiling,
+  hypre_F90_Int *ierr         )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructPFMGGetRelaxTiling(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassIntRef (relax_tiling) ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructPFMGSetRelaxColorSplit, HYPRE_StructPFMGGetRelaxColorSplit
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_structpfmgsetrelaxcolors, HYPRE_STRUCTPFMGSETRELAXCOLORS)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *relax_color_split,
+  hypre_F90_Int *ierr              )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructPFMGSetRelaxColorSplit(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassInt (relax_color_split) ) );
+}
+
+void
+hypre_F90_IFACE(hypre_structpfmggetrelaxcolors, HYPRE_STRUCTPFMGGETRELAXCOLORS)
+( hypre_F90_Obj *solver,
+  hypre_F90_Int *relax_color_split,
+  hypre_F90_Int *ierr              )
+{
+   *ierr = (hypre_F90_Int)
+           ( HYPRE_StructPFMGGetRelaxColorSplit(
+                hypre_F90_PassObj (HYPRE_StructSolver, solver),
+                hypre_F90_PassIntRef (relax_color_split) ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_StructPFMGSetRAPType, HYPRE_StructPFMGSetRapType
  *--------------------------------------------------------------------------*/
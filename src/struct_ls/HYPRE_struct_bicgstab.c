@@ -24,6 +24,9 @@ HYPRE_StructBiCGSTABCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovCommInfo,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_BiCGSTABFunctionsSetFusedOps(bicgstab_functions, hypre_StructKrylovAxpby,
+                                      hypre_StructKrylovAxpyInnerProd,
+                                      hypre_StructKrylovDualAxpyInnerProd);
 
    *solver = ( (HYPRE_StructSolver) hypre_BiCGSTABCreate( bicgstab_functions ) );
 
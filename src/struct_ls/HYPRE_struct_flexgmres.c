@@ -26,6 +26,9 @@ HYPRE_StructFlexGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_FlexGMRESFunctionsSetFusedOps(fgmres_functions, hypre_StructKrylovAxpby,
+                                       hypre_StructKrylovAxpyInnerProd,
+                                       hypre_StructKrylovDualAxpyInnerProd);
 
    *solver = ( (HYPRE_StructSolver) hypre_FlexGMRESCreate( fgmres_functions ) );
 
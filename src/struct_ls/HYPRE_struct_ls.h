@@ -257,6 +257,12 @@ HYPRE_Int HYPRE_StructPFMGSetNonZeroGuess(HYPRE_StructSolver solver);
  *    - 1 : Weighted Jacobi (default)
  *    - 2 : Red/Black Gauss-Seidel (symmetric: RB pre-relaxation, BR post-relaxation)
  *    - 3 : Red/Black Gauss-Seidel (nonsymmetric: RB pre- and post-relaxation)
+ *    - 4 : Zebra line Gauss-Seidel, with lines in the coarsening direction and
+ *          cut at box boundaries (falls back to 2 when data is on the device,
+ *          with a warning if the print level is positive)
+ *
+ * Matrix-free matrices (see \e HYPRE_StructMatrixSetCoeffFcn) require
+ * relax types 0 or 1.
  **/
 HYPRE_Int HYPRE_StructPFMGSetRelaxType(HYPRE_StructSolver solver,
                                        HYPRE_Int          relax_type);
@@ -272,6 +278,43 @@ HYPRE_Int HYPRE_StructPFMGSetJacobiWeight(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGGetJacobiWeight(HYPRE_StructSolver solver,
                                           HYPRE_Real        *weight);
 
+/**
+ * (Optional) Use temporal tiling for Red/Black Gauss-Seidel relaxation
+ * (\e relax_type 2 or 3).  The interior of each box is relaxed for
+ * \e relax_tiling iterations in a single pass over the grid data, using a
+ * plane-by-plane wavefront, and only the points near box boundaries are
+ * relaxed one sweep at a time with the usual ghost exchanges.  The results
+ * are identical to untiled relaxation.  The number of iterations per pass
+ * is limited by the number of pre- and post-relaxation sweeps.  Tiling
+ * applies to 2D and 3D problems on CPU builds without OpenMP and is
+ * otherwise ignored.  The default is 0 (no tiling).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetRelaxTiling(HYPRE_StructSolver solver,
+                                         HYPRE_Int          relax_tiling);
+
+HYPRE_Int HYPRE_StructPFMGGetRelaxTiling(HYPRE_StructSolver solver,
+                                         HYPRE_Int         *relax_tiling);
+
+/**
+ * (Optional) Use color-split storage for Red/Black Gauss-Seidel relaxation
+ * (\e relax_type 2 or 3).  The points of each color are stored contiguously,
+ * so that each half sweep is a unit stride loop that can be vectorized.  The
+ * matrix coefficients are converted once during setup, which needs memory
+ * for a second copy of the level matrices, and the vectors are converted on
+ * each call of the smoother.  Since the vector conversion costs about as much
+ * as a sweep, the split storage is only used when the smoother does two or
+ * more sweeps per call (see \e HYPRE_StructPFMGSetNumPreRelax and
+ * \e HYPRE_StructPFMGSetNumPostRelax).  The results are identical to the default
+ * storage.  Color splitting applies to CPU builds, takes precedence over
+ * \e relax_tiling when it is used, and is otherwise ignored.  The default is 0 (no color
+ * splitting).
+ **/
+HYPRE_Int HYPRE_StructPFMGSetRelaxColorSplit(HYPRE_StructSolver solver,
+                                             HYPRE_Int          relax_color_split);
+
+HYPRE_Int HYPRE_StructPFMGGetRelaxColorSplit(HYPRE_StructSolver solver,
+                                             HYPRE_Int         *relax_color_split);
+
 
 /**
  * (Optional) Set type of coarse-grid operator to use.
@@ -31,6 +31,9 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetFusedOps(pcg_functions, hypre_StructKrylovAxpby,
+                                 hypre_StructKrylovAxpyInnerProd,
+                                 hypre_StructKrylovDualAxpyInnerProd);
 
    *solver = ( (HYPRE_StructSolver) hypre_PCGCreate( pcg_functions ) );
 
@@ -182,6 +182,40 @@ HYPRE_StructPFMGGetJacobiWeight(HYPRE_StructSolver solver,
    return ( hypre_PFMGGetJacobiWeight( (void *) solver, weight) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetRelaxTiling( HYPRE_StructSolver solver,
+                                HYPRE_Int          relax_tiling )
+{
+   return ( hypre_PFMGSetRelaxTiling( (void *) solver, relax_tiling) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetRelaxTiling( HYPRE_StructSolver solver,
+                                HYPRE_Int        * relax_tiling )
+{
+   return ( hypre_PFMGGetRelaxTiling( (void *) solver, relax_tiling) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructPFMGSetRelaxColorSplit( HYPRE_StructSolver solver,
+                                    HYPRE_Int          relax_color_split )
+{
+   return ( hypre_PFMGSetRelaxColorSplit( (void *) solver, relax_color_split) );
+}
+
+HYPRE_Int
+HYPRE_StructPFMGGetRelaxColorSplit( HYPRE_StructSolver solver,
+                                    HYPRE_Int        * relax_color_split )
+{
+   return ( hypre_PFMGGetRelaxColorSplit( (void *) solver, relax_color_split) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -468,6 +468,9 @@ hypre_HybridSolveUsePCG( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_PCGFunctionsSetFusedOps(pcg_functions, hypre_StructKrylovAxpby,
+                                 hypre_StructKrylovAxpyInnerProd,
+                                 hypre_StructKrylovDualAxpyInnerProd);
    krylov_solver = hypre_PCGCreate( pcg_functions );
 
    hypre_PCGSetTol(krylov_solver, tol);
@@ -539,6 +542,9 @@ hypre_HybridSolveUseBiCGSTAB( hypre_HybridData  *hybrid_data )
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovCommInfo,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
+   hypre_BiCGSTABFunctionsSetFusedOps(bicgstab_functions, hypre_StructKrylovAxpby,
+                                      hypre_StructKrylovAxpyInnerProd,
+                                      hypre_StructKrylovDualAxpyInnerProd);
    krylov_solver = hypre_BiCGSTABCreate( bicgstab_functions );
 
    hypre_BiCGSTABSetTol(krylov_solver, tol);
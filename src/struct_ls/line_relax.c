@@ -0,0 +1,772 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Line relaxation: solves the tridiagonal systems along grid lines in
+ * direction 'dir' exactly, moving all other couplings to the right-hand side.
+ *
+ * Lines are cut at box boundaries, so the solve is exact only when every line
+ * lies within a single box (see hypre_LineRelaxGetIsExact).  Lines are
+ * processed in batches of hypre_LINE_RELAX_NLANES: their coefficients are
+ * gathered into lane-interleaved buffers so that the Thomas recurrences run
+ * across the lines of a batch in the innermost (vectorizable) loop.
+ *
+ * With two colors, the lines are relaxed in zebra (red/black line) order.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+
+/* number of lines solved together (a multiple of the SIMD width) */
+#define hypre_LINE_RELAX_NLANES 8
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   MPI_Comm                comm;
+
+   HYPRE_Int               max_iter;
+   HYPRE_Int               zero_guess;
+   HYPRE_Int               dir;          /* direction of the lines */
+   HYPRE_Int               num_colors;   /* 1 (all lines at once) or 2 (zebra) */
+   HYPRE_Int               start_color;
+   hypre_Index             base_index;
+   hypre_Index             base_stride;
+
+   hypre_StructMatrix     *A;
+   hypre_StructVector     *b;
+   hypre_StructVector     *x;
+
+   HYPRE_Int               is_exact;     /* every line lies within one box on
+                                            every process and A is tridiagonal
+                                            along the lines */
+   HYPRE_Int               is_batched;   /* every box has at least one full
+                                            batch of lines */
+   hypre_CommPkg          *comm_pkg;     /* NULL if no ghost values are used */
+
+   /* log info (always logged) */
+   HYPRE_Int               num_iterations;
+   HYPRE_Int               time_index;
+   HYPRE_BigInt            flops;
+
+} hypre_LineRelaxData;
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_LineRelaxCreate( MPI_Comm  comm )
+{
+   hypre_LineRelaxData *relax_data;
+
+   relax_data = hypre_CTAlloc(hypre_LineRelaxData, 1, HYPRE_MEMORY_HOST);
+
+   (relax_data -> comm)       = comm;
+   (relax_data -> time_index) = hypre_InitializeTiming("LineRelax");
+
+   /* set defaults */
+   (relax_data -> max_iter)   = 1;
+   (relax_data -> zero_guess) = 0;
+   (relax_data -> dir)        = 0;
+   (relax_data -> num_colors) = 1;
+   (relax_data -> start_color) = 0;
+   hypre_SetIndex3((relax_data -> base_index), 0, 0, 0);
+   hypre_SetIndex3((relax_data -> base_stride), 1, 1, 1);
+   (relax_data -> A)          = NULL;
+   (relax_data -> b)          = NULL;
+   (relax_data -> x)          = NULL;
+   (relax_data -> is_exact)   = 0;
+   (relax_data -> is_batched) = 0;
+   (relax_data -> comm_pkg)   = NULL;
+
+   return (void *) relax_data;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxDestroy( void *relax_vdata )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   if (relax_data)
+   {
+      hypre_StructMatrixDestroy(relax_data -> A);
+      hypre_StructVectorDestroy(relax_data -> b);
+      hypre_StructVectorDestroy(relax_data -> x);
+      hypre_CommPkgDestroy(relax_data -> comm_pkg);
+      hypre_FinalizeTiming(relax_data -> time_index);
+      hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Determines whether the line solves are exact and sets up the ghost value
+ * exchange for the couplings that they can't see.  This is collective.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetup( void               *relax_vdata,
+                      hypre_StructMatrix *A,
+                      hypre_StructVector *b,
+                      hypre_StructVector *x )
+{
+   hypre_LineRelaxData   *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   HYPRE_Int              dir         = (relax_data -> dir);
+   hypre_StructGrid      *grid        = hypre_StructMatrixGrid(A);
+   hypre_StructStencil   *stencil     = hypre_StructMatrixStencil(A);
+   hypre_Index           *shape       = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int              ndim        = hypre_StructGridNDim(grid);
+   hypre_BoxArray        *boxes       = hypre_StructGridBoxes(grid);
+   hypre_BoxManager      *boxman      = hypre_StructGridBoxMan(grid);
+   hypre_CommInfo        *comm_info;
+   hypre_CommPkg         *comm_pkg;
+   hypre_BoxManEntry    **entries;
+   hypre_Box             *box, *face_box;
+   hypre_Index            loop_size;
+   HYPRE_Int              nentries, in_line, is_exact, global_is_exact;
+   HYPRE_Int              num_lines, flags[2], global_flags[2];
+   HYPRE_Int              i, s, d, side;
+
+   /*----------------------------------------------------------
+    * The solves are exact if A has only couplings to the two line
+    * neighbors and no box has a neighbor box along the lines (we
+    * also require host memory, since the solves run on the host)
+    *----------------------------------------------------------*/
+
+   is_exact = (hypre_IndexD(hypre_StructGridPeriodic(grid), dir) == 0) &&
+              (hypre_IndexD(relax_data -> base_stride, dir) == 1) &&
+              (hypre_GetActualMemLocation(hypre_StructMatrixMemoryLocation(A)) ==
+               hypre_MEMORY_HOST);
+
+   for (s = 0; s < stencil_size; s++)
+   {
+      in_line = (hypre_abs(hypre_IndexD(shape[s], dir)) <= 1);
+      for (d = 0; d < ndim; d++)
+      {
+         if ((d != dir) && (hypre_IndexD(shape[s], d) != 0))
+         {
+            in_line = 0;
+         }
+      }
+      if (!in_line)
+      {
+         is_exact = 0;
+      }
+   }
+
+   face_box = hypre_BoxCreate(ndim);
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      for (side = 0; (side < 2) && is_exact; side++)
+      {
+         hypre_CopyBox(box, face_box);
+         if (side == 0)
+         {
+            hypre_BoxIMinD(face_box, dir) = hypre_BoxIMinD(box, dir) - 1;
+            hypre_BoxIMaxD(face_box, dir) = hypre_BoxIMinD(box, dir) - 1;
+         }
+         else
+         {
+            hypre_BoxIMinD(face_box, dir) = hypre_BoxIMaxD(box, dir) + 1;
+            hypre_BoxIMaxD(face_box, dir) = hypre_BoxIMaxD(box, dir) + 1;
+         }
+         hypre_BoxManIntersect(boxman, hypre_BoxIMin(face_box), hypre_BoxIMax(face_box),
+                               &entries, &nentries);
+         hypre_TFree(entries, HYPRE_MEMORY_HOST);
+         if (nentries > 0)
+         {
+            is_exact = 0;
+         }
+      }
+   }
+   hypre_BoxDestroy(face_box);
+
+   /* count the lines of each (nonempty) box */
+   flags[1] = 1;
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      if (hypre_BoxVolume(box) > 0)
+      {
+         hypre_BoxGetStrideSize(box, (relax_data -> base_stride), loop_size);
+         num_lines = 1;
+         for (d = 0; d < ndim; d++)
+         {
+            if (d != dir)
+            {
+               num_lines *= hypre_IndexD(loop_size, d);
+            }
+         }
+         if (num_lines < hypre_LINE_RELAX_NLANES)
+         {
+            flags[1] = 0;
+         }
+      }
+   }
+
+   flags[0] = is_exact;
+   hypre_MPI_Allreduce(flags, global_flags, 2, HYPRE_MPI_INT,
+                       hypre_MPI_MIN, (relax_data -> comm));
+   global_is_exact = global_flags[0];
+
+   /*----------------------------------------------------------
+    * Exact solves only touch box-local values, otherwise we need
+    * ghost values for all of the stencil
+    *----------------------------------------------------------*/
+
+   comm_pkg = NULL;
+   if (!global_is_exact)
+   {
+      hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
+      hypre_CommPkgCreate(comm_info,
+                          hypre_StructVectorDataSpace(x),
+                          hypre_StructVectorDataSpace(x),
+                          1, NULL, 0, hypre_StructVectorComm(x), &comm_pkg);
+      hypre_CommInfoDestroy(comm_info);
+   }
+
+   /*----------------------------------------------------------
+    * Set up the relax data structure
+    *----------------------------------------------------------*/
+
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   hypre_CommPkgDestroy(relax_data -> comm_pkg);
+   (relax_data -> A)        = hypre_StructMatrixRef(A);
+   (relax_data -> b)        = hypre_StructVectorRef(b);
+   (relax_data -> x)        = hypre_StructVectorRef(x);
+   (relax_data -> is_exact)   = global_is_exact;
+   (relax_data -> is_batched) = global_flags[1];
+   (relax_data -> comm_pkg)   = comm_pkg;
+
+   (relax_data -> flops) = (HYPRE_BigInt)(hypre_StructVectorGlobalSize(x) *
+                                          (8 + 2 * stencil_size));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Solve the 'nlanes' lines of length 'n' starting at data indices Ai[l],
+ * bi[l], xi[l] with the Thomas algorithm.  The eliminated systems are stored
+ * lane-interleaved in the workspace (entry k of lane l at
+ * k*hypre_LINE_RELAX_NLANES + l), so the recurrences are vectorized across
+ * the lines.  If 'cut_ends' is set, the
+ * couplings past either end of the lines are dropped (they point outside of
+ * the grid when the solves are exact).
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_LineRelaxBatch( HYPRE_Int       nlanes,
+                      HYPRE_Int       n,
+                      HYPRE_Int      *Ai,
+                      HYPRE_Int      *bi,
+                      HYPRE_Int      *xi,
+                      HYPRE_Int       Astride,
+                      HYPRE_Int       bstride,
+                      HYPRE_Int       xstride,
+                      HYPRE_Int       stencil_size,
+                      HYPRE_Real    **Ap,
+                      HYPRE_Int      *Aconst,
+                      HYPRE_Int      *xoffsets,
+                      HYPRE_Int       lower,
+                      HYPRE_Int       diag,
+                      HYPRE_Int       upper,
+                      HYPRE_Int       cut_ends,
+                      HYPRE_Real     *bp,
+                      HYPRE_Real     *xp,
+                      HYPRE_Real     *wc,
+                      HYPRE_Real     *wf )
+{
+   const HYPRE_Int  W = hypre_LINE_RELAX_NLANES;
+   HYPRE_Int        Ao[hypre_LINE_RELAX_NLANES];
+   HYPRE_Real       a[hypre_LINE_RELAX_NLANES];
+   HYPRE_Real       d[hypre_LINE_RELAX_NLANES];
+   HYPRE_Real       c[hypre_LINE_RELAX_NLANES];
+   HYPRE_Real       f[hypre_LINE_RELAX_NLANES];
+   HYPRE_Int        k, l, s, kw;
+   HYPRE_Real       denom;
+
+   /* unused lanes get identity systems */
+   for (l = 0; l < W; l++)
+   {
+      a[l] = 0.0;
+      d[l] = 1.0;
+      c[l] = 0.0;
+      f[l] = 0.0;
+   }
+
+   /*-----------------------------------------------------------
+    * Gather row k of the line systems and eliminate it right away
+    * (forward sweep of the Thomas algorithm).  Couplings off the
+    * line (and past either end of it) use the current values of x.
+    *-----------------------------------------------------------*/
+
+   for (k = 0; k < n; k++)
+   {
+      kw = k * W;
+
+      for (l = 0; l < nlanes; l++)
+      {
+         Ao[l] = Ai[l] + k * Astride;
+         d[l]  = Ap[diag][Aconst[diag] ? 0 : Ao[l]];
+         f[l]  = bp[bi[l] + k * bstride];
+      }
+      if (lower > -1)
+      {
+         for (l = 0; l < nlanes; l++)
+         {
+            a[l] = Ap[lower][Aconst[lower] ? 0 : Ao[l]];
+         }
+      }
+      if (upper > -1)
+      {
+         for (l = 0; l < nlanes; l++)
+         {
+            c[l] = Ap[upper][Aconst[upper] ? 0 : Ao[l]];
+         }
+      }
+
+      for (s = 0; s < stencil_size; s++)
+      {
+         if ((s != lower) && (s != diag) && (s != upper))
+         {
+            for (l = 0; l < nlanes; l++)
+            {
+               f[l] -= Ap[s][Aconst[s] ? 0 : Ao[l]] *
+                       xp[xi[l] + k * xstride + xoffsets[s]];
+            }
+         }
+      }
+
+      if (k == 0)
+      {
+         for (l = 0; l < nlanes; l++)
+         {
+            if (!cut_ends)
+            {
+               f[l] -= a[l] * xp[xi[l] - xstride];
+            }
+            a[l] = 0.0;
+         }
+      }
+      if (k == n - 1)
+      {
+         for (l = 0; l < nlanes; l++)
+         {
+            if (!cut_ends)
+            {
+               f[l] -= c[l] * xp[xi[l] + n * xstride];
+            }
+            c[l] = 0.0;
+         }
+      }
+
+      if (k == 0)
+      {
+         for (l = 0; l < W; l++)
+         {
+            denom  = 1.0 / d[l];
+            wc[l]  = c[l] * denom;
+            wf[l]  = f[l] * denom;
+         }
+      }
+      else
+      {
+         for (l = 0; l < W; l++)
+         {
+            denom      = 1.0 / (d[l] - a[l] * wc[kw - W + l]);
+            wc[kw + l] = c[l] * denom;
+            wf[kw + l] = (f[l] - a[l] * wf[kw - W + l]) * denom;
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Back substitution, scattering the solutions into x
+    *-----------------------------------------------------------*/
+
+   for (k = n - 2; k >= 0; k--)
+   {
+      kw = k * W;
+      for (l = 0; l < W; l++)
+      {
+         wf[kw + l] -= wc[kw + l] * wf[kw + W + l];
+      }
+   }
+   for (k = 0; k < n; k++)
+   {
+      kw = k * W;
+      for (l = 0; l < nlanes; l++)
+      {
+         xp[xi[l] + k * xstride] = wf[kw + l];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelax( void               *relax_vdata,
+                 hypre_StructMatrix *A,
+                 hypre_StructVector *b,
+                 hypre_StructVector *x )
+{
+   hypre_LineRelaxData   *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   const HYPRE_Int        W           = hypre_LINE_RELAX_NLANES;
+   HYPRE_Int              max_iter    = (relax_data -> max_iter);
+   HYPRE_Int              zero_guess  = (relax_data -> zero_guess);
+   HYPRE_Int              dir         = (relax_data -> dir);
+   HYPRE_Int              num_colors  = (relax_data -> num_colors);
+   HYPRE_Int              start_color = (relax_data -> start_color);
+   HYPRE_Int              is_exact    = (relax_data -> is_exact);
+   hypre_IndexRef         base_index  = (relax_data -> base_index);
+   hypre_IndexRef         base_stride = (relax_data -> base_stride);
+   hypre_CommPkg         *comm_pkg    = (relax_data -> comm_pkg);
+   HYPRE_Int              constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
+
+   hypre_StructGrid      *grid        = hypre_StructMatrixGrid(A);
+   hypre_BoxArray        *boxes       = hypre_StructGridBoxes(grid);
+   hypre_StructStencil   *stencil     = hypre_StructMatrixStencil(A);
+   hypre_Index           *shape       = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int              ndim        = hypre_StructGridNDim(grid);
+
+   hypre_CommHandle      *comm_handle;
+   hypre_Box             *line_box;
+   hypre_Box             *A_dbox, *b_dbox, *x_dbox;
+   HYPRE_Real           **Ap;
+   HYPRE_Real            *bp, *xp;
+   HYPRE_Real            *wc, *wf;
+   HYPRE_Int             *Aconst, *xoffsets;
+   HYPRE_Int              lower, diag, upper;
+   HYPRE_Int              Ai[hypre_LINE_RELAX_NLANES];
+   HYPRE_Int              bi[hypre_LINE_RELAX_NLANES];
+   HYPRE_Int              xi[hypre_LINE_RELAX_NLANES];
+   HYPRE_Int              Astride, bstride, xstride;
+   hypre_Index            unit, start, loop_size, lindex;
+   HYPRE_Int              max_n, n, nlanes, color, parity;
+   HYPRE_Int              iter, ic, c, i, s, d;
+
+   hypre_BeginTiming(relax_data -> time_index);
+
+   hypre_StructMatrixDestroy(relax_data -> A);
+   hypre_StructVectorDestroy(relax_data -> b);
+   hypre_StructVectorDestroy(relax_data -> x);
+   (relax_data -> A) = hypre_StructMatrixRef(A);
+   (relax_data -> x) = hypre_StructVectorRef(x);
+   (relax_data -> b) = hypre_StructVectorRef(b);
+
+   (relax_data -> num_iterations) = 0;
+
+   /*----------------------------------------------------------
+    * Special cases
+    *----------------------------------------------------------*/
+
+   /* if max_iter is zero, return */
+   if (max_iter == 0)
+   {
+      /* if using a zero initial guess, return zero */
+      if (zero_guess)
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
+   if (zero_guess)
+   {
+      hypre_StructVectorSetConstantValues(x, 0.0);
+   }
+
+   /*----------------------------------------------------------
+    * Classify the stencil entries
+    *----------------------------------------------------------*/
+
+   Ap       = hypre_TAlloc(HYPRE_Real *, stencil_size, HYPRE_MEMORY_HOST);
+   Aconst   = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   xoffsets = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+
+   lower = -1;
+   diag  = -1;
+   upper = -1;
+   for (s = 0; s < stencil_size; s++)
+   {
+      HYPRE_Int on_line = 1;
+
+      for (d = 0; d < ndim; d++)
+      {
+         if ((d != dir) && (hypre_IndexD(shape[s], d) != 0))
+         {
+            on_line = 0;
+         }
+      }
+      if (on_line)
+      {
+         switch (hypre_IndexD(shape[s], dir))
+         {
+            case -1: lower = s; break;
+            case  0: diag  = s; break;
+            case  1: upper = s; break;
+         }
+      }
+   }
+
+   for (s = 0; s < stencil_size; s++)
+   {
+      Aconst[s] = (constant_coefficient == 1) ||
+                  ((constant_coefficient == 2) && (s != diag));
+   }
+
+   hypre_SetIndex(unit, 0);
+   hypre_IndexD(unit, dir) = 1;
+
+   max_n = 0;
+   hypre_ForBoxI(i, boxes)
+   {
+      max_n = hypre_max(max_n, hypre_BoxSizeD(hypre_BoxArrayBox(boxes, i), dir));
+   }
+   wc = hypre_TAlloc(HYPRE_Real, 2 * W * max_n, HYPRE_MEMORY_HOST);
+   wf = wc + W * max_n;
+
+   line_box = hypre_BoxCreate(ndim);
+
+   /*----------------------------------------------------------
+    * Do the relaxation
+    *----------------------------------------------------------*/
+
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      for (ic = 0; ic < num_colors; ic++)
+      {
+         c = (ic + start_color) % num_colors;
+
+         if (comm_pkg)
+         {
+            xp = hypre_StructVectorData(x);
+            hypre_InitializeCommunication(comm_pkg, xp, xp, 0, 0, &comm_handle);
+            hypre_FinalizeCommunication(comm_handle);
+         }
+
+         hypre_ForBoxI(i, boxes)
+         {
+            A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+            b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+            x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+
+            bp = hypre_StructVectorBoxData(b, i);
+            xp = hypre_StructVectorBoxData(x, i);
+            for (s = 0; s < stencil_size; s++)
+            {
+               Ap[s] = hypre_StructMatrixBoxData(A, i, s);
+               xoffsets[s] = hypre_BoxOffsetDistance(x_dbox, shape[s]);
+            }
+            Astride = (constant_coefficient == 1) ? 0 : hypre_BoxOffsetDistance(A_dbox, unit);
+            bstride = hypre_BoxOffsetDistance(b_dbox, unit);
+            xstride = hypre_BoxOffsetDistance(x_dbox, unit);
+
+            /* one loop point per line: project onto the base lattice and
+               collapse the box in the line direction */
+            hypre_CopyBox(hypre_BoxArrayBox(boxes, i), line_box);
+            hypre_ProjectBox(line_box, base_index, base_stride);
+            n = hypre_BoxSizeD(line_box, dir);
+            if (hypre_BoxVolume(line_box) == 0)
+            {
+               continue;
+            }
+            hypre_BoxIMaxD(line_box, dir) = hypre_BoxIMinD(line_box, dir);
+            hypre_BoxGetStrideSize(line_box, base_stride, loop_size);
+
+            nlanes = 0;
+            hypre_SerialBoxLoop0Begin(ndim, loop_size);
+            {
+               hypre_BoxLoopGetIndex(lindex);
+               parity = 0;
+               for (d = 0; d < ndim; d++)
+               {
+                  hypre_IndexD(start, d) = hypre_BoxIMinD(line_box, d) +
+                                           hypre_IndexD(lindex, d) * hypre_IndexD(base_stride, d);
+                  if (d != dir)
+                  {
+                     parity += hypre_IndexD(start, d);
+                  }
+               }
+               color = (num_colors > 1) ? ((parity % 2) + 2) % 2 : 0;
+
+               if (color == c)
+               {
+                  Ai[nlanes] = (constant_coefficient == 1) ? 0 : hypre_BoxIndexRank(A_dbox, start);
+                  bi[nlanes] = hypre_BoxIndexRank(b_dbox, start);
+                  xi[nlanes] = hypre_BoxIndexRank(x_dbox, start);
+                  nlanes++;
+
+                  if (nlanes == W)
+                  {
+                     hypre_LineRelaxBatch(nlanes, n, Ai, bi, xi, Astride, bstride, xstride,
+                                          stencil_size, Ap, Aconst, xoffsets,
+                                          lower, diag, upper, is_exact, bp, xp, wc, wf);
+                     nlanes = 0;
+                  }
+               }
+            }
+            hypre_SerialBoxLoop0End();
+
+            if (nlanes > 0)
+            {
+               hypre_LineRelaxBatch(nlanes, n, Ai, bi, xi, Astride, bstride, xstride,
+                                    stencil_size, Ap, Aconst, xoffsets,
+                                    lower, diag, upper, is_exact, bp, xp, wc, wf);
+            }
+         }
+      }
+
+      (relax_data -> num_iterations) = (iter + 1);
+   }
+
+   hypre_BoxDestroy(line_box);
+   hypre_TFree(wc, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(Aconst, HYPRE_MEMORY_HOST);
+   hypre_TFree(xoffsets, HYPRE_MEMORY_HOST);
+
+   hypre_IncFLOPCount((relax_data -> flops) * max_iter);
+   hypre_EndTiming(relax_data -> time_index);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetDir( void      *relax_vdata,
+                       HYPRE_Int  dir )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> dir) = dir;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetNumColors( void      *relax_vdata,
+                             HYPRE_Int  num_colors )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> num_colors) = num_colors;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetStartColor( void      *relax_vdata,
+                              HYPRE_Int  start_color )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> start_color) = start_color;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * The base stride must be 1 in the line direction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetBase( void        *relax_vdata,
+                        hypre_Index  base_index,
+                        hypre_Index  base_stride )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   hypre_CopyIndex(base_index,  (relax_data -> base_index));
+   hypre_CopyIndex(base_stride, (relax_data -> base_stride));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetMaxIter( void      *relax_vdata,
+                           HYPRE_Int  max_iter )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> max_iter) = max_iter;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxSetZeroGuess( void      *relax_vdata,
+                             HYPRE_Int  zero_guess )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   (relax_data -> zero_guess) = zero_guess;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if one sweep solves A x = b exactly (available after setup)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxGetIsExact( void      *relax_vdata,
+                           HYPRE_Int *is_exact )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   *is_exact = (relax_data -> is_exact);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if every box has at least one full batch of lines, i.e., if the
+ * solves vectorize across lines everywhere (available after setup)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_LineRelaxGetIsBatched( void      *relax_vdata,
+                             HYPRE_Int *is_batched )
+{
+   hypre_LineRelaxData *relax_data = (hypre_LineRelaxData *)relax_vdata;
+
+   *is_batched = (relax_data -> is_batched);
+
+   return hypre_error_flag;
+}
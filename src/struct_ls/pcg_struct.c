@@ -182,6 +182,50 @@ hypre_StructKrylovAxpy( HYPRE_Complex alpha,
                               (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovAxpby( HYPRE_Complex alpha,
+                         void         *x,
+                         HYPRE_Complex beta,
+                         void         *y )
+{
+   return ( hypre_StructAxpby( alpha, (hypre_StructVector *) x,
+                               beta, (hypre_StructVector *) y ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructKrylovAxpyInnerProd( HYPRE_Complex alpha,
+                                 void         *x,
+                                 void         *y,
+                                 void         *z )
+{
+   return ( hypre_StructAxpyInnerProd( alpha, (hypre_StructVector *) x,
+                                       (hypre_StructVector *) y,
+                                       (hypre_StructVector *) z ) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructKrylovDualAxpyInnerProd( HYPRE_Complex alpha,
+                                     void         *x1,
+                                     void         *y1,
+                                     HYPRE_Complex beta,
+                                     void         *x2,
+                                     void         *y2 )
+{
+   return ( hypre_StructDualAxpyInnerProd( alpha, (hypre_StructVector *) x1,
+                                           (hypre_StructVector *) y1, beta,
+                                           (hypre_StructVector *) x2,
+                                           (hypre_StructVector *) y2 ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
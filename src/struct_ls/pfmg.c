@@ -33,6 +33,8 @@ hypre_PFMGCreate( MPI_Comm  comm )
    (pfmg_data -> relax_type)        = 1;       /* weighted Jacobi */
    (pfmg_data -> jacobi_weight)     = 0.0;
    (pfmg_data -> usr_jacobi_weight) = 0;    /* no user Jacobi weight */
+   (pfmg_data -> relax_tiling)      = 0;    /* no temporal tiling */
+   (pfmg_data -> relax_color_split) = 0;    /* stride-two red-black kernels */
    (pfmg_data -> rap_type)          = 0;
    (pfmg_data -> num_pre_relax)     = 1;
    (pfmg_data -> num_post_relax)    = 1;
@@ -305,6 +307,56 @@ hypre_PFMGGetJacobiWeight( void  *pfmg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetRelaxTiling( void      *pfmg_vdata,
+                          HYPRE_Int  relax_tiling )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> relax_tiling) = relax_tiling;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetRelaxTiling( void      *pfmg_vdata,
+                          HYPRE_Int *relax_tiling )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *relax_tiling = (pfmg_data -> relax_tiling);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGSetRelaxColorSplit( void      *pfmg_vdata,
+                              HYPRE_Int  relax_color_split )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   (pfmg_data -> relax_color_split) = relax_color_split;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PFMGGetRelaxColorSplit( void      *pfmg_vdata,
+                              HYPRE_Int *relax_color_split )
+{
+   hypre_PFMGData *pfmg_data = (hypre_PFMGData *)pfmg_vdata;
+
+   *relax_color_split = (pfmg_data -> relax_color_split);
+
+   return hypre_error_flag;
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
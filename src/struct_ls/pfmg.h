@@ -31,6 +31,8 @@ typedef struct
    HYPRE_Int             relax_type;     /* type of relaxation to use */
    HYPRE_Real            jacobi_weight;  /* weighted jacobi weight */
    HYPRE_Int             usr_jacobi_weight; /* indicator flag for user weight */
+   HYPRE_Int             relax_tiling;   /* red-black iterations per tiled pass */
+   HYPRE_Int             relax_color_split; /* color-split red-black storage */
 
    HYPRE_Int             rap_type;       /* controls choice of RAP codes */
    HYPRE_Int             num_pre_relax;  /* number of pre relaxation sweeps */
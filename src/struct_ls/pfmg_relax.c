@@ -14,6 +14,7 @@ typedef struct
 {
    void                   *relax_data;
    void                   *rb_relax_data;
+   void                   *line_relax_data;
    HYPRE_Int               relax_type;
    HYPRE_Real              jacobi_weight;
 
@@ -30,6 +31,8 @@ hypre_PFMGRelaxCreate( MPI_Comm  comm )
    pfmg_relax_data = hypre_CTAlloc(hypre_PFMGRelaxData,  1, HYPRE_MEMORY_HOST);
    (pfmg_relax_data -> relax_data) = hypre_PointRelaxCreate(comm);
    (pfmg_relax_data -> rb_relax_data) = hypre_RedBlackGSCreate(comm);
+   (pfmg_relax_data -> line_relax_data) = hypre_LineRelaxCreate(comm);
+   hypre_LineRelaxSetNumColors((pfmg_relax_data -> line_relax_data), 2);
    (pfmg_relax_data -> relax_type) = 0;        /* Weighted Jacobi */
    (pfmg_relax_data -> jacobi_weight) = 0.0;
 
@@ -48,6 +51,7 @@ hypre_PFMGRelaxDestroy( void *pfmg_relax_vdata )
    {
       hypre_PointRelaxDestroy(pfmg_relax_data -> relax_data);
       hypre_RedBlackGSDestroy(pfmg_relax_data -> rb_relax_data);
+      hypre_LineRelaxDestroy(pfmg_relax_data -> line_relax_data);
       hypre_TFree(pfmg_relax_data, HYPRE_MEMORY_HOST);
    }
 
@@ -85,6 +89,9 @@ hypre_PFMGRelax( void               *pfmg_relax_vdata,
             hypre_RedBlackGS((pfmg_relax_data -> rb_relax_data), A, b, x);
          }
 
+         break;
+      case 4:
+         hypre_LineRelax((pfmg_relax_data -> line_relax_data), A, b, x);
          break;
    }
 
@@ -104,6 +111,15 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
    HYPRE_Int            relax_type       = (pfmg_relax_data -> relax_type);
    HYPRE_Real           jacobi_weight    = (pfmg_relax_data -> jacobi_weight);
 
+   /* line relaxation runs on the host, so fall back to red-black GS for data
+      on the device (as documented for HYPRE_StructPFMGSetRelaxType) */
+   if ((relax_type == 4) &&
+       (hypre_GetActualMemLocation(hypre_StructMatrixMemoryLocation(A)) != hypre_MEMORY_HOST))
+   {
+      relax_type = 2;
+      (pfmg_relax_data -> relax_type) = relax_type;
+   }
+
    switch (relax_type)
    {
       case 0:
@@ -114,6 +130,9 @@ hypre_PFMGRelaxSetup( void               *pfmg_relax_vdata,
       case 3:
          hypre_RedBlackGSSetup((pfmg_relax_data -> rb_relax_data), A, b, x);
          break;
+      case 4:
+         hypre_LineRelaxSetup((pfmg_relax_data -> line_relax_data), A, b, x);
+         break;
    }
 
    if (relax_type == 1)
@@ -154,6 +173,7 @@ hypre_PFMGRelaxSetType( void  *pfmg_relax_vdata,
 
       case 2: /* Red-Black Gauss-Seidel */
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
+      case 4: /* Zebra line Gauss-Seidel */
          break;
    }
 
@@ -174,6 +194,34 @@ hypre_PFMGRelaxSetJacobiWeight(void  *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetTiling( void      *pfmg_relax_vdata,
+                          HYPRE_Int  relax_tiling )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_RedBlackGSSetTiling((pfmg_relax_data -> rb_relax_data), relax_tiling);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetColorSplit( void      *pfmg_relax_vdata,
+                              HYPRE_Int  relax_color_split )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_RedBlackGSSetColorSplit((pfmg_relax_data -> rb_relax_data), relax_color_split);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -196,6 +244,10 @@ hypre_PFMGRelaxSetPreRelax( void  *pfmg_relax_vdata )
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
          break;
+
+      case 4: /* Zebra line Gauss-Seidel */
+         hypre_LineRelaxSetStartColor((pfmg_relax_data -> line_relax_data), 0);
+         break;
    }
 
    return hypre_error_flag;
@@ -223,6 +275,10 @@ hypre_PFMGRelaxSetPostRelax( void  *pfmg_relax_vdata )
       case 3: /* Red-Black Gauss-Seidel (non-symmetric) */
          hypre_RedBlackGSSetStartRed((pfmg_relax_data -> rb_relax_data));
          break;
+
+      case 4: /* Zebra line Gauss-Seidel */
+         hypre_LineRelaxSetStartColor((pfmg_relax_data -> line_relax_data), 1);
+         break;
    }
 
    return hypre_error_flag;
@@ -254,6 +310,7 @@ hypre_PFMGRelaxSetMaxIter( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetMaxIter((pfmg_relax_data -> relax_data), max_iter);
    hypre_RedBlackGSSetMaxIter((pfmg_relax_data -> rb_relax_data), max_iter);
+   hypre_LineRelaxSetMaxIter((pfmg_relax_data -> line_relax_data), max_iter);
 
    return hypre_error_flag;
 }
@@ -269,6 +326,7 @@ hypre_PFMGRelaxSetZeroGuess( void  *pfmg_relax_vdata,
 
    hypre_PointRelaxSetZeroGuess((pfmg_relax_data -> relax_data), zero_guess);
    hypre_RedBlackGSSetZeroGuess((pfmg_relax_data -> rb_relax_data), zero_guess);
+   hypre_LineRelaxSetZeroGuess((pfmg_relax_data -> line_relax_data), zero_guess);
 
    return hypre_error_flag;
 }
@@ -287,3 +345,18 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * Set the direction of the lines for line relaxation
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetLineDir( void      *pfmg_relax_vdata,
+                           HYPRE_Int  line_dir )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_LineRelaxSetDir((pfmg_relax_data -> line_relax_data), line_dir);
+
+   return hypre_error_flag;
+}
@@ -72,6 +72,8 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             relax_type =       (pfmg_data -> relax_type);
    HYPRE_Int             usr_jacobi_weight = (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
+   HYPRE_Int             relax_tiling     = (pfmg_data -> relax_tiling);
+   HYPRE_Int             relax_color_split = (pfmg_data -> relax_color_split);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
@@ -100,6 +102,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Real           *mean, *deviation;
    HYPRE_Real            alpha, beta;
 
+   hypre_StructMatrix   *A_mf = NULL;
    hypre_StructMatrix  **A_l;
    hypre_StructMatrix  **P_l;
    hypre_StructMatrix  **RT_l;
@@ -137,6 +140,37 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
+   /* Zebra line relaxation runs on the host only (see hypre_PFMGRelaxSetup) */
+   if ((relax_type == 4) &&
+       (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST))
+   {
+      HYPRE_Int  myid;
+
+      hypre_MPI_Comm_rank(comm, &myid);
+      if (myid == 0 && (pfmg_data -> print_level) > 0)
+      {
+         hypre_printf("Warning: zebra line relaxation requires host memory. ");
+         hypre_printf("Using red-black Gauss-Seidel.\n");
+      }
+      relax_type = 2;
+   }
+
+   /* Matrix-free matrices are assembled to set up the coarse grid operators.
+    * The assembled copy is freed after setup, so the fine grid relaxation must
+    * be able to use A itself, which is only supported for Jacobi. */
+   if (hypre_StructMatrixMatrixFree(A))
+   {
+      if ((relax_type != 0) && (relax_type != 1))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Matrix-free PFMG requires Jacobi relaxation (relax_type 0 or 1)");
+         HYPRE_ANNOTATE_FUNC_END;
+         return hypre_error_flag;
+      }
+      A_mf = A;
+      A    = hypre_StructMatrixCreateAssembled(A_mf);
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
@@ -651,6 +685,15 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_SetDeviceOn();
    }
 #endif
+   /* Jacobi relaxation and the residual use the matrix-free A directly */
+   if (A_mf != NULL)
+   {
+      hypre_StructMatrixDestroy(A_l[0]);
+      A_l[0] = hypre_StructMatrixRef(A_mf);
+      hypre_StructMatrixDestroy(A);
+      A = A_mf;
+   }
+
    /* set up fine grid relaxation */
    relax_data_l[0] = hypre_PFMGRelaxCreate(comm);
    hypre_PFMGRelaxSetTol(relax_data_l[0], 0.0);
@@ -663,7 +706,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_PFMGRelaxSetJacobiWeight(relax_data_l[0], relax_weights[0]);
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
+   hypre_PFMGRelaxSetTiling(relax_data_l[0], relax_tiling);
+   hypre_PFMGRelaxSetColorSplit(relax_data_l[0], relax_color_split);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
+   if (num_levels > 1)
+   {
+      hypre_PFMGRelaxSetLineDir(relax_data_l[0], cdir_l[0]);
+   }
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
    {
@@ -683,7 +732,13 @@ hypre_PFMGSetup( void               *pfmg_vdata,
                hypre_PFMGRelaxSetJacobiWeight(relax_data_l[l], relax_weights[l]);
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
+            hypre_PFMGRelaxSetTiling(relax_data_l[l], relax_tiling);
+            hypre_PFMGRelaxSetColorSplit(relax_data_l[l], relax_color_split);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
+            if (l < num_levels - 1)
+            {
+               hypre_PFMGRelaxSetLineDir(relax_data_l[l], cdir_l[l]);
+            }
          }
       }
 
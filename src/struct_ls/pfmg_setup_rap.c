@@ -102,6 +102,9 @@ hypre_PFMGCreateRAPOp( hypre_StructMatrix *R,
  *      rap_type = 1   Use PARFLOW formula for coarse grid operator. Used
  *                     only with 5pt in 2d and 7pt in 3d.
  *      rap_type = 2   General purpose Galerkin code.
+ *
+ *   For rap_type 0 and 2, the Galerkin operator of a constant coefficient
+ *   A is computed once per box (see hypre_PFMGBuildRAPConstant).
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -142,7 +145,13 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
 
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
-   if (rap_type == 0)
+   if (rap_type != 1 && hypre_StructMatrixConstantCoefficient(A) == 1)
+   {
+      /* Galerkin operator of constant stencils, computed symbolically */
+      hypre_PFMGBuildRAPConstant(A, P, R, cdir, Ac_tmp);
+   }
+
+   else if (rap_type == 0)
    {
       switch (hypre_StructStencilNDim(stencil))
       {
@@ -0,0 +1,218 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "pfmg.h"
+
+/*--------------------------------------------------------------------------
+ * Galerkin coarse grid operators for constant stencils.
+ *
+ * When A, P and R have constant coefficients, RAP is computed once per box by
+ * multiplying the stencils symbolically instead of point by point.  The
+ * routines below work for any fine stencil (with extent one in the coarsening
+ * direction) and any dimension.
+ *
+ * Notation (coarsening in direction cdir, e the unit vector in cdir):
+ *
+ *    P(c+e <- c) = pa,  P(c-e <- c) = pb   (P stencil entries -e and +e)
+ *    R(c <- c+e) = ra,  R(c <- c-e) = rb   (R stencil entries -e and +e)
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * Add 'value' to the coarse stencil entry 'offset', appending a new entry to
+ * the (small) list of offsets if needed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGRAPConstantAdd( HYPRE_Int     ndim,
+                          hypre_Index   offset,
+                          HYPRE_Real    value,
+                          hypre_Index  *offsets,
+                          HYPRE_Real   *values,
+                          HYPRE_Int    *size_ptr )
+{
+   HYPRE_Int  size = *size_ptr;
+   HYPRE_Int  k;
+
+   for (k = 0; k < size; k++)
+   {
+      if (hypre_IndexesEqual(offsets[k], offset, ndim))
+      {
+         values[k] += value;
+         return hypre_error_flag;
+      }
+   }
+
+   hypre_CopyIndex(offset, offsets[size]);
+   values[size] = value;
+   *size_ptr = size + 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Compute the constant Galerkin stencil R*A*P for box 'fi' of A, P and R.
+ * On return, the coarse stencil is given by 'offsets' and 'values' of length
+ * 'size'; the arrays must hold 3 * 2 * (stencil size of A) entries.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGRAPConstantStencil( hypre_StructMatrix *A,
+                              hypre_StructMatrix *P,
+                              hypre_StructMatrix *R,
+                              HYPRE_Int           fi,
+                              HYPRE_Int           cdir,
+                              hypre_Index        *offsets,
+                              HYPRE_Real         *values,
+                              HYPRE_Int          *size_ptr )
+{
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(A);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+
+   hypre_Index           index;
+   hypre_Index           offset;
+   HYPRE_Real            pa, pb, ra, rb;
+   HYPRE_Real            rweights[3], aval, rval;
+   HYPRE_Int             rshift[3];
+   HYPRE_Int             r, s, k, kc;
+
+   /* interpolation and restriction weights */
+   hypre_SetIndex(index, 0);
+   hypre_IndexD(index, cdir) = -1;
+   pa = *hypre_StructMatrixExtractPointerByIndex(P, fi, index);
+   ra = *hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+   hypre_IndexD(index, cdir) = 1;
+   pb = *hypre_StructMatrixExtractPointerByIndex(P, fi, index);
+   rb = *hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+
+   /* R gathers from the fine points c, c+e and c-e */
+   rshift[0] =  0;  rweights[0] = 1.0;
+   rshift[1] =  1;  rweights[1] = ra;
+   rshift[2] = -1;  rweights[2] = rb;
+
+   *size_ptr = 0;
+   for (r = 0; r < 3; r++)
+   {
+      rval = rweights[r];
+      for (s = 0; s < stencil_size; s++)
+      {
+         aval = *hypre_StructMatrixBoxData(A, fi, s);
+
+         /* fine point reached by A, in fine units along cdir */
+         hypre_CopyIndex(stencil_shape[s], offset);
+         k = rshift[r] + hypre_IndexD(offset, cdir);
+
+         if ((k % 2) == 0)
+         {
+            /* a coarse point: injected by P */
+            hypre_IndexD(offset, cdir) = k / 2;
+            hypre_PFMGRAPConstantAdd(ndim, offset, rval * aval,
+                                     offsets, values, size_ptr);
+         }
+         else
+         {
+            /* an F-point above coarse point kc and below coarse point kc+1 */
+            kc = (k - 1) / 2;
+            hypre_IndexD(offset, cdir) = kc;
+            hypre_PFMGRAPConstantAdd(ndim, offset, rval * aval * pa,
+                                     offsets, values, size_ptr);
+            hypre_IndexD(offset, cdir) = kc + 1;
+            hypre_PFMGRAPConstantAdd(ndim, offset, rval * aval * pb,
+                                     offsets, values, size_ptr);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PFMGBuildRAPConstant
+ *
+ * Computes RAP for constant coefficient A, P and R.  The coarse stencil is
+ * computed once per box; RAP must contain the resulting stencil.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGBuildRAPConstant( hypre_StructMatrix *A,
+                            hypre_StructMatrix *P,
+                            hypre_StructMatrix *R,
+                            HYPRE_Int           cdir,
+                            hypre_StructMatrix *RAP )
+{
+   hypre_StructStencil  *stencil           = hypre_StructMatrixStencil(A);
+   HYPRE_Int             stencil_size      = hypre_StructStencilSize(stencil);
+   hypre_StructStencil  *RAP_stencil       = hypre_StructMatrixStencil(RAP);
+   HYPRE_Int             RAP_stencil_size  = hypre_StructStencilSize(RAP_stencil);
+   HYPRE_Int            *RAP_symm_elements = hypre_StructMatrixSymmElements(RAP);
+
+   hypre_StructGrid     *fgrid             = hypre_StructMatrixGrid(A);
+   HYPRE_Int            *fgrid_ids         = hypre_StructGridIDs(fgrid);
+   hypre_StructGrid     *cgrid             = hypre_StructMatrixGrid(RAP);
+   hypre_BoxArray       *cgrid_boxes       = hypre_StructGridBoxes(cgrid);
+   HYPRE_Int            *cgrid_ids         = hypre_StructGridIDs(cgrid);
+
+   hypre_Index          *offsets;
+   HYPRE_Real           *values;
+   HYPRE_Int             size;
+   HYPRE_Int             fi, ci, s, k;
+
+   HYPRE_ANNOTATE_FUNC_BEGIN;
+
+   hypre_assert( hypre_StructMatrixConstantCoefficient(A) == 1 );
+   hypre_assert( hypre_StructMatrixConstantCoefficient(P) == 1 );
+   hypre_assert( hypre_StructMatrixConstantCoefficient(R) == 1 );
+   hypre_assert( hypre_StructMatrixConstantCoefficient(RAP) == 1 );
+
+   offsets = hypre_TAlloc(hypre_Index, 3 * 2 * stencil_size, HYPRE_MEMORY_HOST);
+   values  = hypre_TAlloc(HYPRE_Real, 3 * 2 * stencil_size, HYPRE_MEMORY_HOST);
+
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+
+      hypre_PFMGRAPConstantStencil(A, P, R, fi, cdir, offsets, values, &size);
+
+      /* set the stored entries of RAP */
+      for (s = 0; s < RAP_stencil_size; s++)
+      {
+         if (RAP_symm_elements[s] < 0)
+         {
+            *hypre_StructMatrixBoxData(RAP, ci, s) = 0.0;
+         }
+      }
+      for (k = 0; k < size; k++)
+      {
+         s = hypre_StructStencilElementRank(RAP_stencil, offsets[k]);
+         if (s < 0)
+         {
+            if (values[k] != 0.0)
+            {
+               hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                                 "Coarse grid stencil does not contain the Galerkin stencil");
+            }
+         }
+         else if (RAP_symm_elements[s] < 0)
+         {
+            *hypre_StructMatrixBoxData(RAP, ci, s) = values[k];
+         }
+      }
+   }
+
+   hypre_TFree(offsets, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATE_FUNC_END;
+
+   return hypre_error_flag;
+}
@@ -43,6 +43,10 @@ typedef struct
 
    hypre_ComputePkg      **compute_pkgs;
 
+   /* matrix-free matrices (see hypre_PointRelaxMF) */
+   void                   *matvec_data;
+   hypre_StructVector     *dinv;       /* inverse of the diagonal */
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
@@ -83,6 +87,8 @@ hypre_PointRelaxCreate( MPI_Comm  comm )
    (relax_data -> x)                = NULL;
    (relax_data -> t)                = NULL;
    (relax_data -> compute_pkgs)     = NULL;
+   (relax_data -> matvec_data)      = NULL;
+   (relax_data -> dinv)             = NULL;
 
    hypre_SetIndex3(stride, 1, 1, 1);
    hypre_SetIndex3(indices[0], 0, 0, 0);
@@ -123,6 +129,8 @@ hypre_PointRelaxDestroy( void *relax_vdata )
       hypre_StructVectorDestroy(relax_data -> x);
       hypre_StructVectorDestroy(relax_data -> t);
       hypre_TFree(relax_data -> compute_pkgs, HYPRE_MEMORY_HOST);
+      hypre_StructMatvecDestroy(relax_data -> matvec_data);
+      hypre_StructVectorDestroy(relax_data -> dinv);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -284,6 +292,65 @@ hypre_PointRelaxSetup( void               *relax_vdata,
    (relax_data -> diag_rank)    = diag_rank;
    (relax_data -> compute_pkgs) = compute_pkgs;
 
+   /*----------------------------------------------------------
+    * Matrix-free matrices are relaxed with a residual matvec
+    * and the stored inverse diagonal
+    *----------------------------------------------------------*/
+
+   if (hypre_StructMatrixMatrixFree(A))
+   {
+      hypre_BoxArray  *grid_boxes = hypre_StructGridBoxes(grid);
+      hypre_Box       *grid_box;
+      hypre_Box       *dinv_data_box;
+      HYPRE_Real      *dinvp;
+      HYPRE_Complex   *diag;
+      hypre_Index      loop_size, unit_stride;
+      HYPRE_Int        max_volume = 0;
+
+      if ((num_pointsets > 1) ||
+          !hypre_IndexEqual(pointset_strides[0], 1, ndim))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Matrix-free relaxation requires a single unit-stride pointset");
+      }
+
+      hypre_StructMatvecDestroy(relax_data -> matvec_data);
+      hypre_StructVectorDestroy(relax_data -> dinv);
+      (relax_data -> matvec_data) = hypre_StructMatvecCreate();
+      hypre_StructMatvecSetup((relax_data -> matvec_data), A, x);
+
+      (relax_data -> dinv) = hypre_StructVectorCreate(hypre_StructVectorComm(x),
+                                                      hypre_StructVectorGrid(x));
+      hypre_StructVectorSetNumGhost((relax_data -> dinv), hypre_StructVectorNumGhost(x));
+      hypre_StructVectorInitialize(relax_data -> dinv);
+
+      hypre_ForBoxI(i, grid_boxes)
+      {
+         max_volume = hypre_max(max_volume, hypre_BoxVolume(hypre_BoxArrayBox(grid_boxes, i)));
+      }
+      diag = hypre_TAlloc(HYPRE_Complex, max_volume, HYPRE_MEMORY_HOST);
+
+      hypre_SetIndex(unit_stride, 1);
+      hypre_ForBoxI(i, grid_boxes)
+      {
+         grid_box      = hypre_BoxArrayBox(grid_boxes, i);
+         dinv_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(relax_data -> dinv), i);
+         dinvp         = hypre_StructVectorBoxData((relax_data -> dinv), i);
+
+         hypre_StructMatrixEvalCoeffs(A, diag_rank, grid_box, diag);
+
+         hypre_BoxGetSize(grid_box, loop_size);
+         hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                   grid_box, hypre_BoxIMin(grid_box), unit_stride, di,
+                                   dinv_data_box, hypre_BoxIMin(grid_box), unit_stride, vi);
+         {
+            dinvp[vi] = 1.0 / diag[di];
+         }
+         hypre_SerialBoxLoop2End(di, vi);
+      }
+      hypre_TFree(diag, HYPRE_MEMORY_HOST);
+   }
+
    /*-----------------------------------------------------
     * Compute flops
     *-----------------------------------------------------*/
@@ -386,6 +453,15 @@ hypre_PointRelax( void               *relax_vdata,
       return hypre_error_flag;
    }
 
+   if (hypre_StructMatrixMatrixFree(A))
+   {
+      hypre_PointRelaxMF(relax_vdata, A, b, x);
+
+      hypre_IncFLOPCount(relax_data -> flops);
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
    if (constant_coefficient) { hypre_StructVectorClearBoundGhostValues(x, 0); }
 
@@ -435,6 +511,9 @@ hypre_PointRelax( void               *relax_vdata,
             break;
          }
 
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(compute_box_a,A_data_box,b_data_box,x_data_box,Ap,bp,xp,j,compute_box,start,loop_size,Ai,AAp0) if (hypre_BoxArrayBoxThreads(hypre_StructGridBoxes(hypre_StructMatrixGrid(A)))) schedule(dynamic, 1)
+#endif
          hypre_ForBoxArrayI(i, compute_box_aa)
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -547,6 +626,9 @@ hypre_PointRelax( void               *relax_vdata,
             break;
          }
 
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(compute_box_a,A_data_box,b_data_box,x_data_box,t_data_box,bp,xp,tp,j,compute_box,Ap,start,loop_size) if (hypre_BoxArrayBoxThreads(hypre_StructGridBoxes(hypre_StructMatrixGrid(A)))) schedule(dynamic, 1)
+#endif
          hypre_ForBoxArrayI(i, compute_box_aa)
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -657,6 +739,111 @@ hypre_PointRelax( void               *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PointRelaxMF
+ *
+ * Weighted Jacobi for matrix-free matrices: x = x + w D^{-1} (b - A x), where
+ * the residual is computed with the matrix-free matvec.  Only a single pointset
+ * with unit stride is supported.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxMF( void               *relax_vdata,
+                    hypre_StructMatrix *A,
+                    hypre_StructVector *b,
+                    hypre_StructVector *x           )
+{
+   hypre_PointRelaxData  *relax_data  = (hypre_PointRelaxData *)relax_vdata;
+
+   HYPRE_Int              max_iter    = (relax_data -> max_iter);
+   HYPRE_Int              zero_guess  = (relax_data -> zero_guess);
+   HYPRE_Real             weight      = (relax_data -> weight);
+   hypre_StructVector    *t           = (relax_data -> t);
+   hypre_StructVector    *dinv        = (relax_data -> dinv);
+   void                  *matvec_data = (relax_data -> matvec_data);
+   HYPRE_Real             tol         = (relax_data -> tol);
+   HYPRE_Real             tol2        = tol * tol;
+
+   HYPRE_Int              ndim        = hypre_StructVectorNDim(x);
+   hypre_BoxArray        *grid_boxes  = hypre_StructGridBoxes(hypre_StructVectorGrid(x));
+   hypre_Box             *grid_box;
+   hypre_Box             *d_data_box;
+   hypre_Box             *x_data_box;
+   hypre_Box             *t_data_box;
+   HYPRE_Real            *dp;
+   HYPRE_Real            *xp;
+   HYPRE_Real            *tp;
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   hypre_Index            unit_stride;
+
+   HYPRE_Int              iter, i;
+   HYPRE_Real             bsumsq = 1.0, rsumsq = 0.0;
+
+   hypre_SetIndex(unit_stride, 1);
+
+   if ( tol > 0.0 )
+   {
+      bsumsq = hypre_StructInnerProd( b, b );
+   }
+
+   for (iter = 0; iter < max_iter; iter++)
+   {
+      /* t = b - A x */
+      hypre_StructCopy(b, t);
+      if (!(zero_guess && iter == 0))
+      {
+         hypre_StructMatvecCompute(matvec_data, -1.0, A, x, 1.0, t);
+      }
+      else
+      {
+         hypre_StructVectorSetConstantValues(x, 0.0);
+      }
+
+      /* x = x + w D^{-1} t */
+      hypre_ForBoxI(i, grid_boxes)
+      {
+         grid_box   = hypre_BoxArrayBox(grid_boxes, i);
+         start      = hypre_BoxIMin(grid_box);
+         d_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(dinv), i);
+         x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         t_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
+         dp = hypre_StructVectorBoxData(dinv, i);
+         xp = hypre_StructVectorBoxData(x, i);
+         tp = hypre_StructVectorBoxData(t, i);
+
+         hypre_BoxGetSize(grid_box, loop_size);
+#define DEVICE_VAR is_device_ptr(xp,dp,tp)
+         hypre_BoxLoop3Begin(ndim, loop_size,
+                             d_data_box, start, unit_stride, di,
+                             x_data_box, start, unit_stride, xi,
+                             t_data_box, start, unit_stride, ti);
+         {
+            xp[xi] += weight * dp[di] * tp[ti];
+         }
+         hypre_BoxLoop3End(di, xi, ti);
+#undef DEVICE_VAR
+      }
+
+      if ( tol > 0.0 )
+      {
+         hypre_StructCopy(b, t);
+         hypre_StructMatvecCompute(matvec_data, -1.0, A, x, 1.0, t);
+         rsumsq = hypre_StructInnerProd(t, t);
+         if ( rsumsq / bsumsq < tol2 )
+         {
+            iter++;
+            break;
+         }
+      }
+   }
+
+   if ( tol > 0.0 ) { (relax_data -> rresnorm) = hypre_sqrt( rsumsq / bsumsq ); }
+   (relax_data -> num_iterations) = iter;
+
+   return hypre_error_flag;
+}
+
 /* for constant_coefficient==0, all coefficients may vary ...*/
 HYPRE_Int
 hypre_PointRelax_core0( void               *relax_vdata,
@@ -1478,6 +1665,9 @@ HYPRE_Int hypre_relax_wtx( void *relax_vdata, HYPRE_Int pointset,
          break;
       }
 
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(compute_box_a,x_data_box,t_data_box,xp,tp,j,compute_box,start,loop_size) if (hypre_BoxArrayBoxThreads(hypre_StructGridBoxes(hypre_StructVectorGrid(x)))) schedule(dynamic, 1)
+#endif
       hypre_ForBoxArrayI(i, compute_box_aa)
       {
          compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -1562,6 +1752,9 @@ HYPRE_Int hypre_relax_copy( void               *relax_vdata,
          break;
       }
 
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(compute_box_a,x_data_box,t_data_box,xp,tp,j,compute_box,start,loop_size) if (hypre_BoxArrayBoxThreads(hypre_StructGridBoxes(hypre_StructVectorGrid(x)))) schedule(dynamic, 1)
+#endif
       hypre_ForBoxArrayI(i, compute_box_aa)
       {
          compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
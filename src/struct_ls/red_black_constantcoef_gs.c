@@ -116,6 +116,21 @@ hypre_RedBlackConstantCoefGS( void               *relax_vdata,
 
    hypre_StructVectorClearBoundGhostValues(x, 0);
 
+   /*----------------------------------------------------------
+    * Use the color-split storage if it was set up.  Converting
+    * b and x costs about as much as a sweep, so a single sweep
+    * uses the stride-two kernels below.
+    *----------------------------------------------------------*/
+
+   if (((relax_data -> split_boxes) != NULL) && (max_iter > 1))
+   {
+      hypre_RedBlackGSSplit(relax_vdata, A, b, x, offd);
+
+      hypre_IncFLOPCount(relax_data -> flops);
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
    /*----------------------------------------------------------
     * Do zero_guess iteration
     *----------------------------------------------------------*/
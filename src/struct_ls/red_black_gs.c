@@ -15,6 +15,9 @@
 #include "_hypre_struct_mv.hpp"
 #include "red_black_gs.h"
 
+/* Target size in bytes of the data touched by a tile in hypre_RedBlackGSTiled */
+#define hypre_RB_TILE_BYTES 1048576
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -34,11 +37,16 @@ hypre_RedBlackGSCreate( MPI_Comm  comm )
    (relax_data -> rel_change)  = 0;
    (relax_data -> zero_guess)  = 0;
    (relax_data -> rb_start)    = 1;
+   (relax_data -> tile_iters)  = 0;
+   (relax_data -> color_split) = 0;
    (relax_data -> flops)       = 0;
    (relax_data -> A)           = NULL;
    (relax_data -> b)           = NULL;
    (relax_data -> x)           = NULL;
    (relax_data -> compute_pkg) = NULL;
+   (relax_data -> dept_faces)  = NULL;
+   (relax_data -> num_split_boxes) = 0;
+   (relax_data -> split_boxes) = NULL;
 
    return (void *) relax_data;
 }
@@ -57,6 +65,8 @@ hypre_RedBlackGSDestroy( void *relax_vdata )
       hypre_StructVectorDestroy(relax_data -> b);
       hypre_StructVectorDestroy(relax_data -> x);
       hypre_ComputePkgDestroy(relax_data -> compute_pkg);
+      hypre_TFree(relax_data -> dept_faces, HYPRE_MEMORY_HOST);
+      hypre_RedBlackGSSplitDestroy(relax_data);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -83,6 +93,13 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
    hypre_StructStencil   *stencil;
    hypre_Index            diag_index;
    hypre_ComputeInfo     *compute_info;
+   hypre_CommInfo        *comm_info;
+   hypre_BoxArrayArray   *recv_boxes;
+   hypre_BoxArray        *recv_box_a;
+   hypre_Box             *recv_box;
+   hypre_Box             *box;
+   HYPRE_Int             *dept_faces;
+   HYPRE_Int              ndim, i, j, d, outside, overlap = 0;
 
    /*----------------------------------------------------------
     * Find the matrix diagonal
@@ -102,6 +119,55 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
    hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
                           grid, &compute_pkg);
 
+   /*----------------------------------------------------------
+    * Find the box faces that receive ghost values (for tiling and
+    * the color-split storage)
+    *----------------------------------------------------------*/
+
+   dept_faces = NULL;
+   if (((relax_data -> tile_iters) > 0) || (relax_data -> color_split))
+   {
+      ndim = hypre_StructGridNDim(grid);
+      hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
+      recv_boxes = hypre_CommInfoRecvBoxes(comm_info);
+      dept_faces = hypre_CTAlloc(HYPRE_Int, 2 * ndim * hypre_BoxArrayArraySize(recv_boxes),
+                                 HYPRE_MEMORY_HOST);
+      hypre_ForBoxArrayI(i, recv_boxes)
+      {
+         box = hypre_BoxArrayBox(hypre_StructGridBoxes(grid), i);
+         recv_box_a = hypre_BoxArrayArrayBoxArray(recv_boxes, i);
+         hypre_ForBoxI(j, recv_box_a)
+         {
+            recv_box = hypre_BoxArrayBox(recv_box_a, j);
+            outside = 0;
+            for (d = 0; d < ndim; d++)
+            {
+               if (hypre_BoxIMaxD(recv_box, d) < hypre_BoxIMinD(box, d))
+               {
+                  dept_faces[2 * (i * ndim + d)] = 1;
+                  outside = 1;
+               }
+               if (hypre_BoxIMinD(recv_box, d) > hypre_BoxIMaxD(box, d))
+               {
+                  dept_faces[2 * (i * ndim + d) + 1] = 1;
+                  outside = 1;
+               }
+            }
+            /* ghost values received inside the box (e.g., a box wider than the
+               period) would invalidate the cores, so don't tile in that case */
+            if (!outside)
+            {
+               overlap = 1;
+            }
+         }
+      }
+      if (overlap)
+      {
+         hypre_TFree(dept_faces, HYPRE_MEMORY_HOST);
+      }
+      hypre_CommInfoDestroy(comm_info);
+   }
+
    /*----------------------------------------------------------
     * Set up the relax data structure
     *----------------------------------------------------------*/
@@ -111,6 +177,400 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
    (relax_data -> b) = hypre_StructVectorRef(b);
    (relax_data -> diag_rank) = diag_rank;
    (relax_data -> compute_pkg) = compute_pkg;
+   hypre_TFree(relax_data -> dept_faces, HYPRE_MEMORY_HOST);
+   (relax_data -> dept_faces) = dept_faces;
+
+   /*----------------------------------------------------------
+    * Set up the color-split storage (host builds only)
+    *----------------------------------------------------------*/
+
+   hypre_RedBlackGSSplitDestroy(relax_vdata);
+#if !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP) && \
+    !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS)
+   if (relax_data -> color_split)
+   {
+      hypre_RedBlackGSSplitSetup(relax_vdata, A, b, x);
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Relax the points of one color in compute_box, a subset of grid box i.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_RedBlackGSBox( hypre_StructMatrix *A,
+                     hypre_StructVector *b,
+                     hypre_StructVector *x,
+                     HYPRE_Int           i,
+                     hypre_Box          *compute_box,
+                     HYPRE_Int           rb,
+                     HYPRE_Int           diag_rank,
+                     HYPRE_Int          *offd )
+{
+   HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
+
+   hypre_Box             *A_dbox;
+   hypre_Box             *b_dbox;
+   hypre_Box             *x_dbox;
+
+   HYPRE_Int              Astart, Ani, Anj;
+   HYPRE_Int              bstart, bni, bnj;
+   HYPRE_Int              xstart, xni, xnj;
+   HYPRE_Int              xoff0, xoff1, xoff2, xoff3, xoff4, xoff5;
+
+   HYPRE_Real            *Ap;
+   HYPRE_Real            *Ap0, *Ap1, *Ap2, *Ap3, *Ap4, *Ap5;
+   HYPRE_Real            *bp;
+   HYPRE_Real            *xp;
+
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+
+   hypre_StructStencil   *stencil;
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+
+   HYPRE_Int              redblack, d;
+   HYPRE_Int              ni, nj, nk;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+
+   A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+   b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+   x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+
+   Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
+   bp = hypre_StructVectorBoxData(b, i);
+   xp = hypre_StructVectorBoxData(x, i);
+
+   start  = hypre_BoxIMin(compute_box);
+   hypre_BoxGetSize(compute_box, loop_size);
+
+   /* Are we relaxing index start or start+(1,0,0)? */
+   redblack = rb;
+   for (d = 0; d < ndim; d++)
+   {
+      redblack += hypre_IndexD(start, d);
+   }
+   redblack = hypre_abs(redblack) % 2;
+
+   Astart = hypre_BoxIndexRank(A_dbox, start);
+   bstart = hypre_BoxIndexRank(b_dbox, start);
+   xstart = hypre_BoxIndexRank(x_dbox, start);
+   ni = hypre_IndexX(loop_size);
+   nj = hypre_IndexY(loop_size);
+   nk = hypre_IndexZ(loop_size);
+   Ani = hypre_BoxSizeX(A_dbox);
+   bni = hypre_BoxSizeX(b_dbox);
+   xni = hypre_BoxSizeX(x_dbox);
+   Anj = hypre_BoxSizeY(A_dbox);
+   bnj = hypre_BoxSizeY(b_dbox);
+   xnj = hypre_BoxSizeY(x_dbox);
+   if (ndim < 3)
+   {
+      nk = 1;
+      if (ndim < 2)
+      {
+         nj = 1;
+      }
+   }
+
+   switch (stencil_size)
+   {
+      case 7:
+         Ap5 = hypre_StructMatrixBoxData(A, i, offd[5]);
+         Ap4 = hypre_StructMatrixBoxData(A, i, offd[4]);
+         xoff5 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[5]]);
+         xoff4 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[4]]);
+      // fall through
+
+      case 5:
+         Ap3 = hypre_StructMatrixBoxData(A, i, offd[3]);
+         Ap2 = hypre_StructMatrixBoxData(A, i, offd[2]);
+         xoff3 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[3]]);
+         xoff2 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[2]]);
+      // fall through
+
+      case 3:
+         Ap1 = hypre_StructMatrixBoxData(A, i, offd[1]);
+         Ap0 = hypre_StructMatrixBoxData(A, i, offd[0]);
+         xoff1 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[1]]);
+         xoff0 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[0]]);
+         break;
+   }
+
+   switch (stencil_size)
+   {
+      case 7:
+         hypre_RedBlackLoopInit();
+#define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap)
+         hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
+                                 Astart, Ani, Anj, Ai,
+                                 bstart, bni, bnj, bi,
+                                 xstart, xni, xnj, xi);
+         {
+            xp[xi] =
+               (bp[bi] -
+                Ap0[Ai] * xp[xi + xoff0] -
+                Ap1[Ai] * xp[xi + xoff1] -
+                Ap2[Ai] * xp[xi + xoff2] -
+                Ap3[Ai] * xp[xi + xoff3] -
+                Ap4[Ai] * xp[xi + xoff4] -
+                Ap5[Ai] * xp[xi + xoff5]) / Ap[Ai];
+         }
+         hypre_RedBlackLoopEnd();
+#undef DEVICE_VAR
+         break;
+
+      case 5:
+         hypre_RedBlackLoopInit();
+#define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap2,Ap3,Ap)
+         hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
+                                 Astart, Ani, Anj, Ai,
+                                 bstart, bni, bnj, bi,
+                                 xstart, xni, xnj, xi);
+         {
+            xp[xi] =
+               (bp[bi] -
+                Ap0[Ai] * xp[xi + xoff0] -
+                Ap1[Ai] * xp[xi + xoff1] -
+                Ap2[Ai] * xp[xi + xoff2] -
+                Ap3[Ai] * xp[xi + xoff3]) / Ap[Ai];
+         }
+         hypre_RedBlackLoopEnd();
+#undef DEVICE_VAR
+         break;
+
+      case 3:
+         hypre_RedBlackLoopInit();
+#define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap)
+         hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
+                                 Astart, Ani, Anj, Ai,
+                                 bstart, bni, bnj, bi,
+                                 xstart, xni, xnj, xi);
+         {
+            xp[xi] =
+               (bp[bi] -
+                Ap0[Ai] * xp[xi + xoff0] -
+                Ap1[Ai] * xp[xi + xoff1]) / Ap[Ai];
+         }
+         hypre_RedBlackLoopEnd();
+#undef DEVICE_VAR
+
+         break;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Shrink box by width on the faces flagged in faces (two per dimension).
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RedBlackGSShrinkBox( hypre_Box *box,
+                           HYPRE_Int *faces,
+                           HYPRE_Int  width,
+                           hypre_Box *shrunk_box )
+{
+   HYPRE_Int  ndim = hypre_BoxNDim(box);
+   HYPRE_Int  d;
+
+   hypre_CopyBox(box, shrunk_box);
+   for (d = 0; d < ndim; d++)
+   {
+      if (faces[2 * d])
+      {
+         hypre_BoxIMinD(shrunk_box, d) += width;
+      }
+      if (faces[2 * d + 1])
+      {
+         hypre_BoxIMaxD(shrunk_box, d) -= width;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Do num_sweeps half sweeps (alternating colors, starting with rb) with
+ * temporal tiling.  Half sweep h is first done on the core of each box,
+ * the points at least h+1 away from the box faces that receive ghost
+ * values, which is updated without communication.  The cores are swept
+ * plane by plane (the last dimension) in a wavefront: half sweep h works
+ * on plane s-h at step s, so the box interior is streamed through cache
+ * once for all num_sweeps half sweeps.  Then the remaining points near the
+ * faces are relaxed one half sweep at a time, with a ghost exchange before
+ * each one as in the untiled sweeps.  The result is identical to the
+ * untiled sweeps.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_RedBlackGSTiled( hypre_RedBlackGSData *relax_data,
+                       hypre_StructMatrix   *A,
+                       hypre_StructVector   *b,
+                       hypre_StructVector   *x,
+                       HYPRE_Int             rb,
+                       HYPRE_Int             num_sweeps,
+                       HYPRE_Int            *offd )
+{
+   HYPRE_Int              diag_rank   = (relax_data -> diag_rank);
+   hypre_ComputePkg      *compute_pkg = (relax_data -> compute_pkg);
+   HYPRE_Int             *dept_faces  = (relax_data -> dept_faces);
+   HYPRE_Int              ndim        = hypre_StructMatrixNDim(A);
+   HYPRE_Int              kdim        = ndim - 1;
+   hypre_BoxArray        *boxes       = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+
+   hypre_CommHandle      *comm_handle;
+   hypre_Box             *box;
+   hypre_Box             *inner_box;
+   hypre_Box             *core_box;
+   hypre_BoxArray        *ring_a;
+   HYPRE_Int             *faces;
+   HYPRE_Complex         *xp;
+
+   HYPRE_Int              stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+   HYPRE_Int              kmin, kmax, jmin, jmax, jlo, tile_size;
+   HYPRE_Int              i, j, h, s, k;
+
+   inner_box = hypre_BoxCreate(ndim);
+   core_box  = hypre_BoxCreate(ndim);
+   ring_a    = hypre_BoxArrayCreate(0, ndim);
+
+   /*-----------------------------------------------------------------
+    * Wavefront over the planes of the cores
+    *-----------------------------------------------------------------*/
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      faces = &dept_faces[2 * ndim * i];
+      kmin  = hypre_BoxIMinD(box, kdim);
+      kmax  = hypre_BoxIMaxD(box, kdim);
+      jmin  = hypre_BoxIMinD(box, 1);
+      jmax  = hypre_BoxIMaxD(box, 1);
+
+      /* In 3D, split the planes into tiles in the second dimension so that
+       * the num_sweeps+2 planes of a tile in flight stay in cache.  Half
+       * sweep h of a tile is shifted by -h so that it only needs values
+       * from its own tile and the previous one. */
+      tile_size = jmax - jmin + 1;
+      if (ndim > 2)
+      {
+         tile_size = hypre_RB_TILE_BYTES /
+                     (sizeof(HYPRE_Real) * (stencil_size + 2) * (num_sweeps + 2) *
+                      hypre_max(hypre_BoxSizeD(box, 0), 1));
+         tile_size = hypre_max(tile_size, num_sweeps);
+      }
+
+      for (jlo = jmin; ; jlo += tile_size)
+      {
+         for (s = kmin; s < kmax + num_sweeps; s++)
+         {
+            for (h = 0; h < num_sweeps; h++)
+            {
+               hypre_RedBlackGSShrinkBox(box, faces, h + 1, core_box);
+               k = s - h;
+               if ((k < hypre_BoxIMinD(core_box, kdim)) || (k > hypre_BoxIMaxD(core_box, kdim)))
+               {
+                  continue;
+               }
+
+               hypre_BoxIMinD(core_box, kdim) = k;
+               hypre_BoxIMaxD(core_box, kdim) = k;
+               if (ndim > 2)
+               {
+                  if (jlo > jmin)
+                  {
+                     hypre_BoxIMinD(core_box, 1) = hypre_max(hypre_BoxIMinD(core_box, 1), jlo - h);
+                  }
+                  hypre_BoxIMaxD(core_box, 1) =
+                     hypre_min(hypre_BoxIMaxD(core_box, 1), jlo + tile_size - 1 - h);
+               }
+               if (hypre_BoxVolume(core_box) > 0)
+               {
+                  hypre_RedBlackGSBox(A, b, x, i, core_box, (rb + h) % 2, diag_rank, offd);
+               }
+            }
+         }
+
+         if ((ndim < 3) || (jlo + tile_size - num_sweeps >= jmax))
+         {
+            break;
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Remaining points, one half sweep at a time
+    *-----------------------------------------------------------------*/
+
+   for (h = 0; h < num_sweeps; h++)
+   {
+      xp = hypre_StructVectorData(x);
+      hypre_InitializeIndtComputations(compute_pkg, xp, &comm_handle);
+
+      /* points between the inner box and the core need no ghost values */
+      hypre_ForBoxI(i, boxes)
+      {
+         box   = hypre_BoxArrayBox(boxes, i);
+         faces = &dept_faces[2 * ndim * i];
+         hypre_RedBlackGSShrinkBox(box, faces, 1, inner_box);
+         hypre_RedBlackGSShrinkBox(box, faces, h + 1, core_box);
+
+         hypre_BoxArraySetSize(ring_a, 0);
+         if (hypre_BoxVolume(core_box) > 0)
+         {
+            if (h > 0)
+            {
+               hypre_SubtractBoxes(inner_box, core_box, ring_a);
+            }
+         }
+         else if (hypre_BoxVolume(inner_box) > 0)
+         {
+            hypre_AppendBox(inner_box, ring_a);
+         }
+
+         hypre_ForBoxI(j, ring_a)
+         {
+            hypre_RedBlackGSBox(A, b, x, i, hypre_BoxArrayBox(ring_a, j),
+                                (rb + h) % 2, diag_rank, offd);
+         }
+      }
+
+      hypre_FinalizeIndtComputations(comm_handle);
+
+      /* points next to the faces that receive ghost values */
+      hypre_ForBoxI(i, boxes)
+      {
+         box   = hypre_BoxArrayBox(boxes, i);
+         faces = &dept_faces[2 * ndim * i];
+         hypre_RedBlackGSShrinkBox(box, faces, 1, inner_box);
+
+         hypre_BoxArraySetSize(ring_a, 0);
+         if (hypre_BoxVolume(inner_box) > 0)
+         {
+            hypre_SubtractBoxes(box, inner_box, ring_a);
+         }
+         else
+         {
+            hypre_AppendBox(box, ring_a);
+         }
+
+         hypre_ForBoxI(j, ring_a)
+         {
+            hypre_RedBlackGSBox(A, b, x, i, hypre_BoxArrayBox(ring_a, j),
+                                (rb + h) % 2, diag_rank, offd);
+         }
+      }
+   }
+
+   hypre_BoxDestroy(inner_box);
+   hypre_BoxDestroy(core_box);
+   hypre_BoxArrayDestroy(ring_a);
 
    return hypre_error_flag;
 }
@@ -129,6 +589,7 @@ hypre_RedBlackGS( void               *relax_vdata,
    HYPRE_Int              max_iter    = (relax_data -> max_iter);
    HYPRE_Int              zero_guess  = (relax_data -> zero_guess);
    HYPRE_Int              rb_start    = (relax_data -> rb_start);
+   HYPRE_Int              tile_iters  = (relax_data -> tile_iters);
    HYPRE_Int              diag_rank   = (relax_data -> diag_rank);
    hypre_ComputePkg      *compute_pkg = (relax_data -> compute_pkg);
    HYPRE_Int              ndim = hypre_StructMatrixNDim(A);
@@ -146,10 +607,8 @@ hypre_RedBlackGS( void               *relax_vdata,
    HYPRE_Int              Astart, Ani, Anj;
    HYPRE_Int              bstart, bni, bnj;
    HYPRE_Int              xstart, xni, xnj;
-   HYPRE_Int              xoff0, xoff1, xoff2, xoff3, xoff4, xoff5;
 
    HYPRE_Real            *Ap;
-   HYPRE_Real            *Ap0, *Ap1, *Ap2, *Ap3, *Ap4, *Ap5;
    HYPRE_Real            *bp;
    HYPRE_Real            *xp;
 
@@ -157,13 +616,13 @@ hypre_RedBlackGS( void               *relax_vdata,
    hypre_Index            loop_size;
 
    hypre_StructStencil   *stencil;
-   hypre_Index           *stencil_shape;
    HYPRE_Int              stencil_size;
    HYPRE_Int              offd[6];
 
    HYPRE_Int              iter, rb, redblack, d;
    HYPRE_Int              compute_i, i, j;
    HYPRE_Int              ni, nj, nk;
+   HYPRE_Int              num_sweeps;
 
    /*----------------------------------------------------------
     * Initialize some things and deal with special cases
@@ -171,6 +630,17 @@ hypre_RedBlackGS( void               *relax_vdata,
 
    hypre_BeginTiming(relax_data -> time_index);
 
+   /* The wavefront in hypre_RedBlackGSTiled is sequential over the planes,
+    * so tiling is only used for host builds without threading */
+#if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP) || \
+    defined(HYPRE_USING_RAJA) || defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_OPENMP)
+   tile_iters = 0;
+#endif
+   if ((ndim < 2) || ((relax_data -> dept_faces) == NULL))
+   {
+      tile_iters = 0;
+   }
+
    hypre_StructMatrixDestroy(relax_data -> A);
    hypre_StructVectorDestroy(relax_data -> b);
    hypre_StructVectorDestroy(relax_data -> x);
@@ -195,7 +665,6 @@ hypre_RedBlackGS( void               *relax_vdata,
    else
    {
       stencil       = hypre_StructMatrixStencil(A);
-      stencil_shape = hypre_StructStencilShape(stencil);
       stencil_size  = hypre_StructStencilSize(stencil);
 
       /* get off-diag entry ranks ready */
@@ -210,6 +679,21 @@ hypre_RedBlackGS( void               *relax_vdata,
       }
    }
 
+   /*----------------------------------------------------------
+    * Use the color-split storage if it was set up.  Converting
+    * b and x costs about as much as a sweep, so a single sweep
+    * uses the stride-two kernels below.
+    *----------------------------------------------------------*/
+
+   if (((relax_data -> split_boxes) != NULL) && (max_iter > 1))
+   {
+      hypre_RedBlackGSSplit(relax_vdata, A, b, x, offd);
+
+      hypre_IncFLOPCount(relax_data -> flops);
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
+
    /*----------------------------------------------------------
     * Do zero_guess iteration
     *----------------------------------------------------------*/
@@ -236,6 +720,9 @@ hypre_RedBlackGS( void               *relax_vdata,
             break;
          }
 
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(compute_box_a,A_dbox,b_dbox,x_dbox,Ap,bp,xp,j,compute_box,start,loop_size,redblack,d,Astart,bstart,xstart,ni,nj,nk,Ani,bni,xni,Anj,bnj,xnj) if (hypre_BoxArrayBoxThreads(hypre_StructGridBoxes(hypre_StructMatrixGrid(A)))) schedule(dynamic, 1)
+#endif
          hypre_ForBoxArrayI(i, compute_box_aa)
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -307,6 +794,18 @@ hypre_RedBlackGS( void               *relax_vdata,
     * Do regular iterations
     *----------------------------------------------------------*/
 
+   if (tile_iters > 0)
+   {
+      while (iter < 2 * max_iter)
+      {
+         num_sweeps = hypre_min(2 * tile_iters, 2 * max_iter - iter);
+         hypre_RedBlackGSTiled(relax_data, A, b, x, rb, num_sweeps, offd);
+
+         rb = (rb + num_sweeps) % 2;
+         iter += num_sweeps;
+      }
+   }
+
    while (iter < 2 * max_iter)
    {
       for (compute_i = 0; compute_i < 2; compute_i++)
@@ -329,138 +828,18 @@ hypre_RedBlackGS( void               *relax_vdata,
             break;
          }
 
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp parallel for private(compute_box_a,j,compute_box) if (hypre_BoxArrayBoxThreads(hypre_StructGridBoxes(hypre_StructMatrixGrid(A)))) schedule(dynamic, 1)
+#endif
          hypre_ForBoxArrayI(i, compute_box_aa)
          {
             compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
 
-            A_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
-            b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
-            x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
-
-            Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
-            bp = hypre_StructVectorBoxData(b, i);
-            xp = hypre_StructVectorBoxData(x, i);
-
             hypre_ForBoxI(j, compute_box_a)
             {
                compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
-               start  = hypre_BoxIMin(compute_box);
-               hypre_BoxGetSize(compute_box, loop_size);
-
-               /* Are we relaxing index start or start+(1,0,0)? */
-               redblack = rb;
-               for (d = 0; d < ndim; d++)
-               {
-                  redblack += hypre_IndexD(start, d);
-               }
-               redblack = hypre_abs(redblack) % 2;
-
-               Astart = hypre_BoxIndexRank(A_dbox, start);
-               bstart = hypre_BoxIndexRank(b_dbox, start);
-               xstart = hypre_BoxIndexRank(x_dbox, start);
-               ni = hypre_IndexX(loop_size);
-               nj = hypre_IndexY(loop_size);
-               nk = hypre_IndexZ(loop_size);
-               Ani = hypre_BoxSizeX(A_dbox);
-               bni = hypre_BoxSizeX(b_dbox);
-               xni = hypre_BoxSizeX(x_dbox);
-               Anj = hypre_BoxSizeY(A_dbox);
-               bnj = hypre_BoxSizeY(b_dbox);
-               xnj = hypre_BoxSizeY(x_dbox);
-               if (ndim < 3)
-               {
-                  nk = 1;
-                  if (ndim < 2)
-                  {
-                     nj = 1;
-                  }
-               }
-
-               switch (stencil_size)
-               {
-                  case 7:
-                     Ap5 = hypre_StructMatrixBoxData(A, i, offd[5]);
-                     Ap4 = hypre_StructMatrixBoxData(A, i, offd[4]);
-                     xoff5 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[5]]);
-                     xoff4 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[4]]);
-                  // fall through
-
-                  case 5:
-                     Ap3 = hypre_StructMatrixBoxData(A, i, offd[3]);
-                     Ap2 = hypre_StructMatrixBoxData(A, i, offd[2]);
-                     xoff3 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[3]]);
-                     xoff2 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[2]]);
-                  // fall through
-
-                  case 3:
-                     Ap1 = hypre_StructMatrixBoxData(A, i, offd[1]);
-                     Ap0 = hypre_StructMatrixBoxData(A, i, offd[0]);
-                     xoff1 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[1]]);
-                     xoff0 = hypre_BoxOffsetDistance(x_dbox, stencil_shape[offd[0]]);
-                     break;
-               }
-
-               switch (stencil_size)
-               {
-                  case 7:
-                     hypre_RedBlackLoopInit();
-#define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap)
-                     hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
-                                             Astart, Ani, Anj, Ai,
-                                             bstart, bni, bnj, bi,
-                                             xstart, xni, xnj, xi);
-                     {
-                        xp[xi] =
-                           (bp[bi] -
-                            Ap0[Ai] * xp[xi + xoff0] -
-                            Ap1[Ai] * xp[xi + xoff1] -
-                            Ap2[Ai] * xp[xi + xoff2] -
-                            Ap3[Ai] * xp[xi + xoff3] -
-                            Ap4[Ai] * xp[xi + xoff4] -
-                            Ap5[Ai] * xp[xi + xoff5]) / Ap[Ai];
-                     }
-                     hypre_RedBlackLoopEnd();
-#undef DEVICE_VAR
-                     break;
-
-                  case 5:
-                     hypre_RedBlackLoopInit();
-#define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap2,Ap3,Ap)
-                     hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
-                                             Astart, Ani, Anj, Ai,
-                                             bstart, bni, bnj, bi,
-                                             xstart, xni, xnj, xi);
-                     {
-                        xp[xi] =
-                           (bp[bi] -
-                            Ap0[Ai] * xp[xi + xoff0] -
-                            Ap1[Ai] * xp[xi + xoff1] -
-                            Ap2[Ai] * xp[xi + xoff2] -
-                            Ap3[Ai] * xp[xi + xoff3]) / Ap[Ai];
-                     }
-                     hypre_RedBlackLoopEnd();
-#undef DEVICE_VAR
-                     break;
-
-                  case 3:
-                     hypre_RedBlackLoopInit();
-#define DEVICE_VAR is_device_ptr(xp,bp,Ap0,Ap1,Ap)
-                     hypre_RedBlackLoopBegin(ni, nj, nk, redblack,
-                                             Astart, Ani, Anj, Ai,
-                                             bstart, bni, bnj, bi,
-                                             xstart, xni, xnj, xi);
-                     {
-                        xp[xi] =
-                           (bp[bi] -
-                            Ap0[Ai] * xp[xi + xoff0] -
-                            Ap1[Ai] * xp[xi + xoff1]) / Ap[Ai];
-                     }
-                     hypre_RedBlackLoopEnd();
-#undef DEVICE_VAR
-
-                     break;
-               }
+               hypre_RedBlackGSBox(A, b, x, i, compute_box, rb, diag_rank, offd);
             }
          }
       }
@@ -548,3 +927,31 @@ hypre_RedBlackGSSetStartBlack( void *relax_vdata )
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSetTiling( void *relax_vdata,
+                           HYPRE_Int   tile_iters )
+{
+   hypre_RedBlackGSData *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   (relax_data -> tile_iters) = tile_iters;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSetColorSplit( void *relax_vdata,
+                               HYPRE_Int   color_split )
+{
+   hypre_RedBlackGSData *relax_data = (hypre_RedBlackGSData *)relax_vdata;
+
+   (relax_data -> color_split) = color_split;
+
+   return hypre_error_flag;
+}
@@ -5,6 +5,29 @@
  * SPDX-License-Identifier: (Apache-2.0 OR MIT)
  ******************************************************************************/
 
+/*--------------------------------------------------------------------------
+ * hypre_RedBlackSplitBox data structure
+ *
+ * Color-split storage for one grid box and a layer of ghost points around
+ * it.  The points of each color (parity of the index sum) are compacted
+ * along the first dimension, so that the points of one color in a row are
+ * contiguous and their neighbors in the other color are at fixed offsets.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_Index             start;              /* index of the first point */
+   HYPRE_Int               n[3];               /* box size plus ghost layer */
+   HYPRE_Int               half;               /* row length per color */
+   HYPRE_Int               size;               /* points per color */
+   HYPRE_Int               parity;             /* color of the first point */
+
+   HYPRE_Real             *A[2];               /* per color: stored entries of A */
+   HYPRE_Real             *b[2];
+   HYPRE_Real             *x[2];
+
+} hypre_RedBlackSplitBox;
+
 /*--------------------------------------------------------------------------
  * hypre_RedBlackGSData data structure
  *--------------------------------------------------------------------------*/
@@ -18,6 +41,9 @@ typedef struct
    HYPRE_Int               rel_change;         /* not yet used */
    HYPRE_Int               zero_guess;
    HYPRE_Int               rb_start;
+   HYPRE_Int               tile_iters;         /* iterations per pass over the
+                                                  box interiors (0 = no tiling) */
+   HYPRE_Int               color_split;        /* use color-split storage */
 
    hypre_StructMatrix     *A;
    hypre_StructVector     *b;
@@ -26,6 +52,10 @@ typedef struct
    HYPRE_Int               diag_rank;
 
    hypre_ComputePkg       *compute_pkg;
+   HYPRE_Int              *dept_faces;         /* per box and face: 1 if the face
+                                                  receives ghost values */
+   HYPRE_Int               num_split_boxes;
+   hypre_RedBlackSplitBox *split_boxes;        /* color-split storage, or NULL */
 
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
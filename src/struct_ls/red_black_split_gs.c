@@ -0,0 +1,783 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Red/black Gauss-Seidel with color-split storage.
+ *
+ * The stride-two loops in hypre_RedBlackGS use half of each cache line and do
+ * not vectorize.  Here, the points of each color of a box (and its ghost
+ * layer) are stored contiguously (see hypre_RedBlackSplitBox), so that each
+ * half sweep is a unit stride loop over rows.  For the point a = 2m+q of a
+ * row of color p, the neighbors in the first dimension are entries m-1+q and
+ * m+q of the other color, and the neighbors in the other dimensions are
+ * entry m of the rows above and below.
+ *
+ * The matrix coefficients are converted once in hypre_RedBlackGSSplitSetup.
+ * The vectors b and x are converted on entry and x is copied back on exit,
+ * so the callers only use the split storage for two or more sweeps.
+ * In between, only the points next to the box faces that receive ghost
+ * values are copied to x for the exchange, and the ghost values received are
+ * copied back; these points are relaxed after the exchange completes.  The
+ * results are identical to those of hypre_RedBlackGS and
+ * hypre_RedBlackConstantCoefGS.
+ *
+ * Like those routines, this assumes a 3-pt (1D), 5-pt (2D), or 7-pt (3D)
+ * stencil.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "red_black_gs.h"
+
+/*--------------------------------------------------------------------------
+ * Copy the points of the given colors (bit mask) in the local region
+ * [lo, hi] of sbox between the split storage and a vector box.  The data
+ * space box dbox must contain the region.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RedBlackSplitCopy( hypre_RedBlackSplitBox *sbox,
+                         HYPRE_Real            **split,
+                         HYPRE_Real             *data,
+                         hypre_Box              *dbox,
+                         HYPRE_Int              *lo,
+                         HYPRE_Int              *hi,
+                         HYPRE_Int               colors,
+                         HYPRE_Int               to_split )
+{
+   HYPRE_Int   ndim   = hypre_BoxNDim(dbox);
+   HYPRE_Int  *n      = (sbox -> n);
+   HYPRE_Int   half   = (sbox -> half);
+   HYPRE_Int   parity = (sbox -> parity);
+   HYPRE_Int   dstart = hypre_BoxIndexRank(dbox, (sbox -> start));
+   HYPRE_Int   dni    = hypre_BoxSizeD(dbox, 0);
+   HYPRE_Int   dnj    = (ndim > 1) ? hypre_BoxSizeD(dbox, 1) : 1;
+
+   HYPRE_Real *sp;
+   HYPRE_Real *dp;
+   HYPRE_Int   a, b, c, p, m, mlo, mhi;
+
+   for (c = lo[2]; c <= hi[2]; c++)
+   {
+      for (b = lo[1]; b <= hi[1]; b++)
+      {
+         for (p = 0; p < 2; p++)
+         {
+            if (colors & (1 << p))
+            {
+               /* the points of color p in this row are a = 2m+q */
+               a   = (p + parity + b + c) % 2;
+               mlo = (lo[0] - a + 1) / 2;
+               mhi = (hi[0] - a + 2) / 2 - 1;
+               sp  = split[p] + (c * n[1] + b) * half;
+               dp  = data + dstart + (c * dnj + b) * dni + a;
+               if (to_split)
+               {
+                  for (m = mlo; m <= mhi; m++)
+                  {
+                     sp[m] = dp[2 * m];
+                  }
+               }
+               else
+               {
+                  for (m = mlo; m <= mhi; m++)
+                  {
+                     dp[2 * m] = sp[m];
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Local region of the points of sbox, leaving out the points next to the
+ * faces flagged in faces (two per dimension) if faces is not NULL.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RedBlackSplitInterior( hypre_RedBlackSplitBox *sbox,
+                             HYPRE_Int               ndim,
+                             HYPRE_Int              *faces,
+                             HYPRE_Int              *lo,
+                             HYPRE_Int              *hi )
+{
+   HYPRE_Int  *n = (sbox -> n);
+   HYPRE_Int   e;
+
+   for (e = 0; e < 3; e++)
+   {
+      if (e < ndim)
+      {
+         lo[e] = 1;
+         hi[e] = n[e] - 2;
+         if (faces != NULL)
+         {
+            lo[e] += faces[2 * e];
+            hi[e] -= faces[2 * e + 1];
+         }
+      }
+      else
+      {
+         lo[e] = 0;
+         hi[e] = 0;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Local region of the points of sbox at distance 'layer' from face 'face'
+ * (0 = lower, 1 = upper) in dimension d.  Layer 0 is the ghost layer and
+ * layer 1 the first layer of box points.  If faces is not NULL, the points
+ * next to the faces of lower dimensions flagged in faces are left out, so
+ * that the layer 1 regions of the flagged faces partition the points next
+ * to them.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RedBlackSplitFace( hypre_RedBlackSplitBox *sbox,
+                         HYPRE_Int               ndim,
+                         HYPRE_Int              *faces,
+                         HYPRE_Int               d,
+                         HYPRE_Int               face,
+                         HYPRE_Int               layer,
+                         HYPRE_Int              *lo,
+                         HYPRE_Int              *hi )
+{
+   HYPRE_Int  *n = (sbox -> n);
+   HYPRE_Int   e;
+
+   hypre_RedBlackSplitInterior(sbox, ndim, NULL, lo, hi);
+   lo[d] = (face == 0) ? layer : n[d] - 1 - layer;
+   hi[d] = lo[d];
+   if (faces != NULL)
+   {
+      for (e = 0; e < d; e++)
+      {
+         lo[e] += faces[2 * e];
+         hi[e] -= faces[2 * e + 1];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Relax the points of color p in the local region [lo, hi] of box i.  With
+ * zero_guess, the neighbors are taken to be zero.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_RedBlackSplitRelax( hypre_StructMatrix     *A,
+                          HYPRE_Int               i,
+                          hypre_RedBlackSplitBox *sbox,
+                          HYPRE_Int               diag_rank,
+                          HYPRE_Int              *offd,
+                          HYPRE_Int              *lo,
+                          HYPRE_Int              *hi,
+                          HYPRE_Int               p,
+                          HYPRE_Int               zero_guess )
+{
+   HYPRE_Int              ndim           = hypre_StructMatrixNDim(A);
+   HYPRE_Int              constant_coeff = hypre_StructMatrixConstantCoefficient(A);
+   hypre_StructStencil   *stencil        = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape  = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size   = hypre_StructStencilSize(stencil);
+   HYPRE_Int             *n              = (sbox -> n);
+   HYPRE_Int              half           = (sbox -> half);
+   HYPRE_Int              size           = (sbox -> size);
+
+   HYPRE_Real            *Ap, *Ap0, *Ap1, *Ap2, *Ap3, *Ap4, *Ap5;
+   HYPRE_Real            *bp, *xp, *xo;
+   HYPRE_Real             App[6], AApd = 1.0;
+   HYPRE_Int              xoff[2][6];
+   HYPRE_Int             *xo_q;
+   HYPRE_Int              xo0, xo1, xo2, xo3, xo4, xo5;
+   HYPRE_Int              nrows, nb, r, b, c, q, m, mlo, mhi, rowi, k, d, dx;
+
+   Ap = Ap0 = Ap1 = Ap2 = Ap3 = Ap4 = Ap5 = NULL;
+
+   /* offsets of the neighbors in the other color, for rows with even (q = 0)
+    * and odd (q = 1) points of color p */
+   for (k = 0; k < stencil_size - 1; k++)
+   {
+      for (q = 0; q < 2; q++)
+      {
+         xoff[q][k] = 0;
+         for (d = 0; d < ndim; d++)
+         {
+            dx = hypre_IndexD(stencil_shape[offd[k]], d);
+            if (d == 0)
+            {
+               xoff[q][k] += (dx < 0) ? (q - 1) : ((dx > 0) ? q : 0);
+            }
+            else if (d == 1)
+            {
+               xoff[q][k] += dx * half;
+            }
+            else
+            {
+               xoff[q][k] += dx * half * n[1];
+            }
+         }
+      }
+   }
+
+   /* coefficients stored per box */
+   if (constant_coeff)
+   {
+      for (k = 0; k < stencil_size - 1; k++)
+      {
+         App[k] = *hypre_StructMatrixBoxData(A, i, offd[k]);
+      }
+      if (constant_coeff == 1)
+      {
+         AApd = 1.0 / *hypre_StructMatrixBoxData(A, i, diag_rank);
+      }
+   }
+
+   nb    = hi[1] - lo[1] + 1;
+   nrows = nb * (hi[2] - lo[2] + 1);
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(r,b,c,q,m,mlo,mhi,rowi,Ap,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,bp,xp,xo,xo_q,xo0,xo1,xo2,xo3,xo4,xo5) HYPRE_SMP_SCHEDULE
+#endif
+   for (r = 0; r < nrows; r++)
+   {
+      b = lo[1] + r % nb;
+      c = lo[2] + r / nb;
+
+      /* the points of color p in this row are a = 2m+q */
+      q    = (p + (sbox -> parity) + b + c) % 2;
+      mlo  = (lo[0] - q + 1) / 2;
+      mhi  = (hi[0] - q + 2) / 2 - 1;
+      rowi = (c * n[1] + b) * half;
+      xo_q = xoff[q];
+
+      bp = (sbox -> b[p]) + rowi;
+      xp = (sbox -> x[p]) + rowi;
+      xo = (sbox -> x[1 - p]) + rowi;
+      if (constant_coeff != 1)
+      {
+         Ap = (sbox -> A[p]) + ((constant_coeff) ? 0 : diag_rank * size) + rowi;
+      }
+
+      if (zero_guess)
+      {
+         if (constant_coeff == 1)
+         {
+            for (m = mlo; m <= mhi; m++)
+            {
+               xp[m] = bp[m] * AApd;
+            }
+         }
+         else
+         {
+            for (m = mlo; m <= mhi; m++)
+            {
+               xp[m] = bp[m] / Ap[m];
+            }
+         }
+         continue;
+      }
+
+      xo0 = xo_q[0];
+      xo1 = xo_q[1];
+      xo2 = (stencil_size > 3) ? xo_q[2] : 0;
+      xo3 = (stencil_size > 3) ? xo_q[3] : 0;
+      xo4 = (stencil_size > 5) ? xo_q[4] : 0;
+      xo5 = (stencil_size > 5) ? xo_q[5] : 0;
+
+      if (constant_coeff == 0)
+      {
+         Ap0 = (sbox -> A[p]) + offd[0] * size + rowi;
+         Ap1 = (sbox -> A[p]) + offd[1] * size + rowi;
+         if (stencil_size > 3)
+         {
+            Ap2 = (sbox -> A[p]) + offd[2] * size + rowi;
+            Ap3 = (sbox -> A[p]) + offd[3] * size + rowi;
+         }
+         if (stencil_size > 5)
+         {
+            Ap4 = (sbox -> A[p]) + offd[4] * size + rowi;
+            Ap5 = (sbox -> A[p]) + offd[5] * size + rowi;
+         }
+
+         switch (stencil_size)
+         {
+            case 7:
+               for (m = mlo; m <= mhi; m++)
+               {
+                  xp[m] =
+                     (bp[m] -
+                      Ap0[m] * xo[m + xo0] -
+                      Ap1[m] * xo[m + xo1] -
+                      Ap2[m] * xo[m + xo2] -
+                      Ap3[m] * xo[m + xo3] -
+                      Ap4[m] * xo[m + xo4] -
+                      Ap5[m] * xo[m + xo5]) / Ap[m];
+               }
+               break;
+
+            case 5:
+               for (m = mlo; m <= mhi; m++)
+               {
+                  xp[m] =
+                     (bp[m] -
+                      Ap0[m] * xo[m + xo0] -
+                      Ap1[m] * xo[m + xo1] -
+                      Ap2[m] * xo[m + xo2] -
+                      Ap3[m] * xo[m + xo3]) / Ap[m];
+               }
+               break;
+
+            case 3:
+               for (m = mlo; m <= mhi; m++)
+               {
+                  xp[m] =
+                     (bp[m] -
+                      Ap0[m] * xo[m + xo0] -
+                      Ap1[m] * xo[m + xo1]) / Ap[m];
+               }
+               break;
+         }
+      }
+      else if (constant_coeff == 1)
+      {
+         switch (stencil_size)
+         {
+            case 7:
+               for (m = mlo; m <= mhi; m++)
+               {
+                  xp[m] =
+                     (bp[m] -
+                      App[0] * xo[m + xo0] -
+                      App[1] * xo[m + xo1] -
+                      App[2] * xo[m + xo2] -
+                      App[3] * xo[m + xo3] -
+                      App[4] * xo[m + xo4] -
+                      App[5] * xo[m + xo5]) * AApd;
+               }
+               break;
+
+            case 5:
+               for (m = mlo; m <= mhi; m++)
+               {
+                  xp[m] =
+                     (bp[m] -
+                      App[0] * xo[m + xo0] -
+                      App[1] * xo[m + xo1] -
+                      App[2] * xo[m + xo2] -
+                      App[3] * xo[m + xo3]) * AApd;
+               }
+               break;
+
+            case 3:
+               for (m = mlo; m <= mhi; m++)
+               {
+                  xp[m] =
+                     (bp[m] -
+                      App[0] * xo[m + xo0] -
+                      App[1] * xo[m + xo1]) * AApd;
+               }
+               break;
+         }
+      }
+      else /* variable diagonal */
+      {
+         switch (stencil_size)
+         {
+            case 7:
+               for (m = mlo; m <= mhi; m++)
+               {
+                  xp[m] =
+                     (bp[m] -
+                      App[0] * xo[m + xo0] -
+                      App[1] * xo[m + xo1] -
+                      App[2] * xo[m + xo2] -
+                      App[3] * xo[m + xo3] -
+                      App[4] * xo[m + xo4] -
+                      App[5] * xo[m + xo5]) / Ap[m];
+               }
+               break;
+
+            case 5:
+               for (m = mlo; m <= mhi; m++)
+               {
+                  xp[m] =
+                     (bp[m] -
+                      App[0] * xo[m + xo0] -
+                      App[1] * xo[m + xo1] -
+                      App[2] * xo[m + xo2] -
+                      App[3] * xo[m + xo3]) / Ap[m];
+               }
+               break;
+
+            case 3:
+               for (m = mlo; m <= mhi; m++)
+               {
+                  xp[m] =
+                     (bp[m] -
+                      App[0] * xo[m + xo0] -
+                      App[1] * xo[m + xo1]) / Ap[m];
+               }
+               break;
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RedBlackGSSplitDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSplitDestroy( void *relax_vdata )
+{
+   hypre_RedBlackGSData    *relax_data  = (hypre_RedBlackGSData *)relax_vdata;
+   hypre_RedBlackSplitBox  *split_boxes = (relax_data -> split_boxes);
+   HYPRE_Int                i;
+
+   if (split_boxes)
+   {
+      for (i = 0; i < (relax_data -> num_split_boxes); i++)
+      {
+         hypre_TFree(split_boxes[i].A[0], HYPRE_MEMORY_HOST);
+         hypre_TFree(split_boxes[i].A[1], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(split_boxes, HYPRE_MEMORY_HOST);
+   }
+   (relax_data -> split_boxes)     = NULL;
+   (relax_data -> num_split_boxes) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RedBlackGSSplitSetup
+ *
+ * Set up the color-split storage and convert the coefficients of A.  For
+ * constant coefficient A, only the diagonal is converted when it is
+ * variable.  If the stencil is not supported or x has no ghost layer, no
+ * split storage is set up and the stride-two kernels are used instead.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSplitSetup( void               *relax_vdata,
+                            hypre_StructMatrix *A,
+                            hypre_StructVector *b,
+                            hypre_StructVector *x )
+{
+   hypre_RedBlackGSData    *relax_data     = (hypre_RedBlackGSData *)relax_vdata;
+   HYPRE_Int                diag_rank      = (relax_data -> diag_rank);
+   HYPRE_Int                ndim           = hypre_StructMatrixNDim(A);
+   HYPRE_Int                constant_coeff = hypre_StructMatrixConstantCoefficient(A);
+   hypre_StructStencil     *stencil        = hypre_StructMatrixStencil(A);
+   HYPRE_Int                stencil_size   = hypre_StructStencilSize(stencil);
+   hypre_BoxArray          *boxes          = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+
+   hypre_RedBlackSplitBox  *split_boxes;
+   hypre_RedBlackSplitBox  *sbox;
+   hypre_Box               *box;
+   hypre_Box               *A_dbox;
+   hypre_Box               *b_dbox;
+   hypre_Box               *x_dbox;
+   HYPRE_Real              *Ap;
+   HYPRE_Real              *split_A[2];
+   HYPRE_Int                lo[3], hi[3];
+   HYPRE_Int                num_A, i, d, s, p, a, bb, c, si, Ai;
+   HYPRE_Int                A_dni, A_dnj, A_start;
+
+   hypre_RedBlackGSSplitDestroy(relax_vdata);
+
+   if (stencil_size != 2 * ndim + 1)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box    = hypre_BoxArrayBox(boxes, i);
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      for (d = 0; d < ndim; d++)
+      {
+         if ((hypre_BoxIMinD(x_dbox, d) > hypre_BoxIMinD(box, d) - 1) ||
+             (hypre_BoxIMaxD(x_dbox, d) < hypre_BoxIMaxD(box, d) + 1) ||
+             (hypre_BoxIMinD(b_dbox, d) > hypre_BoxIMinD(box, d)) ||
+             (hypre_BoxIMaxD(b_dbox, d) < hypre_BoxIMaxD(box, d)))
+         {
+            return hypre_error_flag;
+         }
+      }
+   }
+
+   /* number of stored coefficients per point */
+   num_A = (constant_coeff == 0) ? stencil_size : ((constant_coeff == 2) ? 1 : 0);
+
+   split_boxes = hypre_CTAlloc(hypre_RedBlackSplitBox, hypre_BoxArraySize(boxes),
+                               HYPRE_MEMORY_HOST);
+
+   hypre_ForBoxI(i, boxes)
+   {
+      sbox = &split_boxes[i];
+      box  = hypre_BoxArrayBox(boxes, i);
+
+      hypre_SetIndex(sbox -> start, 0);
+      (sbox -> parity) = 0;
+      for (d = 0; d < 3; d++)
+      {
+         if (d < ndim)
+         {
+            hypre_IndexD(sbox -> start, d) = hypre_BoxIMinD(box, d) - 1;
+            (sbox -> n[d]) = hypre_BoxSizeD(box, d) + 2;
+            (sbox -> parity) += hypre_IndexD(sbox -> start, d);
+         }
+         else
+         {
+            (sbox -> n[d]) = 1;
+         }
+      }
+      (sbox -> parity) = hypre_abs(sbox -> parity) % 2;
+      (sbox -> half)   = ((sbox -> n[0]) + 1) / 2;
+      (sbox -> size)   = (sbox -> half) * (sbox -> n[1]) * (sbox -> n[2]);
+
+      for (p = 0; p < 2; p++)
+      {
+         (sbox -> A[p]) = hypre_CTAlloc(HYPRE_Real, (num_A + 2) * (sbox -> size),
+                                        HYPRE_MEMORY_HOST);
+         (sbox -> b[p]) = (sbox -> A[p]) + num_A * (sbox -> size);
+         (sbox -> x[p]) = (sbox -> b[p]) + (sbox -> size);
+      }
+
+      /* convert the variable coefficients of A at the box points */
+      if (num_A > 0)
+      {
+         A_dbox  = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+         A_dni   = hypre_BoxSizeD(A_dbox, 0);
+         A_dnj   = (ndim > 1) ? hypre_BoxSizeD(A_dbox, 1) : 1;
+         A_start = hypre_BoxIndexRank(A_dbox, hypre_BoxIMin(box));
+
+         hypre_RedBlackSplitInterior(sbox, ndim, NULL, lo, hi);
+         for (s = 0; s < num_A; s++)
+         {
+            Ap = hypre_StructMatrixBoxData(A, i, (num_A == 1) ? diag_rank : s);
+            split_A[0] = (sbox -> A[0]) + s * (sbox -> size);
+            split_A[1] = (sbox -> A[1]) + s * (sbox -> size);
+            for (c = lo[2]; c <= hi[2]; c++)
+            {
+               for (bb = lo[1]; bb <= hi[1]; bb++)
+               {
+                  for (a = lo[0]; a <= hi[0]; a++)
+                  {
+                     p  = ((sbox -> parity) + a + bb + c) % 2;
+                     si = (c * (sbox -> n[1]) + bb) * (sbox -> half) + a / 2;
+                     Ai = A_start + ((c - lo[2]) * A_dnj + (bb - lo[1])) * A_dni + (a - lo[0]);
+                     split_A[p][si] = Ap[Ai];
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   (relax_data -> split_boxes)     = split_boxes;
+   (relax_data -> num_split_boxes) = hypre_BoxArraySize(boxes);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RedBlackGSSplit
+ *
+ * Do the red/black iterations of hypre_RedBlackGS or
+ * hypre_RedBlackConstantCoefGS with the color-split storage.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_RedBlackGSSplit( void               *relax_vdata,
+                       hypre_StructMatrix *A,
+                       hypre_StructVector *b,
+                       hypre_StructVector *x,
+                       HYPRE_Int          *offd )
+{
+   hypre_RedBlackGSData    *relax_data  = (hypre_RedBlackGSData *)relax_vdata;
+
+   HYPRE_Int                max_iter    = (relax_data -> max_iter);
+   HYPRE_Int                zero_guess  = (relax_data -> zero_guess);
+   HYPRE_Int                rb_start    = (relax_data -> rb_start);
+   HYPRE_Int                diag_rank   = (relax_data -> diag_rank);
+   hypre_ComputePkg        *compute_pkg = (relax_data -> compute_pkg);
+   HYPRE_Int               *dept_faces  = (relax_data -> dept_faces);
+   hypre_RedBlackSplitBox  *split_boxes = (relax_data -> split_boxes);
+   HYPRE_Int                ndim        = hypre_StructMatrixNDim(A);
+   hypre_BoxArray          *boxes       = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+
+   hypre_CommHandle        *comm_handle;
+   hypre_RedBlackSplitBox  *sbox;
+   hypre_Box               *b_dbox;
+   hypre_Box               *x_dbox;
+   HYPRE_Real              *bp;
+   HYPRE_Real              *xp;
+   HYPRE_Int                all_faces[6] = {1, 1, 1, 1, 1, 1};
+   HYPRE_Int               *faces;
+   HYPRE_Int                lo[3], hi[3];
+   HYPRE_Int                iter, rb, i, d, face;
+
+   /*----------------------------------------------------------
+    * Convert b and x, including the ghost values of x
+    *----------------------------------------------------------*/
+
+   hypre_ForBoxI(i, boxes)
+   {
+      sbox   = &split_boxes[i];
+      b_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      bp     = hypre_StructVectorBoxData(b, i);
+      xp     = hypre_StructVectorBoxData(x, i);
+
+      hypre_RedBlackSplitInterior(sbox, ndim, NULL, lo, hi);
+      hypre_RedBlackSplitCopy(sbox, (sbox -> b), bp, b_dbox, lo, hi, 3, 1);
+      if (!zero_guess)
+      {
+         hypre_RedBlackSplitCopy(sbox, (sbox -> x), xp, x_dbox, lo, hi, 3, 1);
+      }
+      for (d = 0; d < ndim; d++)
+      {
+         for (face = 0; face < 2; face++)
+         {
+            hypre_RedBlackSplitFace(sbox, ndim, NULL, d, face, 0, lo, hi);
+            hypre_RedBlackSplitCopy(sbox, (sbox -> x), xp, x_dbox, lo, hi, 3, 1);
+         }
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Do zero_guess iteration
+    *----------------------------------------------------------*/
+
+   rb = rb_start;
+   iter = 0;
+
+   if (zero_guess)
+   {
+      hypre_ForBoxI(i, boxes)
+      {
+         sbox = &split_boxes[i];
+         hypre_RedBlackSplitInterior(sbox, ndim, NULL, lo, hi);
+         hypre_RedBlackSplitRelax(A, i, sbox, diag_rank, offd, lo, hi, rb, 1);
+      }
+
+      rb = (rb + 1) % 2;
+      iter++;
+   }
+
+   /*----------------------------------------------------------
+    * Do regular iterations.  Only the points next to the faces
+    * that receive ghost values (all faces if the ghost values
+    * may come from the box itself) take part in the exchange.
+    *----------------------------------------------------------*/
+
+   while (iter < 2 * max_iter)
+   {
+      /* copy the points of the other color next to the faces to x */
+      hypre_ForBoxI(i, boxes)
+      {
+         sbox   = &split_boxes[i];
+         faces  = (dept_faces != NULL) ? &dept_faces[2 * ndim * i] : all_faces;
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         xp     = hypre_StructVectorBoxData(x, i);
+         for (d = 0; d < ndim; d++)
+         {
+            for (face = 0; face < 2; face++)
+            {
+               if (faces[2 * d + face])
+               {
+                  hypre_RedBlackSplitFace(sbox, ndim, NULL, d, face, 1, lo, hi);
+                  hypre_RedBlackSplitCopy(sbox, (sbox -> x), xp, x_dbox, lo, hi,
+                                          1 << (1 - rb), 0);
+               }
+            }
+         }
+      }
+
+      xp = hypre_StructVectorData(x);
+      hypre_InitializeIndtComputations(compute_pkg, xp, &comm_handle);
+
+      /* points that need no ghost values */
+      hypre_ForBoxI(i, boxes)
+      {
+         sbox  = &split_boxes[i];
+         faces = (dept_faces != NULL) ? &dept_faces[2 * ndim * i] : all_faces;
+         hypre_RedBlackSplitInterior(sbox, ndim, faces, lo, hi);
+         if ((lo[0] <= hi[0]) && (lo[1] <= hi[1]) && (lo[2] <= hi[2]))
+         {
+            hypre_RedBlackSplitRelax(A, i, sbox, diag_rank, offd, lo, hi, rb, 0);
+         }
+      }
+
+      hypre_FinalizeIndtComputations(comm_handle);
+
+      /* copy the ghost values and relax the points next to the faces */
+      hypre_ForBoxI(i, boxes)
+      {
+         sbox   = &split_boxes[i];
+         faces  = (dept_faces != NULL) ? &dept_faces[2 * ndim * i] : all_faces;
+         x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+         xp     = hypre_StructVectorBoxData(x, i);
+         for (d = 0; d < ndim; d++)
+         {
+            for (face = 0; face < 2; face++)
+            {
+               if (faces[2 * d + face])
+               {
+                  hypre_RedBlackSplitFace(sbox, ndim, NULL, d, face, 0, lo, hi);
+                  hypre_RedBlackSplitCopy(sbox, (sbox -> x), xp, x_dbox, lo, hi,
+                                          1 << (1 - rb), 1);
+               }
+            }
+         }
+         for (d = 0; d < ndim; d++)
+         {
+            for (face = 0; face < 2; face++)
+            {
+               /* a box of size one in d has a single layer of points */
+               if (!faces[2 * d + face] ||
+                   ((face == 1) && faces[2 * d] && ((sbox -> n[d]) == 3)))
+               {
+                  continue;
+               }
+               hypre_RedBlackSplitFace(sbox, ndim, faces, d, face, 1, lo, hi);
+               if ((lo[0] <= hi[0]) && (lo[1] <= hi[1]) && (lo[2] <= hi[2]))
+               {
+                  hypre_RedBlackSplitRelax(A, i, sbox, diag_rank, offd, lo, hi, rb, 0);
+               }
+            }
+         }
+      }
+
+      rb = (rb + 1) % 2;
+      iter++;
+   }
+
+   /*----------------------------------------------------------
+    * Copy x back
+    *----------------------------------------------------------*/
+
+   hypre_ForBoxI(i, boxes)
+   {
+      sbox   = &split_boxes[i];
+      x_dbox = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      xp     = hypre_StructVectorBoxData(x, i);
+      hypre_RedBlackSplitInterior(sbox, ndim, NULL, lo, hi);
+      hypre_RedBlackSplitCopy(sbox, (sbox -> x), xp, x_dbox, lo, hi, 3, 0);
+   }
+
+   (relax_data -> num_iterations) = iter / 2;
+
+   return hypre_error_flag;
+}
@@ -49,6 +49,8 @@ typedef struct
                                       A_rem = A - A_sol                  */
    void                  **residual_data;  /* Array of size `num_spaces' */
    void                  **solve_data;     /* Array of size `num_spaces' */
+   HYPRE_Int               line_solve;     /* Use batched line solves instead
+                                              of cyclic reduction (2D only) */
 
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
@@ -160,6 +162,10 @@ hypre_SMGRelaxDestroyASol( void *relax_vdata )
          {
             hypre_SMGDestroy(relax_data -> solve_data[i]);
          }
+         else if (relax_data -> line_solve)
+         {
+            hypre_LineRelaxDestroy(relax_data -> solve_data[i]);
+         }
          else
          {
             hypre_CyclicReductionDestroy(relax_data -> solve_data[i]);
@@ -309,6 +315,10 @@ hypre_SMGRelax( void               *relax_vdata,
             {
                hypre_SMGSolve(solve_data[is], A_sol, temp_vec, x);
             }
+            else if (relax_data -> line_solve)
+            {
+               hypre_LineRelax(solve_data[is], A_sol, temp_vec, x);
+            }
             else
             {
                hypre_CyclicReduction(solve_data[is], A_sol, temp_vec, x);
@@ -548,6 +558,7 @@ hypre_SMGRelaxSetupASol( void               *relax_vdata,
    HYPRE_Int             num_stencil_indices;
    HYPRE_Int            *stencil_indices;
 
+   HYPRE_Int             is_exact, is_batched;
    HYPRE_Int             i;
 
    /*----------------------------------------------------------
@@ -600,6 +611,34 @@ hypre_SMGRelaxSetupASol( void               *relax_vdata,
       }
       else
       {
+         /* Use batched line solves when they are exact (i.e., each line lies
+            within a single box) and every box has at least a full batch of
+            lines to vectorize across, otherwise use cyclic reduction.  Every
+            space has the same lines, so this is decided for the first one. */
+         if (i == 0)
+         {
+            solve_data[i] = hypre_LineRelaxCreate(relax_data -> comm);
+            hypre_LineRelaxSetDir(solve_data[i], 0);
+            hypre_LineRelaxSetBase(solve_data[i], base_index, base_stride);
+            hypre_LineRelaxSetup(solve_data[i], A_sol, temp_vec, x);
+            hypre_LineRelaxGetIsExact(solve_data[i], &is_exact);
+            hypre_LineRelaxGetIsBatched(solve_data[i], &is_batched);
+            (relax_data -> line_solve) = (is_exact && is_batched);
+            if (relax_data -> line_solve)
+            {
+               continue;
+            }
+            hypre_LineRelaxDestroy(solve_data[i]);
+         }
+         else if (relax_data -> line_solve)
+         {
+            solve_data[i] = hypre_LineRelaxCreate(relax_data -> comm);
+            hypre_LineRelaxSetDir(solve_data[i], 0);
+            hypre_LineRelaxSetBase(solve_data[i], base_index, base_stride);
+            hypre_LineRelaxSetup(solve_data[i], A_sol, temp_vec, x);
+            continue;
+         }
+
          solve_data[i] = hypre_CyclicReductionCreate(relax_data -> comm);
          hypre_CyclicReductionSetBase(solve_data[i], base_index, base_stride);
          //hypre_CyclicReductionSetMaxLevel(solve_data[i], -1);//(relax_data -> max_level)+10);
@@ -378,6 +378,24 @@ HYPRE_Int  HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix  matrix,
    return hypre_StructMatrixSetConstantEntries( matrix, nentries, entries );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructMatrixSetCoeffFcn
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixSetCoeffFcn( HYPRE_StructMatrix          matrix,
+                               HYPRE_StructMatrixCoeffFcn  fcn,
+                               void                       *data )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_StructMatrixSetCoeffFcn(matrix, fcn, data) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -409,6 +427,40 @@ HYPRE_StructMatrixRead( MPI_Comm             comm,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructMatrixPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixPrintBinary( const char         *filename,
+                               HYPRE_StructMatrix  matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_StructMatrixPrintBinary(filename, (hypre_StructMatrix *) matrix) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructMatrixReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixReadBinary( const char         *filename,
+                              HYPRE_StructMatrix  matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_StructMatrixReadBinary(filename, (hypre_StructMatrix *) matrix) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -343,6 +343,38 @@ HYPRE_Int HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix matrix,
                                                 HYPRE_Int          nentries,
                                                 HYPRE_Int         *entries );
 
+/**
+ * Coefficient function for matrix-free matrices.  The function fills
+ * \e values with the coefficients of stencil entry \e entry at all points of
+ * the box [\e ilower, \e iupper], ordered with the first index varying
+ * fastest.  The argument \e data is the pointer passed to
+ * \e HYPRE_StructMatrixSetCoeffFcn.
+ **/
+typedef HYPRE_Int (*HYPRE_StructMatrixCoeffFcn)(void          *data,
+                                                HYPRE_Int      entry,
+                                                HYPRE_Int     *ilower,
+                                                HYPRE_Int     *iupper,
+                                                HYPRE_Complex *values);
+
+/**
+ * Make the matrix matrix-free.  The variable coefficients are not stored, but
+ * evaluated on the fly by calling \e fcn on small blocks of grid points.  If
+ * the matrix also has constant entries (all but the diagonal), these are set
+ * as usual with \e HYPRE_StructMatrixSetConstantValues.  Coefficients that
+ * couple to points outside of the grid are ignored.
+ *
+ * Must be called before \e HYPRE_StructMatrixInitialize.  The matrix must use
+ * nonsymmetric storage and live in host memory, and its variable
+ * coefficients cannot be set, cleared, or printed.  Presently supported by
+ * matvec, Jacobi, and PFMG with Jacobi relaxation (relax types 0 and 1);
+ * PFMG setup returns an error for the other relaxation types.  PFMG builds its
+ * coarse operators from an assembled copy of the matrix, which is freed at the
+ * end of setup.
+ **/
+HYPRE_Int HYPRE_StructMatrixSetCoeffFcn( HYPRE_StructMatrix          matrix,
+                                         HYPRE_StructMatrixCoeffFcn  fcn,
+                                         void                       *data );
+
 /**
  * Set the ghost layer in the matrix
  **/
@@ -365,6 +397,26 @@ HYPRE_Int HYPRE_StructMatrixRead( MPI_Comm             comm,
                                   HYPRE_Int           *num_ghost,
                                   HYPRE_StructMatrix  *matrix );
 
+/**
+ * Collectively write the matrix coefficients to a single binary checkpoint
+ * file using MPI-IO.  The file holds a small header (grid boxes, stencil, and
+ * ghost layer sizes) followed by the raw coefficients of each grid box.  Data
+ * is written in native byte order.
+ **/
+HYPRE_Int HYPRE_StructMatrixPrintBinary(const char         *filename,
+                                        HYPRE_StructMatrix  matrix);
+
+/**
+ * Collectively read a file written by \e HYPRE_StructMatrixPrintBinary into
+ * an initialized matrix with the same stencil, symmetry, and constant
+ * coefficient type.  The matrix grid may be distributed over a different
+ * number of processes than the one used to write the file, since the data is
+ * restored by intersecting the local boxes with the boxes in the file.  Call
+ * \e HYPRE_StructMatrixAssemble afterwards.
+ **/
+HYPRE_Int HYPRE_StructMatrixReadBinary(const char         *filename,
+                                       HYPRE_StructMatrix  matrix);
+
 /**
  * Matvec operator.  This operation is \f$y = \alpha A x + \beta y\f$ .
  * Note that you can do a simple matrix-vector multiply by setting
@@ -534,6 +586,22 @@ HYPRE_Int HYPRE_StructVectorRead( MPI_Comm             comm,
                                   HYPRE_Int           *num_ghost,
                                   HYPRE_StructVector  *vector );
 
+/**
+ * Collectively write the vector values to a single binary checkpoint file
+ * using MPI-IO (see \e HYPRE_StructMatrixPrintBinary).
+ **/
+HYPRE_Int HYPRE_StructVectorPrintBinary(const char         *filename,
+                                        HYPRE_StructVector  vector);
+
+/**
+ * Collectively read a file written by \e HYPRE_StructVectorPrintBinary into
+ * an initialized vector, possibly distributed over a different number of
+ * processes (see \e HYPRE_StructMatrixReadBinary).  Call
+ * \e HYPRE_StructVectorAssemble afterwards.
+ **/
+HYPRE_Int HYPRE_StructVectorReadBinary(const char         *filename,
+                                       HYPRE_StructVector  vector);
+
 /**@}*/
 /**@}*/
 
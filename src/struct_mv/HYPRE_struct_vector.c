@@ -319,6 +319,40 @@ HYPRE_StructVectorRead( MPI_Comm             comm,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorPrintBinary( const char         *filename,
+                               HYPRE_StructVector  vector )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_StructVectorPrintBinary(filename, (hypre_StructVector *) vector) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorReadBinary( const char         *filename,
+                              HYPRE_StructVector  vector )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   return ( hypre_StructVectorReadBinary(filename, (hypre_StructVector *) vector) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_StructVectorSetNumGhost
  *--------------------------------------------------------------------------*/
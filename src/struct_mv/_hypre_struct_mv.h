@@ -433,6 +433,7 @@ typedef struct
 {
    /* the entries will be the same for all procs */
    HYPRE_Int           ndim;             /* number of dimensions */
+   HYPRE_Int           global_num_boxes; /* number of boxes in the grid */
    hypre_BoxArray     *regions;          /* areas of the grid with boxes */
    HYPRE_Int           num_regions;      /* how many regions */
    HYPRE_Int          *proc_partitions;  /* proc ids assigned to each region
@@ -454,6 +455,7 @@ typedef struct
 /*Accessor macros */
 
 #define hypre_StructAssumedPartNDim(apart) ((apart)->ndim)
+#define hypre_StructAssumedPartGlobalNumBoxes(apart) ((apart)->global_num_boxes)
 #define hypre_StructAssumedPartRegions(apart) ((apart)->regions)
 #define hypre_StructAssumedPartNumRegions(apart) ((apart)->num_regions)
 #define hypre_StructAssumedPartDivisions(apart) ((apart)->divisions)
@@ -505,6 +507,22 @@ typedef struct hypre_BoxManEntry_struct
 
 } hypre_BoxManEntry;
 
+/*--------------------------------------------------------------------------
+ * BoxManNode: node of the bounding volume tree built over the entries
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_Index imin; /* Extents of the smallest box containing all entries */
+   hypre_Index imax; /* below this node */
+
+   HYPRE_Int   child; /* First child node (the second one is child+1), or -1
+                         if this node is a leaf */
+   HYPRE_Int   first; /* Entries of a leaf: tree_order[first:first+count-1] */
+   HYPRE_Int   count;
+
+} hypre_BoxManNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -561,18 +579,12 @@ typedef struct
    HYPRE_Int          local_proc_offset; /* Position of local information in
                                             offsets */
 
-   /* Here is the table  that organizes the entries spatially (by index) */
-   hypre_BoxManEntry **index_table; /* This points into 'entries' array and
-                                       corresponds to the index arays */
-
-   HYPRE_Int          *indexes[HYPRE_MAXDIM]; /* Indexes (ordered) for imin and
-                                                 imax of each box in the entries
-                                                 array */
-   HYPRE_Int           size[HYPRE_MAXDIM]; /* How many indexes in each
-                                              direction */
-
-   HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
-                                                    indexes map */
+   /* Here is the bounding volume tree that organizes the entries spatially */
+   HYPRE_Int           tree_nnodes; /* Number of nodes in the tree */
+   hypre_BoxManNode   *tree_nodes; /* Tree nodes (node 0 is the root) */
+   HYPRE_Int          *tree_order; /* Entry positions, ordered so that the
+                                      entries of each leaf are contiguous */
+   HYPRE_Int           tree_depth; /* Maximum depth of the tree */
 
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */
@@ -625,10 +637,10 @@ typedef struct
 
 #define hypre_BoxManFirstLocal(manager)         ((manager) -> first_local)
 
-#define hypre_BoxManIndexTable(manager)         ((manager) -> index_table)
-#define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
-#define hypre_BoxManSize(manager)               ((manager) -> size)
-#define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManTreeNNodes(manager)         ((manager) -> tree_nnodes)
+#define hypre_BoxManTreeNodes(manager)          ((manager) -> tree_nodes)
+#define hypre_BoxManTreeOrder(manager)          ((manager) -> tree_order)
+#define hypre_BoxManTreeDepth(manager)          ((manager) -> tree_depth)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
@@ -641,9 +653,7 @@ typedef struct
 
 #define hypre_BoxManNumGhost(manager)           ((manager) -> num_ghost)
 
-#define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
-#define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
-#define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
+#define hypre_BoxManTreeNode(manager, i)    &(hypre_BoxManTreeNodes(manager)[i])
 
 #define hypre_BoxManInfoObject(manager, i) \
 (void *) ((char *)hypre_BoxManInfoObjects(manager) + i* hypre_BoxManEntryInfoSize(manager))
@@ -662,6 +672,16 @@ typedef struct
 #define hypre_BoxManEntryNext(entry)     ((entry) -> next)
 #define hypre_BoxManEntryBoxMan(entry)   ((entry) -> boxman)
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_BoxManNode
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BoxManNodeIMin(node)       ((node) -> imin)
+#define hypre_BoxManNodeIMax(node)       ((node) -> imax)
+#define hypre_BoxManNodeChild(node)      ((node) -> child)
+#define hypre_BoxManNodeFirst(node)      ((node) -> first)
+#define hypre_BoxManNodeCount(node)      ((node) -> count)
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -921,6 +941,14 @@ typedef struct hypre_CommPkg_struct
    hypre_Index          identity_coord;
    hypre_Index          identity_dir;
    HYPRE_Int           *identity_order;
+
+   /* persistent requests and buffers (HYPRE_USING_PERSISTENT_COMM) */
+   HYPRE_Int            persistent_tag;
+   HYPRE_Int            persistent_active;
+   hypre_MPI_Request   *persistent_requests;
+   hypre_MPI_Status    *persistent_status;
+   HYPRE_Complex      **persistent_send_buffers;
+   HYPRE_Complex      **persistent_recv_buffers;
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -946,6 +974,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int          action;
 
+   /* requests and buffers belong to comm_pkg */
+   HYPRE_Int          persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1039,6 +1070,13 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)                (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)              (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistentTag(comm_pkg)              (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentActive(comm_pkg)           (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentRequests(comm_pkg)         (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)           (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg)      (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg)      (comm_pkg -> persistent_recv_buffers)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1054,6 +1092,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleAction(comm_handle)               (comm_handle -> action)
 #define hypre_CommHandleSendBuffersMPI(comm_handle)       (comm_handle -> send_buffers_mpi)
 #define hypre_CommHandleRecvBuffersMPI(comm_handle)       (comm_handle -> recv_buffers_mpi)
+#define hypre_CommHandlePersistent(comm_handle)           (comm_handle -> persistent)
 
 #endif
 /******************************************************************************
@@ -1185,6 +1224,10 @@ typedef struct hypre_StructMatrix_struct
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   HYPRE_StructMatrixCoeffFcn coeff_fcn;            /* Evaluates the variable coefficients of
+                                                       matrix-free matrices (NULL otherwise) */
+   void                 *coeff_data;                /* User data passed to coeff_fcn */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
@@ -1213,11 +1256,16 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
+#define hypre_StructMatrixCoeffFcn(matrix)            ((matrix) -> coeff_fcn)
+#define hypre_StructMatrixCoeffData(matrix)           ((matrix) -> coeff_data)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
 
 #define hypre_StructMatrixNDim(matrix) \
 hypre_StructGridNDim(hypre_StructMatrixGrid(matrix))
 
+#define hypre_StructMatrixMatrixFree(matrix) \
+(hypre_StructMatrixCoeffFcn(matrix) != NULL)
+
 #define hypre_StructMatrixBox(matrix, b) \
 hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 
@@ -1232,6 +1280,9 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_CCBoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
 
+/* Object type stored in binary files (see hypre_PrintBoxArrayDataBinary) */
+#define hypre_STRUCT_BINARY_MATRIX 1
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -1310,6 +1361,9 @@ hypre_BoxArrayBox(hypre_StructVectorDataSpace(vector), b)
 (hypre_StructVectorBoxData(vector, b) + \
  hypre_BoxIndexRank(hypre_StructVectorBox(vector, b), index))
 
+/* Object type stored in binary files (see hypre_PrintBoxArrayDataBinary) */
+#define hypre_STRUCT_BINARY_VECTOR 0
+
 #endif
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -1344,6 +1398,9 @@ HYPRE_Int hypre_StructAssumedPartitionGetRegionsFromProc ( hypre_StructAssumedPa
 HYPRE_Int hypre_StructAssumedPartitionGetProcsFromBox ( hypre_StructAssumedPart *assumed_part,
                                                         hypre_Box *box, HYPRE_Int *num_proc_array, HYPRE_Int *size_alloc_proc_array,
                                                         HYPRE_Int **p_proc_array );
+HYPRE_Int hypre_StructAssumedPartitionUpdate ( hypre_StructAssumedPart *ap,
+                                               hypre_BoxArray *old_boxes, HYPRE_Int *old_boxnums, hypre_BoxArray *new_boxes,
+                                               HYPRE_Int *new_boxnums, MPI_Comm comm, hypre_StructAssumedPart **p_new_ap );
 
 /* box_algebra.c */
 HYPRE_Int hypre_IntersectBoxes ( hypre_Box *box1, hypre_Box *box2, hypre_Box *ibox );
@@ -1407,6 +1464,7 @@ HYPRE_Int hypre_DeleteBox ( hypre_BoxArray *box_array, HYPRE_Int index );
 HYPRE_Int hypre_DeleteMultipleBoxes ( hypre_BoxArray *box_array, HYPRE_Int *indices,
                                       HYPRE_Int num );
 HYPRE_Int hypre_AppendBoxArray ( hypre_BoxArray *box_array_0, hypre_BoxArray *box_array_1 );
+HYPRE_Int hypre_BoxArrayBoxThreads ( hypre_BoxArray *box_array );
 hypre_BoxArrayArray *hypre_BoxArrayArrayCreate ( HYPRE_Int size, HYPRE_Int ndim );
 HYPRE_Int hypre_BoxArrayArrayDestroy ( hypre_BoxArrayArray *box_array_array );
 hypre_BoxArrayArray *hypre_BoxArrayArrayDuplicate ( hypre_BoxArrayArray *box_array_array );
@@ -1449,6 +1507,8 @@ HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager, hypre_Index imi
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager, hypre_Index ilower, hypre_Index iupper,
                                   hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManIntersectBoxes ( hypre_BoxManager *manager, hypre_BoxArray *boxes,
+                                       HYPRE_Int **offsets_ptr, hypre_BoxManEntry ***entries_ptr );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf, HYPRE_Int contact_size,
                                               HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                               HYPRE_Int *response_message_size );
@@ -1489,6 +1549,8 @@ HYPRE_Int hypre_ComputeInfoProjectComp ( hypre_ComputeInfo *compute_info, hypre_
 HYPRE_Int hypre_ComputeInfoDestroy ( hypre_ComputeInfo *compute_info );
 HYPRE_Int hypre_CreateComputeInfo ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
                                     hypre_ComputeInfo **compute_info_ptr );
+HYPRE_Int hypre_CreateComputeInfoOverlap ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
+                                           HYPRE_Int overlap, hypre_ComputeInfo **compute_info_ptr );
 HYPRE_Int hypre_ComputePkgCreate ( hypre_ComputeInfo *compute_info, hypre_BoxArray *data_space,
                                    HYPRE_Int num_values, hypre_StructGrid *grid, hypre_ComputePkg **compute_pkg_ptr );
 HYPRE_Int hypre_ComputePkgDestroy ( hypre_ComputePkg *compute_pkg );
@@ -1590,6 +1652,8 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array, hyp
 
 /* struct_axpy.c */
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha, hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructAxpby ( HYPRE_Complex alpha, hypre_StructVector *x, HYPRE_Complex beta,
+                              hypre_StructVector *y );
 
 /* struct_communication.c */
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info, hypre_BoxArray *send_data_space,
@@ -1639,6 +1703,11 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
 #endif
 /* struct_innerprod.c */
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Real hypre_StructAxpyInnerProd ( HYPRE_Complex alpha, hypre_StructVector *x,
+                                      hypre_StructVector *y, hypre_StructVector *z );
+HYPRE_Real hypre_StructDualAxpyInnerProd ( HYPRE_Complex alpha, hypre_StructVector *x1,
+                                          hypre_StructVector *y1, HYPRE_Complex beta,
+                                          hypre_StructVector *x2, hypre_StructVector *y2 );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
@@ -1653,6 +1722,16 @@ HYPRE_Int hypre_ReadBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
 HYPRE_Int hypre_ReadBoxArrayData_CC ( FILE *file, hypre_BoxArray *box_array,
                                       hypre_BoxArray *data_space, HYPRE_Int stencil_size, HYPRE_Int real_stencil_size,
                                       HYPRE_Int constant_coefficient, HYPRE_Int dim, HYPRE_Complex *data );
+HYPRE_Int hypre_PrintBoxArrayDataBinary ( MPI_Comm comm, const char *filename,
+                                          HYPRE_Int object_type, HYPRE_Int ndim, HYPRE_Int *num_ghost, HYPRE_Int symmetric,
+                                          HYPRE_Int constant_coefficient, HYPRE_Int num_values, hypre_Index *value_shapes,
+                                          HYPRE_Int *value_const, HYPRE_Complex *const_values, hypre_BoxArray *box_array,
+                                          hypre_BoxArray *data_space, HYPRE_Int **value_indices, HYPRE_Complex *data );
+HYPRE_Int hypre_ReadBoxArrayDataBinary ( MPI_Comm comm, const char *filename,
+                                         HYPRE_Int object_type, HYPRE_Int ndim, HYPRE_Int symmetric,
+                                         HYPRE_Int constant_coefficient, HYPRE_Int num_values, hypre_Index *value_shapes,
+                                         HYPRE_Int *value_const, HYPRE_Complex *const_values, hypre_BoxArray *box_array,
+                                         hypre_BoxArray *data_space, HYPRE_Int **value_indices, HYPRE_Complex *data );
 
 /* struct_matrix.c */
 HYPRE_Complex *hypre_StructMatrixExtractPointerByIndex ( hypre_StructMatrix *matrix, HYPRE_Int b,
@@ -1684,6 +1763,11 @@ HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
 HYPRE_Int hypre_StructMatrixSetConstantEntries ( hypre_StructMatrix *matrix, HYPRE_Int nentries,
                                                  HYPRE_Int *entries );
+HYPRE_Int hypre_StructMatrixSetCoeffFcn ( hypre_StructMatrix *matrix,
+                                          HYPRE_StructMatrixCoeffFcn coeff_fcn, void *coeff_data );
+HYPRE_Int hypre_StructMatrixEvalCoeffs ( hypre_StructMatrix *matrix, HYPRE_Int entry,
+                                         hypre_Box *box, HYPRE_Complex *values );
+hypre_StructMatrix *hypre_StructMatrixCreateAssembled ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixClearGhostValues ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixPrintData ( FILE *file, hypre_StructMatrix *matrix, HYPRE_Int all );
 HYPRE_Int hypre_StructMatrixReadData ( FILE *file, hypre_StructMatrix *matrix );
@@ -1691,6 +1775,8 @@ HYPRE_Int hypre_StructMatrixPrint ( const char *filename, hypre_StructMatrix *ma
                                     HYPRE_Int all );
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixPrintBinary ( const char *filename, hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixReadBinary ( const char *filename, hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix,
                                       hypre_StructMatrix *to_matrix );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
@@ -1707,10 +1793,15 @@ HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata, HYPRE_Complex alpha,
                                       hypre_StructMatrix *A, hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecCC0Stencil ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                         hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                         hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecMF ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                 hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
@@ -1764,6 +1855,8 @@ HYPRE_Int hypre_StructVectorPrint ( const char *filename, hypre_StructVector *ve
                                     HYPRE_Int all );
 hypre_StructVector *hypre_StructVectorRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorPrintBinary ( const char *filename, hypre_StructVector *vector );
+HYPRE_Int hypre_StructVectorReadBinary ( const char *filename, hypre_StructVector *vector );
 hypre_StructVector *hypre_StructVectorClone ( hypre_StructVector *vector );
 /******************************************************************************
  * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
@@ -790,6 +790,7 @@ hypre_StructAssumedPartitionCreate(
       assumed_part = hypre_TAlloc(hypre_StructAssumedPart,  1, HYPRE_MEMORY_HOST);
 
       hypre_StructAssumedPartNDim(assumed_part) = ndim;
+      hypre_StructAssumedPartGlobalNumBoxes(assumed_part) = 0;
       hypre_StructAssumedPartRegions(assumed_part) = region_array;
       hypre_StructAssumedPartNumRegions(assumed_part) = 0;
       hypre_StructAssumedPartDivisions(assumed_part) =  NULL;
@@ -1012,6 +1013,7 @@ hypre_StructAssumedPartitionCreate(
    size = hypre_BoxArraySize(region_array);
    assumed_part = hypre_TAlloc(hypre_StructAssumedPart,  1, HYPRE_MEMORY_HOST);
    hypre_StructAssumedPartNDim(assumed_part) = ndim;
+   hypre_StructAssumedPartGlobalNumBoxes(assumed_part) = global_num_boxes;
    hypre_StructAssumedPartRegions(assumed_part) = region_array;
    /* The above is aliased, so don't destroy region_array in this function */
    hypre_StructAssumedPartNumRegions(assumed_part) = size;
@@ -1840,6 +1842,331 @@ hypre_StructAssumedPartitionGetProcsFromBox(
    return hypre_error_flag;
 }
 
+/******************************************************************************
+ * Create a new assumed partition from an existing one after the local boxes
+ * have changed from (old_boxes, old_boxnums) to (new_boxes, new_boxnums).
+ *
+ * The global description (regions, proc partitions and divisions) is copied
+ * as is, so no region refinement is done, and the global number of boxes is
+ * updated with the change in the number of local boxes.  Only the
+ * processors whose boxes changed contact the owners of the assumed regions
+ * touched by their old and new boxes.  Each message starts with a marker entry
+ * (boxnum -1) so that an owner drops all of its previous entries for the
+ * sender, even if the sender has no boxes left in its region.
+ *
+ * The old regions only cover the old grid, so if some new box is not covered
+ * by them on any processor, *p_new_ap is set to NULL and the caller has to
+ * create a new assumed partition.
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_StructAssumedPartitionUpdate( hypre_StructAssumedPart  *ap,
+                                    hypre_BoxArray           *old_boxes,
+                                    HYPRE_Int                *old_boxnums,
+                                    hypre_BoxArray           *new_boxes,
+                                    HYPRE_Int                *new_boxnums,
+                                    MPI_Comm                  comm,
+                                    hypre_StructAssumedPart **p_new_ap )
+{
+   HYPRE_Int                ndim        = hypre_StructAssumedPartNDim(ap);
+   HYPRE_Int                num_regions = hypre_StructAssumedPartNumRegions(ap);
+   hypre_BoxArray          *regions     = hypre_StructAssumedPartRegions(ap);
+   hypre_StructAssumedPart *new_ap;
+
+   HYPRE_Int                changed, uncovered, sendbuf[3], recvbuf[3];
+   HYPRE_Int                i, j, k, d, index, proc, last_proc;
+   HYPRE_Int                num_old, num_new, count, size;
+   HYPRE_Int                proc_count, proc_alloc, contact_count;
+   HYPRE_Int               *proc_array, *tmp_proc_ids, *tmp_box_inds;
+   HYPRE_Int               *contact_procs, *contact_starts, *contact_boxinfo;
+   HYPRE_Int               *response_buf = NULL, *response_buf_starts = NULL;
+   HYPRE_Int               *ids, *boxnums, *old_ids, *old_part_boxnums;
+   HYPRE_Int               *reset_procs, num_reset, num_received, num_kept;
+   HYPRE_Real               vol;
+
+   hypre_Box               *box, *int_box;
+   hypre_BoxArray          *part_boxes, *old_part_boxes;
+   hypre_DataExchangeResponse  response_obj;
+
+   *p_new_ap = NULL;
+
+   num_old = hypre_BoxArraySize(old_boxes);
+   num_new = hypre_BoxArraySize(new_boxes);
+
+   /* Did my boxes change, and are the new ones inside the assumed regions? */
+   changed = (num_old != num_new);
+   for (i = 0; (i < num_new) && !changed; i++)
+   {
+      box     = hypre_BoxArrayBox(new_boxes, i);
+      int_box = hypre_BoxArrayBox(old_boxes, i);
+      if ( (old_boxnums[i] != new_boxnums[i]) ||
+           !hypre_IndexesEqual(hypre_BoxIMin(box), hypre_BoxIMin(int_box), ndim) ||
+           !hypre_IndexesEqual(hypre_BoxIMax(box), hypre_BoxIMax(int_box), ndim) )
+      {
+         changed = 1;
+      }
+   }
+
+   uncovered = 0;
+   if (changed)
+   {
+      int_box = hypre_BoxCreate(ndim);
+      hypre_ForBoxI(i, new_boxes)
+      {
+         box = hypre_BoxArrayBox(new_boxes, i);
+         vol = 0.0;
+         for (j = 0; j < num_regions; j++)
+         {
+            hypre_IntersectBoxes(box, hypre_BoxArrayBox(regions, j), int_box);
+            vol += (HYPRE_Real) hypre_BoxVolume(int_box);
+         }
+         if (vol < (HYPRE_Real) hypre_BoxVolume(box))
+         {
+            uncovered = 1;
+            break;
+         }
+      }
+      hypre_BoxDestroy(int_box);
+   }
+
+   /* the sums of the flags are nonzero if they are set on any processor */
+   sendbuf[0] = changed;
+   sendbuf[1] = uncovered;
+   sendbuf[2] = num_new - num_old;
+   hypre_MPI_Allreduce(sendbuf, recvbuf, 3, HYPRE_MPI_INT, hypre_MPI_SUM, comm);
+   if (recvbuf[1])
+   {
+      return hypre_error_flag;
+   }
+
+   /* Copy the global description and my partition */
+   new_ap = hypre_TAlloc(hypre_StructAssumedPart, 1, HYPRE_MEMORY_HOST);
+
+   hypre_StructAssumedPartNDim(new_ap) = ndim;
+   hypre_StructAssumedPartGlobalNumBoxes(new_ap) =
+      hypre_StructAssumedPartGlobalNumBoxes(ap) + recvbuf[2];
+   hypre_StructAssumedPartRegions(new_ap) = hypre_BoxArrayDuplicate(regions);
+   hypre_StructAssumedPartNumRegions(new_ap) = num_regions;
+   hypre_StructAssumedPartProcPartitions(new_ap) =
+      hypre_TAlloc(HYPRE_Int, num_regions + 1, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(hypre_StructAssumedPartProcPartitions(new_ap),
+                 hypre_StructAssumedPartProcPartitions(ap), HYPRE_Int,
+                 num_regions + 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_StructAssumedPartDivisions(new_ap) = NULL;
+   if (num_regions)
+   {
+      hypre_StructAssumedPartDivisions(new_ap) =
+         hypre_TAlloc(hypre_Index, num_regions, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_regions; i++)
+      {
+         hypre_CopyIndex(hypre_StructAssumedPartDivision(ap, i),
+                         hypre_StructAssumedPartDivision(new_ap, i));
+      }
+   }
+   hypre_StructAssumedPartMyPartition(new_ap) = NULL;
+   if (hypre_StructAssumedPartMyPartition(ap))
+   {
+      hypre_StructAssumedPartMyPartition(new_ap) =
+         hypre_BoxArrayDuplicate(hypre_StructAssumedPartMyPartition(ap));
+   }
+
+   hypre_StructAssumedPartMyPartitionBoxes(new_ap) = hypre_BoxArrayCreate(0, ndim);
+   hypre_StructAssumedPartMyPartitionIdsSize(new_ap) = 0;
+   hypre_StructAssumedPartMyPartitionIdsAlloc(new_ap) = 0;
+   hypre_StructAssumedPartMyPartitionProcIds(new_ap) = NULL;
+   hypre_StructAssumedPartMyPartitionBoxnums(new_ap) = NULL;
+   hypre_StructAssumedPartMyPartitionNumDistinctProcs(new_ap) = 0;
+
+   /* Send a marker and my new boxes to the owners of my old and new boxes */
+   if (recvbuf[0])
+   {
+      proc_alloc = hypre_pow2(ndim);
+      proc_array = hypre_CTAlloc(HYPRE_Int, proc_alloc, HYPRE_MEMORY_HOST);
+
+      size = 2 * (num_old + num_new);
+      tmp_proc_ids = hypre_CTAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      tmp_box_inds = hypre_CTAlloc(HYPRE_Int, size, HYPRE_MEMORY_HOST);
+      count = 0;
+
+      if (changed)
+      {
+         /* box index -1 refers to an old box and only produces the marker */
+         for (k = 0; k < 2; k++)
+         {
+            hypre_ForBoxI(i, (k ? new_boxes : old_boxes))
+            {
+               box = hypre_BoxArrayBox((k ? new_boxes : old_boxes), i);
+               hypre_StructAssumedPartitionGetProcsFromBox(
+                  ap, box, &proc_count, &proc_alloc, &proc_array);
+               if ((count + proc_count) > size)
+               {
+                  size = count + proc_count + num_old + num_new;
+                  tmp_proc_ids = hypre_TReAlloc(tmp_proc_ids, HYPRE_Int, size,
+                                                HYPRE_MEMORY_HOST);
+                  tmp_box_inds = hypre_TReAlloc(tmp_box_inds, HYPRE_Int, size,
+                                                HYPRE_MEMORY_HOST);
+               }
+               for (j = 0; j < proc_count; j++)
+               {
+                  tmp_proc_ids[count] = proc_array[j];
+                  tmp_box_inds[count] = k ? i : -1;
+                  count++;
+               }
+            }
+         }
+      }
+
+      if (count > 1)
+      {
+         hypre_qsort2i(tmp_proc_ids, tmp_box_inds, 0, count - 1);
+      }
+
+      /* Each distinct proc gets one marker followed by its new boxes */
+      contact_procs   = hypre_CTAlloc(HYPRE_Int, count + 1, HYPRE_MEMORY_HOST);
+      contact_starts  = hypre_CTAlloc(HYPRE_Int, count + 1, HYPRE_MEMORY_HOST);
+      contact_boxinfo = hypre_CTAlloc(HYPRE_Int, 2 * count * (1 + 2 * ndim),
+                                      HYPRE_MEMORY_HOST);
+      contact_count = 0;
+      index = 0;
+      j = 0;
+      last_proc = -1;
+      for (i = 0; i < count; i++)
+      {
+         proc = tmp_proc_ids[i];
+         if (proc != last_proc)
+         {
+            contact_procs[contact_count] = proc;
+            contact_starts[contact_count] = j;
+            contact_count++;
+            last_proc = proc;
+
+            contact_boxinfo[index++] = -1;
+            for (d = 0; d < ndim; d++)
+            {
+               contact_boxinfo[index++] = 0;
+               contact_boxinfo[index++] = -1;
+            }
+            j++;
+         }
+         if (tmp_box_inds[i] > -1)
+         {
+            box = hypre_BoxArrayBox(new_boxes, tmp_box_inds[i]);
+            contact_boxinfo[index++] = new_boxnums[tmp_box_inds[i]];
+            for (d = 0; d < ndim; d++)
+            {
+               contact_boxinfo[index++] = hypre_BoxIMinD(box, d);
+               contact_boxinfo[index++] = hypre_BoxIMaxD(box, d);
+            }
+            j++;
+         }
+      }
+      contact_starts[contact_count] = j;
+
+      hypre_TFree(proc_array, HYPRE_MEMORY_HOST);
+      hypre_TFree(tmp_proc_ids, HYPRE_MEMORY_HOST);
+      hypre_TFree(tmp_box_inds, HYPRE_MEMORY_HOST);
+
+      response_obj.fill_response = hypre_APFillResponseStructAssumedPart;
+      response_obj.data1 = new_ap;
+      response_obj.data2 = NULL;
+
+      hypre_DataExchangeList(contact_count, contact_procs,
+                             contact_boxinfo, contact_starts,
+                             (1 + 2 * ndim)*sizeof(HYPRE_Int),
+                             sizeof(HYPRE_Int), &response_obj, 0, 1,
+                             comm, (void**) &response_buf, &response_buf_starts);
+
+      hypre_TFree(contact_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(contact_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(contact_boxinfo, HYPRE_MEMORY_HOST);
+      hypre_TFree(response_buf, HYPRE_MEMORY_HOST);
+      hypre_TFree(response_buf_starts, HYPRE_MEMORY_HOST);
+   }
+
+   /* The entries received so far belong to the senders that were reset.
+      Remove the markers, then append the old entries of all other procs.
+      Entries of the same proc stay adjacent. */
+   part_boxes   = hypre_StructAssumedPartMyPartitionBoxes(new_ap);
+   ids          = hypre_StructAssumedPartMyPartitionProcIds(new_ap);
+   boxnums      = hypre_StructAssumedPartMyPartitionBoxnums(new_ap);
+   num_received = hypre_StructAssumedPartMyPartitionIdsSize(new_ap);
+
+   reset_procs = hypre_CTAlloc(HYPRE_Int, num_received, HYPRE_MEMORY_HOST);
+   num_reset = 0;
+   j = 0;
+   for (i = 0; i < num_received; i++)
+   {
+      if (boxnums[i] < 0)
+      {
+         reset_procs[num_reset++] = ids[i];
+      }
+      else
+      {
+         hypre_CopyBox(hypre_BoxArrayBox(part_boxes, i),
+                       hypre_BoxArrayBox(part_boxes, j));
+         ids[j] = ids[i];
+         boxnums[j] = boxnums[i];
+         j++;
+      }
+   }
+   num_received = j;
+   if (num_reset > 1)
+   {
+      hypre_qsort0(reset_procs, 0, num_reset - 1);
+   }
+
+   old_part_boxes   = hypre_StructAssumedPartMyPartitionBoxes(ap);
+   old_ids          = hypre_StructAssumedPartMyPartitionProcIds(ap);
+   old_part_boxnums = hypre_StructAssumedPartMyPartitionBoxnums(ap);
+   num_kept = 0;
+   for (i = 0; i < hypre_StructAssumedPartMyPartitionIdsSize(ap); i++)
+   {
+      if (hypre_BinarySearch(reset_procs, old_ids[i], num_reset) < 0)
+      {
+         num_kept++;
+      }
+   }
+
+   size = num_received + num_kept;
+   ids = hypre_TReAlloc(ids, HYPRE_Int, hypre_max(size, 1), HYPRE_MEMORY_HOST);
+   boxnums = hypre_TReAlloc(boxnums, HYPRE_Int, hypre_max(size, 1), HYPRE_MEMORY_HOST);
+   hypre_BoxArraySetSize(part_boxes, size);
+
+   j = num_received;
+   for (i = 0; i < hypre_StructAssumedPartMyPartitionIdsSize(ap); i++)
+   {
+      if (hypre_BinarySearch(reset_procs, old_ids[i], num_reset) < 0)
+      {
+         hypre_CopyBox(hypre_BoxArrayBox(old_part_boxes, i),
+                       hypre_BoxArrayBox(part_boxes, j));
+         ids[j] = old_ids[i];
+         boxnums[j] = old_part_boxnums[i];
+         j++;
+      }
+   }
+   hypre_TFree(reset_procs, HYPRE_MEMORY_HOST);
+
+   count = 0;
+   for (i = 0; i < size; i++)
+   {
+      if ((i == 0) || (ids[i] != ids[i - 1]))
+      {
+         count++;
+      }
+   }
+
+   hypre_StructAssumedPartMyPartitionBoxes(new_ap) = part_boxes;
+   hypre_StructAssumedPartMyPartitionProcIds(new_ap) = ids;
+   hypre_StructAssumedPartMyPartitionBoxnums(new_ap) = boxnums;
+   hypre_StructAssumedPartMyPartitionIdsSize(new_ap) = size;
+   hypre_StructAssumedPartMyPartitionIdsAlloc(new_ap) = hypre_max(size, 1);
+   hypre_StructAssumedPartMyPartitionNumDistinctProcs(new_ap) = count;
+
+   *p_new_ap = new_ap;
+
+   return hypre_error_flag;
+}
+
 #if 0
 /******************************************************************************
  * UNFINISHED
@@ -18,6 +18,7 @@ typedef struct
 {
    /* the entries will be the same for all procs */
    HYPRE_Int           ndim;             /* number of dimensions */
+   HYPRE_Int           global_num_boxes; /* number of boxes in the grid */
    hypre_BoxArray     *regions;          /* areas of the grid with boxes */
    HYPRE_Int           num_regions;      /* how many regions */
    HYPRE_Int          *proc_partitions;  /* proc ids assigned to each region
@@ -39,6 +40,7 @@ typedef struct
 /*Accessor macros */
 
 #define hypre_StructAssumedPartNDim(apart) ((apart)->ndim)
+#define hypre_StructAssumedPartGlobalNumBoxes(apart) ((apart)->global_num_boxes)
 #define hypre_StructAssumedPartRegions(apart) ((apart)->regions)
 #define hypre_StructAssumedPartNumRegions(apart) ((apart)->num_regions)
 #define hypre_StructAssumedPartDivisions(apart) ((apart)->divisions)
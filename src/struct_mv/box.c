@@ -906,6 +906,40 @@ hypre_AppendBoxArray( hypre_BoxArray *box_array_0,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Return 1 if loops over box_array should hand out whole boxes to the threads
+ * (box-level threading) instead of threading within each box, and 0
+ * otherwise.  See HYPRE_SetStructBoxThreads.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoxArrayBoxThreads( hypre_BoxArray *box_array )
+{
+#if defined(HYPRE_USING_OPENMP) && !defined(HYPRE_USING_GPU) && !defined(HYPRE_USING_DEVICE_OPENMP) && !defined(HYPRE_USING_RAJA) && !defined(HYPRE_USING_KOKKOS)
+   HYPRE_Int  max_box_volume = hypre_GetStructBoxThreads();
+   HYPRE_Int  size           = hypre_BoxArraySize(box_array);
+   HYPRE_Real volume;
+   HYPRE_Int  i;
+
+   if ((max_box_volume < 1) || (size < 2) || (hypre_NumThreads() < 2) || omp_in_parallel())
+   {
+      return 0;
+   }
+
+   volume = 0.0;
+   hypre_ForBoxI(i, box_array)
+   {
+      volume += hypre_doubleBoxVolume(hypre_BoxArrayBox(box_array, i));
+   }
+
+   return (volume <= (HYPRE_Real) max_box_volume * size);
+#else
+   HYPRE_UNUSED_VAR(box_array);
+
+   return 0;
+#endif
+}
+
 /*==========================================================================
  * Member functions: hypre_BoxArrayArray
  *==========================================================================*/
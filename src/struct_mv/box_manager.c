@@ -107,6 +107,365 @@ hypre_entryqsort2( HYPRE_Int *v,
    hypre_entryqsort2(v, ent, last + 1, right);
 }
 
+/******************************************************************************
+ * Bounding volume tree routines used only in this file
+ *****************************************************************************/
+
+/* maximum number of entries stored in a leaf of the tree */
+#define hypre_BOXMAN_TREE_LEAF_SIZE 4
+
+/* traversal stack size; the tree is split at medians, so its depth is less
+   than the number of bits in HYPRE_Int */
+#define hypre_BOXMAN_TREE_STACK_SIZE 72
+
+/* partially sort (HYPRE_Int v, HYPRE_Int w) pairs so that the kth smallest
+   pair is at position k, with smaller pairs before it and larger ones after;
+   using w to break ties keeps this from degrading on the many repeated keys
+   found in regular box layouts */
+
+static void
+hypre_BoxManTreeSelect( HYPRE_Int *v,
+                        HYPRE_Int *w,
+                        HYPRE_Int  left,
+                        HYPRE_Int  right,
+                        HYPRE_Int  k )
+{
+   HYPRE_Int i, last;
+
+   while (left < right)
+   {
+      hypre_swap2i(v, w, left, (left + right) / 2);
+      last = left;
+      for (i = left + 1; i <= right; i++)
+      {
+         if ( (v[i] < v[left]) || ((v[i] == v[left]) && (w[i] < w[left])) )
+         {
+            hypre_swap2i(v, w, ++last, i);
+         }
+      }
+      hypre_swap2i(v, w, left, last);
+
+      if (last == k)
+      {
+         return;
+      }
+      else if (k < last)
+      {
+         right = last - 1;
+      }
+      else
+      {
+         left = last + 1;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Build the subtree rooted at 'node_id' over the entries with positions
+ * tree_order[first:first+count-1].  The entries are split in half at the
+ * median of their centers in the dimension where the centers are the most
+ * spread out.  The 'keys' array is workspace of size nentries.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoxManTreeBuild( hypre_BoxManager *manager,
+                       HYPRE_Int         node_id,
+                       HYPRE_Int         first,
+                       HYPRE_Int         count,
+                       HYPRE_Int         depth,
+                       HYPRE_Int        *keys )
+{
+   HYPRE_Int           ndim    = hypre_BoxManNDim(manager);
+   hypre_BoxManEntry  *entries = hypre_BoxManEntries(manager);
+   HYPRE_Int          *order   = hypre_BoxManTreeOrder(manager);
+   hypre_BoxManNode   *node    = hypre_BoxManTreeNode(manager, node_id);
+   hypre_BoxManEntry  *entry;
+   hypre_IndexRef      imin, imax;
+   HYPRE_Int           cmin[HYPRE_MAXDIM];
+   HYPRE_Int           cmax[HYPRE_MAXDIM];
+   HYPRE_Int           i, d, c, split_d, half, child;
+
+   hypre_BoxManTreeDepth(manager) = hypre_max(hypre_BoxManTreeDepth(manager), depth);
+
+   /* compute the node extents and the range of the (doubled) entry centers */
+   imin = hypre_BoxManNodeIMin(node);
+   imax = hypre_BoxManNodeIMax(node);
+   hypre_SetIndex(imin, 0);
+   hypre_SetIndex(imax, 0);
+   for (i = first; i < first + count; i++)
+   {
+      entry = &entries[order[i]];
+      for (d = 0; d < ndim; d++)
+      {
+         c = hypre_IndexD(hypre_BoxManEntryIMin(entry), d) +
+             hypre_IndexD(hypre_BoxManEntryIMax(entry), d);
+         if (i == first)
+         {
+            hypre_IndexD(imin, d) = hypre_IndexD(hypre_BoxManEntryIMin(entry), d);
+            hypre_IndexD(imax, d) = hypre_IndexD(hypre_BoxManEntryIMax(entry), d);
+            cmin[d] = c;
+            cmax[d] = c;
+         }
+         else
+         {
+            hypre_IndexD(imin, d) = hypre_min(hypre_IndexD(imin, d),
+                                              hypre_IndexD(hypre_BoxManEntryIMin(entry), d));
+            hypre_IndexD(imax, d) = hypre_max(hypre_IndexD(imax, d),
+                                              hypre_IndexD(hypre_BoxManEntryIMax(entry), d));
+            cmin[d] = hypre_min(cmin[d], c);
+            cmax[d] = hypre_max(cmax[d], c);
+         }
+      }
+   }
+
+   hypre_BoxManNodeChild(node) = -1;
+   hypre_BoxManNodeFirst(node) = first;
+   hypre_BoxManNodeCount(node) = count;
+
+   if (count <= hypre_BOXMAN_TREE_LEAF_SIZE)
+   {
+      return;
+   }
+
+   split_d = 0;
+   for (d = 1; d < ndim; d++)
+   {
+      if ((cmax[d] - cmin[d]) > (cmax[split_d] - cmin[split_d]))
+      {
+         split_d = d;
+      }
+   }
+
+   /* identical centers can't be separated; keep them all in this leaf */
+   if (cmax[split_d] == cmin[split_d])
+   {
+      return;
+   }
+
+   for (i = first; i < first + count; i++)
+   {
+      entry = &entries[order[i]];
+      keys[i] = hypre_IndexD(hypre_BoxManEntryIMin(entry), split_d) +
+                hypre_IndexD(hypre_BoxManEntryIMax(entry), split_d);
+   }
+   half = count / 2;
+   hypre_BoxManTreeSelect(keys, order, first, first + count - 1, first + half);
+
+   child = hypre_BoxManTreeNNodes(manager);
+   hypre_BoxManTreeNNodes(manager) += 2;
+   hypre_BoxManNodeChild(node) = child;
+
+   hypre_BoxManTreeBuild(manager, child, first, half, depth + 1, keys);
+   hypre_BoxManTreeBuild(manager, child + 1, first + half, count - half, depth + 1, keys);
+}
+
+/*--------------------------------------------------------------------------
+ * Return 1 if the boxes [imin, imax] and [ilower, iupper] intersect.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Int
+hypre_BoxManExtentsIntersect( HYPRE_Int    ndim,
+                              hypre_Index  imin,
+                              hypre_Index  imax,
+                              hypre_Index  ilower,
+                              hypre_Index  iupper )
+{
+   HYPRE_Int d;
+
+   for (d = 0; d < ndim; d++)
+   {
+      if ( (hypre_IndexD(imin, d) > hypre_IndexD(iupper, d)) ||
+           (hypre_IndexD(imax, d) < hypre_IndexD(ilower, d)) )
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * Compare two entries returned by an intersection with a box whose lower
+ * corner is 'ilower'.  Intersections are ordered lexicographically (last
+ * dimension slowest) by the corner max(entry imin, ilower), then with local
+ * entries (positions local_start to local_end-1) ahead of off-process ones,
+ * then by decreasing position.  This is the order in which the index table
+ * used by earlier versions of the box manager reported them.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoxManIntersectCompare( HYPRE_Int           ndim,
+                              hypre_Index         ilower,
+                              HYPRE_Int           local_start,
+                              HYPRE_Int           local_end,
+                              hypre_BoxManEntry  *entry1,
+                              hypre_BoxManEntry  *entry2 )
+{
+   HYPRE_Int d, c1, c2, p1, p2, local1, local2;
+
+   for (d = ndim - 1; d >= 0; d--)
+   {
+      c1 = hypre_max(hypre_IndexD(hypre_BoxManEntryIMin(entry1), d), hypre_IndexD(ilower, d));
+      c2 = hypre_max(hypre_IndexD(hypre_BoxManEntryIMin(entry2), d), hypre_IndexD(ilower, d));
+      if (c1 != c2)
+      {
+         return (c1 < c2) ? -1 : 1;
+      }
+   }
+
+   p1 = hypre_BoxManEntryPosition(entry1);
+   p2 = hypre_BoxManEntryPosition(entry2);
+   local1 = (p1 >= local_start) && (p1 < local_end);
+   local2 = (p2 >= local_start) && (p2 < local_end);
+   if (local1 != local2)
+   {
+      return local1 ? -1 : 1;
+   }
+
+   return (p1 > p2) ? -1 : ((p1 < p2) ? 1 : 0);
+}
+
+static void
+hypre_BoxManIntersectQsort( HYPRE_Int            ndim,
+                            hypre_Index          ilower,
+                            HYPRE_Int            local_start,
+                            HYPRE_Int            local_end,
+                            hypre_BoxManEntry  **ent,
+                            HYPRE_Int            left,
+                            HYPRE_Int            right )
+{
+   HYPRE_Int           i, last;
+   hypre_BoxManEntry  *temp_e;
+
+   if (left >= right)
+   {
+      return;
+   }
+
+   i = (left + right) / 2;
+   temp_e = ent[left]; ent[left] = ent[i]; ent[i] = temp_e;
+   last = left;
+   for (i = left + 1; i <= right; i++)
+   {
+      if (hypre_BoxManIntersectCompare(ndim, ilower, local_start, local_end,
+                                       ent[i], ent[left]) < 0)
+      {
+         last++;
+         temp_e = ent[last]; ent[last] = ent[i]; ent[i] = temp_e;
+      }
+   }
+   temp_e = ent[left]; ent[left] = ent[last]; ent[last] = temp_e;
+   hypre_BoxManIntersectQsort(ndim, ilower, local_start, local_end, ent, left, last - 1);
+   hypre_BoxManIntersectQsort(ndim, ilower, local_start, local_end, ent, last + 1, right);
+}
+
+/*--------------------------------------------------------------------------
+ * Return the range of positions of the local entries (empty if none).
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoxManLocalRange( hypre_BoxManager *manager,
+                        HYPRE_Int        *local_start_ptr,
+                        HYPRE_Int        *local_end_ptr )
+{
+   HYPRE_Int  first_local  = hypre_BoxManFirstLocal(manager);
+   HYPRE_Int *proc_offsets = hypre_BoxManProcsSortOffsets(manager);
+
+   if (first_local >= 0 && proc_offsets != NULL)
+   {
+      *local_start_ptr = first_local;
+      *local_end_ptr   = proc_offsets[hypre_BoxManLocalProcOffset(manager) + 1];
+   }
+   else
+   {
+      *local_start_ptr = 0;
+      *local_end_ptr   = 0;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Recursive part of hypre_BoxManIntersectBoxes.  The 'nqueries' boxes listed
+ * in 'queries' all intersect the parent of 'node_id'.  Those that intersect
+ * this node are copied to 'scratch' for use by the children, so 'scratch'
+ * needs room for (tree depth + 1) times the number of boxes.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoxManTreeIntersectBoxes( hypre_BoxManager    *manager,
+                                HYPRE_Int            node_id,
+                                hypre_BoxArray      *boxes,
+                                HYPRE_Int            nqueries,
+                                HYPRE_Int           *queries,
+                                HYPRE_Int           *scratch,
+                                HYPRE_Int           *nhits_ptr,
+                                HYPRE_Int           *max_hits_ptr,
+                                HYPRE_Int          **hit_boxes_ptr,
+                                hypre_BoxManEntry ***hit_entries_ptr )
+{
+   HYPRE_Int           ndim    = hypre_BoxManNDim(manager);
+   hypre_BoxManEntry  *entries = hypre_BoxManEntries(manager);
+   HYPRE_Int          *order   = hypre_BoxManTreeOrder(manager);
+   hypre_BoxManNode   *node    = hypre_BoxManTreeNode(manager, node_id);
+   HYPRE_Int           child   = hypre_BoxManNodeChild(node);
+   hypre_BoxManEntry  *entry;
+   hypre_Box          *box;
+   HYPRE_Int           nsub, i, q, e;
+
+   nsub = 0;
+   for (q = 0; q < nqueries; q++)
+   {
+      box = hypre_BoxArrayBox(boxes, queries[q]);
+      if (hypre_BoxManExtentsIntersect(ndim, hypre_BoxManNodeIMin(node),
+                                       hypre_BoxManNodeIMax(node),
+                                       hypre_BoxIMin(box), hypre_BoxIMax(box)))
+      {
+         scratch[nsub++] = queries[q];
+      }
+   }
+
+   if (nsub == 0)
+   {
+      return;
+   }
+
+   if (child > -1)
+   {
+      hypre_BoxManTreeIntersectBoxes(manager, child, boxes, nsub, scratch,
+                                     scratch + nsub, nhits_ptr, max_hits_ptr,
+                                     hit_boxes_ptr, hit_entries_ptr);
+      hypre_BoxManTreeIntersectBoxes(manager, child + 1, boxes, nsub, scratch,
+                                     scratch + nsub, nhits_ptr, max_hits_ptr,
+                                     hit_boxes_ptr, hit_entries_ptr);
+      return;
+   }
+
+   for (i = 0; i < hypre_BoxManNodeCount(node); i++)
+   {
+      entry = &entries[order[hypre_BoxManNodeFirst(node) + i]];
+      for (q = 0; q < nsub; q++)
+      {
+         box = hypre_BoxArrayBox(boxes, scratch[q]);
+         if (hypre_BoxManExtentsIntersect(ndim, hypre_BoxManEntryIMin(entry),
+                                          hypre_BoxManEntryIMax(entry),
+                                          hypre_BoxIMin(box), hypre_BoxIMax(box)))
+         {
+            e = *nhits_ptr;
+            if (e == *max_hits_ptr)
+            {
+               *max_hits_ptr    = 2 * e + 8;
+               *hit_boxes_ptr   = hypre_TReAlloc(*hit_boxes_ptr, HYPRE_Int,
+                                                 *max_hits_ptr, HYPRE_MEMORY_HOST);
+               *hit_entries_ptr = hypre_TReAlloc(*hit_entries_ptr, hypre_BoxManEntry *,
+                                                 *max_hits_ptr, HYPRE_MEMORY_HOST);
+            }
+            (*hit_boxes_ptr)[e]   = scratch[q];
+            (*hit_entries_ptr)[e] = entry;
+            (*nhits_ptr)++;
+         }
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * This is not used
  *--------------------------------------------------------------------------*/
@@ -434,7 +793,7 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
    hypre_BoxManager   *manager;
    hypre_Box          *bbox;
 
-   HYPRE_Int  i, d;
+   HYPRE_Int  i;
    /* allocate object */
    manager = hypre_CTAlloc(hypre_BoxManager,  1, HYPRE_MEMORY_HOST);
 
@@ -445,18 +804,16 @@ hypre_BoxManCreate( HYPRE_Int max_nentries,
    hypre_BoxManNDim(manager) = ndim;
    hypre_BoxManIsAssembled(manager) = 0;
 
-   for (d = 0; d < ndim; d++)
-   {
-      hypre_BoxManIndexesD(manager, d) = NULL;
-   }
-
    hypre_BoxManNEntries(manager) = 0;
    hypre_BoxManEntries(manager)  = hypre_CTAlloc(hypre_BoxManEntry,  max_nentries, HYPRE_MEMORY_HOST);
 
    hypre_BoxManInfoObjects(manager) = NULL;
    hypre_BoxManInfoObjects(manager) = hypre_TAlloc(char, max_nentries * info_size, HYPRE_MEMORY_HOST);
 
-   hypre_BoxManIndexTable(manager) = NULL;
+   hypre_BoxManTreeNNodes(manager) = 0;
+   hypre_BoxManTreeNodes(manager)  = NULL;
+   hypre_BoxManTreeOrder(manager)  = NULL;
+   hypre_BoxManTreeDepth(manager)  = 0;
 
    hypre_BoxManNumProcsSort(manager)     = 0;
    hypre_BoxManIdsSort(manager)          = hypre_CTAlloc(HYPRE_Int,  max_nentries, HYPRE_MEMORY_HOST);
@@ -561,21 +918,14 @@ hypre_BoxManIncSize ( hypre_BoxManager *manager,
 HYPRE_Int
 hypre_BoxManDestroy( hypre_BoxManager *manager )
 {
-   HYPRE_Int ndim = hypre_BoxManNDim(manager);
-   HYPRE_Int d;
-
    if (manager)
    {
-      for (d = 0; d < ndim; d++)
-      {
-         hypre_TFree(hypre_BoxManIndexesD(manager,  d), HYPRE_MEMORY_HOST);
-      }
-
       hypre_TFree(hypre_BoxManEntries(manager), HYPRE_MEMORY_HOST);
 
       hypre_TFree(hypre_BoxManInfoObjects(manager), HYPRE_MEMORY_HOST);
 
-      hypre_TFree(hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManTreeNodes(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManTreeOrder(manager), HYPRE_MEMORY_HOST);
 
       hypre_TFree(hypre_BoxManIdsSort(manager), HYPRE_MEMORY_HOST);
       hypre_TFree(hypre_BoxManProcsSort(manager), HYPRE_MEMORY_HOST);
@@ -1134,7 +1484,7 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
    HYPRE_Int  is_gather, global_is_gather;
    HYPRE_Int  nentries;
    HYPRE_Int *procs_sort, *ids_sort;
-   HYPRE_Int  i, j, k;
+   HYPRE_Int  i, j;
 
    HYPRE_Int need_to_sort = 1; /* default it to sort */
    //HYPRE_Int short_sort = 0; /*do abreviated sort */
@@ -1278,8 +1628,8 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
 
          hypre_IndexRef  min_ref, max_ref;
 
-         /* 1.  Create an assumed partition? (may have been added in the coarsen
-            routine) */
+         /* 1.  Create an assumed partition? (may have been set by the caller,
+            e.g., one updated from a previous grid) */
 
          if (hypre_BoxManAssumedPartition(manager) == NULL)
          {
@@ -1349,6 +1699,7 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
          else
          {
             ap = hypre_BoxManAssumedPartition(manager);
+            global_num_boxes = hypre_StructAssumedPartGlobalNumBoxes(ap);
          }
 
          /* 2.  Now go thru gather regions and find out which processor's AP
@@ -2209,213 +2560,42 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
       }
    }
 
-   /*------------------------------INDEX TABLE ---------------------------*/
+   /*---------------------------- SPATIAL TREE ---------------------------*/
 
-   /* now build the index_table and indexes array */
-   /* Note: for now we are using the same scheme as in BoxMap  */
+   /* now build the bounding volume tree over the entries (this replaces the
+      index table that earlier versions used, which cost O(nentries^2) to
+      set up and could be much larger than the number of entries) */
    {
-      HYPRE_Int *indexes[HYPRE_MAXDIM];
-      HYPRE_Int  size[HYPRE_MAXDIM];
-      HYPRE_Int  iminmax[2];
-      HYPRE_Int  index_not_there;
-      HYPRE_Int  d, e, itsize;
-      HYPRE_Int  mystart, myfinish;
-      HYPRE_Int  imin[HYPRE_MAXDIM];
-      HYPRE_Int  imax[HYPRE_MAXDIM];
-      HYPRE_Int  start_loop[HYPRE_MAXDIM];
-      HYPRE_Int  end_loop[HYPRE_MAXDIM];
-      HYPRE_Int  loop, range, loop_num;
-      HYPRE_Int *proc_offsets;
-
-      HYPRE_Int location, spot;
-
-      hypre_BoxManEntry  **index_table;
-      hypre_BoxManEntry   *entry;
-      hypre_Box           *index_box, *table_box;
-      hypre_Index          stride, loop_size;
-
-      hypre_IndexRef entry_imin;
-      hypre_IndexRef entry_imax;
-
-      /* initial */
-      nentries     = hypre_BoxManNEntries(manager);
-      entries      = hypre_BoxManEntries(manager);
-      proc_offsets = hypre_BoxManProcsSortOffsets(manager);
-
-      /*------------------------------------------------------
-       * Set up the indexes array and record the processor's
-       * entries. This will be used in ordering the link list
-       * of BoxManEntry- ones on this processor listed first.
-       *------------------------------------------------------*/
-      itsize = 0;
-      for (d = 0; d < ndim; d++)
-      {
-         /* room for min and max of each entry in each dim */
-         indexes[d] = hypre_CTAlloc(HYPRE_Int,  2 * nentries, HYPRE_MEMORY_HOST);
-         size[d] = 0;
-      }
-      /* loop through each entry and get index */
-      for (e = 0; e < nentries; e++)
-      {
-         entry  = &entries[e]; /* grab the entry - get min and max extents */
-         entry_imin = hypre_BoxManEntryIMin(entry);
-         entry_imax = hypre_BoxManEntryIMax(entry);
-
-         /* in each dim, check if min/max positions are already in the table */
-         for (d = 0; d < ndim; d++)
-         {
-            iminmax[0] = hypre_IndexD(entry_imin, d);
-            iminmax[1] = hypre_IndexD(entry_imax, d) + 1;
-
-            /* do the min then the max */
-            for (i = 0; i < 2; i++)
-            {
-               /* find the new index position in the indexes array */
-               index_not_there = 1;
-
-               if (!i)
-               {
-                  location = hypre_BinarySearch2(indexes[d], iminmax[i], 0,
-                                                 size[d] - 1, &j);
-                  if (location != -1) { index_not_there = 0; }
-               }
-               else /* for max, we can start seach at min position */
-               {
-                  location = hypre_BinarySearch2(indexes[d], iminmax[i], j,
-                                                 size[d] - 1, &j);
-                  if (location != -1) { index_not_there = 0; }
-               }
-
-               /* if the index is already there, don't add it again */
-               if (index_not_there)
-               {
-                  for (k = size[d]; k > j; k--) /* make room for new index */
-                  {
-                     indexes[d][k] = indexes[d][k - 1];
-                  }
-                  indexes[d][j] = iminmax[i];
-                  size[d]++; /* increase the size in that dimension */
-               }
-            } /* end of for min and max */
-         } /* end of for each dimension of the entry */
-      } /* end of for each entry loop */
-
-      if (nentries)
-      {
-         itsize = 1;
-         for (d = 0; d < ndim; d++)
-         {
-            size[d]--;
-            itsize *= size[d];
-         }
-      }
-
-      /*------------------------------------------------------
-       * Set up the table - do offprocessor then on-processor
-       *------------------------------------------------------*/
+      HYPRE_Int  *tree_order;
+      HYPRE_Int  *keys;
 
-      /* allocate space for table */
-      index_table = hypre_CTAlloc(hypre_BoxManEntry *,  itsize, HYPRE_MEMORY_HOST);
-
-      index_box = hypre_BoxCreate(ndim);
-      table_box = hypre_BoxCreate(ndim);
+      nentries = hypre_BoxManNEntries(manager);
 
-      /* create a table_box for use below */
-      hypre_SetIndex(stride, 1);
-      hypre_BoxSetExtents(table_box, stride, size);
-      hypre_BoxShiftNeg(table_box, stride); /* Want box to start at 0*/
+      /* in case this is a re-assemble - shouldn't be though */
+      hypre_TFree(hypre_BoxManTreeNodes(manager), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_BoxManTreeOrder(manager), HYPRE_MEMORY_HOST);
 
-      /* which are my entries? (on-processor) */
-      mystart = hypre_BoxManFirstLocal(manager);
-      if (mystart >= 0 ) /*  we have local entries) because
-                             firstlocal = -1 if no local entries */
-      {
-         loop_num = 3;
-         /* basically we have need to do the same code fragment repeated three
-            times so that we can do off-proc then on proc entries - this
-            ordering is because creating the linked list for overlapping
-            boxes */
-
-         myfinish =  proc_offsets[hypre_BoxManLocalProcOffset(manager) + 1];
-         /* #1 do off proc. entries - lower range */
-         start_loop[0] = 0;
-         end_loop[0] = mystart;
-         /* #2 do off proc. entries - upper range */
-         start_loop[1] = myfinish;
-         end_loop[1] = nentries;
-         /* #3 do ON proc. entries */
-         start_loop[2] = mystart;
-         end_loop[2] = myfinish;
-      }
-      else /* no on-proc entries */
+      /* a binary tree with at least one entry per leaf has fewer than
+         2*nentries nodes */
+      tree_order = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+      for (i = 0; i < nentries; i++)
       {
-         loop_num = 1;
-         start_loop[0] = 0;
-         end_loop[0] = nentries;
+         tree_order[i] = i;
       }
+      hypre_BoxManTreeOrder(manager) = tree_order;
+      hypre_BoxManTreeNodes(manager) =
+         hypre_TAlloc(hypre_BoxManNode, hypre_max(2 * nentries - 1, 1), HYPRE_MEMORY_HOST);
+      hypre_BoxManTreeNNodes(manager) = 0;
+      hypre_BoxManTreeDepth(manager)  = 0;
 
-      for (loop = 0; loop < loop_num; loop++)
-      {
-         for (range = start_loop[loop]; range < end_loop[loop]; range++)
-         {
-            entry = &entries[range];
-            entry_imin = hypre_BoxManEntryIMin(entry);
-            entry_imax = hypre_BoxManEntryIMax(entry);
-
-            /* find the indexes corresponding to the current box - put in imin
-               and imax */
-            for (d = 0; d < ndim; d++)
-            {
-               /* need to go to size[d] because that contains the last element */
-               location = hypre_BinarySearch2(
-                             indexes[d], hypre_IndexD(entry_imin, d), 0, size[d], &spot);
-               hypre_IndexD(imin, d) = location;
-
-               location = hypre_BinarySearch2(
-                             indexes[d], hypre_IndexD(entry_imax, d) + 1, 0, size[d], &spot);
-               hypre_IndexD(imax, d) = location - 1;
-
-            } /* now have imin and imax location in index array*/
-
-            /* set up index table */
-            hypre_BoxSetExtents(index_box, imin, imax);
-            hypre_BoxGetSize(index_box, loop_size);
-            hypre_SerialBoxLoop1Begin(ndim, loop_size, table_box, imin, stride, ii);
-            {
-               if (!index_table[ii]) /* no entry- add one */
-               {
-                  index_table[ii] = entry;
-               }
-               else /* already an entry there - so add to link list for
-                       BoxMapEntry - overlapping */
-               {
-                  hypre_BoxManEntryNext(entry) = index_table[ii];
-                  index_table[ii] = entry;
-               }
-            }
-            hypre_SerialBoxLoop1End(ii);
-
-         } /* end of subset of entries */
-      }/* end of three loops over subsets */
-
-      /* done with the index_table! */
-      hypre_TFree( hypre_BoxManIndexTable(manager), HYPRE_MEMORY_HOST); /* in case this is a
-                                                        re-assemble - shouldn't
-                                                        be though */
-      hypre_BoxManIndexTable(manager) = index_table;
-
-      for (d = 0; d < ndim; d++)
+      if (nentries > 0)
       {
-         hypre_TFree(hypre_BoxManIndexesD(manager,  d), HYPRE_MEMORY_HOST);
-         hypre_BoxManIndexesD(manager, d) = indexes[d];
-         hypre_BoxManSizeD(manager, d) = size[d];
-         hypre_BoxManLastIndexD(manager, d) = 0;
+         keys = hypre_TAlloc(HYPRE_Int, nentries, HYPRE_MEMORY_HOST);
+         hypre_BoxManTreeNNodes(manager) = 1;
+         hypre_BoxManTreeBuild(manager, 0, 0, nentries, 0, keys);
+         hypre_TFree(keys, HYPRE_MEMORY_HOST);
       }
-
-      hypre_BoxDestroy(index_box);
-      hypre_BoxDestroy(table_box);
-
-   } /* end of building index table group */
+   }
 
    /* clean up and update*/
 
@@ -2444,6 +2624,10 @@ hypre_BoxManAssemble( hypre_BoxManager *manager )
  *
  * (2) return NULL for entries if none are found
  *
+ * (3) The entries are found by descending the bounding volume tree built in
+ * the assemble, and are returned in the order described in
+ * hypre_BoxManIntersectCompare.
+ *
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -2454,25 +2638,16 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
                         HYPRE_Int *nentries_ptr )
 {
    HYPRE_Int           ndim = hypre_BoxManNDim(manager);
-   HYPRE_Int           d;
-   HYPRE_Int           find_index_d, current_index_d;
-   HYPRE_Int          *man_indexes_d;
-   HYPRE_Int           man_index_size_d;
-   HYPRE_Int           nentries;
-   HYPRE_Int          *marker, position;
-   hypre_Box          *index_box, *table_box;
-   hypre_Index         stride, loop_size;
-   hypre_Index         man_ilower, man_iupper;
-   hypre_BoxManEntry **index_table;
+   hypre_BoxManEntry  *man_entries;
+   HYPRE_Int          *order;
+   hypre_BoxManNode   *node;
+   HYPRE_Int           stack[hypre_BOXMAN_TREE_STACK_SIZE];
+   HYPRE_Int           nstack, child, i;
+   HYPRE_Int           local_start, local_end;
+   HYPRE_Int           nentries, max_nentries;
    hypre_BoxManEntry **entries;
    hypre_BoxManEntry  *entry;
 
-#if 0
-   HYPRE_Int   i, cnt;
-   HYPRE_Int  *proc_ids, *ids, *unsort;
-   HYPRE_Int   tmp_id, start;
-#endif
-
    /* can only use after assembling */
    if (!hypre_BoxManIsAssembled(manager))
    {
@@ -2488,123 +2663,167 @@ hypre_BoxManIntersect ( hypre_BoxManager *manager,
       return hypre_error_flag;
    }
 
-   /* Loop through each dimension */
-   for (d = 0; d < ndim; d++)
-   {
-      /* Initialize */
-      man_ilower[d] = 0;
-      man_iupper[d] = 0;
+   man_entries = hypre_BoxManEntries(manager);
+   order       = hypre_BoxManTreeOrder(manager);
 
-      man_indexes_d = hypre_BoxManIndexesD(manager, d);
-      man_index_size_d = hypre_BoxManSizeD(manager, d);
+   nentries     = 0;
+   max_nentries = 0;
+   entries      = NULL;
 
-      /* -----find location of ilower[d] in  indexes-----*/
-      find_index_d = hypre_IndexD(ilower, d);
-
-      /* Start looking in place indicated by last_index stored in map */
-      current_index_d = hypre_BoxManLastIndexD(manager, d);
+   /* depth-first traversal of the tree, skipping subtrees whose bounding
+      boxes miss [ilower, iupper] */
+   stack[0] = 0;
+   nstack   = 1;
+   while (nstack > 0)
+   {
+      node = hypre_BoxManTreeNode(manager, stack[--nstack]);
 
-      /* Loop downward if target index is less than current location */
-      while ( (current_index_d >= 0 ) &&
-              (find_index_d < man_indexes_d[current_index_d]) )
+      if (!hypre_BoxManExtentsIntersect(ndim, hypre_BoxManNodeIMin(node),
+                                        hypre_BoxManNodeIMax(node), ilower, iupper))
       {
-         current_index_d --;
+         continue;
       }
 
-      /* Loop upward if target index is greater than current location */
-      while ( (current_index_d <= (man_index_size_d - 1)) &&
-              (find_index_d >= man_indexes_d[current_index_d + 1]) )
+      child = hypre_BoxManNodeChild(node);
+      if (child > -1)
       {
-         current_index_d ++;
+         stack[nstack++] = child + 1;
+         stack[nstack++] = child;
+         continue;
       }
 
-      if ( current_index_d > (man_index_size_d - 1) )
+      for (i = 0; i < hypre_BoxManNodeCount(node); i++)
       {
-         *entries_ptr  = NULL;
-         *nentries_ptr = 0;
-         return hypre_error_flag;
-      }
-      else
-      {
-         man_ilower[d] = hypre_max(current_index_d, 0);
+         entry = &man_entries[order[hypre_BoxManNodeFirst(node) + i]];
+         if (hypre_BoxManExtentsIntersect(ndim, hypre_BoxManEntryIMin(entry),
+                                          hypre_BoxManEntryIMax(entry), ilower, iupper))
+         {
+            if (nentries == max_nentries)
+            {
+               max_nentries = 2 * max_nentries + 4;
+               entries = hypre_TReAlloc(entries, hypre_BoxManEntry *,
+                                        max_nentries, HYPRE_MEMORY_HOST);
+            }
+            entries[nentries++] = entry;
+         }
       }
+   }
 
-      /* -----find location of iupper[d] in  indexes-----*/
-
-      find_index_d = hypre_IndexD(iupper, d);
-
-      /* Loop upward if target index is greater than current location */
-      while ( (current_index_d <= (man_index_size_d - 1)) &&
-              (find_index_d >= man_indexes_d[current_index_d + 1]) )
-      {
-         current_index_d ++;
-      }
-      if ( current_index_d < 0 )
-      {
-         *entries_ptr  = NULL;
-         *nentries_ptr = 0;
-         return hypre_error_flag;
-      }
-      else
-      {
-         man_iupper[d] = hypre_min(current_index_d, (man_index_size_d - 1));
-      }
+   if (nentries > 1)
+   {
+      hypre_BoxManLocalRange(manager, &local_start, &local_end);
+      hypre_BoxManIntersectQsort(ndim, ilower, local_start, local_end,
+                                 entries, 0, nentries - 1);
    }
 
-   /*-----------------------------------------------------------------
-    * If we reach this point, then set up the entries array.
-    * Use a marker array to ensure unique entries.
-    *-----------------------------------------------------------------*/
+   *entries_ptr  = entries;
+   *nentries_ptr = nentries;
 
-   nentries = hypre_BoxManMaxNEntries(manager);
-   entries  = hypre_CTAlloc(hypre_BoxManEntry *,  nentries, HYPRE_MEMORY_HOST); /* realloc below */
-   marker   = hypre_CTAlloc(HYPRE_Int,  nentries, HYPRE_MEMORY_HOST);
-   index_table = hypre_BoxManIndexTable(manager);
+   return hypre_error_flag;
+}
 
-   nentries = 0;
+/*--------------------------------------------------------------------------
+ * Batched version of hypre_BoxManIntersect.  All boxes in 'boxes' are
+ * intersected with the manager in a single traversal of the spatial tree.
+ * The entries intersected by box i are returned in
+ *
+ *    entries[offsets[i]], ..., entries[offsets[i+1]-1]
+ *
+ * in the same order that hypre_BoxManIntersect would return them.  The user
+ * must free both 'offsets' (size nboxes+1) and 'entries' (NULL if no entries
+ * are found).
+ *--------------------------------------------------------------------------*/
 
-   table_box = hypre_BoxCreate(ndim);
-   index_box = hypre_BoxCreate(ndim);
+HYPRE_Int
+hypre_BoxManIntersectBoxes( hypre_BoxManager    *manager,
+                            hypre_BoxArray      *boxes,
+                            HYPRE_Int          **offsets_ptr,
+                            hypre_BoxManEntry ***entries_ptr )
+{
+   HYPRE_Int            ndim   = hypre_BoxManNDim(manager);
+   HYPRE_Int            nboxes = hypre_BoxArraySize(boxes);
+   HYPRE_Int           *offsets;
+   hypre_BoxManEntry  **entries;
+   HYPRE_Int           *queries, *scratch;
+   HYPRE_Int            nhits, max_hits;
+   HYPRE_Int           *hit_boxes;
+   hypre_BoxManEntry  **hit_entries;
+   HYPRE_Int           *counts;
+   HYPRE_Int            local_start, local_end;
+   HYPRE_Int            i, b;
 
-   hypre_SetIndex(stride, 1);
-   hypre_BoxSetExtents(table_box, stride, hypre_BoxManSize(manager));
-   hypre_BoxShiftNeg(table_box, stride); /* Want box to start at 0*/
-   hypre_BoxSetExtents(index_box, man_ilower, man_iupper);
-   hypre_BoxGetSize(index_box, loop_size);
-   hypre_SerialBoxLoop1Begin(ndim, loop_size, table_box, man_ilower, stride, ii);
+   /* can only use after assembling */
+   if (!hypre_BoxManIsAssembled(manager))
    {
-      entry = index_table[ii];
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
 
-      while (entry != NULL)
-      {
-         position = hypre_BoxManEntryPosition(entry);
+   offsets = hypre_CTAlloc(HYPRE_Int, nboxes + 1, HYPRE_MEMORY_HOST);
 
-         if (marker[position] == 0) /* Add entry and mark as added */
-         {
-            entries[nentries] = entry;
-            marker[position]  = 1;
-            nentries++;
-         }
+   if (hypre_BoxManNEntries(manager) == 0 || nboxes == 0)
+   {
+      *offsets_ptr = offsets;
+      *entries_ptr = NULL;
+      return hypre_error_flag;
+   }
 
-         entry = hypre_BoxManEntryNext(entry);
-      }
+   /* collect (box, entry) pairs */
+   queries = hypre_TAlloc(HYPRE_Int, nboxes, HYPRE_MEMORY_HOST);
+   scratch = hypre_TAlloc(HYPRE_Int, nboxes * (hypre_BoxManTreeDepth(manager) + 1),
+                          HYPRE_MEMORY_HOST);
+   for (b = 0; b < nboxes; b++)
+   {
+      queries[b] = b;
    }
-   hypre_SerialBoxLoop1End(ii);
 
-   entries  = hypre_TReAlloc(entries,  hypre_BoxManEntry *,  nentries, HYPRE_MEMORY_HOST);
+   nhits       = 0;
+   max_hits    = 0;
+   hit_boxes   = NULL;
+   hit_entries = NULL;
+   hypre_BoxManTreeIntersectBoxes(manager, 0, boxes, nboxes, queries, scratch,
+                                  &nhits, &max_hits, &hit_boxes, &hit_entries);
 
-   /* Reset the last index in the manager */
-   for (d = 0; d < ndim; d++)
+   hypre_TFree(queries, HYPRE_MEMORY_HOST);
+   hypre_TFree(scratch, HYPRE_MEMORY_HOST);
+
+   /* bucket the pairs by box, then order each bucket */
+   for (i = 0; i < nhits; i++)
    {
-      hypre_BoxManLastIndexD(manager, d) = man_ilower[d];
+      offsets[hit_boxes[i] + 1]++;
+   }
+   for (b = 0; b < nboxes; b++)
+   {
+      offsets[b + 1] += offsets[b];
    }
 
-   hypre_BoxDestroy(table_box);
-   hypre_BoxDestroy(index_box);
-   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   entries = NULL;
+   if (nhits > 0)
+   {
+      entries = hypre_TAlloc(hypre_BoxManEntry *, nhits, HYPRE_MEMORY_HOST);
+      counts  = hypre_CTAlloc(HYPRE_Int, nboxes, HYPRE_MEMORY_HOST);
+      for (i = 0; i < nhits; i++)
+      {
+         b = hit_boxes[i];
+         entries[offsets[b] + counts[b]] = hit_entries[i];
+         counts[b]++;
+      }
+      hypre_TFree(counts, HYPRE_MEMORY_HOST);
 
-   *entries_ptr  = entries;
-   *nentries_ptr = nentries;
+      hypre_BoxManLocalRange(manager, &local_start, &local_end);
+      for (b = 0; b < nboxes; b++)
+      {
+         hypre_BoxManIntersectQsort(ndim, hypre_BoxIMin(hypre_BoxArrayBox(boxes, b)),
+                                    local_start, local_end,
+                                    entries, offsets[b], offsets[b + 1] - 1);
+      }
+   }
+
+   hypre_TFree(hit_boxes, HYPRE_MEMORY_HOST);
+   hypre_TFree(hit_entries, HYPRE_MEMORY_HOST);
+
+   *offsets_ptr = offsets;
+   *entries_ptr = entries;
 
    return hypre_error_flag;
 }
@@ -32,6 +32,22 @@ typedef struct hypre_BoxManEntry_struct
 
 } hypre_BoxManEntry;
 
+/*--------------------------------------------------------------------------
+ * BoxManNode: node of the bounding volume tree built over the entries
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_Index imin; /* Extents of the smallest box containing all entries */
+   hypre_Index imax; /* below this node */
+
+   HYPRE_Int   child; /* First child node (the second one is child+1), or -1
+                         if this node is a leaf */
+   HYPRE_Int   first; /* Entries of a leaf: tree_order[first:first+count-1] */
+   HYPRE_Int   count;
+
+} hypre_BoxManNode;
+
 /*---------------------------------------------------------------------------
  * Box Manager: organizes arbitrary information in a spatial way
  *----------------------------------------------------------------------------*/
@@ -88,18 +104,12 @@ typedef struct
    HYPRE_Int          local_proc_offset; /* Position of local information in
                                             offsets */
 
-   /* Here is the table  that organizes the entries spatially (by index) */
-   hypre_BoxManEntry **index_table; /* This points into 'entries' array and
-                                       corresponds to the index arays */
-
-   HYPRE_Int          *indexes[HYPRE_MAXDIM]; /* Indexes (ordered) for imin and
-                                                 imax of each box in the entries
-                                                 array */
-   HYPRE_Int           size[HYPRE_MAXDIM]; /* How many indexes in each
-                                              direction */
-
-   HYPRE_Int           last_index[HYPRE_MAXDIM]; /* Last index used in the
-                                                    indexes map */
+   /* Here is the bounding volume tree that organizes the entries spatially */
+   HYPRE_Int           tree_nnodes; /* Number of nodes in the tree */
+   hypre_BoxManNode   *tree_nodes; /* Tree nodes (node 0 is the root) */
+   HYPRE_Int          *tree_order; /* Entry positions, ordered so that the
+                                      entries of each leaf are contiguous */
+   HYPRE_Int           tree_depth; /* Maximum depth of the tree */
 
    HYPRE_Int           num_my_entries; /* Num entries with proc_id = myid */
    HYPRE_Int          *my_ids; /* Array of ids corresponding to my entries */
@@ -152,10 +162,10 @@ typedef struct
 
 #define hypre_BoxManFirstLocal(manager)         ((manager) -> first_local)
 
-#define hypre_BoxManIndexTable(manager)         ((manager) -> index_table)
-#define hypre_BoxManIndexes(manager)            ((manager) -> indexes)
-#define hypre_BoxManSize(manager)               ((manager) -> size)
-#define hypre_BoxManLastIndex(manager)          ((manager) -> last_index)
+#define hypre_BoxManTreeNNodes(manager)         ((manager) -> tree_nnodes)
+#define hypre_BoxManTreeNodes(manager)          ((manager) -> tree_nodes)
+#define hypre_BoxManTreeOrder(manager)          ((manager) -> tree_order)
+#define hypre_BoxManTreeDepth(manager)          ((manager) -> tree_depth)
 
 #define hypre_BoxManNumMyEntries(manager)       ((manager) -> num_my_entries)
 #define hypre_BoxManMyIds(manager)              ((manager) -> my_ids)
@@ -168,9 +178,7 @@ typedef struct
 
 #define hypre_BoxManNumGhost(manager)           ((manager) -> num_ghost)
 
-#define hypre_BoxManIndexesD(manager, d)    hypre_BoxManIndexes(manager)[d]
-#define hypre_BoxManSizeD(manager, d)       hypre_BoxManSize(manager)[d]
-#define hypre_BoxManLastIndexD(manager, d)  hypre_BoxManLastIndex(manager)[d]
+#define hypre_BoxManTreeNode(manager, i)    &(hypre_BoxManTreeNodes(manager)[i])
 
 #define hypre_BoxManInfoObject(manager, i) \
 (void *) ((char *)hypre_BoxManInfoObjects(manager) + i* hypre_BoxManEntryInfoSize(manager))
@@ -189,4 +197,14 @@ typedef struct
 #define hypre_BoxManEntryNext(entry)     ((entry) -> next)
 #define hypre_BoxManEntryBoxMan(entry)   ((entry) -> boxman)
 
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_BoxManNode
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BoxManNodeIMin(node)       ((node) -> imin)
+#define hypre_BoxManNodeIMax(node)       ((node) -> imax)
+#define hypre_BoxManNodeChild(node)      ((node) -> child)
+#define hypre_BoxManNodeFirst(node)      ((node) -> first)
+#define hypre_BoxManNodeCount(node)      ((node) -> count)
+
 #endif
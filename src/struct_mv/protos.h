@@ -31,6 +31,9 @@ HYPRE_Int hypre_StructAssumedPartitionGetRegionsFromProc ( hypre_StructAssumedPa
 HYPRE_Int hypre_StructAssumedPartitionGetProcsFromBox ( hypre_StructAssumedPart *assumed_part,
                                                         hypre_Box *box, HYPRE_Int *num_proc_array, HYPRE_Int *size_alloc_proc_array,
                                                         HYPRE_Int **p_proc_array );
+HYPRE_Int hypre_StructAssumedPartitionUpdate ( hypre_StructAssumedPart *ap,
+                                               hypre_BoxArray *old_boxes, HYPRE_Int *old_boxnums, hypre_BoxArray *new_boxes,
+                                               HYPRE_Int *new_boxnums, MPI_Comm comm, hypre_StructAssumedPart **p_new_ap );
 
 /* box_algebra.c */
 HYPRE_Int hypre_IntersectBoxes ( hypre_Box *box1, hypre_Box *box2, hypre_Box *ibox );
@@ -94,6 +97,7 @@ HYPRE_Int hypre_DeleteBox ( hypre_BoxArray *box_array, HYPRE_Int index );
 HYPRE_Int hypre_DeleteMultipleBoxes ( hypre_BoxArray *box_array, HYPRE_Int *indices,
                                       HYPRE_Int num );
 HYPRE_Int hypre_AppendBoxArray ( hypre_BoxArray *box_array_0, hypre_BoxArray *box_array_1 );
+HYPRE_Int hypre_BoxArrayBoxThreads ( hypre_BoxArray *box_array );
 hypre_BoxArrayArray *hypre_BoxArrayArrayCreate ( HYPRE_Int size, HYPRE_Int ndim );
 HYPRE_Int hypre_BoxArrayArrayDestroy ( hypre_BoxArrayArray *box_array_array );
 hypre_BoxArrayArray *hypre_BoxArrayArrayDuplicate ( hypre_BoxArrayArray *box_array_array );
@@ -136,6 +140,8 @@ HYPRE_Int hypre_BoxManGatherEntries ( hypre_BoxManager *manager, hypre_Index imi
 HYPRE_Int hypre_BoxManAssemble ( hypre_BoxManager *manager );
 HYPRE_Int hypre_BoxManIntersect ( hypre_BoxManager *manager, hypre_Index ilower, hypre_Index iupper,
                                   hypre_BoxManEntry ***entries_ptr, HYPRE_Int *nentries_ptr );
+HYPRE_Int hypre_BoxManIntersectBoxes ( hypre_BoxManager *manager, hypre_BoxArray *boxes,
+                                       HYPRE_Int **offsets_ptr, hypre_BoxManEntry ***entries_ptr );
 HYPRE_Int hypre_FillResponseBoxManAssemble1 ( void *p_recv_contact_buf, HYPRE_Int contact_size,
                                               HYPRE_Int contact_proc, void *ro, MPI_Comm comm, void **p_send_response_buf,
                                               HYPRE_Int *response_message_size );
@@ -176,6 +182,8 @@ HYPRE_Int hypre_ComputeInfoProjectComp ( hypre_ComputeInfo *compute_info, hypre_
 HYPRE_Int hypre_ComputeInfoDestroy ( hypre_ComputeInfo *compute_info );
 HYPRE_Int hypre_CreateComputeInfo ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
                                     hypre_ComputeInfo **compute_info_ptr );
+HYPRE_Int hypre_CreateComputeInfoOverlap ( hypre_StructGrid *grid, hypre_StructStencil *stencil,
+                                           HYPRE_Int overlap, hypre_ComputeInfo **compute_info_ptr );
 HYPRE_Int hypre_ComputePkgCreate ( hypre_ComputeInfo *compute_info, hypre_BoxArray *data_space,
                                    HYPRE_Int num_values, hypre_StructGrid *grid, hypre_ComputePkg **compute_pkg_ptr );
 HYPRE_Int hypre_ComputePkgDestroy ( hypre_ComputePkg *compute_pkg );
@@ -277,6 +285,8 @@ HYPRE_Int hypre_ProjectBoxArrayArray ( hypre_BoxArrayArray *box_array_array, hyp
 
 /* struct_axpy.c */
 HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha, hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Int hypre_StructAxpby ( HYPRE_Complex alpha, hypre_StructVector *x, HYPRE_Complex beta,
+                              hypre_StructVector *y );
 
 /* struct_communication.c */
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info, hypre_BoxArray *send_data_space,
@@ -326,6 +336,11 @@ HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid,
 #endif
 /* struct_innerprod.c */
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x, hypre_StructVector *y );
+HYPRE_Real hypre_StructAxpyInnerProd ( HYPRE_Complex alpha, hypre_StructVector *x,
+                                      hypre_StructVector *y, hypre_StructVector *z );
+HYPRE_Real hypre_StructDualAxpyInnerProd ( HYPRE_Complex alpha, hypre_StructVector *x1,
+                                          hypre_StructVector *y1, HYPRE_Complex beta,
+                                          hypre_StructVector *x2, hypre_StructVector *y2 );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
@@ -340,6 +355,16 @@ HYPRE_Int hypre_ReadBoxArrayData ( FILE *file, hypre_BoxArray *box_array,
 HYPRE_Int hypre_ReadBoxArrayData_CC ( FILE *file, hypre_BoxArray *box_array,
                                       hypre_BoxArray *data_space, HYPRE_Int stencil_size, HYPRE_Int real_stencil_size,
                                       HYPRE_Int constant_coefficient, HYPRE_Int dim, HYPRE_Complex *data );
+HYPRE_Int hypre_PrintBoxArrayDataBinary ( MPI_Comm comm, const char *filename,
+                                          HYPRE_Int object_type, HYPRE_Int ndim, HYPRE_Int *num_ghost, HYPRE_Int symmetric,
+                                          HYPRE_Int constant_coefficient, HYPRE_Int num_values, hypre_Index *value_shapes,
+                                          HYPRE_Int *value_const, HYPRE_Complex *const_values, hypre_BoxArray *box_array,
+                                          hypre_BoxArray *data_space, HYPRE_Int **value_indices, HYPRE_Complex *data );
+HYPRE_Int hypre_ReadBoxArrayDataBinary ( MPI_Comm comm, const char *filename,
+                                         HYPRE_Int object_type, HYPRE_Int ndim, HYPRE_Int symmetric,
+                                         HYPRE_Int constant_coefficient, HYPRE_Int num_values, hypre_Index *value_shapes,
+                                         HYPRE_Int *value_const, HYPRE_Complex *const_values, hypre_BoxArray *box_array,
+                                         hypre_BoxArray *data_space, HYPRE_Int **value_indices, HYPRE_Complex *data );
 
 /* struct_matrix.c */
 HYPRE_Complex *hypre_StructMatrixExtractPointerByIndex ( hypre_StructMatrix *matrix, HYPRE_Int b,
@@ -371,6 +396,11 @@ HYPRE_Int hypre_StructMatrixSetConstantCoefficient ( hypre_StructMatrix *matrix,
                                                      HYPRE_Int constant_coefficient );
 HYPRE_Int hypre_StructMatrixSetConstantEntries ( hypre_StructMatrix *matrix, HYPRE_Int nentries,
                                                  HYPRE_Int *entries );
+HYPRE_Int hypre_StructMatrixSetCoeffFcn ( hypre_StructMatrix *matrix,
+                                          HYPRE_StructMatrixCoeffFcn coeff_fcn, void *coeff_data );
+HYPRE_Int hypre_StructMatrixEvalCoeffs ( hypre_StructMatrix *matrix, HYPRE_Int entry,
+                                         hypre_Box *box, HYPRE_Complex *values );
+hypre_StructMatrix *hypre_StructMatrixCreateAssembled ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixClearGhostValues ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixPrintData ( FILE *file, hypre_StructMatrix *matrix, HYPRE_Int all );
 HYPRE_Int hypre_StructMatrixReadData ( FILE *file, hypre_StructMatrix *matrix );
@@ -378,6 +408,8 @@ HYPRE_Int hypre_StructMatrixPrint ( const char *filename, hypre_StructMatrix *ma
                                     HYPRE_Int all );
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixPrintBinary ( const char *filename, hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixReadBinary ( const char *filename, hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix,
                                       hypre_StructMatrix *to_matrix );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
@@ -394,10 +426,15 @@ HYPRE_Int hypre_StructMatvecCompute ( void *matvec_vdata, HYPRE_Complex alpha,
                                       hypre_StructMatrix *A, hypre_StructVector *x, HYPRE_Complex beta, hypre_StructVector *y );
 HYPRE_Int hypre_StructMatvecCC0 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecCC0Stencil ( HYPRE_Complex alpha, hypre_StructMatrix *A,
+                                         hypre_StructVector *x, hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa,
+                                         hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC1 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                   hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecMF ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
+                                 hypre_StructVector *y, hypre_BoxArrayArray *compute_box_aa, hypre_IndexRef stride );
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha, hypre_StructMatrix *A, hypre_StructVector *x,
                                HYPRE_Complex beta, hypre_StructVector *y );
@@ -451,4 +488,6 @@ HYPRE_Int hypre_StructVectorPrint ( const char *filename, hypre_StructVector *ve
                                     HYPRE_Int all );
 hypre_StructVector *hypre_StructVectorRead ( MPI_Comm comm, const char *filename,
                                              HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorPrintBinary ( const char *filename, hypre_StructVector *vector );
+HYPRE_Int hypre_StructVectorReadBinary ( const char *filename, hypre_StructVector *vector );
 hypre_StructVector *hypre_StructVectorClone ( hypre_StructVector *vector );
@@ -805,6 +805,133 @@ hypre_StructCommunicationReleaseBuffer(HYPRE_Complex       *buffer,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Bind persistent requests with the given tag to buffers owned by comm_pkg.
+ * This is only done after the first communication, when the message sizes
+ * no longer include the prefix information.  The buffers are kept across
+ * tags; the requests are recreated when the tag changes.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommPkgPersistentSetup( hypre_CommPkg *comm_pkg,
+                              HYPRE_Int      tag )
+{
+   HYPRE_Int            num_sends = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm      = hypre_CommPkgComm(comm_pkg);
+
+   hypre_MPI_Request   *requests  = hypre_CommPkgPersistentRequests(comm_pkg);
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+   hypre_CommType      *comm_type;
+   HYPRE_Int            i, j;
+
+   if (requests != NULL)
+   {
+      if (hypre_CommPkgPersistentTag(comm_pkg) == tag)
+      {
+         return hypre_error_flag;
+      }
+
+      for (j = 0; j < num_sends + num_recvs; j++)
+      {
+         hypre_MPI_Request_free(&requests[j]);
+      }
+   }
+   else
+   {
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+      hypre_CommPkgPersistentRequests(comm_pkg) = requests;
+      hypre_CommPkgPersistentStatus(comm_pkg) =
+         hypre_CTAlloc(hypre_MPI_Status, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+
+      send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         send_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgSendBufsize(comm_pkg),
+                                         HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i - 1);
+            send_buffers[i] = send_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+         }
+      }
+      hypre_CommPkgPersistentSendBuffers(comm_pkg) = send_buffers;
+
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+      if (num_recvs > 0)
+      {
+         recv_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgRecvBufsize(comm_pkg),
+                                         HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i - 1);
+            recv_buffers[i] = recv_buffers[i - 1] + hypre_CommTypeBufsize(comm_type);
+         }
+      }
+      hypre_CommPkgPersistentRecvBuffers(comm_pkg) = recv_buffers;
+   }
+
+   send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+   recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_MPI_Recv_init(recv_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      hypre_MPI_Send_init(send_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+   hypre_CommPkgPersistentTag(comm_pkg) = tag;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Free the persistent requests and buffers of comm_pkg.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CommPkgPersistentDestroy( hypre_CommPkg *comm_pkg )
+{
+   HYPRE_Int            num_sends = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   hypre_MPI_Request   *requests  = hypre_CommPkgPersistentRequests(comm_pkg);
+   HYPRE_Int            j;
+
+   if (requests != NULL)
+   {
+      for (j = 0; j < num_sends + num_recvs; j++)
+      {
+         hypre_MPI_Request_free(&requests[j]);
+      }
+      hypre_TFree(hypre_CommPkgPersistentRequests(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgPersistentStatus(comm_pkg), HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         hypre_TFree(hypre_CommPkgPersistentSendBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+      }
+      if (num_recvs > 0)
+      {
+         hypre_TFree(hypre_CommPkgPersistentRecvBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_CommPkgPersistentSendBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgPersistentRecvBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
@@ -814,6 +941,10 @@ hypre_StructCommunicationReleaseBuffer(HYPRE_Complex       *buffer,
  * Different "actions" are possible when the buffer data is unpacked:
  *   action = 0    - copy the data over existing values in memory
  *   action = 1    - add the data to existing values in memory
+ *
+ * If HYPRE_USING_PERSISTENT_COMM is defined, host communications after the
+ * first one pack into buffers owned by comm_pkg and start persistent
+ * requests bound to them instead of posting new ones.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int
@@ -854,47 +985,74 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
 
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
+   HYPRE_Int            persistent = 0;
 
    HYPRE_MemoryLocation memory_location     = hypre_HandleMemoryLocation(hypre_handle());
    HYPRE_MemoryLocation memory_location_mpi = memory_location;
 
-   /*--------------------------------------------------------------------
-    * allocate requests and status
-    *--------------------------------------------------------------------*/
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* a comm_pkg may be in use by more than one exchange at a time */
+   if ( !hypre_CommPkgFirstComm(comm_pkg) && !hypre_CommPkgPersistentActive(comm_pkg) &&
+        hypre_GetActualMemLocation(memory_location) == hypre_MEMORY_HOST )
+   {
+      persistent = 1;
+   }
+#endif
 
    num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
-   status = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+   if (persistent)
+   {
+      /*-----------------------------------------------------------------
+       * use the requests and buffers of comm_pkg
+       *-----------------------------------------------------------------*/
 
-   /*--------------------------------------------------------------------
-    * allocate buffers
-    *--------------------------------------------------------------------*/
+      hypre_CommPkgPersistentSetup(comm_pkg, tag);
+      hypre_CommPkgPersistentActive(comm_pkg) = 1;
 
-   /* allocate send buffers */
-   send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
-   if (num_sends > 0)
+      requests     = hypre_CommPkgPersistentRequests(comm_pkg);
+      status       = hypre_CommPkgPersistentStatus(comm_pkg);
+      send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+      recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+   }
+   else
    {
-      size = hypre_CommPkgSendBufsize(comm_pkg);
-      send_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
-      for (i = 1; i < num_sends; i++)
+      /*-----------------------------------------------------------------
+       * allocate requests and status
+       *-----------------------------------------------------------------*/
+
+      requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+      status = hypre_CTAlloc(hypre_MPI_Status, num_requests, HYPRE_MEMORY_HOST);
+
+      /*-----------------------------------------------------------------
+       * allocate buffers
+       *-----------------------------------------------------------------*/
+
+      /* allocate send buffers */
+      send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
       {
-         comm_type = hypre_CommPkgSendType(comm_pkg, i - 1);
-         size = hypre_CommTypeBufsize(comm_type);
-         send_buffers[i] = send_buffers[i - 1] + size;
+         size = hypre_CommPkgSendBufsize(comm_pkg);
+         send_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
+         for (i = 1; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i - 1);
+            size = hypre_CommTypeBufsize(comm_type);
+            send_buffers[i] = send_buffers[i - 1] + size;
+         }
       }
-   }
 
-   /* allocate recv buffers */
-   recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
-   if (num_recvs > 0)
-   {
-      size = hypre_CommPkgRecvBufsize(comm_pkg);
-      recv_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
-      for (i = 1; i < num_recvs; i++)
+      /* allocate recv buffers */
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+      if (num_recvs > 0)
       {
-         comm_type = hypre_CommPkgRecvType(comm_pkg, i - 1);
-         size = hypre_CommTypeBufsize(comm_type);
-         recv_buffers[i] = recv_buffers[i - 1] + size;
+         size = hypre_CommPkgRecvBufsize(comm_pkg);
+         recv_buffers[0] = hypre_StructCommunicationGetBuffer(memory_location, size);
+         for (i = 1; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i - 1);
+            size = hypre_CommTypeBufsize(comm_type);
+            recv_buffers[i] = recv_buffers[i - 1] + size;
+         }
       }
    }
 
@@ -1032,34 +1190,44 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
     * post receives and initiate sends
     *--------------------------------------------------------------------*/
 
-   j = 0;
-   for (i = 0; i < num_recvs; i++)
+   if (persistent)
    {
-      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
-      hypre_MPI_Irecv(recv_buffers_mpi[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      if (num_requests > 0)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         hypre_MPI_Startall(num_requests, requests);
       }
    }
-
-   for (i = 0; i < num_sends; i++)
+   else
    {
-      comm_type = hypre_CommPkgSendType(comm_pkg, i);
-      hypre_MPI_Isend(send_buffers_mpi[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      j = 0;
+      for (i = 0; i < num_recvs; i++)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         hypre_MPI_Irecv(recv_buffers_mpi[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         }
+      }
+
+      for (i = 0; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         hypre_MPI_Isend(send_buffers_mpi[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         }
       }
    }
 
@@ -1107,6 +1275,7 @@ hypre_InitializeCommunication( hypre_CommPkg        *comm_pkg,
    hypre_CommHandleAction(comm_handle)         = action;
    hypre_CommHandleSendBuffersMPI(comm_handle) = send_buffers_mpi;
    hypre_CommHandleRecvBuffersMPI(comm_handle) = recv_buffers_mpi;
+   hypre_CommHandlePersistent(comm_handle)     = persistent;
 
    *comm_handle_ptr = comm_handle;
 
@@ -1327,6 +1496,15 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
     * Free up communication handle
     *--------------------------------------------------------------------*/
 
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      /* requests and buffers are kept for the next communication */
+      hypre_CommPkgPersistentActive(comm_pkg) = 0;
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
    if (num_sends > 0)
@@ -1483,6 +1661,8 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
       hypre_TFree(hypre_CommPkgIdentityOrder(comm_pkg), HYPRE_MEMORY_HOST);
 
+      hypre_CommPkgPersistentDestroy(comm_pkg);
+
       hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
    }
 
@@ -45,10 +45,24 @@ hypre_StructInnerProd( hypre_StructVector *x,
 #endif
 
    HYPRE_Real       local_result = 0.0;
+   HYPRE_Real      *box_results = NULL;
+   HYPRE_Int        box_threads;
 
    hypre_SetIndex(unit_stride, 1);
 
    boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+
+   /* With box threading, keep one partial sum per box and add them up in box
+      order afterwards, so the result does not depend on the thread schedule */
+   box_threads = hypre_BoxArrayBoxThreads(boxes);
+   if (box_threads)
+   {
+      box_results = hypre_TAlloc(HYPRE_Real, hypre_BoxArraySize(boxes), HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp parallel for private(box,start,x_data_box,y_data_box,xp,yp,loop_size) if (box_threads) schedule(dynamic, 1)
+#endif
    hypre_ForBoxI(i, boxes)
    {
       box   = hypre_BoxArrayBox(boxes, i);
@@ -92,8 +106,25 @@ hypre_StructInnerProd( hypre_StructVector *x,
          box_sum += tmp;
       }
       hypre_BoxLoop2ReductionEnd(xi, yi, box_sum);
+#undef DEVICE_VAR
 
-      local_result += (HYPRE_Real) box_sum;
+      if (box_threads)
+      {
+         box_results[i] = (HYPRE_Real) box_sum;
+      }
+      else
+      {
+         local_result += (HYPRE_Real) box_sum;
+      }
+   }
+
+   if (box_threads)
+   {
+      hypre_ForBoxI(i, boxes)
+      {
+         local_result += box_results[i];
+      }
+      hypre_TFree(box_results, HYPRE_MEMORY_HOST);
    }
 
    process_result = (HYPRE_Real) local_result;
@@ -105,3 +136,261 @@ hypre_StructInnerProd( hypre_StructVector *x,
 
    return final_innerprod_result;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorDataSpacesMatch
+ *
+ * Returns 1 if x and y have identical data boxes, in which case the same
+ * BoxLoop index can be used to address both vectors.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructVectorDataSpacesMatch( hypre_StructVector *x,
+                                   hypre_StructVector *y )
+{
+   hypre_BoxArray  *x_data_space = hypre_StructVectorDataSpace(x);
+   hypre_BoxArray  *y_data_space = hypre_StructVectorDataSpace(y);
+   hypre_Box       *x_data_box;
+   hypre_Box       *y_data_box;
+   HYPRE_Int        ndim = hypre_StructVectorNDim(x);
+   HYPRE_Int        i;
+
+   if (x == y)
+   {
+      return 1;
+   }
+
+   if (hypre_BoxArraySize(x_data_space) != hypre_BoxArraySize(y_data_space))
+   {
+      return 0;
+   }
+
+   hypre_ForBoxI(i, x_data_space)
+   {
+      x_data_box = hypre_BoxArrayBox(x_data_space, i);
+      y_data_box = hypre_BoxArrayBox(y_data_space, i);
+
+      if (!hypre_IndexesEqual(hypre_BoxIMin(x_data_box), hypre_BoxIMin(y_data_box), ndim) ||
+          !hypre_IndexesEqual(hypre_BoxIMax(x_data_box), hypre_BoxIMax(y_data_box), ndim))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructAxpyInnerProd
+ *
+ * Computes y = y + alpha*x and returns <y, z> in a single pass over the
+ * data. z may be the same vector as y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructAxpyInnerProd( HYPRE_Complex       alpha,
+                           hypre_StructVector *x,
+                           hypre_StructVector *y,
+                           hypre_StructVector *z )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   hypre_Box       *x_data_box;
+   hypre_Box       *y_data_box;
+
+   HYPRE_Complex   *xp;
+   HYPRE_Complex   *yp;
+   HYPRE_Complex   *zp;
+
+   hypre_BoxArray  *boxes;
+   hypre_Box       *box;
+   hypre_Index      loop_size;
+   hypre_IndexRef   start;
+   hypre_Index      unit_stride;
+
+   HYPRE_Int        ndim = hypre_StructVectorNDim(x);
+   HYPRE_Int        i;
+
+   HYPRE_Real       local_result = 0.0;
+
+   /* z is addressed with the index of y */
+   if (!hypre_StructVectorDataSpacesMatch(y, z))
+   {
+      hypre_StructAxpy(alpha, x, y);
+      return hypre_StructInnerProd(y, z);
+   }
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+      zp = hypre_StructVectorBoxData(z, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#if defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_SYCL)
+      HYPRE_Real box_sum = 0.0;
+#elif defined(HYPRE_USING_RAJA)
+      ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
+#elif defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      ReduceSum<HYPRE_Real> box_sum(0.0);
+#else
+      HYPRE_Real box_sum = 0.0;
+#endif
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_BOX_REDUCTION map(tofrom: box_sum) reduction(+:box_sum)
+#else
+#define HYPRE_BOX_REDUCTION reduction(+:box_sum)
+#endif
+
+#define DEVICE_VAR is_device_ptr(yp,xp,zp)
+      hypre_BoxLoop2ReductionBegin(ndim, loop_size,
+                                   x_data_box, start, unit_stride, xi,
+                                   y_data_box, start, unit_stride, yi,
+                                   box_sum)
+      {
+         yp[yi] += alpha * xp[xi];
+         HYPRE_Real tmp = yp[yi] * hypre_conj(zp[yi]);
+         box_sum += tmp;
+      }
+      hypre_BoxLoop2ReductionEnd(xi, yi, box_sum);
+#undef DEVICE_VAR
+
+      local_result += (HYPRE_Real) box_sum;
+   }
+
+   process_result = (HYPRE_Real) local_result;
+
+   hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
+
+   hypre_IncFLOPCount(4 * hypre_StructVectorGlobalSize(x));
+
+   return final_innerprod_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructDualAxpyInnerProd
+ *
+ * Computes y1 = y1 + alpha*x1, y2 = y2 + beta*x2 and returns <y2, y2> in a
+ * single pass over the data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructDualAxpyInnerProd( HYPRE_Complex       alpha,
+                               hypre_StructVector *x1,
+                               hypre_StructVector *y1,
+                               HYPRE_Complex       beta,
+                               hypre_StructVector *x2,
+                               hypre_StructVector *y2 )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   hypre_Box       *x1_data_box;
+   hypre_Box       *x2_data_box;
+
+   HYPRE_Complex   *x1p;
+   HYPRE_Complex   *y1p;
+   HYPRE_Complex   *x2p;
+   HYPRE_Complex   *y2p;
+
+   hypre_BoxArray  *boxes;
+   hypre_Box       *box;
+   hypre_Index      loop_size;
+   hypre_IndexRef   start;
+   hypre_Index      unit_stride;
+
+   HYPRE_Int        ndim = hypre_StructVectorNDim(x1);
+   HYPRE_Int        i;
+
+   HYPRE_Real       local_result = 0.0;
+
+   /* y1 is addressed with the index of x1, y2 with the index of x2 */
+   if (!hypre_StructVectorDataSpacesMatch(x1, y1) ||
+       !hypre_StructVectorDataSpacesMatch(x2, y2))
+   {
+      hypre_StructAxpy(alpha, x1, y1);
+      hypre_StructAxpy(beta, x2, y2);
+      return hypre_StructInnerProd(y2, y2);
+   }
+
+   hypre_SetIndex(unit_stride, 1);
+
+   boxes = hypre_StructGridBoxes(hypre_StructVectorGrid(y2));
+   hypre_ForBoxI(i, boxes)
+   {
+      box   = hypre_BoxArrayBox(boxes, i);
+      start = hypre_BoxIMin(box);
+
+      x1_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x1), i);
+      x2_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x2), i);
+
+      x1p = hypre_StructVectorBoxData(x1, i);
+      y1p = hypre_StructVectorBoxData(y1, i);
+      x2p = hypre_StructVectorBoxData(x2, i);
+      y2p = hypre_StructVectorBoxData(y2, i);
+
+      hypre_BoxGetSize(box, loop_size);
+
+#if defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_SYCL)
+      HYPRE_Real box_sum = 0.0;
+#elif defined(HYPRE_USING_RAJA)
+      ReduceSum<hypre_raja_reduce_policy, HYPRE_Real> box_sum(0.0);
+#elif defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_HIP)
+      ReduceSum<HYPRE_Real> box_sum(0.0);
+#else
+      HYPRE_Real box_sum = 0.0;
+#endif
+
+#ifdef HYPRE_BOX_REDUCTION
+#undef HYPRE_BOX_REDUCTION
+#endif
+
+#if defined(HYPRE_USING_DEVICE_OPENMP)
+#define HYPRE_BOX_REDUCTION map(tofrom: box_sum) reduction(+:box_sum)
+#else
+#define HYPRE_BOX_REDUCTION reduction(+:box_sum)
+#endif
+
+#define DEVICE_VAR is_device_ptr(x1p,y1p,x2p,y2p)
+      hypre_BoxLoop2ReductionBegin(ndim, loop_size,
+                                   x1_data_box, start, unit_stride, i1,
+                                   x2_data_box, start, unit_stride, i2,
+                                   box_sum)
+      {
+         y1p[i1] += alpha * x1p[i1];
+         y2p[i2] += beta  * x2p[i2];
+         HYPRE_Real tmp = y2p[i2] * hypre_conj(y2p[i2]);
+         box_sum += tmp;
+      }
+      hypre_BoxLoop2ReductionEnd(i1, i2, box_sum);
+#undef DEVICE_VAR
+
+      local_result += (HYPRE_Real) box_sum;
+   }
+
+   process_result = (HYPRE_Real) local_result;
+
+   hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x1));
+
+   hypre_IncFLOPCount(6 * hypre_StructVectorGlobalSize(x1));
+
+   return final_innerprod_result;
+}
@@ -376,3 +376,659 @@ hypre_ReadBoxArrayData_CC( FILE            *file,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * Binary box array data files
+ *
+ * These are single files written and read collectively with MPI-IO.  The
+ * file starts with a header of hypre_MPI_Offset integers:
+ *
+ *   magic, version, object type, ndim, number of boxes, sizeof(HYPRE_Complex),
+ *   number of values, symmetric, constant coefficient, num_ghost[2*ndim],
+ *   value offsets[num_values*ndim], value is constant[num_values],
+ *   box extents[nboxes*2*ndim] (imin, then imax)
+ *
+ * followed by num_values constant values (only the constant ones are used)
+ * and then the variable values of each box in turn.  The boxes are ordered
+ * by process rank and then by local box number, and the data for each box
+ * is stored value by value, with each value in box order (x fastest).  Data
+ * is stored in native byte order.
+ *
+ * Reading intersects the local boxes with the boxes in the file, so the data
+ * can be read on a different number of processes than it was written on.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_BOXDATA_BINARY_MAGIC    0x68797072
+#define hypre_BOXDATA_BINARY_VERSION  1
+#define hypre_BOXDATA_BINARY_NFIXED   9
+
+/*--------------------------------------------------------------------------
+ * hypre_PrintBoxArrayDataBinary
+ *
+ * Collective.  The variable values of value j in box i start at data index
+ * value_indices[i][j].  The constant values are taken from the first process
+ * with boxes.
+ *
+ * Note: data array is expected to live on the host memory.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PrintBoxArrayDataBinary( MPI_Comm         comm,
+                               const char      *filename,
+                               HYPRE_Int        object_type,
+                               HYPRE_Int        ndim,
+                               HYPRE_Int       *num_ghost,
+                               HYPRE_Int        symmetric,
+                               HYPRE_Int        constant_coefficient,
+                               HYPRE_Int        num_values,
+                               hypre_Index     *value_shapes,
+                               HYPRE_Int       *value_const,
+                               HYPRE_Complex   *const_values,
+                               hypre_BoxArray  *box_array,
+                               hypre_BoxArray  *data_space,
+                               HYPRE_Int      **value_indices,
+                               HYPRE_Complex   *data )
+{
+   const size_t       csize = sizeof(HYPRE_Complex);
+
+   hypre_MPI_File     fh;
+   hypre_MPI_Offset  *header = NULL;
+   hypre_MPI_Offset   local_count, data_offset, header_size, data_start;
+   hypre_MPI_Offset  *proc_counts;
+   HYPRE_Int         *proc_nboxes, *recv_counts = NULL, *displs = NULL;
+   HYPRE_Int         *extents, *all_extents = NULL;
+   HYPRE_Int          num_procs, myid, nboxes, local_nboxes, nvar, const_proc;
+   HYPRE_Int          ierr, p, i, j, d, k, count;
+   HYPRE_Complex     *buffer, *zeros = NULL;
+   hypre_Box         *box, *data_box;
+   hypre_Index        loop_size, stride;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   local_nboxes = hypre_BoxArraySize(box_array);
+   nvar = 0;
+   for (j = 0; j < num_values; j++)
+   {
+      nvar += (value_const[j] == 0);
+   }
+
+   /*----------------------------------------
+    * Compute the sizes and offsets
+    *----------------------------------------*/
+
+   local_count = 0;
+   hypre_ForBoxI(i, box_array)
+   {
+      local_count += (hypre_MPI_Offset) nvar * hypre_BoxVolume(hypre_BoxArrayBox(box_array, i));
+   }
+
+   proc_nboxes = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   proc_counts = hypre_TAlloc(hypre_MPI_Offset, num_procs, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&local_nboxes, 1, HYPRE_MPI_INT, proc_nboxes, 1, HYPRE_MPI_INT, comm);
+   hypre_MPI_Allgather(&local_count, (HYPRE_Int) sizeof(hypre_MPI_Offset), hypre_MPI_BYTE,
+                       proc_counts, (HYPRE_Int) sizeof(hypre_MPI_Offset), hypre_MPI_BYTE, comm);
+
+   nboxes = 0;
+   data_offset = 0;
+   const_proc = -1;
+   for (p = 0; p < num_procs; p++)
+   {
+      if (p < myid)
+      {
+         data_offset += proc_counts[p];
+      }
+      if ((const_proc < 0) && (proc_nboxes[p] > 0))
+      {
+         const_proc = p;
+      }
+      nboxes += proc_nboxes[p];
+   }
+
+   header_size = hypre_BOXDATA_BINARY_NFIXED + 2 * ndim + num_values * ndim + num_values +
+                 (hypre_MPI_Offset) nboxes * 2 * ndim;
+   data_start  = header_size * (hypre_MPI_Offset) sizeof(hypre_MPI_Offset) +
+                 num_values * (hypre_MPI_Offset) csize;
+
+   /*----------------------------------------
+    * Gather the box extents and set up the header on process 0
+    *----------------------------------------*/
+
+   extents = hypre_TAlloc(HYPRE_Int, 2 * ndim * local_nboxes + 1, HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, box_array)
+   {
+      box = hypre_BoxArrayBox(box_array, i);
+      for (d = 0; d < ndim; d++)
+      {
+         extents[2 * ndim * i + d]        = hypre_BoxIMinD(box, d);
+         extents[2 * ndim * i + ndim + d] = hypre_BoxIMaxD(box, d);
+      }
+   }
+   if (myid == 0)
+   {
+      all_extents = hypre_TAlloc(HYPRE_Int, 2 * ndim * nboxes + 1, HYPRE_MEMORY_HOST);
+      recv_counts = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+      displs      = hypre_TAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+      k = 0;
+      for (p = 0; p < num_procs; p++)
+      {
+         recv_counts[p] = 2 * ndim * proc_nboxes[p];
+         displs[p] = k;
+         k += recv_counts[p];
+      }
+   }
+   hypre_MPI_Gatherv(extents, 2 * ndim * local_nboxes, HYPRE_MPI_INT,
+                     all_extents, recv_counts, displs, HYPRE_MPI_INT, 0, comm);
+
+   if (myid == 0)
+   {
+      header = hypre_TAlloc(hypre_MPI_Offset, header_size, HYPRE_MEMORY_HOST);
+      k = 0;
+      header[k++] = hypre_BOXDATA_BINARY_MAGIC;
+      header[k++] = hypre_BOXDATA_BINARY_VERSION;
+      header[k++] = object_type;
+      header[k++] = ndim;
+      header[k++] = nboxes;
+      header[k++] = (hypre_MPI_Offset) csize;
+      header[k++] = num_values;
+      header[k++] = symmetric;
+      header[k++] = constant_coefficient;
+      for (d = 0; d < 2 * ndim; d++)
+      {
+         header[k++] = num_ghost[d];
+      }
+      for (j = 0; j < num_values; j++)
+      {
+         for (d = 0; d < ndim; d++)
+         {
+            header[k++] = hypre_IndexD(value_shapes[j], d);
+         }
+      }
+      for (j = 0; j < num_values; j++)
+      {
+         header[k++] = value_const[j];
+      }
+      for (i = 0; i < 2 * ndim * nboxes; i++)
+      {
+         header[k++] = all_extents[i];
+      }
+   }
+
+   /*----------------------------------------
+    * Pack the variable values of the local boxes
+    *----------------------------------------*/
+
+   buffer = hypre_TAlloc(HYPRE_Complex, local_count + 1, HYPRE_MEMORY_HOST);
+   hypre_SetIndex(stride, 1);
+   k = 0;
+   hypre_ForBoxI(i, box_array)
+   {
+      box      = hypre_BoxArrayBox(box_array, i);
+      data_box = hypre_BoxArrayBox(data_space, i);
+      hypre_BoxGetSize(box, loop_size);
+
+      for (j = 0; j < num_values; j++)
+      {
+         if (value_const[j] == 0)
+         {
+            HYPRE_Complex *datap = data + value_indices[i][j];
+            HYPRE_Complex *bufp  = buffer + k;
+
+            hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                      data_box, hypre_BoxIMin(box), stride, datai,
+                                      box, hypre_BoxIMin(box), stride, bufi);
+            {
+               bufp[bufi] = datap[datai];
+            }
+            hypre_SerialBoxLoop2End(datai, bufi);
+
+            k += hypre_BoxVolume(box);
+         }
+      }
+   }
+
+   /*----------------------------------------
+    * Write the file
+    *----------------------------------------*/
+
+   ierr = hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_WRONLY | hypre_MPI_MODE_CREATE,
+                              hypre_MPI_INFO_NULL, &fh);
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't open binary output file");
+   }
+   else
+   {
+      hypre_MPI_File_set_size(fh, 0);
+
+      count = (myid == 0) ? (HYPRE_Int) (header_size * sizeof(hypre_MPI_Offset)) : 0;
+      ierr = hypre_MPI_File_write_at_all(fh, 0, header, count, hypre_MPI_BYTE,
+                                         hypre_MPI_STATUS_IGNORE);
+
+      /* constant values (zeros if no process has boxes) */
+      count = 0;
+      if ((myid == const_proc) || ((const_proc < 0) && (myid == 0)))
+      {
+         count = num_values;
+         if (const_proc < 0)
+         {
+            zeros = hypre_CTAlloc(HYPRE_Complex, num_values, HYPRE_MEMORY_HOST);
+            const_values = zeros;
+         }
+      }
+      ierr += hypre_MPI_File_write_at_all(fh, header_size * (hypre_MPI_Offset) sizeof(hypre_MPI_Offset),
+                                          const_values, count, hypre_MPI_COMPLEX,
+                                          hypre_MPI_STATUS_IGNORE);
+
+      ierr += hypre_MPI_File_write_at_all(fh, data_start + data_offset * (hypre_MPI_Offset) csize,
+                                          buffer, (HYPRE_Int) local_count, hypre_MPI_COMPLEX,
+                                          hypre_MPI_STATUS_IGNORE);
+      if (ierr)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error writing binary output file");
+      }
+
+      hypre_MPI_File_close(&fh);
+   }
+
+   hypre_TFree(zeros, HYPRE_MEMORY_HOST);
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+   hypre_TFree(header, HYPRE_MEMORY_HOST);
+   hypre_TFree(extents, HYPRE_MEMORY_HOST);
+   hypre_TFree(all_extents, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(proc_nboxes, HYPRE_MEMORY_HOST);
+   hypre_TFree(proc_counts, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReadBoxArrayDataBinary
+ *
+ * Collective.  Reads the data written by hypre_PrintBoxArrayDataBinary into
+ * the parts of the boxes in box_array that are covered by the boxes in the
+ * file.  The header must match the given object description.  The constant
+ * values are returned in const_values (of size num_values).
+ *
+ * Note: data array is expected to live on the host memory.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReadBoxArrayDataBinary( MPI_Comm         comm,
+                              const char      *filename,
+                              HYPRE_Int        object_type,
+                              HYPRE_Int        ndim,
+                              HYPRE_Int        symmetric,
+                              HYPRE_Int        constant_coefficient,
+                              HYPRE_Int        num_values,
+                              hypre_Index     *value_shapes,
+                              HYPRE_Int       *value_const,
+                              HYPRE_Complex   *const_values,
+                              hypre_BoxArray  *box_array,
+                              hypre_BoxArray  *data_space,
+                              HYPRE_Int      **value_indices,
+                              HYPRE_Complex   *data )
+{
+   const size_t       csize = sizeof(HYPRE_Complex);
+
+   hypre_MPI_File     fh;
+   hypre_MPI_Offset   fixed[hypre_BOXDATA_BINARY_NFIXED];
+   hypre_MPI_Offset  *header, *file_extents, *file_offsets;
+   hypre_MPI_Offset   header_size, data_start, offset;
+   HYPRE_Int          nboxes, local_nboxes, max_nboxes, nvar, nonempty;
+   HYPRE_Int          match, ierr, count, buffer_size;
+   HYPRE_Int          b, i, j, v, d, k;
+   HYPRE_Complex     *buffer;
+   hypre_Box         *box, *data_box, *file_box, *int_box, *bound_box;
+   hypre_BoxArray    *file_boxes;
+   hypre_Index        loop_size, stride;
+#ifdef HYPRE_SEQUENTIAL
+   hypre_MPI_Offset   base, frank, fstride;
+   HYPRE_Int          r, nruns, run_len, tmp;
+   hypre_Index        coord;
+#else
+   hypre_MPI_Datatype file_type, *sub_types, *piece_types;
+   hypre_MPI_Aint    *piece_displs;
+   HYPRE_Int         *piece_lens, nfile, nsub, npieces;
+   HYPRE_Int          sizes[HYPRE_MAXDIM], subsizes[HYPRE_MAXDIM], starts[HYPRE_MAXDIM];
+#endif
+
+   ierr = hypre_MPI_File_open(comm, filename, hypre_MPI_MODE_RDONLY,
+                              hypre_MPI_INFO_NULL, &fh);
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't open binary input file");
+      return hypre_error_flag;
+   }
+
+   /*----------------------------------------
+    * Read and check the header
+    *----------------------------------------*/
+
+   ierr = hypre_MPI_File_read_at_all(fh, 0, fixed,
+                                     (HYPRE_Int) sizeof(fixed), hypre_MPI_BYTE,
+                                     hypre_MPI_STATUS_IGNORE);
+   match = (ierr == 0) &&
+           (fixed[0] == hypre_BOXDATA_BINARY_MAGIC) &&
+           (fixed[1] == hypre_BOXDATA_BINARY_VERSION) &&
+           (fixed[2] == object_type) &&
+           (fixed[3] == ndim) &&
+           (fixed[5] == (hypre_MPI_Offset) csize) &&
+           (fixed[6] == num_values) &&
+           (fixed[7] == symmetric) &&
+           (fixed[8] == constant_coefficient);
+   if (!match)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Binary input file does not match the object");
+      hypre_MPI_File_close(&fh);
+      return hypre_error_flag;
+   }
+
+   nboxes = (HYPRE_Int) fixed[4];
+   header_size = hypre_BOXDATA_BINARY_NFIXED + 2 * ndim + num_values * ndim + num_values +
+                 (hypre_MPI_Offset) nboxes * 2 * ndim;
+   data_start  = header_size * (hypre_MPI_Offset) sizeof(hypre_MPI_Offset) +
+                 num_values * (hypre_MPI_Offset) csize;
+
+   header = hypre_TAlloc(hypre_MPI_Offset, header_size, HYPRE_MEMORY_HOST);
+   ierr = hypre_MPI_File_read_at_all(fh, 0, header,
+                                     (HYPRE_Int) (header_size * sizeof(hypre_MPI_Offset)),
+                                     hypre_MPI_BYTE, hypre_MPI_STATUS_IGNORE);
+
+   /* skip num_ghost, then check the values */
+   k = hypre_BOXDATA_BINARY_NFIXED + 2 * ndim;
+   for (j = 0; j < num_values; j++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         match = match && (header[k++] == hypre_IndexD(value_shapes[j], d));
+      }
+   }
+   for (j = 0; j < num_values; j++)
+   {
+      match = match && (header[k++] == value_const[j]);
+   }
+   file_extents = header + k;
+   if (ierr || !match)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Binary input file does not match the object");
+      hypre_TFree(header, HYPRE_MEMORY_HOST);
+      hypre_MPI_File_close(&fh);
+      return hypre_error_flag;
+   }
+
+   ierr = hypre_MPI_File_read_at_all(fh, header_size * (hypre_MPI_Offset) sizeof(hypre_MPI_Offset),
+                                     const_values, num_values, hypre_MPI_COMPLEX,
+                                     hypre_MPI_STATUS_IGNORE);
+
+   /*----------------------------------------
+    * Compute the data offsets of the file boxes
+    *----------------------------------------*/
+
+   nvar = 0;
+   for (j = 0; j < num_values; j++)
+   {
+      nvar += (value_const[j] == 0);
+   }
+
+   /*----------------------------------------
+    * Keep only the file boxes that intersect the bounding box of the local
+    * boxes, and compute their data offsets
+    *----------------------------------------*/
+
+   local_nboxes = hypre_BoxArraySize(box_array);
+
+   file_box  = hypre_BoxCreate(ndim);
+   int_box   = hypre_BoxCreate(ndim);
+   bound_box = hypre_BoxCreate(ndim);
+   nonempty  = 0;
+   hypre_ForBoxI(i, box_array)
+   {
+      box = hypre_BoxArrayBox(box_array, i);
+      if (hypre_BoxVolume(box) > 0)
+      {
+         if (!nonempty)
+         {
+            hypre_CopyBox(box, bound_box);
+            nonempty = 1;
+         }
+         for (d = 0; d < ndim; d++)
+         {
+            hypre_BoxIMinD(bound_box, d) = hypre_min(hypre_BoxIMinD(bound_box, d),
+                                                     hypre_BoxIMinD(box, d));
+            hypre_BoxIMaxD(bound_box, d) = hypre_max(hypre_BoxIMaxD(bound_box, d),
+                                                     hypre_BoxIMaxD(box, d));
+         }
+      }
+   }
+
+   file_boxes   = hypre_BoxArrayCreate(0, ndim);
+   file_offsets = hypre_TAlloc(hypre_MPI_Offset, nboxes + 1, HYPRE_MEMORY_HOST);
+   offset = data_start;
+   for (b = 0; b < nboxes; b++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         hypre_BoxIMinD(file_box, d) = (HYPRE_Int) file_extents[2 * ndim * b + d];
+         hypre_BoxIMaxD(file_box, d) = (HYPRE_Int) file_extents[2 * ndim * b + ndim + d];
+      }
+      if (nonempty)
+      {
+         hypre_IntersectBoxes(bound_box, file_box, int_box);
+         if (hypre_BoxVolume(int_box) > 0)
+         {
+            file_offsets[hypre_BoxArraySize(file_boxes)] = offset;
+            hypre_AppendBox(file_box, file_boxes);
+         }
+      }
+      offset += (hypre_MPI_Offset) nvar * hypre_BoxVolume(file_box) * csize;
+   }
+
+   /*----------------------------------------
+    * Read the data of each local box with one collective read.  The file view
+    * has one subarray per intersecting file box and variable value, so the
+    * intersections land one after the other in the buffer, each in box order.
+    * Processes with fewer boxes take part with empty reads.
+    *----------------------------------------*/
+
+#ifndef HYPRE_SEQUENTIAL
+   nfile = hypre_BoxArraySize(file_boxes);
+   sub_types    = hypre_TAlloc(hypre_MPI_Datatype, nfile + 1, HYPRE_MEMORY_HOST);
+   piece_types  = hypre_TAlloc(hypre_MPI_Datatype, nfile * nvar + 1, HYPRE_MEMORY_HOST);
+   piece_lens   = hypre_TAlloc(HYPRE_Int, nfile * nvar + 1, HYPRE_MEMORY_HOST);
+   piece_displs = hypre_TAlloc(hypre_MPI_Aint, nfile * nvar + 1, HYPRE_MEMORY_HOST);
+#endif
+
+   hypre_MPI_Allreduce(&local_nboxes, &max_nboxes, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+
+   buffer = NULL;
+   buffer_size = 0;
+   hypre_SetIndex(stride, 1);
+   for (i = 0; i < max_nboxes; i++)
+   {
+#ifndef HYPRE_SEQUENTIAL
+      nsub = 0;
+      npieces = 0;
+#endif
+      count = 0;
+      if (i < local_nboxes)
+      {
+         box = hypre_BoxArrayBox(box_array, i);
+         hypre_ForBoxI(b, file_boxes)
+         {
+            file_box = hypre_BoxArrayBox(file_boxes, b);
+            hypre_IntersectBoxes(box, file_box, int_box);
+            if (hypre_BoxVolume(int_box) == 0)
+            {
+               continue;
+            }
+            count += nvar * hypre_BoxVolume(int_box);
+         }
+      }
+      if (count > buffer_size)
+      {
+         buffer_size = count;
+         buffer = hypre_TReAlloc(buffer, HYPRE_Complex, buffer_size, HYPRE_MEMORY_HOST);
+      }
+
+      k = 0;
+      if (i < local_nboxes)
+      {
+         hypre_ForBoxI(b, file_boxes)
+         {
+            file_box = hypre_BoxArrayBox(file_boxes, b);
+            hypre_IntersectBoxes(box, file_box, int_box);
+            if (hypre_BoxVolume(int_box) == 0)
+            {
+               continue;
+            }
+
+#ifdef HYPRE_SEQUENTIAL
+            /* read the intersection in contiguous runs, each of which covers
+               the leading dimensions 0 through r that span the whole file box */
+            for (r = 0; r < ndim - 1; r++)
+            {
+               if (hypre_BoxSizeD(int_box, r) != hypre_BoxSizeD(file_box, r))
+               {
+                  break;
+               }
+            }
+            run_len = 1;
+            for (d = 0; d <= r; d++)
+            {
+               run_len *= hypre_BoxSizeD(int_box, d);
+            }
+            nruns = hypre_BoxVolume(int_box) / run_len;
+            for (v = 0; v < nvar; v++)
+            {
+               base = file_offsets[b] + (hypre_MPI_Offset) v * hypre_BoxVolume(file_box) * csize;
+               for (j = 0; j < nruns; j++)
+               {
+                  tmp = j;
+                  frank = 0;
+                  fstride = 1;
+                  for (d = 0; d < ndim; d++)
+                  {
+                     hypre_IndexD(coord, d) = hypre_BoxIMinD(int_box, d);
+                     if (d > r)
+                     {
+                        hypre_IndexD(coord, d) += tmp % hypre_BoxSizeD(int_box, d);
+                        tmp /= hypre_BoxSizeD(int_box, d);
+                     }
+                     frank += (hypre_IndexD(coord, d) - hypre_BoxIMinD(file_box, d)) * fstride;
+                     fstride *= hypre_BoxSizeD(file_box, d);
+                  }
+                  ierr += hypre_MPI_File_read_at(fh, base + frank * (hypre_MPI_Offset) csize,
+                                                 buffer + k, run_len, hypre_MPI_COMPLEX,
+                                                 hypre_MPI_STATUS_IGNORE);
+                  k += run_len;
+               }
+            }
+#else
+            for (d = 0; d < ndim; d++)
+            {
+               sizes[d]    = hypre_BoxSizeD(file_box, d);
+               subsizes[d] = hypre_BoxSizeD(int_box, d);
+               starts[d]   = hypre_BoxIMinD(int_box, d) - hypre_BoxIMinD(file_box, d);
+            }
+            hypre_MPI_Type_create_subarray(ndim, sizes, subsizes, starts,
+                                           hypre_MPI_ORDER_FORTRAN, hypre_MPI_COMPLEX,
+                                           &sub_types[nsub]);
+            for (v = 0; v < nvar; v++)
+            {
+               piece_types[npieces]  = sub_types[nsub];
+               piece_lens[npieces]   = 1;
+               piece_displs[npieces] = (hypre_MPI_Aint)
+                                       (file_offsets[b] + (hypre_MPI_Offset) v * hypre_BoxVolume(file_box) * csize);
+               npieces++;
+            }
+            nsub++;
+#endif
+         }
+      }
+
+#ifndef HYPRE_SEQUENTIAL
+      if (npieces > 0)
+      {
+         hypre_MPI_Type_struct(npieces, piece_lens, piece_displs, piece_types, &file_type);
+         hypre_MPI_Type_commit(&file_type);
+      }
+      else
+      {
+         file_type = hypre_MPI_COMPLEX;
+      }
+      ierr += hypre_MPI_File_set_view(fh, 0, hypre_MPI_COMPLEX, file_type, "native",
+                                      hypre_MPI_INFO_NULL);
+      ierr += hypre_MPI_File_read_at_all(fh, 0, buffer, count, hypre_MPI_COMPLEX,
+                                         hypre_MPI_STATUS_IGNORE);
+      if (npieces > 0)
+      {
+         hypre_MPI_Type_free(&file_type);
+      }
+      for (j = 0; j < nsub; j++)
+      {
+         hypre_MPI_Type_free(&sub_types[j]);
+      }
+#endif
+
+      /* copy the intersections into the data array */
+      if (i < local_nboxes)
+      {
+         data_box = hypre_BoxArrayBox(data_space, i);
+         k = 0;
+         hypre_ForBoxI(b, file_boxes)
+         {
+            file_box = hypre_BoxArrayBox(file_boxes, b);
+            hypre_IntersectBoxes(box, file_box, int_box);
+            if (hypre_BoxVolume(int_box) == 0)
+            {
+               continue;
+            }
+            hypre_BoxGetSize(int_box, loop_size);
+
+            for (j = 0; j < num_values; j++)
+            {
+               if (value_const[j] == 0)
+               {
+                  HYPRE_Complex *datap = data + value_indices[i][j];
+                  HYPRE_Complex *bufp  = buffer + k;
+
+                  hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                            data_box, hypre_BoxIMin(int_box), stride, datai,
+                                            int_box, hypre_BoxIMin(int_box), stride, bufi);
+                  {
+                     datap[datai] = bufp[bufi];
+                  }
+                  hypre_SerialBoxLoop2End(datai, bufi);
+
+                  k += hypre_BoxVolume(int_box);
+               }
+            }
+         }
+      }
+   }
+
+   if (ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading binary input file");
+   }
+
+   hypre_MPI_File_close(&fh);
+
+   hypre_BoxDestroy(int_box);
+   hypre_BoxDestroy(bound_box);
+   hypre_BoxArrayDestroy(file_boxes);
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+   hypre_TFree(file_offsets, HYPRE_MEMORY_HOST);
+#ifndef HYPRE_SEQUENTIAL
+   hypre_TFree(sub_types, HYPRE_MEMORY_HOST);
+   hypre_TFree(piece_types, HYPRE_MEMORY_HOST);
+   hypre_TFree(piece_lens, HYPRE_MEMORY_HOST);
+   hypre_TFree(piece_displs, HYPRE_MEMORY_HOST);
+#endif
+   hypre_TFree(header, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
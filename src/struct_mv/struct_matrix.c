@@ -158,6 +158,24 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
 
    HYPRE_Int             i, j, d;
 
+   /*-----------------------------------------------------------------------
+    * Check that a matrix-free matrix is supported.  If not, report an error
+    * and store the coefficients as usual.
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      if ( hypre_StructMatrixSymmetric(matrix) ||
+           (hypre_StructMatrixConstantCoefficient(matrix) == 1) ||
+           (hypre_GetActualMemLocation(hypre_StructMatrixMemoryLocation(matrix)) !=
+            hypre_MEMORY_HOST) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Matrix-free matrices must be nonsymmetric, variable, and on the host");
+         hypre_StructMatrixCoeffFcn(matrix) = NULL;
+      }
+   }
+
    /*-----------------------------------------------------------------------
     * Set up stencil and num_values:
     *
@@ -412,6 +430,11 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
          data_size       = 0;
       }
 #endif
+      /* the variable coefficients of matrix-free matrices are not stored */
+      if (hypre_StructMatrixMatrixFree(matrix))
+      {
+         data_size = 0;
+      }
       hypre_StructMatrixDataSize(matrix)      = data_size;
       hypre_StructMatrixDataConstSize(matrix) = data_const_size;
 
@@ -582,6 +605,13 @@ hypre_StructMatrixSetValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   /* the variable coefficients of matrix-free matrices are not stored */
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't set values of a matrix-free matrix");
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
    symm_elements        = hypre_StructMatrixSymmElements(matrix);
 
@@ -736,6 +766,13 @@ hypre_StructMatrixSetBoxValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   /* the variable coefficients of matrix-free matrices are not stored */
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't set values of a matrix-free matrix");
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
    symm_elements        = hypre_StructMatrixSymmElements(matrix);
 
@@ -1085,6 +1122,13 @@ hypre_StructMatrixClearValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   /* the variable coefficients of matrix-free matrices are not stored */
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't clear values of a matrix-free matrix");
+      return hypre_error_flag;
+   }
+
    if (outside > 0)
    {
       grid_boxes = hypre_StructMatrixDataSpace(matrix);
@@ -1159,6 +1203,13 @@ hypre_StructMatrixClearBoxValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   /* the variable coefficients of matrix-free matrices are not stored */
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't clear values of a matrix-free matrix");
+      return hypre_error_flag;
+   }
+
    if (outside > 0)
    {
       grid_boxes = hypre_StructMatrixDataSpace(matrix);
@@ -1276,6 +1327,12 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient( matrix );
 
+   /* matrix-free matrices have no variable coefficient data to update */
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Set ghost zones along the domain boundary to the identity to enable code
     * simplifications elsewhere in hypre (e.g., CyclicReduction).
@@ -1551,6 +1608,137 @@ HYPRE_Int  hypre_StructMatrixSetConstantEntries( hypre_StructMatrix *matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixSetCoeffFcn
+ *
+ * Makes the matrix matrix-free: the variable coefficients are not stored, but
+ * evaluated by 'coeff_fcn' when needed.  Must be called before the matrix is
+ * initialized.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixSetCoeffFcn( hypre_StructMatrix         *matrix,
+                               HYPRE_StructMatrixCoeffFcn  coeff_fcn,
+                               void                       *coeff_data )
+{
+   if (hypre_StructMatrixStencil(matrix) != NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Coefficient function must be set before initializing the matrix");
+      return hypre_error_flag;
+   }
+
+   hypre_StructMatrixCoeffFcn(matrix)  = coeff_fcn;
+   hypre_StructMatrixCoeffData(matrix) = coeff_data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixEvalCoeffs
+ *
+ * Evaluates the coefficients of stencil entry 'entry' of a matrix-free matrix
+ * at the points of 'box'.  The values are stored in box order.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixEvalCoeffs( hypre_StructMatrix *matrix,
+                              HYPRE_Int           entry,
+                              hypre_Box          *box,
+                              HYPRE_Complex      *values )
+{
+   HYPRE_StructMatrixCoeffFcn  coeff_fcn = hypre_StructMatrixCoeffFcn(matrix);
+
+   if ((coeff_fcn)(hypre_StructMatrixCoeffData(matrix), entry,
+                   hypre_BoxIMin(box), hypre_BoxIMax(box), values))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Matrix coefficient function failed");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixCreateAssembled
+ *
+ * Returns a new assembled matrix that stores the coefficients of the
+ * matrix-free matrix 'matrix'.  As in the matrix-free matvec, coefficients
+ * that couple to points outside of the grid are zero.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixCreateAssembled( hypre_StructMatrix *matrix )
+{
+   HYPRE_Int             ndim          = hypre_StructMatrixNDim(matrix);
+   HYPRE_Int             ctecoef       = hypre_StructMatrixConstantCoefficient(matrix);
+   hypre_StructGrid     *grid          = hypre_StructMatrixGrid(matrix);
+   hypre_BoxArray       *grid_boxes    = hypre_StructGridBoxes(grid);
+   hypre_StructStencil  *stencil       = hypre_StructMatrixStencil(matrix);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size  = hypre_StructStencilSize(stencil);
+
+   hypre_StructMatrix   *new_matrix;
+   hypre_Box            *box, *data_box;
+   HYPRE_Complex        *values, *datap;
+   hypre_Index           loop_size, stride;
+   HYPRE_Int             max_volume, i, s;
+
+   new_matrix = hypre_StructMatrixCreate(hypre_StructMatrixComm(matrix), grid,
+                                         hypre_StructMatrixUserStencil(matrix));
+   hypre_StructMatrixSetNumGhost(new_matrix, hypre_StructMatrixNumGhost(matrix));
+   hypre_StructMatrixSetConstantCoefficient(new_matrix, ctecoef);
+   hypre_StructMatrixMemoryLocation(new_matrix) = hypre_StructMatrixMemoryLocation(matrix);
+   hypre_StructMatrixInitialize(new_matrix);
+
+   /* the constant coefficients are laid out the same way */
+   hypre_TMemcpy(hypre_StructMatrixDataConst(new_matrix), hypre_StructMatrixDataConst(matrix),
+                 HYPRE_Complex, hypre_StructMatrixDataConstSize(matrix),
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   max_volume = 0;
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      max_volume = hypre_max(max_volume, hypre_BoxVolume(hypre_BoxArrayBox(grid_boxes, i)));
+   }
+   values = hypre_TAlloc(HYPRE_Complex, max_volume, HYPRE_MEMORY_HOST);
+
+   hypre_SetIndex(stride, 1);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      box      = hypre_BoxArrayBox(grid_boxes, i);
+      data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(new_matrix), i);
+      hypre_BoxGetSize(box, loop_size);
+
+      for (s = 0; s < stencil_size; s++)
+      {
+         if ((ctecoef == 2) && !hypre_IndexEqual(stencil_shape[s], 0, ndim))
+         {
+            continue;
+         }
+
+         hypre_StructMatrixEvalCoeffs(matrix, s, box, values);
+
+         datap = hypre_StructMatrixBoxData(new_matrix, i, s);
+         hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                   data_box, hypre_BoxIMin(box), stride, datai,
+                                   box, hypre_BoxIMin(box), stride, vi);
+         {
+            datap[datai] = values[vi];
+         }
+         hypre_SerialBoxLoop2End(datai, vi);
+      }
+   }
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   if (ctecoef == 0)
+   {
+      hypre_StructMatrixClearBoundary(new_matrix);
+   }
+   hypre_StructMatrixAssemble(new_matrix);
+
+   return new_matrix;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1574,6 +1762,12 @@ hypre_StructMatrixClearGhostValues( hypre_StructMatrix *matrix )
 
    HYPRE_Int             i, j, s;
 
+   /* matrix-free matrices have no stored ghost values */
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------------------------
     * Set the matrix coefficients
     *-----------------------------------------------------------------------*/
@@ -1647,6 +1841,12 @@ hypre_StructMatrixPrintData( FILE               *file,
    HYPRE_Int             center_rank;
    HYPRE_Complex        *h_data;
 
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't print values of a matrix-free matrix");
+      return hypre_error_flag;
+   }
+
    /* Allocate/Point to data on the host memory */
    if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
    {
@@ -1960,6 +2160,238 @@ hypre_StructMatrixRead( MPI_Comm    comm,
    return matrix;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixPrintBinary
+ *
+ * Collectively writes the stored coefficients of the matrix on the grid boxes
+ * to a single binary file (see hypre_PrintBoxArrayDataBinary).  Constant
+ * coefficients are written once.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixPrintBinary( const char         *filename,
+                               hypre_StructMatrix *matrix )
+{
+   HYPRE_Int             ndim            = hypre_StructMatrixNDim(matrix);
+   HYPRE_Int             ctecoef         = hypre_StructMatrixConstantCoefficient(matrix);
+   hypre_StructGrid     *grid            = hypre_StructMatrixGrid(matrix);
+   hypre_BoxArray       *grid_boxes      = hypre_StructGridBoxes(grid);
+   hypre_StructStencil  *stencil         = hypre_StructMatrixStencil(matrix);
+   hypre_Index          *stencil_shape   = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size    = hypre_StructStencilSize(stencil);
+   HYPRE_Int            *symm_elements   = hypre_StructMatrixSymmElements(matrix);
+   hypre_BoxArray       *data_space      = hypre_StructMatrixDataSpace(matrix);
+   HYPRE_Int           **data_indices    = hypre_StructMatrixDataIndices(matrix);
+   HYPRE_Int             data_size       = hypre_StructMatrixDataSize(matrix);
+   HYPRE_Complex        *data            = hypre_StructMatrixData(matrix);
+   HYPRE_Complex        *data_const      = hypre_StructMatrixDataConst(matrix);
+   HYPRE_MemoryLocation  memory_location = hypre_StructMatrixMemoryLocation(matrix);
+
+   HYPRE_Int             nboxes = hypre_BoxArraySize(grid_boxes);
+   HYPRE_Int             num_values, i, j, s;
+   hypre_Index          *value_shapes;
+   HYPRE_Int            *value_const;
+   HYPRE_Int           **value_indices;
+   HYPRE_Complex        *const_values;
+   HYPRE_Complex        *h_data;
+
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't print values of a matrix-free matrix");
+      return hypre_error_flag;
+   }
+
+   /* Allocate/Point to data on the host memory */
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      h_data = hypre_CTAlloc(HYPRE_Complex, data_size, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(h_data, data, HYPRE_Complex, data_size,
+                    HYPRE_MEMORY_HOST, memory_location);
+   }
+   else
+   {
+      h_data = data;
+   }
+
+   /* Describe the stored coefficients */
+   value_shapes  = hypre_TAlloc(hypre_Index, stencil_size, HYPRE_MEMORY_HOST);
+   value_const   = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   const_values  = hypre_CTAlloc(HYPRE_Complex, stencil_size, HYPRE_MEMORY_HOST);
+   value_indices = hypre_TAlloc(HYPRE_Int *, nboxes + 1, HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      value_indices[i] = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   }
+
+   num_values = 0;
+   for (s = 0; s < stencil_size; s++)
+   {
+      if (symm_elements[s] < 0)
+      {
+         j = num_values++;
+         hypre_CopyIndex(stencil_shape[s], value_shapes[j]);
+         value_const[j] = (ctecoef == 1) ||
+                          (ctecoef == 2 && !hypre_IndexEqual(stencil_shape[s], 0, ndim));
+         if (value_const[j] && nboxes > 0)
+         {
+            const_values[j] = data_const[data_indices[0][s]];
+         }
+         hypre_ForBoxI(i, grid_boxes)
+         {
+            value_indices[i][j] = data_indices[i][s];
+         }
+      }
+   }
+
+   hypre_PrintBoxArrayDataBinary(hypre_StructMatrixComm(matrix), filename,
+                                 hypre_STRUCT_BINARY_MATRIX, ndim,
+                                 hypre_StructMatrixNumGhost(matrix),
+                                 hypre_StructMatrixSymmetric(matrix), ctecoef,
+                                 num_values, value_shapes, value_const, const_values,
+                                 grid_boxes, data_space, value_indices, h_data);
+
+   /* Free memory */
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      hypre_TFree(value_indices[i], HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(value_indices, HYPRE_MEMORY_HOST);
+   hypre_TFree(value_shapes, HYPRE_MEMORY_HOST);
+   hypre_TFree(value_const, HYPRE_MEMORY_HOST);
+   hypre_TFree(const_values, HYPRE_MEMORY_HOST);
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      hypre_TFree(h_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixReadBinary
+ *
+ * Collectively reads a file written by hypre_StructMatrixPrintBinary into an
+ * initialized matrix with the same stencil, symmetry, and constant
+ * coefficient type.  The matrix grid may be distributed differently than the
+ * one used to write the file.  Grid points not covered by the file are left
+ * unchanged.  The matrix is not assembled.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixReadBinary( const char         *filename,
+                              hypre_StructMatrix *matrix )
+{
+   HYPRE_Int             ndim            = hypre_StructMatrixNDim(matrix);
+   HYPRE_Int             ctecoef         = hypre_StructMatrixConstantCoefficient(matrix);
+   hypre_StructGrid     *grid            = hypre_StructMatrixGrid(matrix);
+   hypre_BoxArray       *grid_boxes      = hypre_StructGridBoxes(grid);
+   hypre_StructStencil  *stencil         = hypre_StructMatrixStencil(matrix);
+   hypre_Index          *stencil_shape   = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size    = hypre_StructStencilSize(stencil);
+   HYPRE_Int            *symm_elements   = hypre_StructMatrixSymmElements(matrix);
+   hypre_BoxArray       *data_space      = hypre_StructMatrixDataSpace(matrix);
+   HYPRE_Int           **data_indices    = hypre_StructMatrixDataIndices(matrix);
+   HYPRE_Int             data_size       = hypre_StructMatrixDataSize(matrix);
+   HYPRE_Complex        *data            = hypre_StructMatrixData(matrix);
+   HYPRE_Complex        *data_const      = hypre_StructMatrixDataConst(matrix);
+   HYPRE_MemoryLocation  memory_location = hypre_StructMatrixMemoryLocation(matrix);
+
+   HYPRE_Int             nboxes = hypre_BoxArraySize(grid_boxes);
+   HYPRE_Int             num_values, i, j, s;
+   hypre_Index          *value_shapes;
+   HYPRE_Int            *value_const;
+   HYPRE_Int            *value_stencil;
+   HYPRE_Int           **value_indices;
+   HYPRE_Complex        *const_values;
+   HYPRE_Complex        *h_data;
+
+   if (hypre_StructMatrixMatrixFree(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Can't read values of a matrix-free matrix");
+      return hypre_error_flag;
+   }
+
+   /* Copy data to the host memory, since it is only partially overwritten */
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      h_data = hypre_CTAlloc(HYPRE_Complex, data_size, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(h_data, data, HYPRE_Complex, data_size,
+                    HYPRE_MEMORY_HOST, memory_location);
+   }
+   else
+   {
+      h_data = data;
+   }
+
+   /* Describe the stored coefficients */
+   value_shapes  = hypre_TAlloc(hypre_Index, stencil_size, HYPRE_MEMORY_HOST);
+   value_const   = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   value_stencil = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   const_values  = hypre_CTAlloc(HYPRE_Complex, stencil_size, HYPRE_MEMORY_HOST);
+   value_indices = hypre_TAlloc(HYPRE_Int *, nboxes + 1, HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      value_indices[i] = hypre_TAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+   }
+
+   num_values = 0;
+   for (s = 0; s < stencil_size; s++)
+   {
+      if (symm_elements[s] < 0)
+      {
+         j = num_values++;
+         value_stencil[j] = s;
+         hypre_CopyIndex(stencil_shape[s], value_shapes[j]);
+         value_const[j] = (ctecoef == 1) ||
+                          (ctecoef == 2 && !hypre_IndexEqual(stencil_shape[s], 0, ndim));
+         hypre_ForBoxI(i, grid_boxes)
+         {
+            value_indices[i][j] = data_indices[i][s];
+         }
+      }
+   }
+
+   hypre_ReadBoxArrayDataBinary(hypre_StructMatrixComm(matrix), filename,
+                                hypre_STRUCT_BINARY_MATRIX, ndim,
+                                hypre_StructMatrixSymmetric(matrix), ctecoef,
+                                num_values, value_shapes, value_const, const_values,
+                                grid_boxes, data_space, value_indices, h_data);
+
+   /* Set the constant coefficients (data_const is always on the host) */
+   if (!hypre_error_flag)
+   {
+      for (j = 0; j < num_values; j++)
+      {
+         if (value_const[j])
+         {
+            hypre_ForBoxI(i, grid_boxes)
+            {
+               data_const[data_indices[i][value_stencil[j]]] = const_values[j];
+            }
+         }
+      }
+   }
+
+   /* Move data to the device memory if necessary and free host data */
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      hypre_TFree(value_indices[i], HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(value_indices, HYPRE_MEMORY_HOST);
+   hypre_TFree(value_shapes, HYPRE_MEMORY_HOST);
+   hypre_TFree(value_const, HYPRE_MEMORY_HOST);
+   hypre_TFree(value_stencil, HYPRE_MEMORY_HOST);
+   hypre_TFree(const_values, HYPRE_MEMORY_HOST);
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      hypre_TMemcpy(data, h_data, HYPRE_Complex, data_size,
+                    memory_location, HYPRE_MEMORY_HOST);
+      hypre_TFree(h_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatrixMigrate
  *--------------------------------------------------------------------------*/
@@ -54,6 +54,10 @@ typedef struct hypre_StructMatrix_struct
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   HYPRE_StructMatrixCoeffFcn coeff_fcn;            /* Evaluates the variable coefficients of
+                                                       matrix-free matrices (NULL otherwise) */
+   void                 *coeff_data;                /* User data passed to coeff_fcn */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
@@ -82,11 +86,16 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
+#define hypre_StructMatrixCoeffFcn(matrix)            ((matrix) -> coeff_fcn)
+#define hypre_StructMatrixCoeffData(matrix)           ((matrix) -> coeff_data)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
 
 #define hypre_StructMatrixNDim(matrix) \
 hypre_StructGridNDim(hypre_StructMatrixGrid(matrix))
 
+#define hypre_StructMatrixMatrixFree(matrix) \
+(hypre_StructMatrixCoeffFcn(matrix) != NULL)
+
 #define hypre_StructMatrixBox(matrix, b) \
 hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 
@@ -101,4 +110,7 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_CCBoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
 
+/* Object type stored in binary files (see hypre_PrintBoxArrayDataBinary) */
+#define hypre_STRUCT_BINARY_MATRIX 1
+
 #endif
@@ -20,6 +20,9 @@
 #endif
 #define MAX_DEPTH 7
 
+/* number of grid points per block in the matrix-free matvec */
+#define MF_TILE_SIZE 1024
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecData data structure
  *--------------------------------------------------------------------------*/
@@ -29,6 +32,7 @@ typedef struct
    hypre_StructMatrix  *A;
    hypre_StructVector  *x;
    hypre_ComputePkg    *compute_pkg;
+   HYPRE_Int            single_pass;  /* use hypre_StructMatvecCC0Stencil */
 
 } hypre_StructMatvecData;
 
@@ -71,7 +75,13 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    grid    = hypre_StructMatrixGrid(A);
    stencil = hypre_StructMatrixStencil(A);
 
+#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* starting persistent requests is cheap, so overlap the ghost exchange
+      with the box interiors */
+   hypre_CreateComputeInfoOverlap(grid, stencil, 1, &compute_info);
+#else
    hypre_CreateComputeInfo(grid, stencil, &compute_info);
+#endif
    hypre_ComputePkgCreate(compute_info, hypre_StructVectorDataSpace(x), 1,
                           grid, &compute_pkg);
 
@@ -83,6 +93,26 @@ hypre_StructMatvecSetup( void               *matvec_vdata,
    (matvec_data -> x)           = hypre_StructVectorRef(x);
    (matvec_data -> compute_pkg) = compute_pkg;
 
+   /*----------------------------------------------------------
+    * Choose a single-pass kernel for the common stencil sizes
+    *----------------------------------------------------------*/
+
+   (matvec_data -> single_pass) = 0;
+   if ((hypre_StructMatrixConstantCoefficient(A) == 0) &&
+       !hypre_StructMatrixMatrixFree(A))
+   {
+      switch (hypre_StructStencilSize(stencil))
+      {
+         case 5:
+         case 7:
+         case 9:
+         case 19:
+         case 27:
+            (matvec_data -> single_pass) = 1;
+            break;
+      }
+   }
+
    HYPRE_ANNOTATE_FUNC_END;
 
    return hypre_error_flag;
@@ -132,7 +162,10 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    HYPRE_ANNOTATE_FUNC_BEGIN;
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
-   if (constant_coefficient) { hypre_StructVectorClearBoundGhostValues(x, 0); }
+   if (constant_coefficient || hypre_StructMatrixMatrixFree(A))
+   {
+      hypre_StructVectorClearBoundGhostValues(x, 0);
+   }
 
    compute_pkg = (matvec_data -> compute_pkg);
 
@@ -145,6 +178,9 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    if (alpha == 0.0)
    {
       boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel for private(box,start,y_data_box,yp,loop_size) if (hypre_BoxArrayBoxThreads(boxes)) schedule(dynamic, 1)
+#endif
       hypre_ForBoxI(i, boxes)
       {
          box   = hypre_BoxArrayBox(boxes, i);
@@ -204,6 +240,9 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
             if (temp != 1.0)
             {
                boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+#ifdef HYPRE_USING_OPENMP
+               #pragma omp parallel for private(box,start,y_data_box,yp,loop_size) if (hypre_BoxArrayBoxThreads(boxes)) schedule(dynamic, 1)
+#endif
                hypre_ForBoxI(i, boxes)
                {
                   box   = hypre_BoxArrayBox(boxes, i);
@@ -254,11 +293,29 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
        * y += A*x
        *--------------------------------------------------------------------*/
 
+      if (hypre_StructMatrixMatrixFree(A))
+      {
+         hypre_StructMatvecMF( alpha, A, x, y, compute_box_aa, stride );
+         continue;
+      }
+
+      /* With box-level threading, the kernels below are called by all threads
+       * and share out their loops over boxes (see hypre_StructMatvecCC0) */
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel if (hypre_BoxArrayBoxThreads(hypre_StructGridBoxes(hypre_StructMatrixGrid(A))))
+#endif
       switch ( constant_coefficient )
       {
          case 0:
          {
-            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            if (matvec_data -> single_pass)
+            {
+               hypre_StructMatvecCC0Stencil( alpha, A, x, y, compute_box_aa, stride );
+            }
+            else
+            {
+               hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
          case 1:
@@ -290,6 +347,11 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
  * hypre_StructMatvecCC0
  * core of struct matvec computation, for the case constant_coefficient==0
  * (all coefficients are variable)
+ *
+ * The loop over boxes is an orphaned OpenMP work-sharing loop: when called
+ * from within a parallel region (box-level threading), the boxes are shared
+ * out among the threads; otherwise, one thread does all boxes.  The same
+ * holds for the other kernels below except hypre_StructMatvecMF.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
@@ -337,6 +399,9 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
    stencil_size  = hypre_StructStencilSize(stencil);
    ndim          = hypre_StructVectorNDim(x);
 
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp for schedule(dynamic, 1)
+#endif
    hypre_ForBoxArrayI(i, compute_box_aa)
    {
       compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -605,6 +670,384 @@ HYPRE_Int hypre_StructMatvecCC0( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecCC0Stencil
+ * core of struct matvec computation, for the case constant_coefficient==0
+ * and one of the common stencil sizes (5, 7, 9, 19 or 27).  All stencil
+ * entries and the alpha scaling are applied in a single pass over y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_StructMatvecCC0Stencil( HYPRE_Complex       alpha,
+                                        hypre_StructMatrix *A,
+                                        hypre_StructVector *x,
+                                        hypre_StructVector *y,
+                                        hypre_BoxArrayArray     *compute_box_aa,
+                                        hypre_IndexRef           stride
+                                      )
+{
+   HYPRE_Int i, j, si;
+   HYPRE_Complex           *Ap0 = NULL;
+   HYPRE_Complex           *Ap1 = NULL;
+   HYPRE_Complex           *Ap2 = NULL;
+   HYPRE_Complex           *Ap3 = NULL;
+   HYPRE_Complex           *Ap4 = NULL;
+   HYPRE_Complex           *Ap5 = NULL;
+   HYPRE_Complex           *Ap6 = NULL;
+   HYPRE_Complex           *Ap7 = NULL;
+   HYPRE_Complex           *Ap8 = NULL;
+   HYPRE_Complex           *Ap9 = NULL;
+   HYPRE_Complex           *Ap10 = NULL;
+   HYPRE_Complex           *Ap11 = NULL;
+   HYPRE_Complex           *Ap12 = NULL;
+   HYPRE_Complex           *Ap13 = NULL;
+   HYPRE_Complex           *Ap14 = NULL;
+   HYPRE_Complex           *Ap15 = NULL;
+   HYPRE_Complex           *Ap16 = NULL;
+   HYPRE_Complex           *Ap17 = NULL;
+   HYPRE_Complex           *Ap18 = NULL;
+   HYPRE_Complex           *Ap19 = NULL;
+   HYPRE_Complex           *Ap20 = NULL;
+   HYPRE_Complex           *Ap21 = NULL;
+   HYPRE_Complex           *Ap22 = NULL;
+   HYPRE_Complex           *Ap23 = NULL;
+   HYPRE_Complex           *Ap24 = NULL;
+   HYPRE_Complex           *Ap25 = NULL;
+   HYPRE_Complex           *Ap26 = NULL;
+   HYPRE_Int                xoff0 = 0;
+   HYPRE_Int                xoff1 = 0;
+   HYPRE_Int                xoff2 = 0;
+   HYPRE_Int                xoff3 = 0;
+   HYPRE_Int                xoff4 = 0;
+   HYPRE_Int                xoff5 = 0;
+   HYPRE_Int                xoff6 = 0;
+   HYPRE_Int                xoff7 = 0;
+   HYPRE_Int                xoff8 = 0;
+   HYPRE_Int                xoff9 = 0;
+   HYPRE_Int                xoff10 = 0;
+   HYPRE_Int                xoff11 = 0;
+   HYPRE_Int                xoff12 = 0;
+   HYPRE_Int                xoff13 = 0;
+   HYPRE_Int                xoff14 = 0;
+   HYPRE_Int                xoff15 = 0;
+   HYPRE_Int                xoff16 = 0;
+   HYPRE_Int                xoff17 = 0;
+   HYPRE_Int                xoff18 = 0;
+   HYPRE_Int                xoff19 = 0;
+   HYPRE_Int                xoff20 = 0;
+   HYPRE_Int                xoff21 = 0;
+   HYPRE_Int                xoff22 = 0;
+   HYPRE_Int                xoff23 = 0;
+   HYPRE_Int                xoff24 = 0;
+   HYPRE_Int                xoff25 = 0;
+   HYPRE_Int                xoff26 = 0;
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+
+   hypre_Box               *y_data_box;
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   if (stencil_size != 5  && stencil_size != 7  && stencil_size != 9 &&
+       stencil_size != 19 && stencil_size != 27)
+   {
+      return hypre_StructMatvecCC0(alpha, A, x, y, compute_box_aa, stride);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp for schedule(dynamic, 1)
+#endif
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      /* set the pointers and offsets for all stencil entries */
+      for (si = 0; si < stencil_size; si++)
+      {
+         switch (si)
+         {
+            case 0:
+               Ap0 = hypre_StructMatrixBoxData(A, i, 0);
+               xoff0 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[0]);
+               break;
+            case 1:
+               Ap1 = hypre_StructMatrixBoxData(A, i, 1);
+               xoff1 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[1]);
+               break;
+            case 2:
+               Ap2 = hypre_StructMatrixBoxData(A, i, 2);
+               xoff2 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[2]);
+               break;
+            case 3:
+               Ap3 = hypre_StructMatrixBoxData(A, i, 3);
+               xoff3 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[3]);
+               break;
+            case 4:
+               Ap4 = hypre_StructMatrixBoxData(A, i, 4);
+               xoff4 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[4]);
+               break;
+            case 5:
+               Ap5 = hypre_StructMatrixBoxData(A, i, 5);
+               xoff5 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[5]);
+               break;
+            case 6:
+               Ap6 = hypre_StructMatrixBoxData(A, i, 6);
+               xoff6 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[6]);
+               break;
+            case 7:
+               Ap7 = hypre_StructMatrixBoxData(A, i, 7);
+               xoff7 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[7]);
+               break;
+            case 8:
+               Ap8 = hypre_StructMatrixBoxData(A, i, 8);
+               xoff8 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[8]);
+               break;
+            case 9:
+               Ap9 = hypre_StructMatrixBoxData(A, i, 9);
+               xoff9 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[9]);
+               break;
+            case 10:
+               Ap10 = hypre_StructMatrixBoxData(A, i, 10);
+               xoff10 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[10]);
+               break;
+            case 11:
+               Ap11 = hypre_StructMatrixBoxData(A, i, 11);
+               xoff11 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[11]);
+               break;
+            case 12:
+               Ap12 = hypre_StructMatrixBoxData(A, i, 12);
+               xoff12 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[12]);
+               break;
+            case 13:
+               Ap13 = hypre_StructMatrixBoxData(A, i, 13);
+               xoff13 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[13]);
+               break;
+            case 14:
+               Ap14 = hypre_StructMatrixBoxData(A, i, 14);
+               xoff14 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[14]);
+               break;
+            case 15:
+               Ap15 = hypre_StructMatrixBoxData(A, i, 15);
+               xoff15 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[15]);
+               break;
+            case 16:
+               Ap16 = hypre_StructMatrixBoxData(A, i, 16);
+               xoff16 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[16]);
+               break;
+            case 17:
+               Ap17 = hypre_StructMatrixBoxData(A, i, 17);
+               xoff17 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[17]);
+               break;
+            case 18:
+               Ap18 = hypre_StructMatrixBoxData(A, i, 18);
+               xoff18 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[18]);
+               break;
+            case 19:
+               Ap19 = hypre_StructMatrixBoxData(A, i, 19);
+               xoff19 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[19]);
+               break;
+            case 20:
+               Ap20 = hypre_StructMatrixBoxData(A, i, 20);
+               xoff20 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[20]);
+               break;
+            case 21:
+               Ap21 = hypre_StructMatrixBoxData(A, i, 21);
+               xoff21 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[21]);
+               break;
+            case 22:
+               Ap22 = hypre_StructMatrixBoxData(A, i, 22);
+               xoff22 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[22]);
+               break;
+            case 23:
+               Ap23 = hypre_StructMatrixBoxData(A, i, 23);
+               xoff23 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[23]);
+               break;
+            case 24:
+               Ap24 = hypre_StructMatrixBoxData(A, i, 24);
+               xoff24 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[24]);
+               break;
+            case 25:
+               Ap25 = hypre_StructMatrixBoxData(A, i, 25);
+               xoff25 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[25]);
+               break;
+            case 26:
+               Ap26 = hypre_StructMatrixBoxData(A, i, 26);
+               xoff26 = hypre_BoxOffsetDistance(x_data_box, stencil_shape[26]);
+               break;
+         }
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start  = hypre_BoxIMin(compute_box);
+
+         switch (stencil_size)
+         {
+            case 5:
+#define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,xp)
+               hypre_BoxLoop3Begin(ndim, loop_size,
+                                   A_data_box, start, stride, Ai,
+                                   x_data_box, start, stride, xi,
+                                   y_data_box, start, stride, yi);
+               {
+                  yp[yi] = alpha * (yp[yi] +
+                                    Ap0[Ai] * xp[xi + xoff0] +
+                                    Ap1[Ai] * xp[xi + xoff1] +
+                                    Ap2[Ai] * xp[xi + xoff2] +
+                                    Ap3[Ai] * xp[xi + xoff3] +
+                                    Ap4[Ai] * xp[xi + xoff4]);
+               }
+               hypre_BoxLoop3End(Ai, xi, yi);
+#undef DEVICE_VAR
+               break;
+
+            case 7:
+#define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,xp)
+               hypre_BoxLoop3Begin(ndim, loop_size,
+                                   A_data_box, start, stride, Ai,
+                                   x_data_box, start, stride, xi,
+                                   y_data_box, start, stride, yi);
+               {
+                  yp[yi] = alpha * (yp[yi] +
+                                    Ap0[Ai] * xp[xi + xoff0] +
+                                    Ap1[Ai] * xp[xi + xoff1] +
+                                    Ap2[Ai] * xp[xi + xoff2] +
+                                    Ap3[Ai] * xp[xi + xoff3] +
+                                    Ap4[Ai] * xp[xi + xoff4] +
+                                    Ap5[Ai] * xp[xi + xoff5] +
+                                    Ap6[Ai] * xp[xi + xoff6]);
+               }
+               hypre_BoxLoop3End(Ai, xi, yi);
+#undef DEVICE_VAR
+               break;
+
+            case 9:
+#define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,Ap7,Ap8,xp)
+               hypre_BoxLoop3Begin(ndim, loop_size,
+                                   A_data_box, start, stride, Ai,
+                                   x_data_box, start, stride, xi,
+                                   y_data_box, start, stride, yi);
+               {
+                  yp[yi] = alpha * (yp[yi] +
+                                    Ap0[Ai] * xp[xi + xoff0] +
+                                    Ap1[Ai] * xp[xi + xoff1] +
+                                    Ap2[Ai] * xp[xi + xoff2] +
+                                    Ap3[Ai] * xp[xi + xoff3] +
+                                    Ap4[Ai] * xp[xi + xoff4] +
+                                    Ap5[Ai] * xp[xi + xoff5] +
+                                    Ap6[Ai] * xp[xi + xoff6] +
+                                    Ap7[Ai] * xp[xi + xoff7] +
+                                    Ap8[Ai] * xp[xi + xoff8]);
+               }
+               hypre_BoxLoop3End(Ai, xi, yi);
+#undef DEVICE_VAR
+               break;
+
+            case 19:
+#define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,Ap7,Ap8, \
+                                  Ap9,Ap10,Ap11,Ap12,Ap13,Ap14,Ap15,Ap16,Ap17,Ap18, \
+                                  xp)
+               hypre_BoxLoop3Begin(ndim, loop_size,
+                                   A_data_box, start, stride, Ai,
+                                   x_data_box, start, stride, xi,
+                                   y_data_box, start, stride, yi);
+               {
+                  yp[yi] = alpha * (yp[yi] +
+                                    Ap0[Ai] * xp[xi + xoff0] +
+                                    Ap1[Ai] * xp[xi + xoff1] +
+                                    Ap2[Ai] * xp[xi + xoff2] +
+                                    Ap3[Ai] * xp[xi + xoff3] +
+                                    Ap4[Ai] * xp[xi + xoff4] +
+                                    Ap5[Ai] * xp[xi + xoff5] +
+                                    Ap6[Ai] * xp[xi + xoff6] +
+                                    Ap7[Ai] * xp[xi + xoff7] +
+                                    Ap8[Ai] * xp[xi + xoff8] +
+                                    Ap9[Ai] * xp[xi + xoff9] +
+                                    Ap10[Ai] * xp[xi + xoff10] +
+                                    Ap11[Ai] * xp[xi + xoff11] +
+                                    Ap12[Ai] * xp[xi + xoff12] +
+                                    Ap13[Ai] * xp[xi + xoff13] +
+                                    Ap14[Ai] * xp[xi + xoff14] +
+                                    Ap15[Ai] * xp[xi + xoff15] +
+                                    Ap16[Ai] * xp[xi + xoff16] +
+                                    Ap17[Ai] * xp[xi + xoff17] +
+                                    Ap18[Ai] * xp[xi + xoff18]);
+               }
+               hypre_BoxLoop3End(Ai, xi, yi);
+#undef DEVICE_VAR
+               break;
+
+            case 27:
+#define DEVICE_VAR is_device_ptr(yp,Ap0,Ap1,Ap2,Ap3,Ap4,Ap5,Ap6,Ap7,Ap8, \
+                                  Ap9,Ap10,Ap11,Ap12,Ap13,Ap14,Ap15,Ap16,Ap17,Ap18, \
+                                  Ap19,Ap20,Ap21,Ap22,Ap23,Ap24,Ap25,Ap26,xp)
+               hypre_BoxLoop3Begin(ndim, loop_size,
+                                   A_data_box, start, stride, Ai,
+                                   x_data_box, start, stride, xi,
+                                   y_data_box, start, stride, yi);
+               {
+                  yp[yi] = alpha * (yp[yi] +
+                                    Ap0[Ai] * xp[xi + xoff0] +
+                                    Ap1[Ai] * xp[xi + xoff1] +
+                                    Ap2[Ai] * xp[xi + xoff2] +
+                                    Ap3[Ai] * xp[xi + xoff3] +
+                                    Ap4[Ai] * xp[xi + xoff4] +
+                                    Ap5[Ai] * xp[xi + xoff5] +
+                                    Ap6[Ai] * xp[xi + xoff6] +
+                                    Ap7[Ai] * xp[xi + xoff7] +
+                                    Ap8[Ai] * xp[xi + xoff8] +
+                                    Ap9[Ai] * xp[xi + xoff9] +
+                                    Ap10[Ai] * xp[xi + xoff10] +
+                                    Ap11[Ai] * xp[xi + xoff11] +
+                                    Ap12[Ai] * xp[xi + xoff12] +
+                                    Ap13[Ai] * xp[xi + xoff13] +
+                                    Ap14[Ai] * xp[xi + xoff14] +
+                                    Ap15[Ai] * xp[xi + xoff15] +
+                                    Ap16[Ai] * xp[xi + xoff16] +
+                                    Ap17[Ai] * xp[xi + xoff17] +
+                                    Ap18[Ai] * xp[xi + xoff18] +
+                                    Ap19[Ai] * xp[xi + xoff19] +
+                                    Ap20[Ai] * xp[xi + xoff20] +
+                                    Ap21[Ai] * xp[xi + xoff21] +
+                                    Ap22[Ai] * xp[xi + xoff22] +
+                                    Ap23[Ai] * xp[xi + xoff23] +
+                                    Ap24[Ai] * xp[xi + xoff24] +
+                                    Ap25[Ai] * xp[xi + xoff25] +
+                                    Ap26[Ai] * xp[xi + xoff26]);
+               }
+               hypre_BoxLoop3End(Ai, xi, yi);
+#undef DEVICE_VAR
+               break;
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecCC1
  * core of struct matvec computation, for the case constant_coefficient==1
@@ -663,6 +1106,9 @@ HYPRE_Int hypre_StructMatvecCC1( HYPRE_Complex       alpha,
    stencil_size  = hypre_StructStencilSize(stencil);
    ndim          = hypre_StructVectorNDim(x);
 
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp for schedule(dynamic, 1)
+#endif
    hypre_ForBoxArrayI(i, compute_box_aa)
    {
       compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -994,6 +1440,9 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
    stencil_size  = hypre_StructStencilSize(stencil);
    ndim          = hypre_StructVectorNDim(x);
 
+#ifdef HYPRE_USING_OPENMP
+   #pragma omp for schedule(dynamic, 1)
+#endif
    hypre_ForBoxArrayI(i, compute_box_aa)
    {
       compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
@@ -1381,6 +1830,153 @@ HYPRE_Int hypre_StructMatvecCC2( HYPRE_Complex       alpha,
 }
 
 
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecMF
+ * core of struct matvec computation for matrix-free matrices
+ * (constant_coefficient==0 or 2).  Each compute box is split into blocks of
+ * at most MF_TILE_SIZE points, and the variable coefficients are evaluated
+ * one stencil entry at a time on each block, so only the vectors are
+ * streamed from memory.  Assumes unit stride.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_StructMatvecMF( HYPRE_Complex       alpha,
+                                hypre_StructMatrix *A,
+                                hypre_StructVector *x,
+                                hypre_StructVector *y,
+                                hypre_BoxArrayArray     *compute_box_aa,
+                                hypre_IndexRef           stride
+                              )
+{
+   HYPRE_Int                ndim          = hypre_StructVectorNDim(x);
+   HYPRE_Int                ctecoef       = hypre_StructMatrixConstantCoefficient(A);
+   hypre_StructStencil     *stencil       = hypre_StructMatrixStencil(A);
+   hypre_Index             *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int                stencil_size  = hypre_StructStencilSize(stencil);
+
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+   hypre_Box               *tile;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   HYPRE_Complex           *Ap;
+   HYPRE_Complex           *acc;
+   HYPRE_Complex            Aconst;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                xoff, plane, chunk, nchunks, ntiles, rem;
+   HYPRE_Int                i, j, k, d, s, t, ti;
+
+   Ap   = hypre_TAlloc(HYPRE_Complex, MF_TILE_SIZE, HYPRE_MEMORY_HOST);
+   acc  = hypre_TAlloc(HYPRE_Complex, MF_TILE_SIZE, HYPRE_MEMORY_HOST);
+   tile = hypre_BoxCreate(ndim);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+         if (hypre_BoxVolume(compute_box) == 0)
+         {
+            continue;
+         }
+
+         /* Blocks span dimensions 0 to k-1, and are chunked in dimension k */
+         plane = 1;
+         for (k = 0; k < ndim - 1; k++)
+         {
+            if (plane * hypre_BoxSizeD(compute_box, k) > MF_TILE_SIZE)
+            {
+               break;
+            }
+            plane *= hypre_BoxSizeD(compute_box, k);
+         }
+         chunk   = hypre_min(hypre_max(MF_TILE_SIZE / plane, 1), hypre_BoxSizeD(compute_box, k));
+         nchunks = (hypre_BoxSizeD(compute_box, k) + chunk - 1) / chunk;
+         ntiles  = nchunks;
+         for (d = k + 1; d < ndim; d++)
+         {
+            ntiles *= hypre_BoxSizeD(compute_box, d);
+         }
+
+         for (t = 0; t < ntiles; t++)
+         {
+            hypre_CopyBox(compute_box, tile);
+            rem = t;
+            hypre_BoxIMinD(tile, k) += (rem % nchunks) * chunk;
+            hypre_BoxIMaxD(tile, k) = hypre_min(hypre_BoxIMinD(tile, k) + chunk - 1,
+                                                hypre_BoxIMaxD(compute_box, k));
+            rem /= nchunks;
+            for (d = k + 1; d < ndim; d++)
+            {
+               hypre_BoxIMinD(tile, d) += rem % hypre_BoxSizeD(compute_box, d);
+               hypre_BoxIMaxD(tile, d) = hypre_BoxIMinD(tile, d);
+               rem /= hypre_BoxSizeD(compute_box, d);
+            }
+
+            hypre_BoxGetSize(tile, loop_size);
+            start = hypre_BoxIMin(tile);
+
+            for (ti = 0; ti < hypre_BoxVolume(tile); ti++)
+            {
+               acc[ti] = 0.0;
+            }
+
+            for (s = 0; s < stencil_size; s++)
+            {
+               xoff = hypre_BoxOffsetDistance(x_data_box, stencil_shape[s]);
+
+               if ((ctecoef == 2) && !hypre_IndexEqual(stencil_shape[s], 0, ndim))
+               {
+                  Aconst = *hypre_StructMatrixBoxData(A, i, s);
+                  hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                            tile, start, stride, ai,
+                                            x_data_box, start, stride, xi);
+                  {
+                     acc[ai] += Aconst * xp[xi + xoff];
+                  }
+                  hypre_SerialBoxLoop2End(ai, xi);
+               }
+               else
+               {
+                  hypre_StructMatrixEvalCoeffs(A, s, tile, Ap);
+                  hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                            tile, start, stride, ai,
+                                            x_data_box, start, stride, xi);
+                  {
+                     acc[ai] += Ap[ai] * xp[xi + xoff];
+                  }
+                  hypre_SerialBoxLoop2End(ai, xi);
+               }
+            }
+
+            hypre_SerialBoxLoop2Begin(ndim, loop_size,
+                                      tile, start, stride, ai,
+                                      y_data_box, start, stride, yi);
+            {
+               yp[yi] = alpha * (yp[yi] + acc[ai]);
+            }
+            hypre_SerialBoxLoop2End(ai, yi);
+         }
+      }
+   }
+
+   hypre_BoxDestroy(tile);
+   hypre_TFree(Ap, HYPRE_MEMORY_HOST);
+   hypre_TFree(acc, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_StructMatvecDestroy
  *--------------------------------------------------------------------------*/
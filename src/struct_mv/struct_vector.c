@@ -1277,6 +1277,135 @@ hypre_StructVectorRead( MPI_Comm    comm,
    return vector;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorPrintBinary
+ *
+ * Collectively writes the grid box data of the vector to a single binary file
+ * (see hypre_PrintBoxArrayDataBinary).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorPrintBinary( const char         *filename,
+                               hypre_StructVector *vector )
+{
+   HYPRE_Int            ndim            = hypre_StructVectorNDim(vector);
+   hypre_StructGrid    *grid            = hypre_StructVectorGrid(vector);
+   hypre_BoxArray      *grid_boxes      = hypre_StructGridBoxes(grid);
+   hypre_BoxArray      *data_space      = hypre_StructVectorDataSpace(vector);
+   HYPRE_Int           *data_indices    = hypre_StructVectorDataIndices(vector);
+   HYPRE_Int            data_size       = hypre_StructVectorDataSize(vector);
+   HYPRE_Complex       *data            = hypre_StructVectorData(vector);
+   HYPRE_MemoryLocation memory_location = hypre_StructVectorMemoryLocation(vector);
+
+   HYPRE_Int          **value_indices;
+   HYPRE_Complex       *h_data;
+   hypre_Index          value_shape;
+   HYPRE_Int            value_const = 0;
+   HYPRE_Complex        const_value = 0.0;
+   HYPRE_Int            i;
+
+   /* Allocate/Point to data on the host memory */
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      h_data = hypre_CTAlloc(HYPRE_Complex, data_size, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(h_data, data, HYPRE_Complex, data_size,
+                    HYPRE_MEMORY_HOST, memory_location);
+   }
+   else
+   {
+      h_data = data;
+   }
+
+   value_indices = hypre_TAlloc(HYPRE_Int *, hypre_BoxArraySize(grid_boxes) + 1,
+                                HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      value_indices[i] = &data_indices[i];
+   }
+   hypre_SetIndex(value_shape, 0);
+
+   hypre_PrintBoxArrayDataBinary(hypre_StructVectorComm(vector), filename,
+                                 hypre_STRUCT_BINARY_VECTOR, ndim,
+                                 hypre_StructVectorNumGhost(vector), 0, 0,
+                                 1, &value_shape, &value_const, &const_value,
+                                 grid_boxes, data_space, value_indices, h_data);
+
+   /* Free memory */
+   hypre_TFree(value_indices, HYPRE_MEMORY_HOST);
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      hypre_TFree(h_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorReadBinary
+ *
+ * Collectively reads a file written by hypre_StructVectorPrintBinary into an
+ * initialized vector.  The vector grid may be distributed differently than
+ * the one used to write the file.  Grid points not covered by the file are
+ * left unchanged.  The vector is not assembled.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorReadBinary( const char         *filename,
+                              hypre_StructVector *vector )
+{
+   HYPRE_Int            ndim            = hypre_StructVectorNDim(vector);
+   hypre_StructGrid    *grid            = hypre_StructVectorGrid(vector);
+   hypre_BoxArray      *grid_boxes      = hypre_StructGridBoxes(grid);
+   hypre_BoxArray      *data_space      = hypre_StructVectorDataSpace(vector);
+   HYPRE_Int           *data_indices    = hypre_StructVectorDataIndices(vector);
+   HYPRE_Int            data_size       = hypre_StructVectorDataSize(vector);
+   HYPRE_Complex       *data            = hypre_StructVectorData(vector);
+   HYPRE_MemoryLocation memory_location = hypre_StructVectorMemoryLocation(vector);
+
+   HYPRE_Int          **value_indices;
+   HYPRE_Complex       *h_data;
+   hypre_Index          value_shape;
+   HYPRE_Int            value_const = 0;
+   HYPRE_Complex        const_value;
+   HYPRE_Int            i;
+
+   /* Copy data to the host memory, since it is only partially overwritten */
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      h_data = hypre_CTAlloc(HYPRE_Complex, data_size, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(h_data, data, HYPRE_Complex, data_size,
+                    HYPRE_MEMORY_HOST, memory_location);
+   }
+   else
+   {
+      h_data = data;
+   }
+
+   value_indices = hypre_TAlloc(HYPRE_Int *, hypre_BoxArraySize(grid_boxes) + 1,
+                                HYPRE_MEMORY_HOST);
+   hypre_ForBoxI(i, grid_boxes)
+   {
+      value_indices[i] = &data_indices[i];
+   }
+   hypre_SetIndex(value_shape, 0);
+
+   hypre_ReadBoxArrayDataBinary(hypre_StructVectorComm(vector), filename,
+                                hypre_STRUCT_BINARY_VECTOR, ndim, 0, 0,
+                                1, &value_shape, &value_const, &const_value,
+                                grid_boxes, data_space, value_indices, h_data);
+
+   /* Move data to the device memory if necessary and free host data */
+   hypre_TFree(value_indices, HYPRE_MEMORY_HOST);
+   if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+   {
+      hypre_TMemcpy(data, h_data, HYPRE_Complex, data_size,
+                    memory_location, HYPRE_MEMORY_HOST);
+      hypre_TFree(h_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * The following is used only as a debugging aid.
  *
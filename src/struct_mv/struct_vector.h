@@ -75,4 +75,7 @@ hypre_BoxArrayBox(hypre_StructVectorDataSpace(vector), b)
 (hypre_StructVectorBoxData(vector, b) + \
  hypre_BoxIndexRank(hypre_StructVectorBox(vector, b), index))
 
+/* Object type stored in binary files (see hypre_PrintBoxArrayDataBinary) */
+#define hypre_STRUCT_BINARY_VECTOR 0
+
 #endif
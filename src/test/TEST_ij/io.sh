@@ -8,6 +8,29 @@ TNAME=`basename $0 .sh`
 RTOL=$1
 ATOL=$2
 
+#=============================================================================
+# Reading an MPI-IO file on any number of processes reproduces the solve
+#=============================================================================
+
+tail -3 ${TNAME}.out.200 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.201 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+tail -3 ${TNAME}.out.202 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# The same holds for Matrix Market files
+#=============================================================================
+
+tail -3 ${TNAME}.out.300 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.301 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+tail -3 ${TNAME}.out.302 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.303 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+
 FILES="\
  ${TNAME}.out.0\
  ${TNAME}.out.1\
@@ -21,6 +44,13 @@ FILES="\
  ${TNAME}.out.103\
  ${TNAME}.out.150\
  ${TNAME}.out.151\
+ ${TNAME}.out.200\
+ ${TNAME}.out.201\
+ ${TNAME}.out.202\
+ ${TNAME}.out.300\
+ ${TNAME}.out.301\
+ ${TNAME}.out.302\
+ ${TNAME}.out.303\
 "
 
 for i in $FILES
@@ -41,3 +71,4 @@ fi
 #=============================================================================
 
 rm -rf IJ.out.A.0000?.bin IJ.out.b.0000?.bin IJ.out.x0.0000?.bin IJ.out.x.0000?.bin
+rm -f IJ.out.A.mpiio IJ.out.A.mtx ${TNAME}.testdata*
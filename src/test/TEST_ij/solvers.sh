@@ -32,6 +32,26 @@ tail -17 ${TNAME}.out.200 | head -6 > ${TNAME}.mgr_testdata
 tail -17 ${TNAME}.out.202 | head -6 > ${TNAME}.mgr_testdata.temp
 diff ${TNAME}.mgr_testdata ${TNAME}.mgr_testdata.temp >&2
 
+#=============================================================================
+# IJ: Hybrid with and without the cost model should be the same when the
+#     diagonally scaled solver converges
+#=============================================================================
+
+tail -5 ${TNAME}.out.8 > ${TNAME}.hybrid_testdata
+tail -5 ${TNAME}.out.124 > ${TNAME}.hybrid_testdata.temp
+diff ${TNAME}.hybrid_testdata ${TNAME}.hybrid_testdata.temp >&2
+
+#=============================================================================
+# IJ: With the cost model, a second solve with the same matrix reuses the AMG
+#     setup and skips the diagonally scaled solver (out.126); after the values
+#     of the matrix change, the diagonally scaled solver runs again (out.127)
+#=============================================================================
+
+grep "DSCG_Iterations = 0" ${TNAME}.out.126 > /dev/null || \
+   echo "Hybrid did not reuse the AMG setup in ${TNAME}.out.126" >&2
+grep "DSCG_Iterations = 0" ${TNAME}.out.127 > /dev/null && \
+   echo "Hybrid reused a stale AMG setup in ${TNAME}.out.127" >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -79,7 +99,9 @@ FILES="\
  ${TNAME}.out.23\
  ${TNAME}.out.24\
  ${TNAME}.out.25\
- ${TNAME}.out.26
+ ${TNAME}.out.26\
+ ${TNAME}.out.126\
+ ${TNAME}.out.127\
 "
 
 for i in $FILES
@@ -141,6 +163,8 @@ FILES="\
  ${TNAME}.out.121\
  ${TNAME}.out.122\
  ${TNAME}.out.120\
+ ${TNAME}.out.123\
+ ${TNAME}.out.125\
 "
 
 for i in $FILES
@@ -197,3 +221,4 @@ cat ${TNAME}.out.[a-z] > ${TNAME}.out
 
 rm -f ${TNAME}.testdata*
 rm -r ${TNAME}.mgr_testdata*
+rm -f ${TNAME}.hybrid_testdata*
@@ -49,6 +49,28 @@ if [ "$OUTCOUNT" != "$RUNCOUNT" ]; then
    echo "Incorrect number of runs in ${TNAME}.out.b" >&2
 fi
 
+#=============================================================================
+# contiguous multivectors must give the same eigenvalues
+#=============================================================================
+
+for i in 1 2
+do
+  grep "Eigenvalue lambda" ${TNAME}.out.$i.lobpcg.5 > ${TNAME}.testdata
+  grep "Eigenvalue lambda" ${TNAME}.out.$i.lobpcg.5.contig > ${TNAME}.testdata.temp
+  diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+done
+
+FILES="\
+ ${TNAME}.out.1.lobpcg.5.contig\
+ ${TNAME}.out.2.lobpcg.5.contig\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -21 $i | head -11
+done > ${TNAME}.out.c
+
 # put all of the output files together
 cat ${TNAME}.out.[a-z] > ${TNAME}.out
 
@@ -41,6 +41,9 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp  >&2
 tail -3 ${TNAME}.out.34 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.35 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp  >&2
+tail -3 ${TNAME}.out.36 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.37 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp  >&2
 
 tail -3 ${TNAME}.out.40 > ${TNAME}.testdata
 tail -3 ${TNAME}.out.41 > ${TNAME}.testdata.temp
@@ -8,6 +8,55 @@ TNAME=`basename $0 .sh`
 RTOL=$1
 ATOL=$2
 
+#=============================================================================
+# struct: Tiled red/black Gauss-Seidel should give the same results
+#=============================================================================
+
+tail -3 ${TNAME}.out.5 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.7 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.8 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# struct: Red/black Gauss-Seidel with color-split storage should give the
+# same results
+#=============================================================================
+
+tail -3 ${TNAME}.out.5 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.11 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.7 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.12 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.13 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.14 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.17 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.18 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# struct: Box-level threading should give the same results
+#=============================================================================
+
+tail -3 ${TNAME}.out.15 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.16 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# struct: Zebra line Gauss-Seidel should not depend on the distribution
+#=============================================================================
+
+tail -3 ${TNAME}.out.9 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.10 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -18,6 +67,7 @@ FILES="\
  ${TNAME}.out.2\
  ${TNAME}.out.3\
  ${TNAME}.out.4\
+ ${TNAME}.out.9\
 "
 
 for i in $FILES
@@ -114,9 +114,13 @@ main( hypre_int argc,
    HYPRE_Int           arg_index;
    HYPRE_Int           print_usage;
    HYPRE_Int           log_level = 0;
+   HYPRE_Int           repro_reductions = 0;
+   HYPRE_Int           nthreads = 0;
    HYPRE_Int           sparsity_known = 0;
    HYPRE_Int           add = 0;
    HYPRE_Int           check_constant = 0;
+   HYPRE_Int           frozen = 0;
+   HYPRE_Int           adopt = 0;
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
    HYPRE_Int           omp_flag = 0;
@@ -138,6 +142,8 @@ main( hypre_int argc,
    HYPRE_Int           num_components = 1;
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
+   HYPRE_Int           hybrid_cost_model = 0;
+   HYPRE_Real          hybrid_scale = 1.0;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
@@ -370,6 +376,8 @@ main( hypre_int argc,
 
    HYPRE_Int    print_system = 0;
    HYPRE_Int    print_system_binary = 0;
+   HYPRE_Int    print_system_mpiio = 0;
+   HYPRE_Int    print_system_mm = 0;
    HYPRE_Int    rel_change = 0;
    HYPRE_Int    second_time = 0;
    HYPRE_Int    benchmark = 0;
@@ -381,6 +389,7 @@ main( hypre_int argc,
 
    HYPRE_Int  lobpcgFlag = 0;
    HYPRE_Int  lobpcgGen = 0;
+   HYPRE_Int  lobpcgContig = 0;
    HYPRE_Int  constrained = 0;
    HYPRE_Int  vFromFileFlag = 0;
    HYPRE_Int  lobpcgSeed = 0;
@@ -393,6 +402,9 @@ main( hypre_int argc,
    HYPRE_Int  two_norm = 1;
    HYPRE_Int  skip_break = 0;
    HYPRE_Int  flex = 0;
+   HYPRE_Real ir_tol = 0.0;
+   HYPRE_Int  ir_single = 0;
+   HYPRE_Solver ir_solver = NULL;
    HYPRE_Int  pcgIterations = 0;
    HYPRE_Int  pcgMode = 1;
    HYPRE_Real pcgTol = 1e-2;
@@ -701,12 +713,34 @@ main( hypre_int argc,
          arg_index++;
          log_level = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-repro") == 0 )
+      {
+         arg_index++;
+         repro_reductions = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         nthreads = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-frombinfile") == 0 )
       {
          arg_index++;
          build_matrix_type      = -2;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-frommpiiofile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -3;
+         build_matrix_arg_index = arg_index;
+      }
+      else if ( strcmp(argv[arg_index], "-frommmfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -4;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-fromfile") == 0 )
       {
          arg_index++;
@@ -845,6 +879,16 @@ main( hypre_int argc,
          arg_index++;
          check_constant = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-frozen") == 0 )
+      {
+         arg_index++;
+         frozen = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-adopt") == 0 )
+      {
+         arg_index++;
+         adopt = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-concrete_parcsr") == 0 )
       {
          arg_index++;
@@ -1234,6 +1278,12 @@ main( hypre_int argc,
          arg_index++;
          lobpcgFlag = 1;
       }
+      else if ( strcmp(argv[arg_index], "-contigmv") == 0 )
+      {
+         /* lobpcg: contiguous multivectors */
+         arg_index++;
+         lobpcgContig = 1;
+      }
       else if ( strcmp(argv[arg_index], "-gen") == 0 )
       {
          /* generalized evp */
@@ -1965,6 +2015,16 @@ main( hypre_int argc,
          arg_index++;
          solver_type  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-hybrid_cost") == 0 )
+      {
+         arg_index++;
+         hybrid_cost_model  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-hybrid_scale") == 0 )
+      {
+         arg_index++;
+         hybrid_scale  = (HYPRE_Real)atof(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-recompute") == 0 )
       {
          arg_index++;
@@ -1991,6 +2051,16 @@ main( hypre_int argc,
          arg_index++;
          flex  = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ir_tol") == 0 )
+      {
+         arg_index++;
+         ir_tol  = (HYPRE_Real)atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ir_single") == 0 )
+      {
+         arg_index++;
+         ir_single = 1;
+      }
       else if ( strcmp(argv[arg_index], "-var") == 0 )
       {
          arg_index++;
@@ -2196,6 +2266,16 @@ main( hypre_int argc,
          arg_index++;
          print_system_binary = 1;
       }
+      else if ( strcmp(argv[arg_index], "-printmpiio") == 0 )
+      {
+         arg_index++;
+         print_system_mpiio = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-printmm") == 0 )
+      {
+         arg_index++;
+         print_system_mm = 1;
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -2323,10 +2403,17 @@ main( hypre_int argc,
          hypre_printf("      0 = (default) No messaging.\n");
          hypre_printf("      1 = Display memory usage statistics for each MPI rank.\n");
          hypre_printf("      2 = Display aggregate memory usage statistics over MPI ranks.\n");
+         hypre_printf("  -repro                     : reproducible inner products/norms\n");
+         hypre_printf("                               (PCG prints its full-precision residual history)\n");
+         hypre_printf("  -nthreads <n>              : number of OpenMP threads\n");
          hypre_printf("  -fromfile <filename>       : ");
          hypre_printf("matrix read from multiple files (IJ format)\n");
          hypre_printf("  -frombinfile <filename>    : ");
          hypre_printf("matrix read from multiple binary files (IJ format)\n");
+         hypre_printf("  -frommpiiofile <filename>  : ");
+         hypre_printf("matrix read from a single MPI-IO binary file\n");
+         hypre_printf("  -frommmfile <filename>     : ");
+         hypre_printf("matrix read from a Matrix Market file\n");
          hypre_printf("  -fromparcsrfile <filename> : ");
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
@@ -2524,6 +2611,8 @@ main( hypre_int argc,
          hypre_printf("                         : 1  PCG  (default)\n");
          hypre_printf("                         : 2  GMRES\n");
          hypre_printf("                         : 3  BiCGSTAB\n");
+         hypre_printf("  -hybrid_cost <val>     : use cost model for the switch to AMG in Hybrid solver\n");
+         hypre_printf("  -hybrid_scale <val>    : scale A by val before the second Hybrid solve\n");
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
@@ -2533,6 +2622,8 @@ main( hypre_int argc,
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -ir_tol  <val>         : wrap PCG solvers in iterative refinement, inner tol = val\n");
+         hypre_printf("  -ir_single             : with -ir_tol, run the inner PCG on single-precision data\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
@@ -2558,6 +2649,8 @@ main( hypre_int argc,
          hypre_printf("       0=no debugging\n       1=internal timing\n       2=interpolation truncation\n       3=more detailed timing in coarsening routine\n");
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
+         hypre_printf("  -printmpiio            : print out the matrix to a single MPI-IO file\n");
+         hypre_printf("  -printmm               : print out the matrix in Matrix Market format\n");
          hypre_printf("\n");
          /* begin lobpcg */
 
@@ -2565,6 +2658,10 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -lobpcg                 : run LOBPCG instead of PCG\n");
          hypre_printf("\n");
+         hypre_printf("  -contigmv               : store blocks of vectors contiguously and\n");
+         hypre_printf("                            use BLAS-3 for block operations (not with\n");
+         hypre_printf("                            -vfromfile or -con)\n");
+         hypre_printf("\n");
          hypre_printf("  -gen                    : solve generalized EVP with B = Laplacian\n");
          hypre_printf("\n");
          hypre_printf("  -con                    : solve constrained EVP using 'vectors.*.*'\n");
@@ -2782,6 +2879,14 @@ main( hypre_int argc,
    /* Set log level */
    HYPRE_SetLogLevel(log_level);
 
+   /* Reproducible global reductions */
+   HYPRE_SetReproducibleReductions(repro_reductions);
+
+   if (nthreads > 0)
+   {
+      hypre_SetNumThreads(nthreads);
+   }
+
    /* default memory location */
    HYPRE_SetMemoryLocation(memory_location);
 
@@ -2825,6 +2930,26 @@ main( hypre_int argc,
          hypre_MPI_Abort(comm, 1);
       }
    }
+   else if ( build_matrix_type == -3 )
+   {
+      ierr = HYPRE_IJMatrixReadMPIIO( argv[build_matrix_arg_index], comm,
+                                      HYPRE_PARCSR, &ij_A );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+   }
+   else if ( build_matrix_type == -4 )
+   {
+      ierr = HYPRE_IJMatrixReadMM( argv[build_matrix_arg_index], comm,
+                                   HYPRE_PARCSR, &ij_A );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         hypre_MPI_Abort(comm, 1);
+      }
+   }
    else if ( build_matrix_type == -1 )
    {
       ierr = HYPRE_IJMatrixRead( argv[build_matrix_arg_index], comm,
@@ -2963,7 +3088,12 @@ main( hypre_int argc,
    {
       hypre_ParCSRMatrixMigrate(parcsr_A, HYPRE_MEMORY_HOST);
 
-      HYPRE_Int mx_size = 5;
+      HYPRE_Int     mx_size     = 5;
+      HYPRE_Int     frozen_nnz  = 0;
+      HYPRE_BigInt *frozen_rows = NULL;
+      HYPRE_BigInt *frozen_cols = NULL;
+      HYPRE_Real   *frozen_data = NULL;
+
       time_index = hypre_InitializeTiming("Generate IJ matrix");
       hypre_BeginTiming(time_index);
 
@@ -3100,6 +3230,27 @@ main( hypre_int argc,
          ierr = HYPRE_IJMatrixSetRowSizes ( ij_A, (const HYPRE_Int *) row_sizes );
       }
 
+      /* keep the entries in COO form to update them through a frozen pattern */
+      if (frozen)
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            frozen_nnz += num_cols[i];
+         }
+         frozen_rows = hypre_TAlloc(HYPRE_BigInt, frozen_nnz, HYPRE_MEMORY_HOST);
+         frozen_cols = hypre_TAlloc(HYPRE_BigInt, frozen_nnz, HYPRE_MEMORY_HOST);
+         frozen_data = hypre_TAlloc(HYPRE_Real,   frozen_nnz, HYPRE_MEMORY_HOST);
+         for (i = 0, j_indx = 0; i < num_rows; i++)
+         {
+            for (j = 0; j < num_cols[i]; j++, j_indx++)
+            {
+               frozen_rows[j_indx] = row_nums[i];
+               frozen_cols[j_indx] = col_nums[j_indx];
+               frozen_data[j_indx] = data[j_indx];
+            }
+         }
+      }
+
       ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
 
       if (omp_flag)
@@ -3188,6 +3339,83 @@ main( hypre_int argc,
 
       ierr += HYPRE_IJMatrixAssemble( ij_A );
 
+      /* Rewrite the values through a frozen pattern: set twice the values,
+         then add their negatives.  Contributions to the same entry are
+         summed, so this reproduces the matrix built with -add 1.  Frozen
+         patterns are only supported for host memory */
+      if (frozen && hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Warning: -frozen is ignored for device memory.\n");
+         }
+      }
+      else if (frozen)
+      {
+         ierr += HYPRE_IJMatrixFreezePattern( ij_A, frozen_nnz, frozen_rows, frozen_cols );
+         for (i = 0; i < frozen_nnz; i++)
+         {
+            frozen_data[i] *= 2.0;
+         }
+         ierr += HYPRE_IJMatrixSetFrozenValues( ij_A, (const HYPRE_Real *) frozen_data );
+         for (i = 0; i < frozen_nnz; i++)
+         {
+            frozen_data[i] *= -0.5;
+         }
+         ierr += HYPRE_IJMatrixAddToFrozenValues( ij_A, (const HYPRE_Real *) frozen_data );
+      }
+      hypre_TFree(frozen_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(frozen_cols, HYPRE_MEMORY_HOST);
+      hypre_TFree(frozen_data, HYPRE_MEMORY_HOST);
+
+      /* Rebuild the assembled matrix from its local rows in CSR format,
+         handing the arrays over to hypre.  Only supported for host memory */
+      if (adopt && hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Warning: -adopt is ignored for device memory.\n");
+         }
+      }
+      else if (adopt)
+      {
+         HYPRE_IJMatrix      ij_B;
+         HYPRE_ParCSRMatrix  parcsr_B;
+         HYPRE_Int          *adopt_ptr;
+         HYPRE_BigInt       *adopt_cols;
+         HYPRE_Real         *adopt_data;
+
+         ierr += HYPRE_IJMatrixGetObject( ij_A, &object );
+         parcsr_B = (HYPRE_ParCSRMatrix) object;
+
+         adopt_ptr = hypre_TAlloc(HYPRE_Int, local_num_rows + 1, HYPRE_MEMORY_HOST);
+         adopt_ptr[0] = 0;
+         for (i = 0; i < local_num_rows; i++)
+         {
+            ierr += HYPRE_ParCSRMatrixGetRow(parcsr_B, first_local_row + i, &size, NULL, NULL);
+            adopt_ptr[i + 1] = adopt_ptr[i] + size;
+            ierr += HYPRE_ParCSRMatrixRestoreRow(parcsr_B, first_local_row + i, &size, NULL, NULL);
+         }
+         adopt_cols = hypre_TAlloc(HYPRE_BigInt, adopt_ptr[local_num_rows], HYPRE_MEMORY_HOST);
+         adopt_data = hypre_TAlloc(HYPRE_Real,   adopt_ptr[local_num_rows], HYPRE_MEMORY_HOST);
+         for (i = 0; i < local_num_rows; i++)
+         {
+            ierr += HYPRE_ParCSRMatrixGetRow(parcsr_B, first_local_row + i, &size, &col_inds, &values);
+            hypre_TMemcpy(&adopt_cols[adopt_ptr[i]], col_inds, HYPRE_BigInt, size,
+                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            hypre_TMemcpy(&adopt_data[adopt_ptr[i]], values, HYPRE_Real, size,
+                          HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+            ierr += HYPRE_ParCSRMatrixRestoreRow(parcsr_B, first_local_row + i, &size, &col_inds, &values);
+         }
+
+         ierr += HYPRE_IJMatrixCreate( comm, first_local_row, last_local_row,
+                                       first_local_col, last_local_col, &ij_B );
+         ierr += HYPRE_IJMatrixSetObjectType( ij_B, HYPRE_PARCSR );
+         ierr += HYPRE_IJMatrixAdoptCSR( ij_B, adopt_ptr, adopt_cols, adopt_data, 1 );
+         ierr += HYPRE_IJMatrixDestroy( ij_A );
+         ij_A = ij_B;
+      }
+
       hypre_EndTiming(time_index);
       hypre_PrintTiming("IJ Matrix Setup", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
@@ -4060,6 +4288,29 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x0");
    }
 
+   if (print_system_mpiio)
+   {
+      if (ij_A)
+      {
+         HYPRE_IJMatrixPrintMPIIO(ij_A, "IJ.out.A.mpiio");
+      }
+      else
+      {
+         hypre_ParCSRMatrixPrintMPIIO(parcsr_A, 0, 0, "IJ.out.A.mpiio");
+      }
+   }
+
+   if (print_system_mm)
+   {
+      hypre_CSRMatrix *A_CSR = hypre_ParCSRMatrixToCSRMatrixAll(parcsr_A);
+
+      if (myid == 0)
+      {
+         hypre_CSRMatrixPrintMM(A_CSR, 1, 1, 0, "IJ.out.A.mtx");
+      }
+      hypre_CSRMatrixDestroy(A_CSR);
+   }
+
    if (print_system_binary)
    {
       if (ij_A)
@@ -4310,6 +4561,7 @@ main( hypre_int argc,
       HYPRE_ParCSRHybridSetAbsoluteTol(amg_solver, atol);
       HYPRE_ParCSRHybridSetConvergenceTol(amg_solver, cf_tol);
       HYPRE_ParCSRHybridSetSolverType(amg_solver, solver_type);
+      HYPRE_ParCSRHybridSetCostModel(amg_solver, hybrid_cost_model);
       HYPRE_ParCSRHybridSetRecomputeResidual(amg_solver, recompute_res);
       HYPRE_ParCSRHybridSetLogging(amg_solver, ioutdat);
       HYPRE_ParCSRHybridSetPrintLevel(amg_solver, poutdat);
@@ -4385,6 +4637,13 @@ main( hypre_int argc,
 #endif
          hypre_ParVectorCopy(x0_save, x);
 
+         /* change the matrix values, e.g., to check that a cached setup is
+            not reused */
+         if (hybrid_scale != 1.0)
+         {
+            hypre_ParCSRMatrixScale(parcsr_A, hybrid_scale);
+         }
+
          if (myid == 0) { hypre_printf("Solver:  AMG\n"); }
          time_index = hypre_InitializeTiming("AMG_hybrid Setup");
          hypre_BeginTiming(time_index);
@@ -5544,9 +5803,40 @@ main( hypre_int argc,
          hypre_printf("HYPRE_ParCSRPCGGetPrecond got good precond\n");
       }
 
+      if (ir_tol > 0.0)
+      {
+         /* use PCG as the inner solver of iterative refinement */
+         HYPRE_ParCSRIRCreate(&ir_solver);
+         HYPRE_ParCSRIRSetTol(ir_solver, tol);
+         HYPRE_ParCSRIRSetAbsoluteTol(ir_solver, atol);
+         HYPRE_ParCSRIRSetPrintLevel(ir_solver, ioutdat);
+         if (ir_single)
+         {
+            if (myid == 0) { hypre_printf("Solver: IR with single-precision inner PCG tol %e\n", ir_tol); }
+            HYPRE_ParCSRIRSetInnerPrecision(ir_solver, 1);
+         }
+         else
+         {
+            if (myid == 0) { hypre_printf("Solver: IR with inner PCG tol %e\n", ir_tol); }
+         }
+         HYPRE_PCGSetTol(pcg_solver, ir_tol);
+         HYPRE_PCGSetPrintLevel(pcg_solver, 0);
+         HYPRE_ParCSRIRSetInnerSolver(ir_solver,
+                                      (HYPRE_PtrToParSolverFcn) HYPRE_ParCSRPCGSolve,
+                                      (HYPRE_PtrToParSolverFcn) HYPRE_ParCSRPCGSetup,
+                                      pcg_solver);
+      }
+
       hypre_GpuProfilingPushRange("PCG-Setup-1");
-      HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_M,
-                     (HYPRE_Vector) b, (HYPRE_Vector) x);
+      if (ir_solver)
+      {
+         HYPRE_ParCSRIRSetup(ir_solver, parcsr_M, b, x);
+      }
+      else
+      {
+         HYPRE_PCGSetup(pcg_solver, (HYPRE_Matrix) parcsr_M,
+                        (HYPRE_Vector) b, (HYPRE_Vector) x);
+      }
       hypre_GpuProfilingPopRange();
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -5556,8 +5846,15 @@ main( hypre_int argc,
       time_index = hypre_InitializeTiming("PCG Solve");
       hypre_BeginTiming(time_index);
       hypre_GpuProfilingPushRange("PCG-Solve-1");
-      HYPRE_PCGSolve(pcg_solver, (HYPRE_Matrix)parcsr_A,
-                     (HYPRE_Vector)b, (HYPRE_Vector)x);
+      if (ir_solver)
+      {
+         HYPRE_ParCSRIRSolve(ir_solver, parcsr_A, b, x);
+      }
+      else
+      {
+         HYPRE_PCGSolve(pcg_solver, (HYPRE_Matrix)parcsr_A,
+                        (HYPRE_Vector)b, (HYPRE_Vector)x);
+      }
       hypre_GpuProfilingPopRange();
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Solve phase times", hypre_MPI_COMM_WORLD);
@@ -5617,8 +5914,33 @@ main( hypre_int argc,
 #endif
       }
 
-      HYPRE_PCGGetNumIterations(pcg_solver, &num_iterations);
-      HYPRE_PCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+      if (ir_solver)
+      {
+         HYPRE_ParCSRIRGetNumIterations(ir_solver, &num_iterations);
+         HYPRE_ParCSRIRGetFinalRelativeResidualNorm(ir_solver, &final_res_norm);
+         HYPRE_ParCSRIRDestroy(ir_solver);
+         ir_solver = NULL;
+      }
+      else
+      {
+         HYPRE_PCGGetNumIterations(pcg_solver, &num_iterations);
+         HYPRE_PCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
+
+         /* all digits are needed to check that runs agree bitwise */
+         if (repro_reductions && myid == 0)
+         {
+            HYPRE_Real *res_norms;
+
+            HYPRE_PCGGetResidualNorms(pcg_solver, &res_norms);
+            if (res_norms)
+            {
+               for (i = 0; i <= num_iterations; i++)
+               {
+                  hypre_printf("Residual norm[%d] = %.17e\n", i, res_norms[i]);
+               }
+            }
+         }
+      }
 
       HYPRE_ParCSRPCGDestroy(pcg_solver);
 
@@ -5697,8 +6019,16 @@ main( hypre_int argc,
    {
       interpreter = hypre_CTAlloc(mv_InterfaceInterpreter, 1, HYPRE_MEMORY_HOST);
 
-      HYPRE_ParCSRSetupInterpreter( interpreter );
-      HYPRE_ParCSRSetupMatvec(&matvec_fn);
+      if ( lobpcgContig && !vFromFileFlag && !constrained )
+      {
+         HYPRE_ParCSRSetupContigInterpreter( interpreter );
+         HYPRE_ParCSRSetupContigMatvec(&matvec_fn);
+      }
+      else
+      {
+         HYPRE_ParCSRSetupInterpreter( interpreter );
+         HYPRE_ParCSRSetupMatvec(&matvec_fn);
+      }
 
       if (myid != 0)
       {
@@ -9314,7 +9644,8 @@ final:
 
    HYPRE_ParVectorDestroy(x0_save);
 
-   if (test_ij || build_matrix_type == -1 || build_matrix_type == -2)
+   if (test_ij || build_matrix_type == -1 || build_matrix_type == -2 ||
+       build_matrix_type == -3 || build_matrix_type == -4)
    {
       if (ij_A)
       {
@@ -1233,6 +1233,243 @@ DestroyData( ProblemData   data )
    return 0;
 }
 
+/*--------------------------------------------------------------------------
+ * Build the FAC linear system of a distributed problem. This is the same
+ * system that main builds for the FAC solvers.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+BuildFACSystem( ProblemData           data,
+                HYPRE_SStructGrid    *grid_ptr,
+                HYPRE_SStructGraph   *graph_ptr,
+                HYPRE_SStructMatrix  *A_ptr,
+                HYPRE_SStructVector  *b_ptr,
+                HYPRE_SStructVector  *x_ptr )
+{
+   HYPRE_SStructGrid     grid;
+   HYPRE_SStructStencil *stencils;
+   HYPRE_SStructGraph    graph;
+   HYPRE_SStructMatrix   A;
+   HYPRE_SStructVector   b, x;
+   ProblemPartData       pdata;
+   HYPRE_Int            *plevels;
+   Index                *prefinements;
+   Index                 ilower, iupper;
+   Index                 index, to_index;
+   HYPRE_Real           *values;
+   HYPRE_Int             part, box, var, entry, s, i, j, k;
+
+   HYPRE_SStructGridCreate(hypre_MPI_COMM_WORLD, data.ndim, data.nparts, &grid);
+   for (part = 0; part < data.nparts; part++)
+   {
+      pdata = data.pdata[part];
+      for (box = 0; box < pdata.nboxes; box++)
+      {
+         HYPRE_SStructGridSetExtents(grid, part,
+                                     pdata.ilowers[box], pdata.iuppers[box]);
+      }
+      HYPRE_SStructGridSetVariables(grid, part, pdata.nvars, pdata.vartypes);
+      HYPRE_SStructGridSetPeriodic(grid, part, pdata.periodic);
+   }
+   HYPRE_SStructGridAssemble(grid);
+
+   stencils = hypre_CTAlloc(HYPRE_SStructStencil,  data.nstencils, HYPRE_MEMORY_HOST);
+   for (s = 0; s < data.nstencils; s++)
+   {
+      HYPRE_SStructStencilCreate(data.ndim, data.stencil_sizes[s],
+                                 &stencils[s]);
+      for (i = 0; i < data.stencil_sizes[s]; i++)
+      {
+         HYPRE_SStructStencilSetEntry(stencils[s], i,
+                                      data.stencil_offsets[s][i],
+                                      data.stencil_vars[s][i]);
+      }
+   }
+
+   plevels      = hypre_TAlloc(HYPRE_Int,  data.nparts, HYPRE_MEMORY_HOST);
+   prefinements = hypre_TAlloc(Index,  data.nparts, HYPRE_MEMORY_HOST);
+   for (part = 0; part < data.nparts; part++)
+   {
+      pdata = data.pdata[part];
+      plevels[part] = pdata.fac_plevel;
+      for (i = 0; i < data.ndim; i++)
+      {
+         prefinements[part][i] = pdata.fac_prefinement[i];
+      }
+   }
+
+   /* graph */
+   HYPRE_SStructGraphCreate(hypre_MPI_COMM_WORLD, grid, &graph);
+   for (part = 0; part < data.nparts; part++)
+   {
+      pdata = data.pdata[part];
+      for (var = 0; var < pdata.nvars; var++)
+      {
+         HYPRE_SStructGraphSetStencil(graph, part, var,
+                                      stencils[pdata.stencil_num[var]]);
+      }
+      for (entry = 0; entry < pdata.graph_nentries; entry++)
+      {
+         for (index[2] = pdata.graph_ilowers[entry][2];
+              index[2] <= pdata.graph_iuppers[entry][2];
+              index[2] += pdata.graph_strides[entry][2])
+         {
+            for (index[1] = pdata.graph_ilowers[entry][1];
+                 index[1] <= pdata.graph_iuppers[entry][1];
+                 index[1] += pdata.graph_strides[entry][1])
+            {
+               for (index[0] = pdata.graph_ilowers[entry][0];
+                    index[0] <= pdata.graph_iuppers[entry][0];
+                    index[0] += pdata.graph_strides[entry][0])
+               {
+                  for (i = 0; i < 3; i++)
+                  {
+                     j = pdata.graph_index_maps[entry][i];
+                     k = index[i] - pdata.graph_ilowers[entry][i];
+                     k /= pdata.graph_strides[entry][i];
+                     k *= pdata.graph_index_signs[entry][i];
+                     to_index[j] = pdata.graph_to_ilowers[entry][j] +
+                                   k * pdata.graph_to_strides[entry][j];
+                  }
+                  HYPRE_SStructGraphAddEntries(graph, part, index,
+                                               pdata.graph_vars[entry],
+                                               pdata.graph_to_parts[entry],
+                                               to_index,
+                                               pdata.graph_to_vars[entry]);
+               }
+            }
+         }
+      }
+   }
+   HYPRE_SStructGraphAssemble(graph);
+
+   /* matrix */
+   values = hypre_TAlloc(HYPRE_Real,  data.max_boxsize, HYPRE_MEMORY_HOST);
+
+   HYPRE_SStructMatrixCreate(hypre_MPI_COMM_WORLD, graph, &A);
+   HYPRE_SStructMatrixInitialize(A);
+   for (part = 0; part < data.nparts; part++)
+   {
+      pdata = data.pdata[part];
+      for (var = 0; var < pdata.nvars; var++)
+      {
+         s = pdata.stencil_num[var];
+         for (i = 0; i < data.stencil_sizes[s]; i++)
+         {
+            for (j = 0; j < pdata.max_boxsize; j++)
+            {
+               values[j] = data.stencil_values[s][i];
+            }
+            for (box = 0; box < pdata.nboxes; box++)
+            {
+               GetVariableBox(pdata.ilowers[box], pdata.iuppers[box],
+                              pdata.vartypes[var], ilower, iupper);
+               HYPRE_SStructMatrixSetBoxValues(A, part, ilower, iupper,
+                                               var, 1, &i, values);
+            }
+         }
+      }
+      for (entry = 0; entry < pdata.graph_nentries; entry++)
+      {
+         for (index[2] = pdata.graph_ilowers[entry][2];
+              index[2] <= pdata.graph_iuppers[entry][2];
+              index[2] += pdata.graph_strides[entry][2])
+         {
+            for (index[1] = pdata.graph_ilowers[entry][1];
+                 index[1] <= pdata.graph_iuppers[entry][1];
+                 index[1] += pdata.graph_strides[entry][1])
+            {
+               for (index[0] = pdata.graph_ilowers[entry][0];
+                    index[0] <= pdata.graph_iuppers[entry][0];
+                    index[0] += pdata.graph_strides[entry][0])
+               {
+                  HYPRE_SStructMatrixSetValues(A, part, index,
+                                               pdata.graph_vars[entry],
+                                               1, &pdata.graph_entries[entry],
+                                               &pdata.graph_values[entry]);
+               }
+            }
+         }
+      }
+      for (entry = 0; entry < pdata.matrix_nentries; entry++)
+      {
+         for (index[2] = pdata.matrix_ilowers[entry][2];
+              index[2] <= pdata.matrix_iuppers[entry][2];
+              index[2] += pdata.matrix_strides[entry][2])
+         {
+            for (index[1] = pdata.matrix_ilowers[entry][1];
+                 index[1] <= pdata.matrix_iuppers[entry][1];
+                 index[1] += pdata.matrix_strides[entry][1])
+            {
+               for (index[0] = pdata.matrix_ilowers[entry][0];
+                    index[0] <= pdata.matrix_iuppers[entry][0];
+                    index[0] += pdata.matrix_strides[entry][0])
+               {
+                  HYPRE_SStructMatrixSetValues(A, part, index,
+                                               pdata.matrix_vars[entry],
+                                               1, &pdata.matrix_entries[entry],
+                                               &pdata.matrix_values[entry]);
+               }
+            }
+         }
+      }
+   }
+   for (part = data.nparts - 1; part > 0; part--)
+   {
+      HYPRE_SStructFACZeroCFSten(A, grid, part, prefinements[part]);
+      HYPRE_SStructFACZeroFCSten(A, grid, part);
+      HYPRE_SStructFACZeroAMRMatrixData(A, part - 1, prefinements[part]);
+   }
+   HYPRE_SStructMatrixAssemble(A);
+
+   /* right-hand side and initial guess */
+   for (j = 0; j < data.max_boxsize; j++)
+   {
+      values[j] = 1.0;
+   }
+   HYPRE_SStructVectorCreate(hypre_MPI_COMM_WORLD, grid, &b);
+   HYPRE_SStructVectorInitialize(b);
+   HYPRE_SStructVectorCreate(hypre_MPI_COMM_WORLD, grid, &x);
+   HYPRE_SStructVectorInitialize(x);
+   for (part = 0; part < data.nparts; part++)
+   {
+      pdata = data.pdata[part];
+      for (var = 0; var < pdata.nvars; var++)
+      {
+         for (box = 0; box < pdata.nboxes; box++)
+         {
+            GetVariableBox(pdata.ilowers[box], pdata.iuppers[box], var,
+                           ilower, iupper);
+            HYPRE_SStructVectorSetBoxValues(b, part, ilower, iupper,
+                                            var, values);
+            HYPRE_SStructVectorSetBoxValues(x, part, ilower, iupper,
+                                            var, values);
+         }
+      }
+   }
+   HYPRE_SStructFACZeroAMRVectorData(b, plevels, prefinements);
+   HYPRE_SStructVectorAssemble(b);
+   HYPRE_SStructFACZeroAMRVectorData(x, plevels, prefinements);
+   HYPRE_SStructVectorAssemble(x);
+
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(plevels, HYPRE_MEMORY_HOST);
+   hypre_TFree(prefinements, HYPRE_MEMORY_HOST);
+   for (s = 0; s < data.nstencils; s++)
+   {
+      HYPRE_SStructStencilDestroy(stencils[s]);
+   }
+   hypre_TFree(stencils, HYPRE_MEMORY_HOST);
+
+   *grid_ptr  = grid;
+   *graph_ptr = graph;
+   *A_ptr     = A;
+   *b_ptr     = b;
+   *x_ptr     = x;
+
+   return 0;
+}
+
 /*--------------------------------------------------------------------------
  * Test driver for semi-structured matrix interface
  *--------------------------------------------------------------------------*/
@@ -1252,8 +1489,12 @@ main( hypre_int argc,
    Index                *block;
    HYPRE_Int                   solver_id;
    HYPRE_Int                   print_system;
+   HYPRE_Int                   num_setups;
+   HYPRE_Int                   regrid;
+   char                 *presetup_infile;
+   ProblemData           presetup_data;
 
-   HYPRE_SStructGrid     grid;
+   HYPRE_SStructGrid     grid, new_grid;
    HYPRE_SStructStencil *stencils;
    HYPRE_SStructGraph    graph;
    HYPRE_SStructMatrix   A, A_amg;
@@ -1263,6 +1504,11 @@ main( hypre_int argc,
    HYPRE_StructVector    sx;
    HYPRE_SStructSolver   solver;
 
+   HYPRE_SStructGrid     pre_grid;
+   HYPRE_SStructGraph    pre_graph;
+   HYPRE_SStructMatrix   pre_A;
+   HYPRE_SStructVector   pre_b, pre_x;
+
    HYPRE_ParCSRMatrix    par_A;
    HYPRE_ParVector       par_b;
    HYPRE_ParVector       par_x;
@@ -1352,6 +1598,9 @@ main( hypre_int argc,
 
    solver_id = 39;
    print_system = 0;
+   num_setups = 1;
+   regrid = 0;
+   presetup_infile = NULL;
 
    /*-----------------------------------------------------------
     * Parse command line
@@ -1420,6 +1669,25 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-setups") == 0 )
+      {
+         /* repeat the FAC setup; later setups reuse the c/f interface boxes */
+         arg_index++;
+         num_setups = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-regrid") == 0 )
+      {
+         /* rebuild the grid from the assembled one with its boxes reordered */
+         arg_index++;
+         regrid = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-presetup") == 0 )
+      {
+         /* set up FAC on the problem of another input file first, so that
+            the setup of this problem regrids the c/f interface cache */
+         arg_index++;
+         presetup_infile = argv[arg_index++];
+      }
       else if ( strcmp(argv[arg_index], "-v") == 0 )
       {
          arg_index++;
@@ -1439,6 +1707,21 @@ main( hypre_int argc,
    DistributeData(global_data, refine, distribute, block,
                   num_procs, myid, &data);
 
+   if (presetup_infile)
+   {
+      ReadData(presetup_infile, &global_data);
+      if (global_data.nparts != data.nparts)
+      {
+         if (myid == 0)
+         {
+            hypre_printf("Error: -presetup problem must have %d parts\n", data.nparts);
+         }
+         exit(1);
+      }
+      DistributeData(global_data, refine, distribute, block,
+                     num_procs, myid, &presetup_data);
+   }
+
    /*-----------------------------------------------------------
     * Synchronize so that timings make sense
     *-----------------------------------------------------------*/
@@ -1485,6 +1768,27 @@ main( hypre_int argc,
    }
    HYPRE_SStructGridAssemble(grid);
 
+   /* remove the first box of each part and add it back at the end, which
+      changes the box numbering on each process with more than one box */
+   if (regrid)
+   {
+      HYPRE_SStructGridRegrid(grid, &new_grid);
+      for (part = 0; part < data.nparts; part++)
+      {
+         pdata = data.pdata[part];
+         if (pdata.nboxes > 0)
+         {
+            HYPRE_SStructGridRemoveExtents(new_grid, part,
+                                           pdata.ilowers[0], pdata.iuppers[0]);
+            HYPRE_SStructGridSetExtents(new_grid, part,
+                                        pdata.ilowers[0], pdata.iuppers[0]);
+         }
+      }
+      HYPRE_SStructGridAssemble(new_grid);
+      HYPRE_SStructGridDestroy(grid);
+      grid = new_grid;
+   }
+
    /*-----------------------------------------------------------
     * Set up the stencils
     *-----------------------------------------------------------*/
@@ -2014,7 +2318,20 @@ main( hypre_int argc,
       HYPRE_SStructFACSetNumPostRelax(solver, n_post);
       HYPRE_SStructFACSetCoarseSolverType(solver, 2);
       HYPRE_SStructFACSetLogging(solver, 1);
-      HYPRE_SStructFACSetup2(solver, A, b, x);
+      if (presetup_infile)
+      {
+         BuildFACSystem(presetup_data, &pre_grid, &pre_graph, &pre_A, &pre_b, &pre_x);
+         HYPRE_SStructFACSetup2(solver, pre_A, pre_b, pre_x);
+         HYPRE_SStructGridDestroy(pre_grid);
+         HYPRE_SStructGraphDestroy(pre_graph);
+         HYPRE_SStructMatrixDestroy(pre_A);
+         HYPRE_SStructVectorDestroy(pre_b);
+         HYPRE_SStructVectorDestroy(pre_x);
+      }
+      for (i = 0; i < num_setups; i++)
+      {
+         HYPRE_SStructFACSetup2(solver, A, b, x);
+      }
 
       hypre_EndTiming(time_index);
       hypre_PrintTiming("Setup phase times", hypre_MPI_COMM_WORLD);
@@ -2253,6 +2570,10 @@ main( hypre_int argc,
    hypre_TFree(prefinements, HYPRE_MEMORY_HOST);
 
    DestroyData(data);
+   if (presetup_infile)
+   {
+      DestroyData(presetup_data);
+   }
 
    hypre_TFree(parts, HYPRE_MEMORY_HOST);
    hypre_TFree(refine, HYPRE_MEMORY_HOST);
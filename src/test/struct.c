@@ -50,6 +50,25 @@ HYPRE_Int AddValuesVector( hypre_StructGrid  *gridvector,
                            HYPRE_Int          *period,
                            HYPRE_Real         value  )  ;
 
+/* coefficients of the (nonsymmetric) matrix-free operator, in stencil order */
+typedef struct
+{
+   HYPRE_Int   dim;
+   HYPRE_Real  values[7];
+
+} MatrixFreeData;
+
+HYPRE_Int SetMatrixFreeData(MatrixFreeData *mf_data, HYPRE_Int dim,
+                            HYPRE_Real      cx,
+                            HYPRE_Real      cy,
+                            HYPRE_Real      cz,
+                            HYPRE_Real      conx,
+                            HYPRE_Real      cony,
+                            HYPRE_Real      conz);
+
+HYPRE_Int MatrixFreeCoeffs(void *data, HYPRE_Int entry, HYPRE_Int *ilower, HYPRE_Int *iupper,
+                           HYPRE_Complex *values);
+
 /*--------------------------------------------------------------------------
  * Test driver for structured matrix interface (structured storage)
  *--------------------------------------------------------------------------*/
@@ -104,6 +123,9 @@ main( hypre_int argc,
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
+   HYPRE_Int           relax_tiling;
+   HYPRE_Int           relax_color_split;
+   HYPRE_Int           box_threads;
    HYPRE_Real          jacobi_weight;
    HYPRE_Int           usr_jacobi_weight;
    HYPRE_Int           jump;
@@ -142,6 +164,12 @@ main( hypre_int argc,
    HYPRE_Int           solver_print_level = 0;
    HYPRE_Int           log_level = 0;
    HYPRE_Int           print_system = 0;
+   char               *checkpoint_name = NULL;
+   char               *restart_name = NULL;
+   HYPRE_Int           matrix_free = 0;
+   MatrixFreeData      mf_data;
+   HYPRE_Real         *mf_values;
+   char                filename[HYPRE_MAX_FILE_NAME_LEN];
 #if defined(HYPRE_USING_MEMORY_TRACKER)
    HYPRE_Int           print_mem_tracker = 0;
    char                mem_tracker_name[HYPRE_MAX_FILE_NAME_LEN] = {0};
@@ -249,6 +277,9 @@ main( hypre_int argc,
    sym  = 1;
    rap = 0;
    relax = 1;
+   relax_tiling = 0;
+   relax_color_split = 0;
+   box_threads = 0;
    jacobi_weight = 1.0;
    usr_jacobi_weight = 0;
    jump  = 0;
@@ -425,6 +456,21 @@ main( hypre_int argc,
          arg_index++;
          relax = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-rbtile") == 0 )
+      {
+         arg_index++;
+         relax_tiling = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-rbsplit") == 0 )
+      {
+         arg_index++;
+         relax_color_split = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-boxthreads") == 0 )
+      {
+         arg_index++;
+         box_threads = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-w") == 0 )
       {
          arg_index++;
@@ -466,6 +512,21 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-checkpoint") == 0 )
+      {
+         arg_index++;
+         checkpoint_name = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-restart") == 0 )
+      {
+         arg_index++;
+         restart_name = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-matrix_free") == 0 )
+      {
+         arg_index++;
+         matrix_free = 1;
+      }
       else if ( strcmp(argv[arg_index], "-pout") == 0 )
       {
          arg_index++;
@@ -613,6 +674,9 @@ main( hypre_int argc,
 
    HYPRE_SetGpuAwareMPI(gpu_aware_mpi);
 
+   /* box-level threading for struct kernels */
+   HYPRE_SetStructBoxThreads(box_threads);
+
    /* begin lobpcg */
 
    if ( solver_id == 0 && lobpcgFlag )
@@ -691,6 +755,10 @@ main( hypre_int argc,
       hypre_printf("                        1 - Weighted Jacobi (default)\n");
       hypre_printf("                        2 - R/B Gauss-Seidel\n");
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
+      hypre_printf("                        4 - zebra line Gauss-Seidel (PFMG)\n");
+      hypre_printf("  -rbtile <k>         : R/B Gauss-Seidel iterations per tiled pass\n");
+      hypre_printf("  -rbsplit <s>        : R/B Gauss-Seidel with color-split storage (1) or not (0)\n");
+      hypre_printf("  -boxthreads <v>     : thread over whole boxes of average volume <= v\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
@@ -701,6 +769,11 @@ main( hypre_int argc,
       hypre_printf("  -recompute <bool>   : Recompute residual in PCG?\n");
       hypre_printf("  -cf <cf>            : convergence factor for Hybrid\n");
       hypre_printf("  -print              : print out the system\n");
+      hypre_printf("  -checkpoint <name>  : write A and b to binary files <name>.A/.b\n");
+      hypre_printf("  -restart <name>     : read A and b from binary files <name>.A/.b\n");
+      hypre_printf("                        (same grid and stencil, any distribution)\n");
+      hypre_printf("  -matrix_free        : evaluate the variable coefficients of A on the fly\n");
+      hypre_printf("                        (nonsymmetric storage; not with solvers 3, 13)\n");
       hypre_printf("  -pout <val>         : print level for the preconditioner\n");
       hypre_printf("  -sout <val>         : print level for the solver\n");
       hypre_printf("  -ll <val>           : hypre's log level\n");
@@ -786,6 +859,33 @@ main( hypre_int argc,
       sym = 0;
    }
 
+   if (matrix_free && (solver_id == 3 || solver_id == 13))
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Warning: Matrix-free operator needs a variable diagonal, ignoring -matrix_free\n");
+      }
+      matrix_free = 0;
+   }
+
+   if (matrix_free && relax > 1)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Warning: Matrix-free PFMG needs Jacobi relaxation, ignoring -matrix_free\n");
+      }
+      matrix_free = 0;
+   }
+
+   if (matrix_free && sym == 1)
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Warning: Matrix-free operator uses non-symmetric storage\n");
+      }
+      sym = 0;
+   }
+
    /*-----------------------------------------------------------
     * Print driver parameters
     *-----------------------------------------------------------*/
@@ -1175,20 +1275,51 @@ main( hypre_int argc,
          }
 
          HYPRE_StructMatrixSetSymmetric(A, sym);
+         if (matrix_free)
+         {
+            SetMatrixFreeData(&mf_data, dim, cx, cy, cz, conx, cony, conz);
+            HYPRE_StructMatrixSetCoeffFcn(A, MatrixFreeCoeffs, &mf_data);
+         }
          HYPRE_StructMatrixInitialize(A);
 
          /*-----------------------------------------------------------
           * Fill in the matrix elements
           *-----------------------------------------------------------*/
 
-         AddValuesMatrix(A, grid, cx, cy, cz, conx, cony, conz);
+         if (matrix_free)
+         {
+            /* Only the constant off-diagonal entries are stored.  Couplings
+             * to the real boundary are dropped by the matrix-free matvec. */
+            if ( constant_coefficient == 2 )
+            {
+               stencil_size    = 2 * dim;
+               stencil_entries = hypre_CTAlloc(HYPRE_Int, stencil_size, HYPRE_MEMORY_HOST);
+               mf_values       = hypre_CTAlloc(HYPRE_Real, stencil_size, HYPRE_MEMORY_HOST);
+               for (i = 0, s = 0; s < 2 * dim + 1; s++)
+               {
+                  if (s != dim)
+                  {
+                     stencil_entries[i] = s;
+                     mf_values[i] = mf_data.values[s];
+                     i++;
+                  }
+               }
+               HYPRE_StructMatrixSetConstantValues(A, stencil_size, stencil_entries, mf_values);
+               hypre_TFree(stencil_entries, HYPRE_MEMORY_HOST);
+               hypre_TFree(mf_values, HYPRE_MEMORY_HOST);
+            }
+         }
+         else
+         {
+            AddValuesMatrix(A, grid, cx, cy, cz, conx, cony, conz);
 
-         /* Zero out stencils reaching to real boundary */
-         /* But in constant coefficient case, no special stencils! */
+            /* Zero out stencils reaching to real boundary */
+            /* But in constant coefficient case, no special stencils! */
 
-         if ( constant_coefficient == 0 )
-         {
-            SetStencilBndry(A, grid, periodic);
+            if ( constant_coefficient == 0 )
+            {
+               SetStencilBndry(A, grid, periodic);
+            }
          }
          HYPRE_StructMatrixAssemble(A);
          /*-----------------------------------------------------------
@@ -1438,6 +1569,28 @@ main( hypre_int argc,
          hypre_FinalizeTiming(time_index);
       }
 
+      /*-----------------------------------------------------------
+       * Write or restore a binary checkpoint of the system
+       *-----------------------------------------------------------*/
+
+      if (checkpoint_name)
+      {
+         hypre_sprintf(filename, "%s.A", checkpoint_name);
+         HYPRE_StructMatrixPrintBinary(filename, A);
+         hypre_sprintf(filename, "%s.b", checkpoint_name);
+         HYPRE_StructVectorPrintBinary(filename, b);
+      }
+
+      if (restart_name)
+      {
+         hypre_sprintf(filename, "%s.A", restart_name);
+         HYPRE_StructMatrixReadBinary(filename, A);
+         HYPRE_StructMatrixAssemble(A);
+         hypre_sprintf(filename, "%s.b", restart_name);
+         HYPRE_StructVectorReadBinary(filename, b);
+         HYPRE_StructVectorAssemble(b);
+      }
+
       /*-----------------------------------------------------------
        * Print out the system and initial guess
        *-----------------------------------------------------------*/
@@ -1535,6 +1688,8 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetRelChange(solver, 0);
          HYPRE_StructPFMGSetRAPType(solver, rap);
          HYPRE_StructPFMGSetRelaxType(solver, relax);
+         HYPRE_StructPFMGSetRelaxTiling(solver, relax_tiling);
+         HYPRE_StructPFMGSetRelaxColorSplit(solver, relax_color_split);
          if (usr_jacobi_weight)
          {
             HYPRE_StructPFMGSetJacobiWeight(solver, jacobi_weight);
@@ -1717,6 +1872,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetZeroGuess(precond);
             HYPRE_StructPFMGSetRAPType(precond, rap);
             HYPRE_StructPFMGSetRelaxType(precond, relax);
+            HYPRE_StructPFMGSetRelaxTiling(precond, relax_tiling);
+            HYPRE_StructPFMGSetRelaxColorSplit(precond, relax_color_split);
             if (usr_jacobi_weight)
             {
                HYPRE_StructPFMGSetJacobiWeight(precond, jacobi_weight);
@@ -1886,6 +2043,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetZeroGuess(precond);
                HYPRE_StructPFMGSetRAPType(precond, rap);
                HYPRE_StructPFMGSetRelaxType(precond, relax);
+               HYPRE_StructPFMGSetRelaxTiling(precond, relax_tiling);
+               HYPRE_StructPFMGSetRelaxColorSplit(precond, relax_color_split);
                if (usr_jacobi_weight)
                {
                   HYPRE_StructPFMGSetJacobiWeight(precond, jacobi_weight);
@@ -2137,6 +2296,8 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetZeroGuess(precond);
                HYPRE_StructPFMGSetRAPType(precond, rap);
                HYPRE_StructPFMGSetRelaxType(precond, relax);
+               HYPRE_StructPFMGSetRelaxTiling(precond, relax_tiling);
+               HYPRE_StructPFMGSetRelaxColorSplit(precond, relax_color_split);
                if (usr_jacobi_weight)
                {
                   HYPRE_StructPFMGSetJacobiWeight(precond, jacobi_weight);
@@ -2400,6 +2561,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetZeroGuess(precond);
             HYPRE_StructPFMGSetRAPType(precond, rap);
             HYPRE_StructPFMGSetRelaxType(precond, relax);
+            HYPRE_StructPFMGSetRelaxTiling(precond, relax_tiling);
+            HYPRE_StructPFMGSetRelaxColorSplit(precond, relax_color_split);
             if (usr_jacobi_weight)
             {
                HYPRE_StructPFMGSetJacobiWeight(precond, jacobi_weight);
@@ -2524,6 +2687,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetZeroGuess(precond);
             HYPRE_StructPFMGSetRAPType(precond, rap);
             HYPRE_StructPFMGSetRelaxType(precond, relax);
+            HYPRE_StructPFMGSetRelaxTiling(precond, relax_tiling);
+            HYPRE_StructPFMGSetRelaxColorSplit(precond, relax_color_split);
             if (usr_jacobi_weight)
             {
                HYPRE_StructPFMGSetJacobiWeight(precond, jacobi_weight);
@@ -2675,6 +2840,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetZeroGuess(precond);
             HYPRE_StructPFMGSetRAPType(precond, rap);
             HYPRE_StructPFMGSetRelaxType(precond, relax);
+            HYPRE_StructPFMGSetRelaxTiling(precond, relax_tiling);
+            HYPRE_StructPFMGSetRelaxColorSplit(precond, relax_color_split);
             if (usr_jacobi_weight)
             {
                HYPRE_StructPFMGSetJacobiWeight(precond, jacobi_weight);
@@ -2826,6 +2993,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetZeroGuess(precond);
             HYPRE_StructPFMGSetRAPType(precond, rap);
             HYPRE_StructPFMGSetRelaxType(precond, relax);
+            HYPRE_StructPFMGSetRelaxTiling(precond, relax_tiling);
+            HYPRE_StructPFMGSetRelaxColorSplit(precond, relax_color_split);
             if (usr_jacobi_weight)
             {
                HYPRE_StructPFMGSetJacobiWeight(precond, jacobi_weight);
@@ -2924,6 +3093,8 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetZeroGuess(precond);
             HYPRE_StructPFMGSetRAPType(precond, rap);
             HYPRE_StructPFMGSetRelaxType(precond, relax);
+            HYPRE_StructPFMGSetRelaxTiling(precond, relax_tiling);
+            HYPRE_StructPFMGSetRelaxColorSplit(precond, relax_color_split);
             if (usr_jacobi_weight)
             {
                HYPRE_StructPFMGSetJacobiWeight(precond, jacobi_weight);
@@ -3075,6 +3246,87 @@ main( hypre_int argc,
    return (0);
 }
 
+/*-------------------------------------------------------------------------
+ * Compute the nonsymmetric stencil coefficients used by AddValuesMatrix
+ * for the matrix-free operator.
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+SetMatrixFreeData(MatrixFreeData *mf_data,
+                  HYPRE_Int       dim,
+                  HYPRE_Real      cx,
+                  HYPRE_Real      cy,
+                  HYPRE_Real      cz,
+                  HYPRE_Real      conx,
+                  HYPRE_Real      cony,
+                  HYPRE_Real      conz)
+{
+   HYPRE_Real  lower[3], upper[3], center;
+   HYPRE_Real  c[3], con[3];
+   HYPRE_Int   d;
+
+   c[0] = cx;   c[1] = cy;   c[2] = cz;
+   con[0] = conx; con[1] = cony; con[2] = conz;
+
+   center = 0.0;
+   for (d = 0; d < dim; d++)
+   {
+      lower[d] = -c[d];
+      upper[d] = -c[d];
+      center  += 2.0 * c[d];
+
+      /* upwind convection */
+      if (con[d] > 0.0)
+      {
+         lower[d] -= con[d];
+         center   += con[d];
+      }
+      else if (con[d] < 0.0)
+      {
+         upper[d] += con[d];
+         center   -= con[d];
+      }
+   }
+
+   (mf_data -> dim) = dim;
+   for (d = 0; d < dim; d++)
+   {
+      (mf_data -> values)[d]           = lower[d];
+      (mf_data -> values)[dim + 1 + d] = upper[d];
+   }
+   (mf_data -> values)[dim] = center;
+
+   return 0;
+}
+
+/*-------------------------------------------------------------------------
+ * Coefficient callback for the matrix-free operator: stencil entry 'entry'
+ * at every point of the box [ilower, iupper].
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+MatrixFreeCoeffs(void          *data,
+                 HYPRE_Int      entry,
+                 HYPRE_Int     *ilower,
+                 HYPRE_Int     *iupper,
+                 HYPRE_Complex *values)
+{
+   MatrixFreeData  *mf_data = (MatrixFreeData *) data;
+   HYPRE_Int        volume, d, i;
+
+   volume = 1;
+   for (d = 0; d < (mf_data -> dim); d++)
+   {
+      volume *= (iupper[d] - ilower[d] + 1);
+   }
+   for (i = 0; i < volume; i++)
+   {
+      values[i] = (mf_data -> values)[entry];
+   }
+
+   return 0;
+}
+
 /*-------------------------------------------------------------------------
  * add constant values to a vector. Need to pass the initialized vector, grid,
  * period of grid and the constant value.
@@ -23,6 +23,26 @@ HYPRE_SetLogLevel( HYPRE_Int log_level )
    return hypre_SetLogLevel(log_level);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_SetReproducibleReductions
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetReproducibleReductions( HYPRE_Int reproducible )
+{
+   return hypre_SetReproducibleReductions(reproducible);
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetStructBoxThreads
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetStructBoxThreads( HYPRE_Int max_box_volume )
+{
+   return hypre_SetStructBoxThreads(max_box_volume);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_SetSpTransUseVendor
  *--------------------------------------------------------------------------*/
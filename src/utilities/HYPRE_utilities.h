@@ -468,6 +468,54 @@ HYPRE_Int HYPRE_SetGPUMemoryPoolSize(HYPRE_Int bin_growth, HYPRE_Int min_bin, HY
  **/
 HYPRE_Int HYPRE_SetLogLevel(HYPRE_Int log_level);
 
+/**
+ * Enables bitwise-reproducible global reductions.
+ *
+ * When \e reproducible is nonzero, the inner products (and hence norms) of
+ * ParCSR vectors computed on the host give the same bits independently of
+ * the number of OpenMP threads and MPI ranks.  Each term is split into a
+ * few fixed-point "folds" whose sums are exact, so the order of summation
+ * does not matter.  This costs one extra (max) reduction per inner product
+ * and a few flops per entry.  Device inner products are not affected.
+ *
+ * @note Only the reductions are made reproducible.  Sparse matrix-vector
+ *       products split each row into on- and off-process parts, so results
+ *       may still differ in the last bits between different numbers of MPI
+ *       ranks (but not between different numbers of threads).
+ *
+ * @note hypre must not be compiled with value-unsafe floating point
+ *       optimizations (e.g., -ffast-math) for this to hold.
+ *
+ * @param reproducible 0 (default) to use plain summation, 1 for
+ *                     reproducible summation.
+ *
+ * @return Returns hypre's global error code, where 0 indicates success.
+ **/
+HYPRE_Int HYPRE_SetReproducibleReductions(HYPRE_Int reproducible);
+
+/**
+ * Enables box-level threading in the struct kernels.
+ *
+ * By default, the struct kernels (matvec, axpy, inner products, and point
+ * relaxation) use OpenMP threads within each box, one box after the other.
+ * On grids with many small boxes (e.g., coarse multigrid levels or AMR
+ * grids), each box is too small to keep the threads busy.  When
+ * \e max_box_volume is positive, boxes whose average number of points is at
+ * most \e max_box_volume are instead handed out whole to the threads as they
+ * become idle, and each box is traversed by one thread.  This has no effect
+ * without OpenMP, on a single thread, or in device builds.
+ *
+ * @note Nested OpenMP parallelism should be disabled (the default), since
+ *       the loops within each box still contain parallel regions.
+ *
+ * @param max_box_volume 0 (default) to thread within boxes, otherwise the
+ *                       largest average box volume for which whole boxes
+ *                       are threaded (e.g., 4096).
+ *
+ * @return Returns hypre's global error code, where 0 indicates success.
+ **/
+HYPRE_Int HYPRE_SetStructBoxThreads(HYPRE_Int max_box_volume);
+
 /**
  * Specifies the algorithm used for sparse matrix transposition in device builds.
  *
@@ -50,6 +50,8 @@ typedef void (*GPUMfreeFunc)(void *);
 typedef struct
 {
    HYPRE_Int              log_level;
+   HYPRE_Int              reproducible_reductions;
+   HYPRE_Int              struct_box_threads;
    HYPRE_Int              hypre_error;
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
@@ -98,6 +100,8 @@ typedef struct
 
 /* accessor macros to hypre_Handle */
 #define hypre_HandleLogLevel(hypre_handle)                       ((hypre_handle) -> log_level)
+#define hypre_HandleReproducibleReductions(hypre_handle)         ((hypre_handle) -> reproducible_reductions)
+#define hypre_HandleStructBoxThreads(hypre_handle)               ((hypre_handle) -> struct_box_threads)
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 
@@ -327,6 +331,26 @@ typedef double                 hypre_double;
 #endif
 #endif
 
+#ifndef hypre_frexp
+#if defined(HYPRE_SINGLE)
+#define hypre_frexp frexpf
+#elif defined(HYPRE_LONG_DOUBLE)
+#define hypre_frexp frexpl
+#else
+#define hypre_frexp frexp
+#endif
+#endif
+
+#ifndef hypre_ldexp
+#if defined(HYPRE_SINGLE)
+#define hypre_ldexp ldexpf
+#elif defined(HYPRE_LONG_DOUBLE)
+#define hypre_ldexp ldexpl
+#else
+#define hypre_ldexp ldexp
+#endif
+#endif
+
 #ifndef hypre_exp
 #if defined(HYPRE_SINGLE)
 #define hypre_exp expf
@@ -754,6 +778,8 @@ extern "C" {
 #define MPI_Op              hypre_MPI_Op
 #define MPI_Aint            hypre_MPI_Aint
 #define MPI_Info            hypre_MPI_Info
+#define MPI_File            hypre_MPI_File
+#define MPI_Offset          hypre_MPI_Offset
 
 #define MPI_COMM_WORLD       hypre_MPI_COMM_WORLD
 #define MPI_COMM_NULL        hypre_MPI_COMM_NULL
@@ -783,6 +809,7 @@ extern "C" {
 #define MPI_BOR             hypre_MPI_BOR
 #define MPI_SUCCESS         hypre_MPI_SUCCESS
 #define MPI_STATUSES_IGNORE hypre_MPI_STATUSES_IGNORE
+#define MPI_STATUS_IGNORE   hypre_MPI_STATUS_IGNORE
 
 #define MPI_UNDEFINED       hypre_MPI_UNDEFINED
 #define MPI_REQUEST_NULL    hypre_MPI_REQUEST_NULL
@@ -791,6 +818,10 @@ extern "C" {
 #define MPI_ANY_TAG         hypre_MPI_ANY_TAG
 #define MPI_SOURCE          hypre_MPI_SOURCE
 #define MPI_TAG             hypre_MPI_TAG
+#define MPI_MODE_RDONLY     hypre_MPI_MODE_RDONLY
+#define MPI_MODE_WRONLY     hypre_MPI_MODE_WRONLY
+#define MPI_MODE_CREATE     hypre_MPI_MODE_CREATE
+#define MPI_ORDER_FORTRAN   hypre_MPI_ORDER_FORTRAN
 
 #define MPI_Init            hypre_MPI_Init
 #define MPI_Finalize        hypre_MPI_Finalize
@@ -844,10 +875,19 @@ extern "C" {
 #define MPI_Type_struct     hypre_MPI_Type_struct
 #define MPI_Type_commit     hypre_MPI_Type_commit
 #define MPI_Type_free       hypre_MPI_Type_free
+#define MPI_Type_create_subarray hypre_MPI_Type_create_subarray
 #define MPI_Op_free         hypre_MPI_Op_free
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_File_open       hypre_MPI_File_open
+#define MPI_File_close      hypre_MPI_File_close
+#define MPI_File_set_size   hypre_MPI_File_set_size
+#define MPI_File_get_size   hypre_MPI_File_get_size
+#define MPI_File_set_view   hypre_MPI_File_set_view
+#define MPI_File_read_at    hypre_MPI_File_read_at
+#define MPI_File_read_at_all  hypre_MPI_File_read_at_all
+#define MPI_File_write_at_all hypre_MPI_File_write_at_all
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -870,6 +910,10 @@ typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
 
+/* Files are accessed with stdio */
+typedef FILE      *hypre_MPI_File;
+typedef long long  hypre_MPI_Offset;
+
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
@@ -897,6 +941,13 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_BOR 5
 #define  hypre_MPI_SUCCESS 0
 #define  hypre_MPI_STATUSES_IGNORE 0
+#define  hypre_MPI_STATUS_IGNORE 0
+
+#define  hypre_MPI_MODE_RDONLY 1
+#define  hypre_MPI_MODE_WRONLY 2
+#define  hypre_MPI_MODE_CREATE 4
+
+#define  hypre_MPI_ORDER_FORTRAN 1
 
 #define  hypre_MPI_UNDEFINED -9999
 #define  hypre_MPI_REQUEST_NULL  0
@@ -919,6 +970,8 @@ typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
 typedef MPI_User_function    hypre_MPI_User_function;
+typedef MPI_File     hypre_MPI_File;
+typedef MPI_Offset   hypre_MPI_Offset;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
@@ -946,6 +999,13 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_BOR MPI_BOR
 #define  hypre_MPI_SUCCESS MPI_SUCCESS
 #define  hypre_MPI_STATUSES_IGNORE MPI_STATUSES_IGNORE
+#define  hypre_MPI_STATUS_IGNORE MPI_STATUS_IGNORE
+
+#define  hypre_MPI_MODE_RDONLY MPI_MODE_RDONLY
+#define  hypre_MPI_MODE_WRONLY MPI_MODE_WRONLY
+#define  hypre_MPI_MODE_CREATE MPI_MODE_CREATE
+
+#define  hypre_MPI_ORDER_FORTRAN MPI_ORDER_FORTRAN
 
 #define  hypre_MPI_UNDEFINED       MPI_UNDEFINED
 #define  hypre_MPI_REQUEST_NULL    MPI_REQUEST_NULL
@@ -1055,9 +1115,30 @@ HYPRE_Int hypre_MPI_Type_struct( HYPRE_Int count, HYPRE_Int *array_of_blocklengt
                                  hypre_MPI_Datatype *newtype );
 HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
+HYPRE_Int hypre_MPI_Type_create_subarray( HYPRE_Int ndims, HYPRE_Int *array_of_sizes,
+                                          HYPRE_Int *array_of_subsizes, HYPRE_Int *array_of_starts,
+                                          HYPRE_Int order, hypre_MPI_Datatype oldtype,
+                                          hypre_MPI_Datatype *newtype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_File_open( hypre_MPI_Comm comm, const char *filename, HYPRE_Int amode,
+                               hypre_MPI_Info info, hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_close( hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_set_size( hypre_MPI_File fh, hypre_MPI_Offset size );
+HYPRE_Int hypre_MPI_File_get_size( hypre_MPI_File fh, hypre_MPI_Offset *size );
+HYPRE_Int hypre_MPI_File_set_view( hypre_MPI_File fh, hypre_MPI_Offset disp, hypre_MPI_Datatype etype,
+                                   hypre_MPI_Datatype filetype, const char *datarep,
+                                   hypre_MPI_Info info );
+HYPRE_Int hypre_MPI_File_read_at( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                  HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                  hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_read_at_all( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                      HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                      hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_write_at_all( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                       HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                       hypre_MPI_Status *status );
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
@@ -2163,6 +2244,9 @@ void hypre_dense_topo_sort(const HYPRE_Complex *L, HYPRE_Int *ordering, HYPRE_In
 HYPRE_Int hypre_DoubleQuickSplit ( HYPRE_Real *values, HYPRE_Int *indices, HYPRE_Int list_length,
                                    HYPRE_Int NumberKept );
 
+/* radix_sort.c */
+HYPRE_Int hypre_BigRadixSortbi ( HYPRE_Int n, HYPRE_BigInt *v, HYPRE_Int *w );
+
 /* random.c */
 /* HYPRE_CUDA_GLOBAL */ void hypre_SeedRand ( HYPRE_Int seed );
 /* HYPRE_CUDA_GLOBAL */ HYPRE_Int hypre_RandI ( void );
@@ -2435,6 +2519,10 @@ HYPRE_Int hypre_GetSyncCudaCompute(HYPRE_Int *cuda_compute_stream_sync_ptr);
 
 /* handle.c */
 HYPRE_Int hypre_SetLogLevel( HYPRE_Int log_level );
+HYPRE_Int hypre_SetReproducibleReductions( HYPRE_Int reproducible );
+HYPRE_Int hypre_GetReproducibleReductions( void );
+HYPRE_Int hypre_SetStructBoxThreads( HYPRE_Int max_box_volume );
+HYPRE_Int hypre_GetStructBoxThreads( void );
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
@@ -3946,3 +4034,4 @@ HYPRE_Int hypre_mm_read_mtx_crd_size(FILE *f, HYPRE_Int *M, HYPRE_Int *N, HYPRE_
 #endif
 
 #endif
+
@@ -35,6 +35,8 @@ hypre_HandleCreate(void)
    hypre_Handle *hypre_handle_ = (hypre_Handle*) calloc(1, sizeof(hypre_Handle));
 
    hypre_HandleLogLevel(hypre_handle_) = 0;
+   hypre_HandleReproducibleReductions(hypre_handle_) = 0;
+   hypre_HandleStructBoxThreads(hypre_handle_) = 0;
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
 
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
@@ -139,6 +139,26 @@ typedef double                 hypre_double;
 #endif
 #endif
 
+#ifndef hypre_frexp
+#if defined(HYPRE_SINGLE)
+#define hypre_frexp frexpf
+#elif defined(HYPRE_LONG_DOUBLE)
+#define hypre_frexp frexpl
+#else
+#define hypre_frexp frexp
+#endif
+#endif
+
+#ifndef hypre_ldexp
+#if defined(HYPRE_SINGLE)
+#define hypre_ldexp ldexpf
+#elif defined(HYPRE_LONG_DOUBLE)
+#define hypre_ldexp ldexpl
+#else
+#define hypre_ldexp ldexp
+#endif
+#endif
+
 #ifndef hypre_exp
 #if defined(HYPRE_SINGLE)
 #define hypre_exp expf
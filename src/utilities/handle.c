@@ -26,6 +26,56 @@ hypre_SetLogLevel(HYPRE_Int log_level)
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_SetReproducibleReductions
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetReproducibleReductions( HYPRE_Int reproducible )
+{
+   hypre_HandleReproducibleReductions(hypre_handle()) = reproducible;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GetReproducibleReductions
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GetReproducibleReductions( void )
+{
+   return hypre_HandleReproducibleReductions(hypre_handle());
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SetStructBoxThreads
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SetStructBoxThreads( HYPRE_Int max_box_volume )
+{
+   if (max_box_volume < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleStructBoxThreads(hypre_handle()) = max_box_volume;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GetStructBoxThreads
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GetStructBoxThreads( void )
+{
+   return hypre_HandleStructBoxThreads(hypre_handle());
+}
+
 /*--------------------------------------------------------------------------
  * hypre_SetSpTransUseVendor
  *--------------------------------------------------------------------------*/
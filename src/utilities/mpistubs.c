@@ -871,6 +871,25 @@ hypre_MPI_Type_free( hypre_MPI_Datatype *datatype )
    return (0);
 }
 
+HYPRE_Int
+hypre_MPI_Type_create_subarray( HYPRE_Int           ndims,
+                                HYPRE_Int          *array_of_sizes,
+                                HYPRE_Int          *array_of_subsizes,
+                                HYPRE_Int          *array_of_starts,
+                                HYPRE_Int           order,
+                                hypre_MPI_Datatype  oldtype,
+                                hypre_MPI_Datatype *newtype )
+{
+   HYPRE_UNUSED_VAR(ndims);
+   HYPRE_UNUSED_VAR(array_of_sizes);
+   HYPRE_UNUSED_VAR(array_of_subsizes);
+   HYPRE_UNUSED_VAR(array_of_starts);
+   HYPRE_UNUSED_VAR(order);
+   HYPRE_UNUSED_VAR(oldtype);
+   HYPRE_UNUSED_VAR(newtype);
+   return (0);
+}
+
 HYPRE_Int
 hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre_MPI_Op *op )
 {
@@ -887,6 +906,147 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return (0);
 }
 
+/* Size in bytes of the basic datatypes used with the file routines below */
+static size_t
+hypre_MPI_TypeSize( hypre_MPI_Datatype datatype )
+{
+   switch (datatype)
+   {
+      case hypre_MPI_FLOAT:         return sizeof(float);
+      case hypre_MPI_DOUBLE:        return sizeof(double);
+      case hypre_MPI_LONG_DOUBLE:   return sizeof(long double);
+      case hypre_MPI_INT:           return sizeof(HYPRE_Int);
+      case hypre_MPI_CHAR:          return sizeof(char);
+      case hypre_MPI_LONG:          return sizeof(hypre_longint);
+      case hypre_MPI_REAL:          return sizeof(HYPRE_Real);
+      case hypre_MPI_COMPLEX:       return sizeof(HYPRE_Complex);
+      case hypre_MPI_LONG_LONG_INT: return sizeof(HYPRE_BigInt);
+      default:                      return 1;
+   }
+}
+
+HYPRE_Int
+hypre_MPI_File_open( hypre_MPI_Comm      comm,
+                     const char         *filename,
+                     HYPRE_Int           amode,
+                     hypre_MPI_Info      info,
+                     hypre_MPI_File     *fh )
+{
+   HYPRE_UNUSED_VAR(comm);
+   HYPRE_UNUSED_VAR(info);
+
+   /* Note that an existing file is truncated when opened for writing */
+   *fh = fopen(filename, (amode & hypre_MPI_MODE_RDONLY) ? "rb" : "wb");
+
+   return (*fh == NULL);
+}
+
+HYPRE_Int
+hypre_MPI_File_close( hypre_MPI_File *fh )
+{
+   HYPRE_Int ierr = (HYPRE_Int) fclose(*fh);
+
+   *fh = NULL;
+
+   return ierr;
+}
+
+HYPRE_Int
+hypre_MPI_File_set_size( hypre_MPI_File   fh,
+                         hypre_MPI_Offset size )
+{
+   HYPRE_UNUSED_VAR(fh);
+   HYPRE_UNUSED_VAR(size);
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_File_get_size( hypre_MPI_File    fh,
+                         hypre_MPI_Offset *size )
+{
+   long end;
+
+   if (fseek(fh, 0, SEEK_END) != 0 || (end = ftell(fh)) < 0)
+   {
+      return (1);
+   }
+   *size = (hypre_MPI_Offset) end;
+
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_File_set_view( hypre_MPI_File      fh,
+                         hypre_MPI_Offset    disp,
+                         hypre_MPI_Datatype  etype,
+                         hypre_MPI_Datatype  filetype,
+                         const char         *datarep,
+                         hypre_MPI_Info      info )
+{
+   HYPRE_UNUSED_VAR(fh);
+   HYPRE_UNUSED_VAR(disp);
+   HYPRE_UNUSED_VAR(etype);
+   HYPRE_UNUSED_VAR(filetype);
+   HYPRE_UNUSED_VAR(datarep);
+   HYPRE_UNUSED_VAR(info);
+   return (0);
+}
+
+HYPRE_Int
+hypre_MPI_File_read_at( hypre_MPI_File      fh,
+                        hypre_MPI_Offset    offset,
+                        void               *buf,
+                        HYPRE_Int           count,
+                        hypre_MPI_Datatype  datatype,
+                        hypre_MPI_Status   *status )
+{
+   size_t size = hypre_MPI_TypeSize(datatype);
+
+   HYPRE_UNUSED_VAR(status);
+   if (count == 0)
+   {
+      return (0);
+   }
+   if (fseek(fh, (long) offset, SEEK_SET) != 0)
+   {
+      return (1);
+   }
+   return (fread(buf, size, (size_t) count, fh) != (size_t) count);
+}
+
+HYPRE_Int
+hypre_MPI_File_read_at_all( hypre_MPI_File      fh,
+                            hypre_MPI_Offset    offset,
+                            void               *buf,
+                            HYPRE_Int           count,
+                            hypre_MPI_Datatype  datatype,
+                            hypre_MPI_Status   *status )
+{
+   return hypre_MPI_File_read_at(fh, offset, buf, count, datatype, status);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at_all( hypre_MPI_File      fh,
+                             hypre_MPI_Offset    offset,
+                             void               *buf,
+                             HYPRE_Int           count,
+                             hypre_MPI_Datatype  datatype,
+                             hypre_MPI_Status   *status )
+{
+   size_t size = hypre_MPI_TypeSize(datatype);
+
+   HYPRE_UNUSED_VAR(status);
+   if (count == 0)
+   {
+      return (0);
+   }
+   if (fseek(fh, (long) offset, SEEK_SET) != 0)
+   {
+      return (1);
+   }
+   return (fwrite(buf, size, (size_t) count, fh) != (size_t) count);
+}
+
 #if defined(HYPRE_USING_GPU)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                      hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
@@ -1546,6 +1706,39 @@ hypre_MPI_Type_free( hypre_MPI_Datatype *datatype )
    return (HYPRE_Int) MPI_Type_free(datatype);
 }
 
+HYPRE_Int
+hypre_MPI_Type_create_subarray( HYPRE_Int           ndims,
+                                HYPRE_Int          *array_of_sizes,
+                                HYPRE_Int          *array_of_subsizes,
+                                HYPRE_Int          *array_of_starts,
+                                HYPRE_Int           order,
+                                hypre_MPI_Datatype  oldtype,
+                                hypre_MPI_Datatype *newtype )
+{
+   hypre_int *mpi_sizes, *mpi_subsizes, *mpi_starts;
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   mpi_sizes    = hypre_TAlloc(hypre_int, ndims, HYPRE_MEMORY_HOST);
+   mpi_subsizes = hypre_TAlloc(hypre_int, ndims, HYPRE_MEMORY_HOST);
+   mpi_starts   = hypre_TAlloc(hypre_int, ndims, HYPRE_MEMORY_HOST);
+   for (i = 0; i < ndims; i++)
+   {
+      mpi_sizes[i]    = (hypre_int) array_of_sizes[i];
+      mpi_subsizes[i] = (hypre_int) array_of_subsizes[i];
+      mpi_starts[i]   = (hypre_int) array_of_starts[i];
+   }
+
+   ierr = (HYPRE_Int) MPI_Type_create_subarray((hypre_int)ndims, mpi_sizes, mpi_subsizes,
+                                               mpi_starts, (hypre_int)order, oldtype, newtype);
+
+   hypre_TFree(mpi_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_subsizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_starts, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+
 HYPRE_Int
 hypre_MPI_Op_free( hypre_MPI_Op *op )
 {
@@ -1558,6 +1751,80 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
+HYPRE_Int
+hypre_MPI_File_open( hypre_MPI_Comm      comm,
+                     const char         *filename,
+                     HYPRE_Int           amode,
+                     hypre_MPI_Info      info,
+                     hypre_MPI_File     *fh )
+{
+   return (HYPRE_Int) MPI_File_open(comm, (char *) filename, (hypre_int)amode, info, fh);
+}
+
+HYPRE_Int
+hypre_MPI_File_close( hypre_MPI_File *fh )
+{
+   return (HYPRE_Int) MPI_File_close(fh);
+}
+
+HYPRE_Int
+hypre_MPI_File_set_size( hypre_MPI_File   fh,
+                         hypre_MPI_Offset size )
+{
+   return (HYPRE_Int) MPI_File_set_size(fh, size);
+}
+
+HYPRE_Int
+hypre_MPI_File_get_size( hypre_MPI_File    fh,
+                         hypre_MPI_Offset *size )
+{
+   return (HYPRE_Int) MPI_File_get_size(fh, size);
+}
+
+HYPRE_Int
+hypre_MPI_File_set_view( hypre_MPI_File      fh,
+                         hypre_MPI_Offset    disp,
+                         hypre_MPI_Datatype  etype,
+                         hypre_MPI_Datatype  filetype,
+                         const char         *datarep,
+                         hypre_MPI_Info      info )
+{
+   return (HYPRE_Int) MPI_File_set_view(fh, disp, etype, filetype, (char *) datarep, info);
+}
+
+HYPRE_Int
+hypre_MPI_File_read_at( hypre_MPI_File      fh,
+                        hypre_MPI_Offset    offset,
+                        void               *buf,
+                        HYPRE_Int           count,
+                        hypre_MPI_Datatype  datatype,
+                        hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_read_at(fh, offset, buf, (hypre_int)count, datatype, status);
+}
+
+HYPRE_Int
+hypre_MPI_File_read_at_all( hypre_MPI_File      fh,
+                            hypre_MPI_Offset    offset,
+                            void               *buf,
+                            HYPRE_Int           count,
+                            hypre_MPI_Datatype  datatype,
+                            hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_read_at_all(fh, offset, buf, (hypre_int)count, datatype, status);
+}
+
+HYPRE_Int
+hypre_MPI_File_write_at_all( hypre_MPI_File      fh,
+                             hypre_MPI_Offset    offset,
+                             void               *buf,
+                             HYPRE_Int           count,
+                             hypre_MPI_Datatype  datatype,
+                             hypre_MPI_Status   *status )
+{
+   return (HYPRE_Int) MPI_File_write_at_all(fh, offset, buf, (hypre_int)count, datatype, status);
+}
+
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
@@ -39,6 +39,8 @@ extern "C" {
 #define MPI_Op              hypre_MPI_Op
 #define MPI_Aint            hypre_MPI_Aint
 #define MPI_Info            hypre_MPI_Info
+#define MPI_File            hypre_MPI_File
+#define MPI_Offset          hypre_MPI_Offset
 
 #define MPI_COMM_WORLD       hypre_MPI_COMM_WORLD
 #define MPI_COMM_NULL        hypre_MPI_COMM_NULL
@@ -68,6 +70,7 @@ extern "C" {
 #define MPI_BOR             hypre_MPI_BOR
 #define MPI_SUCCESS         hypre_MPI_SUCCESS
 #define MPI_STATUSES_IGNORE hypre_MPI_STATUSES_IGNORE
+#define MPI_STATUS_IGNORE   hypre_MPI_STATUS_IGNORE
 
 #define MPI_UNDEFINED       hypre_MPI_UNDEFINED
 #define MPI_REQUEST_NULL    hypre_MPI_REQUEST_NULL
@@ -76,6 +79,10 @@ extern "C" {
 #define MPI_ANY_TAG         hypre_MPI_ANY_TAG
 #define MPI_SOURCE          hypre_MPI_SOURCE
 #define MPI_TAG             hypre_MPI_TAG
+#define MPI_MODE_RDONLY     hypre_MPI_MODE_RDONLY
+#define MPI_MODE_WRONLY     hypre_MPI_MODE_WRONLY
+#define MPI_MODE_CREATE     hypre_MPI_MODE_CREATE
+#define MPI_ORDER_FORTRAN   hypre_MPI_ORDER_FORTRAN
 
 #define MPI_Init            hypre_MPI_Init
 #define MPI_Finalize        hypre_MPI_Finalize
@@ -129,10 +136,19 @@ extern "C" {
 #define MPI_Type_struct     hypre_MPI_Type_struct
 #define MPI_Type_commit     hypre_MPI_Type_commit
 #define MPI_Type_free       hypre_MPI_Type_free
+#define MPI_Type_create_subarray hypre_MPI_Type_create_subarray
 #define MPI_Op_free         hypre_MPI_Op_free
 #define MPI_Op_create       hypre_MPI_Op_create
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
+#define MPI_File_open       hypre_MPI_File_open
+#define MPI_File_close      hypre_MPI_File_close
+#define MPI_File_set_size   hypre_MPI_File_set_size
+#define MPI_File_get_size   hypre_MPI_File_get_size
+#define MPI_File_set_view   hypre_MPI_File_set_view
+#define MPI_File_read_at    hypre_MPI_File_read_at
+#define MPI_File_read_at_all  hypre_MPI_File_read_at_all
+#define MPI_File_write_at_all hypre_MPI_File_write_at_all
 
 /*--------------------------------------------------------------------------
  * Types, etc.
@@ -155,6 +171,10 @@ typedef HYPRE_Int  hypre_MPI_Op;
 typedef HYPRE_Int  hypre_MPI_Aint;
 typedef HYPRE_Int  hypre_MPI_Info;
 
+/* Files are accessed with stdio */
+typedef FILE      *hypre_MPI_File;
+typedef long long  hypre_MPI_Offset;
+
 #define  hypre_MPI_COMM_SELF   1
 #define  hypre_MPI_COMM_WORLD  0
 #define  hypre_MPI_COMM_NULL  -1
@@ -182,6 +202,13 @@ typedef HYPRE_Int  hypre_MPI_Info;
 #define  hypre_MPI_BOR 5
 #define  hypre_MPI_SUCCESS 0
 #define  hypre_MPI_STATUSES_IGNORE 0
+#define  hypre_MPI_STATUS_IGNORE 0
+
+#define  hypre_MPI_MODE_RDONLY 1
+#define  hypre_MPI_MODE_WRONLY 2
+#define  hypre_MPI_MODE_CREATE 4
+
+#define  hypre_MPI_ORDER_FORTRAN 1
 
 #define  hypre_MPI_UNDEFINED -9999
 #define  hypre_MPI_REQUEST_NULL  0
@@ -204,6 +231,8 @@ typedef MPI_Op       hypre_MPI_Op;
 typedef MPI_Aint     hypre_MPI_Aint;
 typedef MPI_Info     hypre_MPI_Info;
 typedef MPI_User_function    hypre_MPI_User_function;
+typedef MPI_File     hypre_MPI_File;
+typedef MPI_Offset   hypre_MPI_Offset;
 
 #define  hypre_MPI_COMM_WORLD         MPI_COMM_WORLD
 #define  hypre_MPI_COMM_NULL          MPI_COMM_NULL
@@ -231,6 +260,13 @@ typedef MPI_User_function    hypre_MPI_User_function;
 #define  hypre_MPI_BOR MPI_BOR
 #define  hypre_MPI_SUCCESS MPI_SUCCESS
 #define  hypre_MPI_STATUSES_IGNORE MPI_STATUSES_IGNORE
+#define  hypre_MPI_STATUS_IGNORE MPI_STATUS_IGNORE
+
+#define  hypre_MPI_MODE_RDONLY MPI_MODE_RDONLY
+#define  hypre_MPI_MODE_WRONLY MPI_MODE_WRONLY
+#define  hypre_MPI_MODE_CREATE MPI_MODE_CREATE
+
+#define  hypre_MPI_ORDER_FORTRAN MPI_ORDER_FORTRAN
 
 #define  hypre_MPI_UNDEFINED       MPI_UNDEFINED
 #define  hypre_MPI_REQUEST_NULL    MPI_REQUEST_NULL
@@ -340,9 +376,30 @@ HYPRE_Int hypre_MPI_Type_struct( HYPRE_Int count, HYPRE_Int *array_of_blocklengt
                                  hypre_MPI_Datatype *newtype );
 HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
+HYPRE_Int hypre_MPI_Type_create_subarray( HYPRE_Int ndims, HYPRE_Int *array_of_sizes,
+                                          HYPRE_Int *array_of_subsizes, HYPRE_Int *array_of_starts,
+                                          HYPRE_Int order, hypre_MPI_Datatype oldtype,
+                                          hypre_MPI_Datatype *newtype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute,
                                hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_File_open( hypre_MPI_Comm comm, const char *filename, HYPRE_Int amode,
+                               hypre_MPI_Info info, hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_close( hypre_MPI_File *fh );
+HYPRE_Int hypre_MPI_File_set_size( hypre_MPI_File fh, hypre_MPI_Offset size );
+HYPRE_Int hypre_MPI_File_get_size( hypre_MPI_File fh, hypre_MPI_Offset *size );
+HYPRE_Int hypre_MPI_File_set_view( hypre_MPI_File fh, hypre_MPI_Offset disp, hypre_MPI_Datatype etype,
+                                   hypre_MPI_Datatype filetype, const char *datarep,
+                                   hypre_MPI_Info info );
+HYPRE_Int hypre_MPI_File_read_at( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                  HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                  hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_read_at_all( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                      HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                      hypre_MPI_Status *status );
+HYPRE_Int hypre_MPI_File_write_at_all( hypre_MPI_File fh, hypre_MPI_Offset offset, void *buf,
+                                       HYPRE_Int count, hypre_MPI_Datatype datatype,
+                                       hypre_MPI_Status *status );
 #if defined(HYPRE_USING_GPU) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key,
                                     hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
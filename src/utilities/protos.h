@@ -112,6 +112,9 @@ void hypre_dense_topo_sort(const HYPRE_Complex *L, HYPRE_Int *ordering, HYPRE_In
 HYPRE_Int hypre_DoubleQuickSplit ( HYPRE_Real *values, HYPRE_Int *indices, HYPRE_Int list_length,
                                    HYPRE_Int NumberKept );
 
+/* radix_sort.c */
+HYPRE_Int hypre_BigRadixSortbi ( HYPRE_Int n, HYPRE_BigInt *v, HYPRE_Int *w );
+
 /* random.c */
 /* HYPRE_CUDA_GLOBAL */ void hypre_SeedRand ( HYPRE_Int seed );
 /* HYPRE_CUDA_GLOBAL */ HYPRE_Int hypre_RandI ( void );
@@ -384,6 +387,10 @@ HYPRE_Int hypre_GetSyncCudaCompute(HYPRE_Int *cuda_compute_stream_sync_ptr);
 
 /* handle.c */
 HYPRE_Int hypre_SetLogLevel( HYPRE_Int log_level );
+HYPRE_Int hypre_SetReproducibleReductions( HYPRE_Int reproducible );
+HYPRE_Int hypre_GetReproducibleReductions( void );
+HYPRE_Int hypre_SetStructBoxThreads( HYPRE_Int max_box_volume );
+HYPRE_Int hypre_GetStructBoxThreads( void );
 HYPRE_Int hypre_SetSpTransUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpMVUseVendor( HYPRE_Int use_vendor );
 HYPRE_Int hypre_SetSpGemmUseVendor( HYPRE_Int use_vendor );
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * Copyright (c) 1998 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#define HYPRE_RADIX_BITS 8
+#define HYPRE_RADIX_SIZE (1 << HYPRE_RADIX_BITS)
+
+/*--------------------------------------------------------------------------
+ * hypre_BigRadixSortbi
+ *
+ * Stable least-significant-digit radix sort of the n keys v into ascending
+ * order, carrying w along.  Keys are sorted relative to their minimum, so
+ * only as many 8-bit passes are made as the key range requires.  Each pass
+ * is threaded: every thread counts the digits of a contiguous chunk, and
+ * the chunks are scattered in thread order, which keeps the sort stable.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BigRadixSortbi( HYPRE_Int     n,
+                      HYPRE_BigInt *v,
+                      HYPRE_Int    *w )
+{
+   HYPRE_Int           num_threads = hypre_NumThreads();
+   HYPRE_Int          *counts;
+   HYPRE_BigInt       *v_in, *v_out, *v_work, *v_swap;
+   HYPRE_Int          *w_in, *w_out, *w_work, *w_swap;
+   HYPRE_BigInt        v_min, v_max;
+   hypre_ulonglongint  range;
+   HYPRE_Int           num_passes, pass, shift;
+   HYPRE_Int           i, d, t, offset, c;
+
+   if (n < 2)
+   {
+      return hypre_error_flag;
+   }
+
+   v_min = v_max = v[0];
+   for (i = 1; i < n; i++)
+   {
+      v_min = hypre_min(v_min, v[i]);
+      v_max = hypre_max(v_max, v[i]);
+   }
+
+   range = (hypre_ulonglongint) v_max - (hypre_ulonglongint) v_min;
+   for (num_passes = 0; range > 0; num_passes++)
+   {
+      range >>= HYPRE_RADIX_BITS;
+   }
+   if (num_passes == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   counts = hypre_TAlloc(HYPRE_Int, num_threads * HYPRE_RADIX_SIZE, HYPRE_MEMORY_HOST);
+   v_work = hypre_TAlloc(HYPRE_BigInt, n, HYPRE_MEMORY_HOST);
+   w_work = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+
+   v_in = v;  v_out = v_work;
+   w_in = w;  w_out = w_work;
+   for (pass = 0; pass < num_passes; pass++)
+   {
+      shift = pass * HYPRE_RADIX_BITS;
+
+#ifdef HYPRE_USING_OPENMP
+      #pragma omp parallel private(i, d, t, offset, c)
+#endif
+      {
+         HYPRE_Int  my_thread_num = hypre_GetThreadNum();
+         HYPRE_Int  nthreads      = hypre_NumActiveThreads();
+         HYPRE_Int  i_per_thread  = (n + nthreads - 1) / nthreads;
+         HYPRE_Int  i_begin       = hypre_min(i_per_thread * my_thread_num, n);
+         HYPRE_Int  i_end         = hypre_min(i_begin + i_per_thread, n);
+         HYPRE_Int *my_counts     = counts + my_thread_num * HYPRE_RADIX_SIZE;
+
+         for (d = 0; d < HYPRE_RADIX_SIZE; d++)
+         {
+            my_counts[d] = 0;
+         }
+         for (i = i_begin; i < i_end; i++)
+         {
+            d = (HYPRE_Int)((((hypre_ulonglongint) v_in[i] - (hypre_ulonglongint) v_min) >> shift)
+                            & (HYPRE_RADIX_SIZE - 1));
+            my_counts[d]++;
+         }
+
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp barrier
+         #pragma omp master
+#endif
+         {
+            /* digit-major, thread-minor starting positions */
+            offset = 0;
+            for (d = 0; d < HYPRE_RADIX_SIZE; d++)
+            {
+               for (t = 0; t < nthreads; t++)
+               {
+                  c = counts[t * HYPRE_RADIX_SIZE + d];
+                  counts[t * HYPRE_RADIX_SIZE + d] = offset;
+                  offset += c;
+               }
+            }
+         }
+#ifdef HYPRE_USING_OPENMP
+         #pragma omp barrier
+#endif
+
+         for (i = i_begin; i < i_end; i++)
+         {
+            d = (HYPRE_Int)((((hypre_ulonglongint) v_in[i] - (hypre_ulonglongint) v_min) >> shift)
+                            & (HYPRE_RADIX_SIZE - 1));
+            c = my_counts[d]++;
+            v_out[c] = v_in[i];
+            w_out[c] = w_in[i];
+         }
+      } /* omp parallel */
+
+      v_swap = v_in;  v_in = v_out;  v_out = v_swap;
+      w_swap = w_in;  w_in = w_out;  w_out = w_swap;
+   }
+
+   if (v_in != v)
+   {
+      hypre_TMemcpy(v, v_in, HYPRE_BigInt, n, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(w, w_in, HYPRE_Int, n, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(v_work, HYPRE_MEMORY_HOST);
+   hypre_TFree(w_work, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}